@@ -15,6 +15,8 @@
 
 #include <QProcess>
 #include <QSharedMemory>
+
+#include "AssignmentClientSharedStats.h"
 #include <QThread>
 #include <QTimer>
 
@@ -156,6 +158,40 @@ void AssignmentClient::setUpStatusToMonitor() {
     // send a stats packet every 1 seconds
     connect(&_statsTimerACM, &QTimer::timeout, this, &AssignmentClient::sendStatusPacketToACM);
     _statsTimerACM.start(1000);
+
+    // if the monitor handed us a shared-memory stats slot, publish heartbeats there at a much
+    // faster cadence - writing a few words, no serialization, no packets
+    auto statsKey = qEnvironmentVariable(AssignmentClientSharedStats::STATS_KEY_ENV);
+    bool slotOk = false;
+    int statsSlot = qEnvironmentVariableIntValue(AssignmentClientSharedStats::STATS_SLOT_ENV, &slotOk);
+    if (!statsKey.isEmpty() && slotOk && statsSlot >= 0 && statsSlot < AssignmentClientSharedStats::MAX_SLOTS) {
+        _monitorStatsSharedMemory.setKey(statsKey);
+        if (_monitorStatsSharedMemory.attach()) {
+            _monitorStatsSlot = statsSlot;
+            const int STATS_HEARTBEAT_INTERVAL_MSECS = 200;
+            connect(&_statsHeartbeatTimer, &QTimer::timeout, this, &AssignmentClient::publishStatusToSharedMemory);
+            _statsHeartbeatTimer.start(STATS_HEARTBEAT_INTERVAL_MSECS);
+        } else {
+            qWarning() << "Failed to attach to monitor stats shared memory:"
+                << _monitorStatsSharedMemory.errorString();
+        }
+    }
+}
+
+void AssignmentClient::publishStatusToSharedMemory() {
+    if (_monitorStatsSlot < 0) {
+        return;
+    }
+
+    auto slots = static_cast<AssignmentClientSharedStats::Slot*>(_monitorStatsSharedMemory.data());
+    auto& slot = slots[_monitorStatsSlot];
+
+    // we are the only writer for this slot; the timestamp goes last so a fresh heartbeat
+    // implies the rest of the slot is at least as fresh
+    slot.assignmentType = _currentAssignment ? (quint32)_currentAssignment->getType()
+                                             : (quint32)Assignment::Type::AllTypes;
+    slot.pid = (quint32)QCoreApplication::applicationPid();
+    slot.heartbeatTimestamp = usecTimestampNow();
 }
 
 void AssignmentClient::sendStatusPacketToACM() {
@@ -174,6 +210,9 @@ void AssignmentClient::sendStatusPacketToACM() {
     statusPacket->writePrimitive(assignmentType);
     
     nodeList->sendPacket(std::move(statusPacket), _assignmentClientMonitorSocket);
+
+    // keep the shared-memory view in sync with the packet view
+    publishStatusToSharedMemory();
 }
 
 void AssignmentClient::sendAssignmentRequest() {
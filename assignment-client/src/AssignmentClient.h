@@ -14,6 +14,7 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QPointer>
+#include <QtCore/QSharedMemory>
 
 #include "ThreadedAssignment.h"
 
@@ -33,6 +34,7 @@ private slots:
     void assignmentCompleted();
     void handleAuthenticationRequest();
     void sendStatusPacketToACM();
+    void publishStatusToSharedMemory();
     void stopAssignmentClient();
 
 public slots:
@@ -52,6 +54,9 @@ private:
     HifiSockAddr _assignmentServerSocket;
     QTimer _requestTimer; // timer for requesting and assignment
     QTimer _statsTimerACM; // timer for sending stats to assignment client monitor
+    QTimer _statsHeartbeatTimer; // fast heartbeat publishing into the monitor's shared memory
+    QSharedMemory _monitorStatsSharedMemory;
+    int _monitorStatsSlot { -1 };
     QUuid _childAssignmentUUID = QUuid::createUuid();
 
  protected:
@@ -23,6 +23,9 @@
 
 #include "AssignmentClientApp.h"
 #include "AssignmentClientChildData.h"
+#include "AssignmentClientSharedStats.h"
+
+#include <Metrics.h>
 #include "SharedUtil.h"
 #include <QtCore/QJsonDocument>
 #ifdef _POSIX_SOURCE
@@ -74,6 +77,15 @@ AssignmentClientMonitor::AssignmentClientMonitor(const unsigned int numAssignmen
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
     packetReceiver.registerListener(PacketType::AssignmentClientStatus, this, "handleChildStatusPacket");
 
+    // create the shared-memory stats segment the children publish their heartbeats into
+    _childStatsSharedMemory.setKey(QString("hifi-ac-monitor-stats-%1").arg(QCoreApplication::applicationPid()));
+    if (_childStatsSharedMemory.create(AssignmentClientSharedStats::segmentSize())) {
+        memset(_childStatsSharedMemory.data(), 0, AssignmentClientSharedStats::segmentSize());
+    } else {
+        qWarning() << "Failed to create shared-memory stats segment:" << _childStatsSharedMemory.errorString()
+            << "- falling back to packet-based child status only";
+    }
+
     adjustOSResources(std::max(_numAssignmentClientForks, _maxAssignmentClientForks));
     // use QProcess to fork off a process for each of the child assignment clients
     for (unsigned int i = 0; i < _numAssignmentClientForks; i++) {
@@ -83,6 +95,16 @@ AssignmentClientMonitor::AssignmentClientMonitor(const unsigned int numAssignmen
     connect(&_checkSparesTimer, &QTimer::timeout, this, &AssignmentClientMonitor::checkSpares);
 
     _checkSparesTimer.start(NODE_SILENCE_THRESHOLD_MSECS * 3);
+
+    _childCountGauge.reset(new metrics::Gauge("hifi_acm_child_count",
+        "Assignment client child processes currently running",
+        [this] { return (double)_childProcesses.size(); }));
+
+    // sample the shared-memory heartbeats well below the packet cadence so a wedged child is
+    // caught in under a second
+    const int CHILD_STATS_SAMPLE_INTERVAL_MSECS = 250;
+    connect(&_childStatsSampleTimer, &QTimer::timeout, this, &AssignmentClientMonitor::sampleChildStats);
+    _childStatsSampleTimer.start(CHILD_STATS_SAMPLE_INTERVAL_MSECS);
 }
 
 AssignmentClientMonitor::~AssignmentClientMonitor() {
@@ -234,6 +256,18 @@ void AssignmentClientMonitor::spawnChildClient() {
         assignmentClient->setStandardErrorFile(stderrPathTemp);
     }
 
+    // hand the child its slot in the shared-memory stats segment
+    int statsSlot = freeChildStatsSlot();
+    if (statsSlot >= 0) {
+        auto environment = QProcessEnvironment::systemEnvironment();
+        environment.insert(AssignmentClientSharedStats::STATS_KEY_ENV, _childStatsSharedMemory.key());
+        environment.insert(AssignmentClientSharedStats::STATS_SLOT_ENV, QString::number(statsSlot));
+        assignmentClient->setProcessEnvironment(environment);
+
+        auto slots = static_cast<AssignmentClientSharedStats::Slot*>(_childStatsSharedMemory.data());
+        memset(&slots[statsSlot], 0, sizeof(AssignmentClientSharedStats::Slot));
+    }
+
     // make sure that the output from the child process appears in our output
     assignmentClient->setProcessChannelMode(QProcess::ForwardedChannels);
     assignmentClient->start(QCoreApplication::applicationFilePath(), _childArguments);
@@ -280,7 +314,51 @@ void AssignmentClientMonitor::spawnChildClient() {
 
         qDebug() << "Spawned a child client with PID" << assignmentClient->processId();
 
-        _childProcesses.insert(assignmentClient->processId(), { assignmentClient, stdoutPath, stderrPath });
+        _childProcesses.insert(assignmentClient->processId(), { assignmentClient, stdoutPath, stderrPath, statsSlot });
+    }
+}
+
+int AssignmentClientMonitor::freeChildStatsSlot() const {
+    if (!_childStatsSharedMemory.isAttached()) {
+        return -1;
+    }
+    for (int slot = 0; slot < AssignmentClientSharedStats::MAX_SLOTS; slot++) {
+        bool inUse = false;
+        for (const auto& child : _childProcesses) {
+            if (child.statsSlot == slot) {
+                inUse = true;
+                break;
+            }
+        }
+        if (!inUse) {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+void AssignmentClientMonitor::sampleChildStats() {
+    if (!_childStatsSharedMemory.isAttached()) {
+        return;
+    }
+
+    // children write their own slots and we only read, so no locking is needed here
+    auto slots = static_cast<const AssignmentClientSharedStats::Slot*>(_childStatsSharedMemory.constData());
+    const quint64 CHILD_HEARTBEAT_TIMEOUT_USECS = 2 * USECS_PER_SECOND;
+    quint64 now = usecTimestampNow();
+
+    for (auto it = _childProcesses.begin(); it != _childProcesses.end(); ++it) {
+        if (it->statsSlot < 0 || it->process->state() != QProcess::Running) {
+            continue;
+        }
+        quint64 heartbeat = slots[it->statsSlot].heartbeatTimestamp;
+        if (heartbeat != 0 && now > heartbeat && (now - heartbeat) > CHILD_HEARTBEAT_TIMEOUT_USECS) {
+            // the process is alive but its event loop stopped publishing - treat it as wedged
+            // and recycle it; checkSpares respawns a replacement
+            qWarning() << "Child" << it.key() << "stopped publishing heartbeats for"
+                << (now - heartbeat) / USECS_PER_MSEC << "msecs - terminating it";
+            it->process->terminate();
+        }
     }
 }
 
@@ -376,6 +454,12 @@ void AssignmentClientMonitor::handleChildStatusPacket(QSharedPointer<ReceivedMes
 }
 
 bool AssignmentClientMonitor::handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler) {
+    if (url.path() == "/metrics") {
+        connection->respond(HTTPConnection::StatusCode200, metrics::renderPrometheusText(),
+                            metrics::PROMETHEUS_MIME_TYPE);
+        return true;
+    }
+
     if (url.path() == "/status") {
         QByteArray response;
 
@@ -22,6 +22,12 @@
 
 #include "AssignmentClientChildData.h"
 #include <HTTPManager.h>
+#include <memory>
+
+#include <QtCore/QSharedMemory>
+
+#include <Metrics.h>
+
 #include <HTTPConnection.h>
 
 extern const char* NUM_FORKS_PARAMETER;
@@ -30,6 +36,7 @@ struct ACProcess {
     QProcess* process; // looks like a dangling pointer, but is parented by the AssignmentClientMonitor 
     QString logStdoutPath;
     QString logStderrPath;
+    int statsSlot { -1 }; // this child's slot in the shared-memory stats segment
 };
 
 class AssignmentClientMonitor : public QObject, public HTTPRequestHandler {
@@ -45,6 +52,7 @@ public:
     void stopChildProcesses();
 private slots:
     void checkSpares();
+    void sampleChildStats();
     void childProcessFinished(qint64 pid, quint16 port, int exitCode, QProcess::ExitStatus exitStatus);
     void handleChildStatusPacket(QSharedPointer<ReceivedMessage> message);
 
@@ -59,6 +67,11 @@ private:
     void adjustOSResources(unsigned int numForks) const;
 
     QTimer _checkSparesTimer; // every few seconds see if it need fewer or more spare children
+    QTimer _childStatsSampleTimer; // sub-second sampling of the shared-memory heartbeats
+
+    QSharedMemory _childStatsSharedMemory;
+    std::unique_ptr<metrics::Gauge> _childCountGauge;
+    int freeChildStatsSlot() const;
 
     QDir _logDirectory;
 
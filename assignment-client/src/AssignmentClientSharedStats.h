@@ -0,0 +1,41 @@
+//
+//  AssignmentClientSharedStats.h
+//  assignment-client/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssignmentClientSharedStats_h
+#define hifi_AssignmentClientSharedStats_h
+
+#include <QtCore/QtGlobal>
+
+// Layout of the shared-memory stats segment between the AssignmentClientMonitor and its child
+// processes. Each child owns one slot and is its only writer; the monitor samples at will. The
+// fields are written timestamp-last, so a fresh heartbeatTimestamp implies the other fields are
+// at least as fresh - no locking on the sampling path.
+namespace AssignmentClientSharedStats {
+
+const int MAX_SLOTS = 128;
+
+// environment variables the monitor sets for each spawned child
+const char STATS_KEY_ENV[] = "HIFI_ASSIGNMENT_CLIENT_STATS_KEY";
+const char STATS_SLOT_ENV[] = "HIFI_ASSIGNMENT_CLIENT_STATS_SLOT";
+
+struct Slot {
+    quint32 assignmentType;      // Assignment::Type, AllTypes when the child is a spare
+    quint32 pid;
+    quint64 heartbeatTimestamp;  // usecTimestampNow at the child's last publish, 0 = never
+};
+
+inline int segmentSize() {
+    return (int)sizeof(Slot) * MAX_SLOTS;
+}
+
+}
+
+#endif // hifi_AssignmentClientSharedStats_h
@@ -82,24 +82,32 @@ void SendAssetTask::run() {
                 // we have a valid byte range, handle it and send the asset
                 auto size = byteRange.size();
 
-                if (byteRange.fromInclusive >= 0) {
+                // map the requested range and stream straight out of the page
+                // cache instead of materializing it in a heap buffer first;
+                // fall back to a read when mapping fails
+                auto writeFileRange = [&](qint64 offset, qint64 rangeSize) {
+                    uchar* mapped = (rangeSize > 0) ? file.map(offset, rangeSize) : nullptr;
+                    if (mapped) {
+                        replyPacketList->write(reinterpret_cast<const char*>(mapped), rangeSize);
+                        file.unmap(mapped);
+                    } else {
+                        file.seek(offset);
+                        replyPacketList->write(file.read(rangeSize));
+                    }
+                };
 
-                    // this range is positive, meaning we just need to seek into the file and then read from there
-                    file.seek(byteRange.fromInclusive);
+                if (byteRange.fromInclusive >= 0) {
+                    // this range is positive, meaning we just need to read from the offset
                     replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
                     replyPacketList->writePrimitive(size);
-                    replyPacketList->write(file.read(size));
+                    writeFileRange(byteRange.fromInclusive, size);
                 } else {
                     // this range is negative, at least the first part of the read will be back into the end of the file
-
-                    // seek to the part of the file where the negative range begins
-                    file.seek(file.size() + byteRange.fromInclusive);
-
                     replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
                     replyPacketList->writePrimitive(size);
 
                     // first write everything from the negative range to the end of the file
-                    replyPacketList->write(file.read(size));
+                    writeFileRange(file.size() + byteRange.fromInclusive, size);
                 }
 
                 qCDebug(networking) << "Sending asset: " << hexHash;
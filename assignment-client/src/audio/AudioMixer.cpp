@@ -44,6 +44,10 @@ using namespace std;
 static const float DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE = 0.5f;    // attenuation = -6dB * log2(distance)
 static const int DISABLE_STATIC_JITTER_FRAMES = -1;
 static const float DEFAULT_NOISE_MUTING_THRESHOLD = 1.0f;
+static const float DEFAULT_AUDIBILITY_THRESHOLD = 0.0f;     // 0 disables inaudible-stream suppression
+static const bool DEFAULT_LISTENER_CLUSTERING_ENABLED = false;
+static const float DEFAULT_CLUSTER_POSITION_THRESHOLD = 1.0f;       // meters
+static const float DEFAULT_CLUSTER_ORIENTATION_THRESHOLD = 0.393f;  // radians (22.5 degrees)
 static const QString AUDIO_MIXER_LOGGING_TARGET_NAME = "audio-mixer";
 static const QString AUDIO_ENV_GROUP_KEY = "audio_env";
 static const QString AUDIO_BUFFER_GROUP_KEY = "audio_buffer";
@@ -52,6 +56,10 @@ static const QString AUDIO_THREADING_GROUP_KEY = "audio_threading";
 int AudioMixer::_numStaticJitterFrames{ DISABLE_STATIC_JITTER_FRAMES };
 float AudioMixer::_noiseMutingThreshold{ DEFAULT_NOISE_MUTING_THRESHOLD };
 float AudioMixer::_attenuationPerDoublingInDistance{ DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE };
+float AudioMixer::_audibilityThreshold{ DEFAULT_AUDIBILITY_THRESHOLD };
+bool AudioMixer::_listenerClusteringEnabled{ DEFAULT_LISTENER_CLUSTERING_ENABLED };
+float AudioMixer::_clusterPositionThreshold{ DEFAULT_CLUSTER_POSITION_THRESHOLD };
+float AudioMixer::_clusterOrientationThreshold{ DEFAULT_CLUSTER_ORIENTATION_THRESHOLD };
 map<QString, shared_ptr<CodecPlugin>> AudioMixer::_availableCodecs{ };
 QStringList AudioMixer::_codecPreferenceOrder{};
 vector<AudioMixer::ZoneDescription> AudioMixer::_audioZones;
@@ -549,12 +557,27 @@ void AudioMixer::clearDomainSettings() {
     _numStaticJitterFrames = DISABLE_STATIC_JITTER_FRAMES;
     _attenuationPerDoublingInDistance = DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE;
     _noiseMutingThreshold = DEFAULT_NOISE_MUTING_THRESHOLD;
+    _audibilityThreshold = DEFAULT_AUDIBILITY_THRESHOLD;
+    _listenerClusteringEnabled = DEFAULT_LISTENER_CLUSTERING_ENABLED;
+    _clusterPositionThreshold = DEFAULT_CLUSTER_POSITION_THRESHOLD;
+    _clusterOrientationThreshold = DEFAULT_CLUSTER_ORIENTATION_THRESHOLD;
     _codecPreferenceOrder.clear();
     _audioZones.clear();
     _zoneSettings.clear();
     _zoneReverbSettings.clear();
 }
 
+uint32_t AudioMixer::computeZoneMask(const glm::vec3& position) {
+    uint32_t zoneMask = 0;
+    int numZones = std::min((int)_audioZones.size(), MAX_CACHED_AUDIO_ZONES);
+    for (int i = 0; i < numZones; ++i) {
+        if (_audioZones[i].area.contains(position)) {
+            zoneMask |= (1u << i);
+        }
+    }
+    return zoneMask;
+}
+
 void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
     qCDebug(audio) << "AVX2 Support:" << (cpuSupportsAVX2() ? "enabled" : "disabled");
 
@@ -674,6 +697,42 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
             }
         }
 
+        const QString AUDIBILITY_THRESHOLD = "audibility_threshold";
+        if (audioEnvGroupObject[AUDIBILITY_THRESHOLD].isString()) {
+            bool ok = false;
+            float audibilityThreshold = audioEnvGroupObject[AUDIBILITY_THRESHOLD].toString().toFloat(&ok);
+            if (ok) {
+                _audibilityThreshold = audibilityThreshold;
+                qCDebug(audio) << "Audibility threshold changed to" << _audibilityThreshold;
+            }
+        }
+
+        const QString LISTENER_CLUSTERING = "listener_clustering";
+        if (audioEnvGroupObject[LISTENER_CLUSTERING].isBool()) {
+            _listenerClusteringEnabled = audioEnvGroupObject[LISTENER_CLUSTERING].toBool();
+            qCDebug(audio) << "Listener clustering changed to" << _listenerClusteringEnabled;
+        }
+
+        const QString CLUSTER_POSITION_THRESHOLD = "cluster_position_threshold";
+        if (audioEnvGroupObject[CLUSTER_POSITION_THRESHOLD].isString()) {
+            bool ok = false;
+            float positionThreshold = audioEnvGroupObject[CLUSTER_POSITION_THRESHOLD].toString().toFloat(&ok);
+            if (ok && positionThreshold > 0.0f) {
+                _clusterPositionThreshold = positionThreshold;
+                qCDebug(audio) << "Cluster position threshold changed to" << _clusterPositionThreshold;
+            }
+        }
+
+        const QString CLUSTER_ORIENTATION_THRESHOLD = "cluster_orientation_threshold";
+        if (audioEnvGroupObject[CLUSTER_ORIENTATION_THRESHOLD].isString()) {
+            bool ok = false;
+            float orientationThreshold = audioEnvGroupObject[CLUSTER_ORIENTATION_THRESHOLD].toString().toFloat(&ok);
+            if (ok && orientationThreshold > 0.0f) {
+                _clusterOrientationThreshold = orientationThreshold;
+                qCDebug(audio) << "Cluster orientation threshold changed to" << _clusterOrientationThreshold;
+            }
+        }
+
         const QString NOISE_MUTING_THRESHOLD = "noise_muting_threshold";
         if (audioEnvGroupObject[NOISE_MUTING_THRESHOLD].isString()) {
             bool ok = false;
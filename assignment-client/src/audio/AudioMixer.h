@@ -50,9 +50,18 @@ public:
         float wetLevel;
     };
 
+    // zone membership is cached per stream as a bitmask of this width; zones
+    // beyond it are evaluated directly
+    static const int MAX_CACHED_AUDIO_ZONES = 32;
+    static uint32_t computeZoneMask(const glm::vec3& position);
+
     static int getStaticJitterFrames() { return _numStaticJitterFrames; }
     static bool shouldMute(float quietestFrame) { return quietestFrame > _noiseMutingThreshold; }
     static float getAttenuationPerDoublingInDistance() { return _attenuationPerDoublingInDistance; }
+    static float getAudibilityThreshold() { return _audibilityThreshold; }
+    static bool getListenerClusteringEnabled() { return _listenerClusteringEnabled; }
+    static float getClusterPositionThreshold() { return _clusterPositionThreshold; }
+    static float getClusterOrientationThreshold() { return _clusterOrientationThreshold; }
     static const std::vector<ZoneDescription>& getAudioZones() { return _audioZones; }
     static const std::vector<ZoneSettings>& getZoneSettings() { return _zoneSettings; }
     static const std::vector<ReverbSettings>& getReverbSettings() { return _zoneReverbSettings; }
@@ -141,6 +150,10 @@ private:
     static int _numStaticJitterFrames; // -1 denotes dynamic jitter buffering
     static float _noiseMutingThreshold;
     static float _attenuationPerDoublingInDistance;
+    static float _audibilityThreshold;
+    static bool _listenerClusteringEnabled;
+    static float _clusterPositionThreshold;
+    static float _clusterOrientationThreshold;
     static std::map<QString, CodecPluginPointer> _availableCodecs;
     static QStringList _codecPreferenceOrder;
 
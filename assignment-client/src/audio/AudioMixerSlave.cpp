@@ -41,6 +41,8 @@ using AudioStreamVector = AudioMixerClientData::AudioStreamVector;
 using MixableStream = AudioMixerClientData::MixableStream;
 using MixableStreamsVector = AudioMixerClientData::MixableStreamsVector;
 
+static const int HRTF_DATASET_INDEX = 1;
+
 // packet helpers
 std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 sequence, QString codec);
 void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer);
@@ -60,6 +62,12 @@ void AudioMixerSlave::processPackets(const SharedNodePointer& node) {
     if (data) {
         // process packets and collect the number of streams available for this frame
         stats.sumStreams += data->processPackets(_sharedData.addedStreams);
+
+        // refresh each stream's cached zone membership for this frame, so mixing
+        // never re-tests zone containment per source/listener pair
+        for (auto& stream : data->getAudioStreams()) {
+            stream->setZoneMask(AudioMixer::computeZoneMask(stream->getPosition()));
+        }
     }
 }
 
@@ -68,6 +76,9 @@ void AudioMixerSlave::configureMix(ConstIter begin, ConstIter end, unsigned int
     _end = end;
     _frame = frame;
     _numToRetain = numToRetain;
+
+    // cluster mixes are only shared within a frame
+    _clusterCache.clear();
 }
 
 void AudioMixerSlave::mix(const SharedNodePointer& node) {
@@ -101,17 +112,21 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
 
         // send audio packet
         if (mixHasAudio || data->shouldFlushEncoder()) {
-            QByteArray encodedBuffer;
+            // the encode buffer is a slave member, so its allocation is reused across
+            // listeners and ticks instead of being reallocated per packet
+            _encodedBuffer.clear();
             if (mixHasAudio) {
-                // encode the audio
-                QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
-                data->encode(decodedBuffer, encodedBuffer);
+                // encode the audio, wrapping the mix buffer without copying it
+                // (the encoder consumes it synchronously)
+                QByteArray decodedBuffer = QByteArray::fromRawData(reinterpret_cast<char*>(_bufferSamples),
+                                                                   AudioConstants::NETWORK_FRAME_BYTES_STEREO);
+                data->encode(decodedBuffer, _encodedBuffer);
             } else {
                 // time to flush (resets shouldFlush until the next encode)
-                data->encodeFrameOfZeros(encodedBuffer);
+                data->encodeFrameOfZeros(_encodedBuffer);
             }
 
-            sendMixPacket(node, *data, encodedBuffer);
+            sendMixPacket(node, *data, _encodedBuffer);
         } else {
             ++stats.sumListenersSilent;
             sendSilentPacket(node, *data);
@@ -306,6 +321,29 @@ float approximateVolume(const MixableStream& stream, const AvatarAudioStream* li
     return stream.positionalStream->getLastPopOutputTrailingLoudness() * gain;
 };
 
+// inaudible streams are parked as inactive instead of being rendered;
+// a zero threshold keeps every stream audible (the default)
+bool isAudible(const MixableStream& stream, const AvatarAudioStream* listenerAudioStream) {
+    float threshold = AudioMixer::getAudibilityThreshold();
+    if (threshold <= 0.0f) {
+        return true;
+    }
+
+    // the listener's own loopback is always kept
+    if (stream.positionalStream == listenerAudioStream) {
+        return true;
+    }
+
+    return approximateVolume(stream, listenerAudioStream) >= threshold;
+}
+
+// Idle (skipped/inactive) streams are inaudible, so their HRTF parameter history
+// only needs a periodic refresh; updates are staggered across frames by node.
+bool AudioMixerSlave::shouldUpdateIdleStream(const AudioMixerClientData::MixableStream& stream) const {
+    static const unsigned int IDLE_UPDATE_INTERVAL_FRAMES = 4;
+    return ((_frame + stream.nodeStreamID.nodeLocalID) % IDLE_UPDATE_INTERVAL_FRAMES) == 0;
+}
+
 bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     AvatarAudioStream* listenerAudioStream = static_cast<AudioMixerClientData*>(listener->getLinkedData())->getAvatarAudioStream();
     AudioMixerClientData* listenerData = static_cast<AudioMixerClientData*>(listener->getLinkedData());
@@ -313,6 +351,8 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     // zero out the mix for this listener
     memset(_mixSamples, 0, sizeof(_mixSamples));
 
+    setupClusterState(*listenerData, *listenerAudioStream);
+
     bool isThrottling = _numToRetain != -1;
     bool isSoloing = !listenerData->getSoloedNodes().empty();
 
@@ -327,7 +367,7 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         }
 
         if (!shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
-            if (shouldBeInactive(stream)) {
+            if (shouldBeInactive(stream) || !isAudible(stream, listenerAudioStream)) {
                 streams.inactive.push_back(move(stream));
                 ++stats.skippedToInactive;
             } else {
@@ -337,7 +377,7 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
-        if (!isThrottling) {
+        if (!isThrottling && shouldUpdateIdleStream(stream)) {
             updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
                                  listenerData->getMasterInjectorGain());
         }
@@ -356,13 +396,13 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
-        if (!shouldBeInactive(stream)) {
+        if (!shouldBeInactive(stream) && isAudible(stream, listenerAudioStream)) {
             streams.active.push_back(move(stream));
             ++stats.inactiveToActive;
             return true;
         }
 
-        if (!isThrottling) {
+        if (!isThrottling && shouldUpdateIdleStream(stream)) {
             updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
                                  listenerData->getMasterInjectorGain());
         }
@@ -390,9 +430,9 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             addStream(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(), listenerData->getMasterInjectorGain(),
                       isSoloing);
 
-            if (shouldBeInactive(stream)) {
+            if (shouldBeInactive(stream) || !isAudible(stream, listenerAudioStream)) {
                 // To reduce artifacts we still call render to flush the HRTF for every silent
-                // sources on the first frame where the source becomes silent
+                // or inaudible sources on the first frame where the source becomes silent
                 // this ensures the correct tail from last mixed block
                 streams.inactive.push_back(move(stream));
                 ++stats.activeToInactive;
@@ -460,6 +500,29 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         });
     }
 
+    // render all queued HRTF streams in one batched pass
+    flushHRTFBatch();
+
+    if (_clusterActive) {
+        if (_clusterReusing) {
+            // serve the far-field mix from the cluster cache
+            const ClusterMix& entry = _clusterCache[_clusterKey];
+            for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; ++i) {
+                _mixSamples[i] += entry.farSamples[i];
+            }
+            ++stats.clusterMixReuses;
+        } else {
+            // publish the freshly rendered far-field mix for co-located listeners,
+            // then fold it into this listener's mix
+            ClusterMix& entry = _clusterCache[_clusterKey];
+            memcpy(entry.farSamples, _clusterSamples, sizeof(entry.farSamples));
+            for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; ++i) {
+                _mixSamples[i] += _clusterSamples[i];
+            }
+            ++stats.clusterMixRenders;
+        }
+    }
+
     stats.skipped += (int)streams.skipped.size();
     stats.inactive += (int)streams.inactive.size();
     stats.active += (int)streams.active.size();
@@ -510,8 +573,6 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
                                                    relativePosition, distance));
     float azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
 
-    const int HRTF_DATASET_INDEX = 1;
-
     if (!streamToAdd->lastPopSucceeded()) {
         bool forceSilentBlock = true;
 
@@ -532,14 +593,12 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
         }
 
         if (forceSilentBlock) {
-            // call renderSilent with a forced silent block to reduce artifacts
+            // queue a render with a forced silent block to reduce artifacts
             // (this is not done for stereo streams since they do not go through the HRTF)
             if (!streamToAdd->isStereo() && !isEcho) {
                 static int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
-                mixableStream.hrtf->render(silentMonoBlock, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                           AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-
-                ++stats.hrtfRenders;
+                _hrtfBatch.push_back({ mixableStream.hrtf.get(), silentMonoBlock, azimuth, distance, gain });
+                _hrtfBatchOffsets.push_back(-1);    // static block, no staging needed
             }
 
             return;
@@ -567,11 +626,116 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
         ++stats.manualEchoMixes;
     } else {
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        // far-field sources sound near-identical across a cluster of co-located
+        // listeners, so they are rendered once per cluster and shared
+        bool isFarField = _clusterActive && distance > _clusterFarDistance;
+
+        if (isFarField && _clusterReusing) {
+            // the cached cluster mix already carries this source; keep the HRTF history warm
+            mixableStream.hrtf->setParameterHistory(azimuth, distance, gain);
+            ++stats.hrtfUpdates;
+            return;
+        }
 
-        mixableStream.hrtf->render(_bufferSamples, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                   AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-        ++stats.hrtfRenders;
+        // stage the samples in the batch arena, since _bufferSamples is reused per stream,
+        // and queue the render for the batched HRTF pass
+        int32_t offset = (int32_t)_hrtfBatchSamples.size();
+        _hrtfBatchSamples.resize(offset + AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        streamPopOutput.readSamples(&_hrtfBatchSamples[offset], AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+
+        if (isFarField) {
+            _hrtfFarBatch.push_back({ mixableStream.hrtf.get(), nullptr, azimuth, distance, gain });
+            _hrtfFarBatchOffsets.push_back(offset);
+        } else {
+            _hrtfBatch.push_back({ mixableStream.hrtf.get(), nullptr, azimuth, distance, gain });
+            _hrtfBatchOffsets.push_back(offset);
+        }
+    }
+}
+
+void AudioMixerSlave::flushHRTFBatch() {
+    // resolve staged sample offsets, now that the arena can no longer grow
+    for (size_t i = 0; i < _hrtfBatch.size(); i++) {
+        if (_hrtfBatchOffsets[i] >= 0) {
+            _hrtfBatch[i].input = &_hrtfBatchSamples[_hrtfBatchOffsets[i]];
+        }
+    }
+    for (size_t i = 0; i < _hrtfFarBatch.size(); i++) {
+        if (_hrtfFarBatchOffsets[i] >= 0) {
+            _hrtfFarBatch[i].input = &_hrtfBatchSamples[_hrtfFarBatchOffsets[i]];
+        }
+    }
+
+    if (!_hrtfBatch.empty()) {
+        AudioHRTF::renderBatch(_hrtfBatch.data(), (int)_hrtfBatch.size(), _mixSamples, HRTF_DATASET_INDEX,
+                               AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        stats.hrtfRenders += (int)_hrtfBatch.size();
+    }
+
+    if (!_hrtfFarBatch.empty()) {
+        AudioHRTF::renderBatch(_hrtfFarBatch.data(), (int)_hrtfFarBatch.size(), _clusterSamples, HRTF_DATASET_INDEX,
+                               AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        stats.hrtfRenders += (int)_hrtfFarBatch.size();
+    }
+
+    _hrtfBatch.clear();
+    _hrtfBatchOffsets.clear();
+    _hrtfFarBatch.clear();
+    _hrtfFarBatchOffsets.clear();
+    _hrtfBatchSamples.clear();
+}
+
+void AudioMixerSlave::setupClusterState(AudioMixerClientData& listenerData, AvatarAudioStream& listenerAudioStream) {
+    _clusterActive = false;
+    _clusterReusing = false;
+
+    if (!AudioMixer::getListenerClusteringEnabled()) {
+        return;
+    }
+
+    // throttled frames reorder and drop streams per listener, so mixes are not shareable
+    if (_numToRetain != -1) {
+        return;
+    }
+
+    // per-listener adjustments make the mix unique to this listener
+    if (!listenerData.getSoloedNodes().empty() ||
+        listenerData.getMasterAvatarGain() != 1.0f ||
+        listenerData.getMasterInjectorGain() != 1.0f) {
+        return;
+    }
+
+    float positionThreshold = AudioMixer::getClusterPositionThreshold();
+    float orientationThreshold = AudioMixer::getClusterOrientationThreshold();
+
+    // quantize position into cells of the position threshold
+    glm::vec3 position = listenerAudioStream.getPosition();
+    int64_t cellX = (int64_t)floorf(position.x / positionThreshold);
+    int64_t cellY = (int64_t)floorf(position.y / positionThreshold);
+    int64_t cellZ = (int64_t)floorf(position.z / positionThreshold);
+
+    // quantize yaw into bins of the orientation threshold (UNIT_NEG_Z is "forward")
+    glm::vec3 forward = listenerAudioStream.getOrientation() * glm::vec3(0.0f, 0.0f, -1.0f);
+    float yaw = atan2f(forward.x, -forward.z);
+    int64_t yawBin = (int64_t)floorf(yaw / orientationThreshold);
+
+    // listeners near a cell or bin edge can key apart despite being within the
+    // thresholds, which only costs an extra render
+    uint64_t key = 0;
+    for (int64_t quantized : { cellX, cellY, cellZ, yawBin }) {
+        key = key * 0x9E3779B97F4A7C15ull + (uint64_t)quantized;
+    }
+
+    _clusterActive = true;
+    _clusterKey = key;
+    _clusterReusing = (_clusterCache.find(key) != _clusterCache.end());
+
+    // far enough that the parallax across the cluster is inaudible
+    const float FAR_FIELD_DISTANCE_RATIO = 8.0f;
+    _clusterFarDistance = positionThreshold * FAR_FIELD_DISTANCE_RATIO;
+
+    if (!_clusterReusing) {
+        memset(_clusterSamples, 0, sizeof(_clusterSamples));
     }
 }
 
@@ -656,10 +820,14 @@ void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData&
     AvatarAudioStream* stream = data.getAvatarAudioStream();
     glm::vec3 streamPosition = stream->getPosition();
 
-    // find reverb properties
+    // find reverb properties, using the stream's cached zone mask when possible
+    uint32_t zoneMask = stream->getZoneMask();
     for (const auto& settings : reverbSettings) {
-        AABox box = audioZones[settings.zone].area;
-        if (box.contains(streamPosition)) {
+        bool inZone = (settings.zone < AudioMixer::MAX_CACHED_AUDIO_ZONES)
+            ? (zoneMask & (1u << settings.zone)) != 0
+            : audioZones[settings.zone].area.contains(streamPosition);
+
+        if (inZone) {
             hasReverb = true;
             reverbTime = settings.reverbTime;
             wetLevel = settings.wetLevel;
@@ -761,11 +929,20 @@ float computeGain(float masterAvatarGain,
     auto& audioZones = AudioMixer::getAudioZones();
     auto& zoneSettings = AudioMixer::getZoneSettings();
 
-    // find distance attenuation coefficient
+    // find distance attenuation coefficient, using the per-stream cached zone
+    // masks; zones beyond the mask width fall back to direct containment tests
+    uint32_t sourceZoneMask = streamToAdd.getZoneMask();
+    uint32_t listenerZoneMask = listeningNodeStream.getZoneMask();
     float attenuationPerDoublingInDistance = AudioMixer::getAttenuationPerDoublingInDistance();
     for (const auto& settings : zoneSettings) {
-        if (audioZones[settings.source].area.contains(streamToAdd.getPosition()) &&
-            audioZones[settings.listener].area.contains(listeningNodeStream.getPosition())) {
+        bool sourceInZone = (settings.source < AudioMixer::MAX_CACHED_AUDIO_ZONES)
+            ? (sourceZoneMask & (1u << settings.source)) != 0
+            : audioZones[settings.source].area.contains(streamToAdd.getPosition());
+        bool listenerInZone = (settings.listener < AudioMixer::MAX_CACHED_AUDIO_ZONES)
+            ? (listenerZoneMask & (1u << settings.listener)) != 0
+            : audioZones[settings.listener].area.contains(listeningNodeStream.getPosition());
+
+        if (sourceInZone && listenerInZone) {
             attenuationPerDoublingInDistance = settings.coefficient;
             break;
         }
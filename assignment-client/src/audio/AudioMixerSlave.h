@@ -12,6 +12,8 @@
 #ifndef hifi_AudioMixerSlave_h
 #define hifi_AudioMixerSlave_h
 
+#include <unordered_map>
+
 #include <tbb/concurrent_vector.h>
 
 #include <AABox.h>
@@ -68,9 +70,42 @@ private:
 
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
+    // staggers HRTF parameter refreshes for idle (skipped/inactive) streams
+    bool shouldUpdateIdleStream(const AudioMixerClientData::MixableStream& stream) const;
+
+    // render all HRTF streams queued by addStream in one batched pass
+    void flushHRTFBatch();
+
+    // listener clustering - co-located, same-facing listeners share one far-field mix per frame
+    void setupClusterState(AudioMixerClientData& listenerData, AvatarAudioStream& listenerAudioStream);
+
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    float _clusterSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+
+    // encode output, reused across listeners and ticks to avoid per-packet allocation
+    QByteArray _encodedBuffer;
+
+    // per-listener batches of HRTF renders, flushed once all streams are queued
+    // (near-field renders target _mixSamples, far-field renders target _clusterSamples)
+    std::vector<AudioHRTF::BatchedSource> _hrtfBatch;
+    std::vector<int32_t> _hrtfBatchOffsets;     // offset into _hrtfBatchSamples, or -1 for a static block
+    std::vector<AudioHRTF::BatchedSource> _hrtfFarBatch;
+    std::vector<int32_t> _hrtfFarBatchOffsets;
+    std::vector<int16_t> _hrtfBatchSamples;
+
+    // per-frame cache of rendered far-field cluster mixes, keyed by quantized listener position/orientation
+    struct ClusterMix {
+        float farSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    };
+    std::unordered_map<uint64_t, ClusterMix> _clusterCache;
+
+    // clustering state for the listener currently being mixed
+    bool _clusterActive { false };      // listener participates in clustering
+    bool _clusterReusing { false };     // far-field mix is served from the cache
+    uint64_t _clusterKey { 0 };
+    float _clusterFarDistance { 0.0f }; // sources beyond this distance share the cluster mix
 
     // frame state
     ConstIter _begin;
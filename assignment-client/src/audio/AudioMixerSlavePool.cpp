@@ -13,8 +13,25 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <thread>
+
+#ifdef Q_OS_LINUX
+#include <sched.h>
+#endif
 
 void AudioMixerSlaveThread::run() {
+#ifdef Q_OS_LINUX
+    // Keep each slave on one core, so per-stream mixer state (HRTF histories,
+    // jitter buffers) stays in that core's cache and on its NUMA node.
+    unsigned int numCores = std::thread::hardware_concurrency();
+    if (numCores > 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(_index % numCores, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+#endif
+
     while (true) {
         wait();
 
@@ -61,7 +78,15 @@ void AudioMixerSlaveThread::notify(bool stopping) {
 }
 
 bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node) {
-    return _pool._queue.try_pop(node);
+    // drain the local queue first, then steal from the other slaves
+    auto& queues = _pool._queues;
+    int numQueues = (int)queues.size();
+    for (int i = 0; i < numQueues; ++i) {
+        if (queues[(_index + i) % numQueues]->try_pop(node)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void AudioMixerSlavePool::processPackets(ConstIter begin, ConstIter end) {
@@ -83,9 +108,12 @@ void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
     _begin = begin;
     _end = end;
 
-    // fill the queue
+    // fill the per-slave queues round-robin
+    int index = 0;
+    int numQueues = (int)_queues.size();
     std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
-        _queue.push(node);
+        _queues[index]->push(node);
+        index = (index + 1) % numQueues;
     });
 
     {
@@ -104,7 +132,11 @@ void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
         assert(_numStarted == _numThreads);
     }
 
-    assert(_queue.empty());
+#ifndef NDEBUG
+    for (auto& queue : _queues) {
+        assert(queue->empty());
+    }
+#endif
 }
 
 void AudioMixerSlavePool::each(std::function<void(AudioMixerSlave& slave)> functor) {
@@ -157,6 +189,8 @@ void AudioMixerSlavePool::resize(int numThreads) {
         // start new slaves
         for (int i = 0; i < numThreads - _numThreads; ++i) {
             auto slave = new AudioMixerSlaveThread(*this, _workerSharedData);
+            slave->_index = _numThreads + i;
+            _queues.emplace_back(new Queue());
             slave->start();
             _slaves.emplace_back(slave);
         }
@@ -192,6 +226,7 @@ void AudioMixerSlavePool::resize(int numThreads) {
 
         // ...and erase them
         _slaves.erase(extraBegin, _slaves.end());
+        _queues.erase(_queues.begin() + numThreads, _queues.end());
     }
 
     _numThreads = _numStarted = _numFinished = numThreads;
@@ -13,6 +13,7 @@
 #define hifi_AudioMixerSlavePool_h
 
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -46,6 +47,7 @@ private:
     AudioMixerSlavePool& _pool;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
     bool _stop { false };
+    int _index { 0 };   // slave index, used for the local queue and thread affinity
 };
 
 // Slave pool for audio mixers
@@ -101,7 +103,9 @@ private:
     int _numStopped { 0 }; // guarded by _mutex
 
     // frame state
-    Queue _queue;
+    // per-slave queues - each slave drains its own queue first, then steals
+    // from the others, so load balances without every pop contending on one queue
+    std::vector<std::unique_ptr<Queue>> _queues;
     ConstIter _begin;
     ConstIter _end;
 
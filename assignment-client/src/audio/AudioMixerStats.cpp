@@ -25,6 +25,9 @@ void AudioMixerStats::reset() {
     manualStereoMixes = 0;
     manualEchoMixes = 0;
 
+    clusterMixRenders = 0;
+    clusterMixReuses = 0;
+
     skippedToActive = 0;
     skippedToInactive = 0;
     inactiveToSkipped = 0;
@@ -55,6 +58,9 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     manualStereoMixes += otherStats.manualStereoMixes;
     manualEchoMixes += otherStats.manualEchoMixes;
 
+    clusterMixRenders += otherStats.clusterMixRenders;
+    clusterMixReuses += otherStats.clusterMixReuses;
+
     skippedToActive += otherStats.skippedToActive;
     skippedToInactive += otherStats.skippedToInactive;
     inactiveToSkipped += otherStats.inactiveToSkipped;
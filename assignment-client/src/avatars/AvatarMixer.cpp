@@ -222,8 +222,8 @@ void AvatarMixer::sendIdentityPacket(AvatarMixerClientData* nodeData, const Shar
 }
 
 std::chrono::microseconds AvatarMixer::timeFrame(p_high_resolution_clock::time_point& timestamp) {
-    // advance the next frame
-    auto nextTimestamp = timestamp + std::chrono::microseconds((int)((float)USECS_PER_SECOND / (float)AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND));
+    // advance the next frame, at the current load-adaptive broadcast rate
+    auto nextTimestamp = timestamp + std::chrono::microseconds((int)((float)USECS_PER_SECOND / _broadcastRate));
     auto now = p_high_resolution_clock::now();
 
     // compute how long the last frame took
@@ -248,6 +248,8 @@ void AvatarMixer::start() {
     unsigned int frame = 1;
     auto frameTimestamp = p_high_resolution_clock::now();
 
+    _broadcastRate = (float)AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND;
+
     while (!_isFinished) {
 
         auto frameDuration = timeFrame(frameTimestamp); // calculates last frame duration and sleeps remainder of target amount
@@ -429,7 +431,7 @@ void AvatarMixer::manageIdentityData(const SharedNodePointer& node) {
 
 void AvatarMixer::throttle(std::chrono::microseconds duration, int frame) {
     // throttle using a modified proportional-integral controller
-    const float FRAME_TIME = USECS_PER_SECOND / AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND;
+    const float FRAME_TIME = USECS_PER_SECOND / _broadcastRate;
     float mixRatio = duration.count() / FRAME_TIME;
 
     // constants are determined based on a "regular" 16-CPU EC2 server
@@ -473,6 +475,23 @@ void AvatarMixer::throttle(std::chrono::microseconds duration, int frame) {
             qDebug("avatar-mixer is recovering (%f mix/sleep) - throttling %f of streams",
                 (double)_trailingMixRatio, (double)_throttlingRatio);
         }
+
+        // When stream throttling has saturated and the mixer still cannot keep up,
+        // shed load by slowing the broadcast rate itself; restore it stepwise once
+        // stream throttling has fully backed off. Clients interpolate between
+        // frames, so a slower broadcast degrades far more gracefully than an
+        // overloaded tick.
+        const float MIN_BROADCAST_RATE = 20.0f;
+        const float BROADCAST_RATE_STEP = 5.0f;
+        if (_throttlingRatio >= 1.0f && _trailingMixRatio > TARGET && _broadcastRate > MIN_BROADCAST_RATE) {
+            _broadcastRate = std::max(_broadcastRate - BROADCAST_RATE_STEP, MIN_BROADCAST_RATE);
+            qDebug("avatar-mixer is saturated - reducing broadcast rate to %f fps", (double)_broadcastRate);
+        } else if (_throttlingRatio <= 0.0f && _trailingMixRatio <= BACKOFF_TARGET &&
+                   _broadcastRate < (float)AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND) {
+            _broadcastRate = std::min(_broadcastRate + BROADCAST_RATE_STEP,
+                                      (float)AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND);
+            qDebug("avatar-mixer has recovered - restoring broadcast rate to %f fps", (double)_broadcastRate);
+        }
     }
 }
 
@@ -755,6 +774,7 @@ void AvatarMixer::sendStatsPacket() {
     statsObject["threads"] = _slavePool.numThreads();
     statsObject["trailing_mix_ratio"] = _trailingMixRatio;
     statsObject["throttling_ratio"] = _throttlingRatio;
+    statsObject["broadcast_rate"] = _broadcastRate;
 
 #ifdef DEBUG_EVENT_QUEUE
     QJsonObject qtStats;
@@ -90,6 +90,7 @@ private:
     // FIXME - new throttling - use these values somehow
     float _trailingMixRatio { 0.0f };
     float _throttlingRatio { 0.0f };
+    float _broadcastRate { 0.0f };  // broadcast frames per second, load-adaptive (set in ctor/start)
 
     int _sumListeners { 0 };
     int _numStatFrames { 0 };
@@ -36,6 +36,31 @@ uint64_t AvatarMixerClientData::getLastOtherAvatarEncodeTime(NLPacket::LocalID o
     return 0;
 }
 
+QByteArray AvatarMixerClientData::getPackedTrait(AvatarTraits::TraitType traitType,
+                                                 AvatarTraits::TraitVersion traitVersion) const {
+    std::lock_guard<std::mutex> lock(_packedTraitsMutex);
+
+    auto& cached = _packedSimpleTraits[traitType];
+    if (cached.version != traitVersion) {
+        cached.data = _avatar->packTrait(traitType);
+        cached.version = traitVersion;
+    }
+    return cached.data;
+}
+
+QByteArray AvatarMixerClientData::getPackedTraitInstance(AvatarTraits::TraitType traitType,
+                                                         AvatarTraits::TraitInstanceID instanceID,
+                                                         AvatarTraits::TraitVersion traitVersion) const {
+    std::lock_guard<std::mutex> lock(_packedTraitsMutex);
+
+    auto& cached = _packedTraitInstances[{ traitType, instanceID }];
+    if (cached.version != traitVersion) {
+        cached.data = _avatar->packTraitInstance(traitType, instanceID);
+        cached.version = traitVersion;
+    }
+    return cached.data;
+}
+
 void AvatarMixerClientData::setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time) {
     auto itr = _lastOtherAvatarEncodeTime.find(otherAvatar);
     if (itr != _lastOtherAvatarEncodeTime.end()) {
@@ -13,7 +13,10 @@
 #define hifi_AvatarMixerClientData_h
 
 #include <algorithm>
+#include <array>
 #include <cfloat>
+#include <map>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <queue>
@@ -52,6 +55,13 @@ public:
     const MixerAvatar* getConstAvatarData() const { return _avatar.get(); }
     MixerAvatarSharedPointer getAvatarSharedPointer() const { return _avatar; }
 
+    // Flyweight cache of packed trait payloads: a trait is serialized once per
+    // version and the implicitly-shared bytes are reused for every receiver.
+    // Thread-safe, called concurrently from the AvatarMixerSlaves.
+    QByteArray getPackedTrait(AvatarTraits::TraitType traitType, AvatarTraits::TraitVersion traitVersion) const;
+    QByteArray getPackedTraitInstance(AvatarTraits::TraitType traitType, AvatarTraits::TraitInstanceID instanceID,
+                                      AvatarTraits::TraitVersion traitVersion) const;
+
     uint16_t getLastBroadcastSequenceNumber(NLPacket::LocalID nodeID) const;
     void setLastBroadcastSequenceNumber(NLPacket::LocalID nodeID, uint16_t sequenceNumber)
         { _lastBroadcastSequenceNumbers[nodeID] = sequenceNumber; }
@@ -166,6 +176,14 @@ private:
 
     MixerAvatarSharedPointer _avatar { new MixerAvatar() };
 
+    struct PackedTraitVersion {
+        AvatarTraits::TraitVersion version { AvatarTraits::NULL_TRAIT_VERSION };
+        QByteArray data;
+    };
+    mutable std::mutex _packedTraitsMutex;
+    mutable std::array<PackedTraitVersion, AvatarTraits::NUM_SIMPLE_TRAITS> _packedSimpleTraits;
+    mutable std::map<std::pair<AvatarTraits::TraitType, AvatarTraits::TraitInstanceID>, PackedTraitVersion> _packedTraitInstances;
+
     uint16_t _lastReceivedSequenceNumber { 0 };
     std::unordered_map<NLPacket::LocalID, uint16_t> _lastBroadcastSequenceNumbers;
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastBroadcastTimes;
@@ -141,8 +141,9 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
                 if (lastReceivedVersion > lastSentVersionRef) {
                     bytesWritten += addTraitsNodeHeader(listeningNodeData, sendingNodeData, traitsPacketList, bytesWritten);
                     // there is an update to this trait, add it to the traits packet
-                    bytesWritten += AvatarTraits::packVersionedTrait(traitType, traitsPacketList,
-                                                                     lastReceivedVersion, *sendingAvatar);
+                    bytesWritten += AvatarTraits::packVersionedTrait(traitType, traitsPacketList, lastReceivedVersion,
+                                                                     sendingNodeData->getPackedTrait(traitType,
+                                                                                                     lastReceivedVersion));
                     // update the last sent version
                     lastSentVersionRef = lastReceivedVersion;
                     // Remember which versions we sent in this particular packet
@@ -198,7 +199,9 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
 
                     // this instance version exists and has never been sent or is newer so we need to send it
                     bytesWritten += AvatarTraits::packVersionedTraitInstance(traitType, instanceID, traitsPacketList,
-                                                                             receivedVersion, *sendingAvatar);
+                                                                             receivedVersion,
+                                                                             sendingNodeData->getPackedTraitInstance(
+                                                                                 traitType, instanceID, receivedVersion));
 
                     if (sentInstanceIt != sentIDValuePairs.end()) {
                         sentInstanceIt->value = receivedVersion;
@@ -311,6 +314,97 @@ namespace {
 
 }  // Close anonymous namespace.
 
+
+void AvatarBubbleIndex::build(NodeList::const_iterator begin, NodeList::const_iterator end) {
+    _entries.clear();
+    _nodes.clear();
+
+    for (auto it = begin; it != end; ++it) {
+        const Node* node = (*it).data();
+        if (node->getType() != NodeType::Agent || !node->getLinkedData()) {
+            continue;
+        }
+        const AvatarMixerClientData* nodeData = reinterpret_cast<const AvatarMixerClientData*>(node->getLinkedData());
+
+        Entry entry;
+        entry.box = nodeData->getAvatar().getDefaultBubbleBox();
+        entry.center = entry.box.calcCenter();
+        entry.localID = node->getLocalID();
+        _entries.push_back(entry);
+    }
+
+    if (!_entries.empty()) {
+        _nodes.reserve(2 * _entries.size());
+        buildRecursive(0, (int)_entries.size());
+    }
+}
+
+int AvatarBubbleIndex::buildRecursive(int firstEntry, int lastEntry) {
+    static const int MAX_ENTRIES_PER_LEAF = 8;
+
+    int nodeIndex = (int)_nodes.size();
+    _nodes.emplace_back();
+
+    AABox box = _entries[firstEntry].box;
+    for (int i = firstEntry + 1; i < lastEntry; ++i) {
+        box += _entries[i].box;
+    }
+    _nodes[nodeIndex].box = box;
+
+    if (lastEntry - firstEntry <= MAX_ENTRIES_PER_LEAF) {
+        _nodes[nodeIndex].firstEntry = firstEntry;
+        _nodes[nodeIndex].lastEntry = lastEntry;
+        return nodeIndex;
+    }
+
+    // median split along the widest axis of the centers
+    glm::vec3 dimensions = box.getMaximumPoint() - box.getMinimumPoint();
+    int axis = (dimensions.x > dimensions.y)
+        ? ((dimensions.x > dimensions.z) ? 0 : 2)
+        : ((dimensions.y > dimensions.z) ? 1 : 2);
+
+    int midEntry = (firstEntry + lastEntry) / 2;
+    std::nth_element(_entries.begin() + firstEntry, _entries.begin() + midEntry, _entries.begin() + lastEntry,
+                     [axis](const Entry& a, const Entry& b) { return a.center[axis] < b.center[axis]; });
+
+    int left = buildRecursive(firstEntry, midEntry);
+    int right = buildRecursive(midEntry, lastEntry);
+    _nodes[nodeIndex].left = left;
+    _nodes[nodeIndex].right = right;
+    return nodeIndex;
+}
+
+void AvatarBubbleIndex::findTouching(const AABox& queryBox, std::vector<Node::LocalID>& results) const {
+    if (_nodes.empty()) {
+        return;
+    }
+
+    // explicit stack, the tree is shallow
+    static thread_local std::vector<int> stack;
+    stack.clear();
+    stack.push_back(0);
+
+    while (!stack.empty()) {
+        const BVHNode& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        if (!queryBox.touches(node.box)) {
+            continue;
+        }
+
+        if (node.left == -1) {
+            for (int i = node.firstEntry; i < node.lastEntry; ++i) {
+                if (queryBox.touches(_entries[i].box)) {
+                    results.push_back(_entries[i].localID);
+                }
+            }
+        } else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+}
+
 void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node) {
     const Node* destinationNode = node.data();
 
@@ -370,13 +464,20 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     const float MY_AVATAR_BUBBLE_EXPANSION_FACTOR = 4.0f; // magic number determined emperically
     AABox destinationNodeBox = computeBubbleBox(avatar, MY_AVATAR_BUBBLE_EXPANSION_FACTOR);
 
+    // query the shared per-frame bubble BVH once for this receiver
+    static thread_local std::vector<Node::LocalID> bubbleOverlaps;
+    bubbleOverlaps.clear();
+    _sharedData->bubbleIndex.findTouching(destinationNodeBox, bubbleOverlaps);
+
     // prepare to sort
     const auto& cameraViews = destinationNodeData->getViewFrustums();
 
     using AvatarPriorityQueue = PrioritySortUtil::PriorityQueue<SortableAvatar>;
     // Keep two independent queues, one for heroes and one for the riff-raff.
+    // The queues live per slave thread and are reused across receivers, so their
+    // storage is only ever grown, never reallocated per receiver.
     enum PriorityVariants { kHero, kNonhero };
-    AvatarPriorityQueue avatarPriorityQueues[2] =
+    static thread_local AvatarPriorityQueue avatarPriorityQueues[2] =
     {
         {cameraViews, AvatarData::_avatarSortCoefficientSize, 
             AvatarData::_avatarSortCoefficientCenter, AvatarData::_avatarSortCoefficientAge},
@@ -384,6 +485,14 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             AvatarData::_avatarSortCoefficientCenter, AvatarData::_avatarSortCoefficientAge}
     };
 
+    for (auto& queue : avatarPriorityQueues) {
+        queue.setViews(cameraViews);
+        // also refreshes the queue's notion of "now" for age priority
+        queue.setWeights(AvatarData::_avatarSortCoefficientSize,
+            AvatarData::_avatarSortCoefficientCenter, AvatarData::_avatarSortCoefficientAge);
+        queue.clear();
+    }
+
     avatarPriorityQueues[kNonhero].reserve(_end - _begin);
 
     for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
@@ -419,9 +528,9 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             // Check to see if the space bubble is enabled
             // Don't bother with these checks if the other avatar has their bubble enabled and we're gettingAnyIgnored
             if (destinationNodeData->isIgnoreRadiusEnabled() || (sourceAvatarNodeData->isIgnoreRadiusEnabled() && !getsAnyIgnored)) {
-                // Perform the collision check between the two bounding boxes
-                AABox sourceNodeBox = sourceAvatarNodeData->getAvatar().getDefaultBubbleBox();
-                if (destinationNodeBox.touches(sourceNodeBox)) {
+                // Perform the collision check against the per-receiver BVH query results
+                if (std::find(bubbleOverlaps.begin(), bubbleOverlaps.end(), sourceAvatarNode->getLocalID())
+                        != bubbleOverlaps.end()) {
                     destinationNodeData->ignoreOther(destinationNode, sourceAvatarNode);
                     sendAvatar = getsAnyIgnored;
                 }
@@ -569,18 +678,27 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             AvatarDataPacket::SendStatus sendStatus;
             sendStatus.sendUUID = true;
 
+            // serialize into a reusable scratch buffer, then gather straight into the
+            // packet - no per-avatar QByteArray is allocated on this path
+            static thread_local QByteArray avatarDataBuffer;
+            int maxAvatarDataSize = sourceAvatar->maxAvatarDataSize();
+            if (avatarDataBuffer.size() < maxAvatarDataSize) {
+                avatarDataBuffer.resize(maxAvatarDataSize);
+            }
+
             do {
                 auto startSerialize = chrono::high_resolution_clock::now();
-                QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
+                int numBytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
                     sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
-                    &lastSentJointsForOther, avatarSpaceAvailable);
+                    &lastSentJointsForOther, reinterpret_cast<unsigned char*>(avatarDataBuffer.data()),
+                    avatarSpaceAvailable);
                 auto endSerialize = chrono::high_resolution_clock::now();
                 _stats.toByteArrayElapsedTime +=
                     (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
 
-                avatarPacket->write(bytes);
-                avatarSpaceAvailable -= bytes.size();
-                numAvatarDataBytes += bytes.size();
+                avatarPacket->write(avatarDataBuffer.constData(), numBytes);
+                avatarSpaceAvailable -= numBytes;
+                numAvatarDataBytes += numBytes;
                 if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
                     // Weren't able to fit everything.
                     nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
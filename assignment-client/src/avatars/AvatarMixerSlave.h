@@ -12,6 +12,7 @@
 #ifndef hifi_AvatarMixerSlave_h
 #define hifi_AvatarMixerSlave_h
 
+#include <AABox.h>
 #include <NodeList.h>
 
 class AvatarMixerClientData;
@@ -96,10 +97,41 @@ public:
 class EntityTree;
 using EntityTreePointer = std::shared_ptr<EntityTree>;
 
+// Per-frame BVH over source-avatar bubble boxes, rebuilt once per broadcast
+// frame before the slaves run and then queried read-only by every receiver,
+// instead of constructing and testing a bubble box per source/receiver pair.
+class AvatarBubbleIndex {
+public:
+    void build(NodeList::const_iterator begin, NodeList::const_iterator end);
+
+    // appends the local IDs of sources whose bubble box touches queryBox
+    void findTouching(const AABox& queryBox, std::vector<Node::LocalID>& results) const;
+
+private:
+    struct Entry {
+        AABox box;
+        glm::vec3 center;
+        Node::LocalID localID;
+    };
+    struct BVHNode {
+        AABox box;
+        int left { -1 };        // internal nodes: child indices
+        int right { -1 };
+        int firstEntry { 0 };   // leaf nodes: entry range
+        int lastEntry { 0 };
+    };
+
+    int buildRecursive(int firstEntry, int lastEntry);
+
+    std::vector<Entry> _entries;
+    std::vector<BVHNode> _nodes;
+};
+
 struct SlaveSharedData {
     QStringList skeletonURLWhitelist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+    AvatarBubbleIndex bubbleIndex;
 };
 
 class AvatarMixerSlave {
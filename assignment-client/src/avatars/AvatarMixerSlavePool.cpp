@@ -74,6 +74,9 @@ void AvatarMixerSlavePool::processIncomingPackets(ConstIter begin, ConstIter end
 void AvatarMixerSlavePool::broadcastAvatarData(ConstIter begin, ConstIter end, 
                                                p_high_resolution_clock::time_point lastFrameTimestamp,
                                                float maxKbpsPerNode, float throttlingRatio) {
+    // rebuild the shared bubble BVH before the slaves start; they query it read-only
+    _slaveSharedData->bubbleIndex.build(begin, end);
+
     _function = &AvatarMixerSlave::broadcastAvatarData;
     _configure = [=](AvatarMixerSlave& slave) { 
         slave.configureBroadcast(begin, end, lastFrameTimestamp, maxKbpsPerNode, throttlingRatio,
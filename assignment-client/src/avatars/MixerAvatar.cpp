@@ -11,6 +11,8 @@
 
 #include "MixerAvatar.h"
 
+#include <QtConcurrent/QtConcurrentRun>
+
 #include <QRegularExpression>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -255,28 +257,44 @@ void MixerAvatar::processCertifyEvents() {
 
         case receivedFST:
         {
-            generateFSTHash();
-            _numberChallenges = 0;
-            if (_certificateIdFromFST.length() != 0) {
-                QString& marketplacePublicKey = EntityItem::_marketplacePublicKey;
-                bool staticVerification = validateFSTHash(marketplacePublicKey);
-                _verifyState = staticVerification ? staticValidation : verificationFailed;
-
-                if (_verifyState == staticValidation) {
-                    requestCurrentOwnership();
-                    _verifyState = requestingOwner;
-                } else {
-                    _needsIdentityUpdate = true;
-                    _pendingEvent = false;
-                    qCDebug(avatars) << "Avatar" << getDisplayName() << "(" << getSessionUUID() << ") FAILED static certification";
+            // Canonicalizing and hashing the FST and verifying its RSA signature are
+            // too expensive for the mixer tick; run them on the thread pool and
+            // re-enter the state machine with the result.
+            _verifyState = staticValidationPending;
+            _pendingEvent = false;
+
+            auto self = std::static_pointer_cast<MixerAvatar>(shared_from_this());
+            QtConcurrent::run([self] {
+                QMutexLocker certifyLocker(&self->_avatarCertifyLock);
+                if (self->_verifyState != staticValidationPending) {
+                    // verification was restarted while we were queued
+                    return;
                 }
-            } else {  // FST doesn't have a certificate, so noncertified rather than failed:
-                _pendingEvent = false;
-                _certifyFailed = false;
-                _needsIdentityUpdate = true;
-                _verifyState = nonCertified;
-                qCDebug(avatars) << "Avatar " << getDisplayName() << "(" << getSessionUUID() << ") isn't certified";
-            }
+
+                self->generateFSTHash();
+                self->_numberChallenges = 0;
+                if (self->_certificateIdFromFST.length() != 0) {
+                    QString& marketplacePublicKey = EntityItem::_marketplacePublicKey;
+                    bool staticVerification = self->validateFSTHash(marketplacePublicKey);
+
+                    if (staticVerification) {
+                        // the owner request is issued from the next processCertifyEvents call
+                        self->_verifyState = staticValidation;
+                        self->_pendingEvent = true;
+                    } else {
+                        self->_verifyState = verificationFailed;
+                        self->_needsIdentityUpdate = true;
+                        qCDebug(avatars) << "Avatar" << self->getDisplayName() << "(" << self->getSessionUUID()
+                            << ") FAILED static certification";
+                    }
+                } else {  // FST doesn't have a certificate, so noncertified rather than failed:
+                    self->_certifyFailed = false;
+                    self->_needsIdentityUpdate = true;
+                    self->_verifyState = nonCertified;
+                    qCDebug(avatars) << "Avatar " << self->getDisplayName() << "(" << self->getSessionUUID()
+                        << ") isn't certified";
+                }
+            });
             break;
         }
 
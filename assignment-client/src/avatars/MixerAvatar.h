@@ -38,8 +38,8 @@ public:
 
     // Avatar certification/verification:
     enum VerifyState {
-        nonCertified, requestingFST, receivedFST, staticValidation, requestingOwner, ownerResponse,
-        challengeClient, verified, verificationFailed, verificationSucceeded, error
+        nonCertified, requestingFST, receivedFST, staticValidationPending, staticValidation, requestingOwner,
+        ownerResponse, challengeClient, verified, verificationFailed, verificationSucceeded, error
     };
     Q_ENUM(VerifyState)
 
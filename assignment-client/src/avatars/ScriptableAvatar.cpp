@@ -144,48 +144,70 @@ void ScriptableAvatar::update(float deltatime) {
             }
             _animationDetails.currentFrame = currentFrame;
 
-            const std::vector<HFMJoint>& modelJoints = _bind->getHFMModel().joints;
-            QStringList animationJointNames = _animation->getJointNames();
+            // Joint-pose snapshots: only re-evaluate the skeleton when the animation
+            // has advanced perceptibly; between snapshots the previous _jointData
+            // stays current (serialization already culls unchanged joints).
+            const float MIN_SNAPSHOT_FRAME_DELTA = 0.25f;
+            if (_mappedAnimation != _animation || fabsf(currentFrame - _lastEvaluatedFrame) >= MIN_SNAPSHOT_FRAME_DELTA) {
+                _lastEvaluatedFrame = currentFrame;
+
+                const std::vector<HFMJoint>& modelJoints = _bind->getHFMModel().joints;
+
+                // the animation-to-skeleton joint mapping only changes with the
+                // animation, so it is resolved once instead of per frame.
+                // As long as we need the model preRotations anyway, we get the jointIndex
+                // from the bind skeleton rather than trusting the .fst (which is sometimes
+                // not updated to match changes to .fbx).
+                if (_mappedAnimation != _animation) {
+                    _mappedAnimation = _animation;
+                    _mappedJointNames = _animation->getJointNames();
+                    _animationJointMappings.resize(_mappedJointNames.size());
+                    for (int i = 0; i < _mappedJointNames.size(); i++) {
+                        _animationJointMappings[i] = _bind->getHFMModel().getJointIndex(_mappedJointNames[i]);
+                    }
+                }
 
-            const auto nJoints = (int)modelJoints.size();
-            if (_jointData.size() != nJoints) {
-                _jointData.resize(nJoints);
-            }
+                const auto nJoints = (int)modelJoints.size();
+                if (_jointData.size() != nJoints) {
+                    _jointData.resize(nJoints);
+                }
 
-            const int frameCount = _animation->getFrames().size();
-            const HFMAnimationFrame& floorFrame = _animation->getFrames().at((int)glm::floor(currentFrame) % frameCount);
-            const HFMAnimationFrame& ceilFrame = _animation->getFrames().at((int)glm::ceil(currentFrame) % frameCount);
-            const float frameFraction = glm::fract(currentFrame);
-            std::vector<AnimPose> poses = _animSkeleton->getRelativeDefaultPoses();
-
-            const float UNIT_SCALE = 0.01f;
-
-            for (int i = 0; i < animationJointNames.size(); i++) {
-                const QString& name = animationJointNames[i];
-                // As long as we need the model preRotations anyway, let's get the jointIndex from the bind skeleton rather than
-                // trusting the .fst (which is sometimes not updated to match changes to .fbx).
-                int mapping = _bind->getHFMModel().getJointIndex(name);
-                if (mapping != -1 && !_maskedJoints.contains(name)) {
-
-                    AnimPose floorPose = composeAnimPose(modelJoints[mapping], floorFrame.rotations[i], floorFrame.translations[i] * UNIT_SCALE);
-                    AnimPose ceilPose = composeAnimPose(modelJoints[mapping], ceilFrame.rotations[i], floorFrame.translations[i] * UNIT_SCALE);
-                    blend(1, &floorPose, &ceilPose, frameFraction, &poses[mapping]);
-                 }
-            }
+                const int frameCount = _animation->getFrames().size();
+                const HFMAnimationFrame& floorFrame = _animation->getFrames().at((int)glm::floor(currentFrame) % frameCount);
+                const HFMAnimationFrame& ceilFrame = _animation->getFrames().at((int)glm::ceil(currentFrame) % frameCount);
+                const float frameFraction = glm::fract(currentFrame);
+
+                // scratch buffers are members, so the per-frame copies reuse their storage
+                _poseScratch = _animSkeleton->getRelativeDefaultPoses();
+                std::vector<AnimPose>& poses = _poseScratch;
 
-            std::vector<AnimPose> absPoses = poses;
-            _animSkeleton->convertRelativePosesToAbsolute(absPoses);
-            for (int i = 0; i < nJoints; i++) {
-                JointData& data = _jointData[i];
-                AnimPose& absPose = absPoses[i];
-                if (data.rotation != absPose.rot()) {
-                    data.rotation = absPose.rot();
-                    data.rotationIsDefaultPose = false;
+                const float UNIT_SCALE = 0.01f;
+
+                for (int i = 0; i < _mappedJointNames.size(); i++) {
+                    int mapping = _animationJointMappings[i];
+                    if (mapping != -1 && !_maskedJoints.contains(_mappedJointNames[i])) {
+
+                        AnimPose floorPose = composeAnimPose(modelJoints[mapping], floorFrame.rotations[i], floorFrame.translations[i] * UNIT_SCALE);
+                        AnimPose ceilPose = composeAnimPose(modelJoints[mapping], ceilFrame.rotations[i], floorFrame.translations[i] * UNIT_SCALE);
+                        blend(1, &floorPose, &ceilPose, frameFraction, &poses[mapping]);
+                    }
                 }
-                AnimPose& relPose = poses[i];
-                if (data.translation != relPose.trans()) {
-                    data.translation = relPose.trans();
-                    data.translationIsDefaultPose = false;
+
+                _absPoseScratch = poses;
+                std::vector<AnimPose>& absPoses = _absPoseScratch;
+                _animSkeleton->convertRelativePosesToAbsolute(absPoses);
+                for (int i = 0; i < nJoints; i++) {
+                    JointData& data = _jointData[i];
+                    AnimPose& absPose = absPoses[i];
+                    if (data.rotation != absPose.rot()) {
+                        data.rotation = absPose.rot();
+                        data.rotationIsDefaultPose = false;
+                    }
+                    AnimPose& relPose = poses[i];
+                    if (data.translation != relPose.trans()) {
+                        data.translation = relPose.trans();
+                        data.translationIsDefaultPose = false;
+                    }
                 }
             }
 
@@ -372,14 +394,14 @@ void ScriptableAvatar::setAvatarEntityData(const AvatarEntityMap& avatarEntityDa
             }
             if (entity) {
                 // build outgoing payload
-                OctreePacketData packetData(false, AvatarTraits::MAXIMUM_TRAIT_SIZE);
+                PooledOctreePacketData packetData(false, AvatarTraits::MAXIMUM_TRAIT_SIZE);
                 EncodeBitstreamParams params;
                 EntityTreeElementExtraEncodeDataPointer extra { nullptr };
-                OctreeElement::AppendState appendState = entity->appendEntityData(&packetData, params, extra);
+                OctreeElement::AppendState appendState = entity->appendEntityData(packetData.get(), params, extra);
 
                 if (appendState == OctreeElement::COMPLETED) {
                     _entities[id] = entity;
-                    QByteArray tempArray((const char*)packetData.getUncompressedData(), packetData.getUncompressedSize());
+                    QByteArray tempArray((const char*)packetData->getUncompressedData(), packetData->getUncompressedSize());
                     storeAvatarEntityDataPayload(id, tempArray);
                 } else {
                     // payload doesn't fit
@@ -424,14 +446,14 @@ void ScriptableAvatar::updateAvatarEntity(const QUuid& entityID, const QByteArra
         // this is an ADD
         entity = EntityTypes::constructEntityItem(entityID, properties);
         if (entity) {
-            OctreePacketData packetData(false, AvatarTraits::MAXIMUM_TRAIT_SIZE);
+            PooledOctreePacketData packetData(false, AvatarTraits::MAXIMUM_TRAIT_SIZE);
             EncodeBitstreamParams params;
             EntityTreeElementExtraEncodeDataPointer extra { nullptr };
-            OctreeElement::AppendState appendState = entity->appendEntityData(&packetData, params, extra);
+            OctreeElement::AppendState appendState = entity->appendEntityData(packetData.get(), params, extra);
 
             if (appendState == OctreeElement::COMPLETED) {
                 _entities[entityID] = entity;
-                QByteArray tempArray((const char*)packetData.getUncompressedData(), packetData.getUncompressedSize());
+                QByteArray tempArray((const char*)packetData->getUncompressedData(), packetData->getUncompressedSize());
                 storeAvatarEntityDataPayload(entityID, tempArray);
             }
         }
@@ -440,13 +462,13 @@ void ScriptableAvatar::updateAvatarEntity(const QUuid& entityID, const QByteArra
         entity = itr->second;
         bool somethingChanged = entity->setProperties(properties);
         if (somethingChanged) {
-            OctreePacketData packetData(false, AvatarTraits::MAXIMUM_TRAIT_SIZE);
+            PooledOctreePacketData packetData(false, AvatarTraits::MAXIMUM_TRAIT_SIZE);
             EncodeBitstreamParams params;
             EntityTreeElementExtraEncodeDataPointer extra { nullptr };
-            OctreeElement::AppendState appendState = entity->appendEntityData(&packetData, params, extra);
+            OctreeElement::AppendState appendState = entity->appendEntityData(packetData.get(), params, extra);
 
             if (appendState == OctreeElement::COMPLETED) {
-                QByteArray tempArray((const char*)packetData.getUncompressedData(), packetData.getUncompressedSize());
+                QByteArray tempArray((const char*)packetData->getUncompressedData(), packetData->getUncompressedSize());
                 storeAvatarEntityDataPayload(entityID, tempArray);
             }
         }
@@ -214,6 +214,17 @@ public slots:
 private:
     AnimationPointer _animation;
     AnimationDetails _animationDetails;
+
+    // cached animation-to-skeleton joint mapping, rebuilt when the animation changes
+    AnimationPointer _mappedAnimation;
+    QStringList _mappedJointNames;
+    std::vector<int> _animationJointMappings;
+
+    // pose snapshot state - _jointData is a snapshot re-evaluated only when the
+    // animation has advanced perceptibly; scratch buffers reuse their storage
+    float _lastEvaluatedFrame { -1.0e6f };
+    std::vector<AnimPose> _poseScratch;
+    std::vector<AnimPose> _absPoseScratch;
     QStringList _maskedJoints;
     AnimationPointer _bind; // a sleazy way to get the skeleton, given the various library/cmake dependencies
     std::shared_ptr<AnimSkeleton> _animSkeleton;
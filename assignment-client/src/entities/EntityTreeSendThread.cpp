@@ -11,6 +11,8 @@
 
 #include "EntityTreeSendThread.h"
 
+#include <SpanTimer.h>
+
 #include <EntityNodeData.h>
 #include <EntityTypes.h>
 #include <OctreeUtils.h>
@@ -99,8 +101,14 @@ void EntityTreeSendThread::preDistributionProcessing() {
     }
 }
 
+// always-on spans over the entity server's hot path, reported in the server's stats
+static SpanTimer entityTraverseSpan("entityTraverseAndSend");
+static SpanTimer entityBuildPacketSpan("entityBuildPacketPayload");
+
 bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData,
             bool viewFrustumChanged, bool isFullScene) {
+    SpanTimer::Scope span(entityTraverseSpan);
+
     if (viewFrustumChanged || _traversal.finished()) {
         EntityTreeElementPointer root = std::dynamic_pointer_cast<EntityTreeElement>(_myServer->getOctree()->getRoot());
 
@@ -256,7 +264,38 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
                 });
             });
             break;
-        case DiffTraversal::Repeat:
+        case DiffTraversal::Repeat: {
+            // Fast path: when the tree's changed-entity log covers the window since
+            // the last completed traversal, queue those entities directly and skip
+            // the octree descent entirely.
+            uint64_t sinceTime = _traversal.getStartOfCompletedTraversal();
+            std::vector<EntityItemPointer> changedEntities;
+            if (root->getTree() && root->getTree()->getChangedEntitiesSince(sinceTime, changedEntities)) {
+                for (const auto& entity : changedEntities) {
+                    if (_sendQueue.contains(entity.get())) {
+                        continue;
+                    }
+                    float priority = PrioritizedEntity::DO_NOT_SEND;
+
+                    auto knownTimestamp = _knownState.find(entity.get());
+                    if (knownTimestamp == _knownState.end()) {
+                        const auto& view = _traversal.getCurrentView();
+                        priority = view.computePriority(entity);
+
+                    } else if (entity->getLastEdited() > knownTimestamp->second ||
+                               entity->getLastChangedOnServer() > knownTimestamp->second) {
+                        // it is known and it changed --> put it on the queue with any priority
+                        priority = PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
+                    }
+
+                    if (priority != PrioritizedEntity::DO_NOT_SEND) {
+                        _sendQueue.emplace(entity, priority);
+                    }
+                }
+                _traversal.completeWithoutTraversal();
+                break;
+            }
+
             _traversal.setScanCallback([this](DiffTraversal::VisibleElement& next) {
                 uint64_t startOfCompletedTraversal = _traversal.getStartOfCompletedTraversal();
                 if (next.element->getLastChangedContent() > startOfCompletedTraversal) {
@@ -286,6 +325,7 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
                 }
             });
             break;
+        }
         case DiffTraversal::Differential:
             assert(view.usesViewFrustums());
             _traversal.setScanCallback([this] (DiffTraversal::VisibleElement& next) {
@@ -318,6 +358,8 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
 }
 
 bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) {
+    SpanTimer::Scope span(entityBuildPacketSpan);
+
     if (_sendQueue.empty()) {
         params.stopReason = EncodeBitstreamParams::FINISHED;
         OctreeServer::trackEncodeTime(OctreeServer::SKIP_TIME);
@@ -21,6 +21,83 @@
 
 const QString MESSAGES_MIXER_LOGGING_NAME = "messages-mixer";
 
+// channels are hashed across a small pool of worker threads; one channel always lands on the
+// same worker, so per-channel ordering is preserved
+const int NUM_MESSAGES_WORKERS = 4;
+
+void MessagesMixerWorker::processMessage(const QString& channel, bool isText, const QString& message,
+                                         const QByteArray& data, const QUuid& senderID) {
+    auto subscribers = _channelSubscribers.constFind(channel);
+
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    // serialize the message once; subscribers get a copy of the serialized payload rather than
+    // a full re-encode per recipient
+    QByteArray payload;
+    {
+        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
+                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
+        payload = packetList->getMessage();
+    }
+
+    quint64 messagesOut = 0;
+    if (subscribers != _channelSubscribers.constEnd() && !subscribers.value().isEmpty()) {
+        nodeList->eachMatchingNode(
+            [&](const SharedNodePointer& node)->bool {
+            return node->getActiveSocket() && subscribers.value().contains(node->getUUID());
+        },
+            [&](const SharedNodePointer& node) {
+            auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+            packetList->write(payload);
+            nodeList->sendPacketList(std::move(packetList), *node);
+            messagesOut++;
+        });
+    }
+
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    auto& stats = _channelStats[channel];
+    stats.messagesIn++;
+    stats.bytesIn += payload.size();
+    stats.messagesOut += messagesOut;
+    stats.bytesOut += messagesOut * payload.size();
+}
+
+void MessagesMixerWorker::addSubscriber(const QString& channel, const QUuid& nodeID) {
+    _channelSubscribers[channel] << nodeID;
+}
+
+void MessagesMixerWorker::removeSubscriber(const QString& channel, const QUuid& nodeID) {
+    auto it = _channelSubscribers.find(channel);
+    if (it != _channelSubscribers.end()) {
+        it.value().remove(nodeID);
+    }
+}
+
+void MessagesMixerWorker::removeNode(const QUuid& nodeID) {
+    for (auto& channel : _channelSubscribers) {
+        channel.remove(nodeID);
+    }
+}
+
+QJsonObject MessagesMixerWorker::takeChannelStats() {
+    QHash<QString, ChannelStats> stats;
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        stats.swap(_channelStats);
+    }
+
+    QJsonObject channelsObject;
+    for (auto it = stats.constBegin(); it != stats.constEnd(); ++it) {
+        QJsonObject channelObject;
+        channelObject["messages_in"] = (qint64)it.value().messagesIn;
+        channelObject["bytes_in"] = (qint64)it.value().bytesIn;
+        channelObject["messages_out"] = (qint64)it.value().messagesOut;
+        channelObject["bytes_out"] = (qint64)it.value().bytesOut;
+        channelsObject[it.key()] = channelObject;
+    }
+    return channelsObject;
+}
+
 MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(message)
 {
     connect(DependencyManager::get<NodeList>().data(), &NodeList::nodeKilled, this, &MessagesMixer::nodeKilled);
@@ -28,11 +105,34 @@ MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(mess
     packetReceiver.registerListener(PacketType::MessagesData, this, "handleMessages");
     packetReceiver.registerListener(PacketType::MessagesSubscribe, this, "handleMessagesSubscribe");
     packetReceiver.registerListener(PacketType::MessagesUnsubscribe, this, "handleMessagesUnsubscribe");
+
+    for (int i = 0; i < NUM_MESSAGES_WORKERS; i++) {
+        auto thread = std::unique_ptr<QThread>(new QThread());
+        thread->setObjectName(QString("Messages Worker %1").arg(i));
+        auto worker = std::unique_ptr<MessagesMixerWorker>(new MessagesMixerWorker());
+        worker->moveToThread(thread.get());
+        thread->start();
+        _workerThreads.push_back(std::move(thread));
+        _workers.push_back(std::move(worker));
+    }
+}
+
+MessagesMixer::~MessagesMixer() {
+    for (auto& thread : _workerThreads) {
+        thread->quit();
+        thread->wait();
+    }
+}
+
+MessagesMixerWorker* MessagesMixer::workerForChannel(const QString& channel) {
+    return _workers[(uint)qHash(channel) % (uint)_workers.size()].get();
 }
 
 void MessagesMixer::nodeKilled(SharedNodePointer killedNode) {
-    for (auto& channel : _channelSubscribers) {
-        channel.remove(killedNode->getUUID());
+    auto nodeID = killedNode->getUUID();
+    for (auto& worker : _workers) {
+        auto workerPtr = worker.get();
+        QMetaObject::invokeMethod(workerPtr, [workerPtr, nodeID] { workerPtr->removeNode(nodeID); });
     }
 }
 
@@ -43,29 +143,24 @@ void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessa
     bool isText;
     MessagesClient::decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
 
-    auto nodeList = DependencyManager::get<NodeList>();
-
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
-        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
-                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
-        nodeList->sendPacketList(std::move(packetList), *node);
+    auto worker = workerForChannel(channel);
+    QMetaObject::invokeMethod(worker, [worker, channel, isText, message, data, senderID] {
+        worker->processMessage(channel, isText, message, data, senderID);
     });
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
     QString channel = QString::fromUtf8(message->getMessage());
-    _channelSubscribers[channel] << senderNode->getUUID();
+    auto worker = workerForChannel(channel);
+    auto nodeID = senderNode->getUUID();
+    QMetaObject::invokeMethod(worker, [worker, channel, nodeID] { worker->addSubscriber(channel, nodeID); });
 }
 
 void MessagesMixer::handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
     QString channel = QString::fromUtf8(message->getMessage());
-    if (_channelSubscribers.contains(channel)) {
-        _channelSubscribers[channel].remove(senderNode->getUUID());
-    }
+    auto worker = workerForChannel(channel);
+    auto nodeID = senderNode->getUUID();
+    QMetaObject::invokeMethod(worker, [worker, channel, nodeID] { worker->removeSubscriber(channel, nodeID); });
 }
 
 void MessagesMixer::sendStatsPacket() {
@@ -80,7 +175,18 @@ void MessagesMixer::sendStatsPacket() {
         messagesMixerObject[uuidStringWithoutCurlyBraces(node->getUUID())] = clientStats;
     });
 
+    // per-channel traffic since the last stats packet, merged across the workers - this is
+    // where abusive channels show up
+    QJsonObject channelsObject;
+    for (auto& worker : _workers) {
+        auto workerChannels = worker->takeChannelStats();
+        for (auto it = workerChannels.constBegin(); it != workerChannels.constEnd(); ++it) {
+            channelsObject[it.key()] = it.value();
+        }
+    }
+
     statsObject["messages"] = messagesMixerObject;
+    statsObject["channels"] = channelsObject;
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(statsObject);
 }
 
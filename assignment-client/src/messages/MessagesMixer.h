@@ -15,13 +15,49 @@
 #ifndef hifi_MessagesMixer_h
 #define hifi_MessagesMixer_h
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QThread>
+
 #include <ThreadedAssignment.h>
 
+/// Owns the subscribers and traffic stats for the channels hashed to one worker thread. All
+/// mutation happens on the worker's thread via queued invocation from the mixer; only the stats
+/// snapshot is read across threads, under its mutex.
+class MessagesMixerWorker : public QObject {
+    Q_OBJECT
+public:
+    void processMessage(const QString& channel, bool isText, const QString& message,
+                        const QByteArray& data, const QUuid& senderID);
+    void addSubscriber(const QString& channel, const QUuid& nodeID);
+    void removeSubscriber(const QString& channel, const QUuid& nodeID);
+    void removeNode(const QUuid& nodeID);
+
+    // counts since the last call, keyed by channel, for the stats packet
+    QJsonObject takeChannelStats();
+
+private:
+    QHash<QString, QSet<QUuid>> _channelSubscribers;
+
+    struct ChannelStats {
+        quint64 messagesIn { 0 };
+        quint64 bytesIn { 0 };
+        quint64 messagesOut { 0 };
+        quint64 bytesOut { 0 };
+    };
+    std::mutex _statsMutex;
+    QHash<QString, ChannelStats> _channelStats;
+};
+
 /// Handles assignments of type MessagesMixer - distribution of avatar data to various clients
 class MessagesMixer : public ThreadedAssignment {
     Q_OBJECT
 public:
     MessagesMixer(ReceivedMessage& message);
+    ~MessagesMixer();
 
 public slots:
     void run() override;
@@ -34,7 +70,10 @@ private slots:
     void handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
 
 private:
-    QHash<QString,QSet<QUuid>> _channelSubscribers;
+    MessagesMixerWorker* workerForChannel(const QString& channel);
+
+    std::vector<std::unique_ptr<QThread>> _workerThreads;
+    std::vector<std::unique_ptr<MessagesMixerWorker>> _workers;
 };
 
 #endif // hifi_MessagesMixer_h
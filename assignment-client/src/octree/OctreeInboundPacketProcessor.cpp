@@ -11,6 +11,8 @@
 
 #include "OctreeInboundPacketProcessor.h"
 
+#include <SpanTimer.h>
+
 #include <limits>
 
 #include <NumericalConstants.h>
@@ -77,6 +79,9 @@ void OctreeInboundPacketProcessor::midProcess() {
 }
 
 void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+    static SpanTimer octreeInboundSpan("octreeInboundPacket");
+    SpanTimer::Scope span(octreeInboundSpan);
+
     if (_shuttingDown) {
         qDebug() << "OctreeInboundPacketProcessor::processPacket() while shutting down... ignoring incoming packet";
         return;
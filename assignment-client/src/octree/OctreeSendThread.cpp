@@ -101,8 +101,9 @@ bool OctreeSendThread::process() {
         return false; // exit early if we're shutting down
     }
 
-    // Only sleep if we're still running and we got the lock last time we tried, otherwise try to get the lock asap
-    if (isStillRunning()) {
+    // Only sleep if we're still running and we got the lock last time we tried, otherwise try to get the lock asap.
+    // In pooled (non-threaded) mode the worker loop owns the pacing instead.
+    if (isStillRunning() && isThreaded()) {
         // dynamically sleep until we need to fire off the next set of octree elements
         int elapsed = (usecTimestampNow() - start);
         int usecToSleep =  OCTREE_SEND_INTERVAL_USECS - elapsed;
@@ -11,8 +11,11 @@
 
 #include "OctreeServer.h"
 
+#include <Metrics.h>
+
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <SpanTimer.h>
 #include <QTimer>
 
 #include <time.h>
@@ -283,6 +286,16 @@ void OctreeServer::initHTTPManager(int port) {
 
     // setup an httpManager with us as the request handler and the parent
     _httpManager.reset(new HTTPManager(QHostAddress::AnyIPv4, port, documentRoot, this));
+
+    // the hot-path averages already exist; surface them for the /metrics scrape
+    _processMetrics.emplace_back(new metrics::Gauge("hifi_octree_average_loop_time_usecs",
+        "Average octree send loop time", [] { return (double)getAverageLoopTime(); }));
+    _processMetrics.emplace_back(new metrics::Gauge("hifi_octree_average_encode_time_usecs",
+        "Average octree encode time", [] { return (double)getAverageEncodeTime(); }));
+    _processMetrics.emplace_back(new metrics::Gauge("hifi_octree_average_tree_wait_time_usecs",
+        "Average octree tree lock wait time", [] { return (double)getAverageTreeWaitTime(); }));
+    _processMetrics.emplace_back(new metrics::Gauge("hifi_octree_average_compress_and_write_time_usecs",
+        "Average octree compress-and-write time", [] { return (double)getAverageCompressAndWriteTime(); }));
 }
 
 bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler) {
@@ -308,6 +321,12 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
     bool showStats = false;
 
     if (connection->requestOperation() == QNetworkAccessManager::GetOperation) {
+        if (url.path() == "/metrics") {
+            // Prometheus scrape of the registered process metrics
+            connection->respond(HTTPConnection::StatusCode200, metrics::renderPrometheusText(),
+                                metrics::PROMETHEUS_MIME_TYPE);
+            return true;
+        }
         if (url.path() == "/") {
             showStats = true;
         } else if (url.path() == "/resetStats") {
@@ -876,13 +895,86 @@ void OctreeServer::parsePayload() {
 OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePointer& node) {
     auto sendThread = newSendThread(node);
 
-    // we want to be notified when the thread finishes
-    connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread);
-    sendThread->initialize(true);
+    if (_numSendWorkers > 0) {
+        // pooled mode: the send thread runs non-threaded and is driven by a worker
+        sendThread->initialize(false);
+        startSendWorkers();
+        {
+            std::lock_guard<std::mutex> lock(_pooledSendThreadsMutex);
+            _pooledSendThreads[_nextSendWorker].push_back(sendThread.get());
+            _nextSendWorker = (_nextSendWorker + 1) % _numSendWorkers;
+        }
+    } else {
+        // we want to be notified when the thread finishes
+        connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread);
+        sendThread->initialize(true);
+    }
 
     return sendThread;
 }
 
+void OctreeServer::startSendWorkers() {
+    if (!_sendWorkers.empty()) {
+        return;
+    }
+
+    _pooledSendThreads.resize(_numSendWorkers);
+    for (int i = 0; i < _numSendWorkers; ++i) {
+        _sendWorkers.emplace_back([this, i] { sendWorkerLoop(i); });
+    }
+    qDebug() << qPrintable(_safeServerName) << "server started" << _numSendWorkers << "send workers";
+}
+
+void OctreeServer::stopSendWorkers() {
+    _stopSendWorkers = true;
+    for (auto& worker : _sendWorkers) {
+        worker.join();
+    }
+    _sendWorkers.clear();
+    _pooledSendThreads.clear();
+}
+
+void OctreeServer::sendWorkerLoop(int workerIndex) {
+    while (!_stopSendWorkers) {
+        quint64 start = usecTimestampNow();
+
+        // snapshot this worker's clients; each client belongs to exactly one worker
+        std::vector<OctreeSendThread*> sendThreads;
+        {
+            std::lock_guard<std::mutex> lock(_pooledSendThreadsMutex);
+            sendThreads = _pooledSendThreads[workerIndex];
+        }
+
+        for (auto* sendThread : sendThreads) {
+            // one process() pass per interval, in non-threaded mode
+            sendThread->threadRoutine();
+        }
+
+        // retire clients that have shut down: drop them from this worker's list
+        // first, then destroy them on the main thread
+        for (auto* sendThread : sendThreads) {
+            if (sendThread->isShuttingDown()) {
+                {
+                    std::lock_guard<std::mutex> lock(_pooledSendThreadsMutex);
+                    auto& mine = _pooledSendThreads[workerIndex];
+                    mine.erase(std::remove(mine.begin(), mine.end(), sendThread), mine.end());
+                }
+                QUuid nodeUuid = sendThread->getNodeUuid();
+                QMetaObject::invokeMethod(this, [this, nodeUuid] {
+                    _sendThreads.erase(nodeUuid);
+                }, Qt::QueuedConnection);
+            }
+        }
+
+        // pace the pool to the octree send interval
+        int elapsed = (int)(usecTimestampNow() - start);
+        int usecToSleep = OCTREE_SEND_INTERVAL_USECS - elapsed;
+        if (usecToSleep > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
+        }
+    }
+}
+
 void OctreeServer::removeSendThread() {
     // If the object has been deleted since the event was queued, sender() will return nullptr
     if (auto sendThread = qobject_cast<OctreeSendThread*>(sender())) {
@@ -1011,6 +1103,11 @@ void OctreeServer::readConfiguration() {
         qDebug() << "statusPort= DISABLED";
     }
 
+    readOptionInt(QString("sendWorkerThreads"), settingsSectionObject, _numSendWorkers);
+    if (_numSendWorkers > 0) {
+        qDebug("sendWorkerThreads=%d (pooled scene traversal)", _numSendWorkers);
+    }
+
     readOptionBool(QString("verboseDebug"), settingsSectionObject, _verboseDebug);
     qDebug("verboseDebug=%s", debug::valueOf(_verboseDebug));
 
@@ -1295,6 +1392,9 @@ void OctreeServer::aboutToFinish() {
         sendThread.terminate();
     }
 
+    // stop the pooled send workers, if running
+    stopSendWorkers();
+
     // Clear will destruct all the unique_ptr to OctreeSendThreads which will call the GenericThread's dtor
     // which waits on the thread to be done before returning
     _sendThreads.clear(); // Cleans up all the send threads.
@@ -1421,6 +1521,7 @@ void OctreeServer::sendStatsPacket() {
     statsArray1["4. persistFileLoadTime"] = getFileLoadTime();
     statsArray1["5. clients"] = getCurrentClientCount();
     statsArray1["6. threads"] = threadsStats;
+    statsArray1["7. spans"] = SpanTimer::getAllSpanStats();
 
     // Octree Stats
     QJsonObject octreeStats;
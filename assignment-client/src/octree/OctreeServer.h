@@ -12,6 +12,7 @@
 #ifndef hifi_OctreeServer_h
 #define hifi_OctreeServer_h
 
+#include <Metrics.h>
 #include <memory>
 
 #include <QStringList>
@@ -23,6 +24,10 @@
 #include <ThreadedAssignment.h>
 
 #include "OctreePersistThread.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include "OctreeSendThread.h"
 #include "OctreeServerConsts.h"
 #include "OctreeInboundPacketProcessor.h"
@@ -128,6 +133,8 @@ public:
 
     bool handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler) override;
 
+    std::vector<std::unique_ptr<metrics::Metric>> _processMetrics;
+
     virtual void aboutToFinish() override;
 
 public slots:
@@ -145,6 +152,11 @@ private slots:
 
 protected:
     using UniqueSendThread = std::unique_ptr<OctreeSendThread>;
+
+    // fixed worker pool driving per-client send threads in non-threaded mode
+    void startSendWorkers();
+    void stopSendWorkers();
+    void sendWorkerLoop(int workerIndex);
     using SendThreads = std::unordered_map<QUuid, UniqueSendThread>;
     
     virtual OctreePointer createTree() = 0;
@@ -203,6 +215,15 @@ protected:
     
     SendThreads _sendThreads;
 
+    // when sendWorkerThreads > 0, clients are serviced by this fixed pool instead
+    // of one OS thread per client
+    int _numSendWorkers { 0 };
+    std::vector<std::thread> _sendWorkers;
+    std::mutex _pooledSendThreadsMutex;
+    std::vector<std::vector<OctreeSendThread*>> _pooledSendThreads;     // one list per worker
+    int _nextSendWorker { 0 };
+    std::atomic<bool> _stopSendWorkers { false };
+
     static int _clientCount;
     static SimpleMovingAverage _averageLoopTime;
 
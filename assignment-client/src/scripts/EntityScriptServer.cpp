@@ -13,6 +13,8 @@
 
 #include <mutex>
 
+#include <QtCore/QTimer>
+
 #include <AudioConstants.h>
 #include <AudioInjectorManager.h>
 #include <ClientServerUtils.h>
@@ -439,7 +441,7 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
     }
 }
 
-void EntityScriptServer::resetEntitiesScriptEngine() {
+ScriptEnginePointer EntityScriptServer::buildEntitiesScriptEngine() {
     auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
     auto newEngine = scriptEngineFactory(ScriptEngine::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
 
@@ -456,14 +458,35 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
     connect(newEngine.data(), &ScriptEngine::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
     connect(newEngine.data(), &ScriptEngine::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
 
+    scriptEngines->runScriptInitializers(newEngine);
+    newEngine->runInThread();
+
+    return newEngine;
+}
+
+void EntityScriptServer::prewarmStandbyScriptEngine() {
+    if (_shuttingDown || _standbyScriptEngine) {
+        return;
+    }
+    // built ahead of time - with its thread running and global environment initialized - so the
+    // next reset can swap engines without paying construction cost during restart recovery
+    _standbyScriptEngine = buildEntitiesScriptEngine();
+}
+
+void EntityScriptServer::resetEntitiesScriptEngine() {
+    ScriptEnginePointer newEngine;
+    if (_standbyScriptEngine) {
+        newEngine.swap(_standbyScriptEngine);
+    } else {
+        newEngine = buildEntitiesScriptEngine();
+    }
+
     connect(newEngine.data(), &ScriptEngine::update, this, [this] {
         _entityViewer.queryOctree();
         _entityViewer.getTree()->preUpdate();
         _entityViewer.getTree()->update();
     });
 
-    scriptEngines->runScriptInitializers(newEngine);
-    newEngine->runInThread();
     auto newEngineSP = qSharedPointerCast<EntitiesScriptEngineProvider>(newEngine);
     DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(newEngineSP);
 
@@ -475,6 +498,9 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
     _entitiesScriptEngine.swap(newEngine);
     connect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
             this, &EntityScriptServer::updateEntityPPS);
+
+    // start warming the next engine once the current reload settles
+    QTimer::singleShot(0, this, &EntityScriptServer::prewarmStandbyScriptEngine);
 }
 
 
@@ -501,6 +527,12 @@ void EntityScriptServer::shutdownScriptEngine() {
     }
     _shuttingDown = true;
 
+    if (_standbyScriptEngine) {
+        _standbyScriptEngine->stop();
+        _standbyScriptEngine->waitTillDoneRunning();
+        _standbyScriptEngine.clear();
+    }
+
     clear(); // always clear() on shutdown
 
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
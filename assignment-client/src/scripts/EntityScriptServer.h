@@ -62,6 +62,8 @@ private:
     void selectAudioFormat(const QString& selectedCodecName);
 
     void resetEntitiesScriptEngine();
+    ScriptEnginePointer buildEntitiesScriptEngine();
+    void prewarmStandbyScriptEngine();
     void clear();
     void shutdownScriptEngine();
 
@@ -76,6 +78,9 @@ private:
 
     static int _entitiesScriptEngineCount;
     ScriptEnginePointer _entitiesScriptEngine;
+    // a fully-initialized engine kept warm in the background, so swapping engines on reload
+    // (domain restart recovery) does not pay engine construction and initializer cost
+    ScriptEnginePointer _standbyScriptEngine;
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
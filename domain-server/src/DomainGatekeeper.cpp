@@ -17,6 +17,8 @@
 #include <random>
 
 #include <QDataStream>
+#include <QtCore/QPointer>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include <AccountManager.h>
 #include <Assignment.h>
@@ -104,6 +106,26 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
             }
         }
 
+        if (!username.isEmpty() && !usernameSignature.isEmpty()) {
+            auto lowerUsername = username.toLower();
+            // only the RSA verification is worth a worker hop, and it needs both a key and a
+            // live connection token; anything else falls through to the cheap synchronous path
+            if (!_userPublicKeys.value(lowerUsername).first.isEmpty()
+                    && !_connectionTokenHash.value(lowerUsername).isNull()) {
+                auto verdictKey = signatureVerdictKey(lowerUsername, usernameSignature);
+                if (!_signatureVerdicts.contains(verdictKey)) {
+                    // park the request and replay it once the crypto verdict lands; repeated
+                    // requests for the same signature just refresh the parked packet
+                    bool alreadyQueued = _pendingSignatureVerifications.contains(verdictKey);
+                    _pendingSignatureVerifications[verdictKey] = message;
+                    if (!alreadyQueued) {
+                        queueSignatureVerification(lowerUsername, usernameSignature, verdictKey);
+                    }
+                    return;
+                }
+            }
+        }
+
         node = processAgentConnectRequest(nodeConnection, username, usernameSignature);
     }
 
@@ -131,6 +153,8 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
             << "previous connection uptime" << nodeConnection.previousConnectionUpTime/USECS_PER_MSEC << "msec"
             << "sysinfo" << nodeConnection.SystemInfo;
 
+        _admittedNodeCount++;
+
         // signal that we just connected a node so the DomainServer can get it a list
         // and broadcast its presence right away
         emit connectedNode(node, message->getFirstPacketReceiveTime());
@@ -409,7 +433,11 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
     if (!username.isEmpty()) {
         const QUuid& connectionToken = _connectionTokenHash.value(username.toLower());
 
-        if (usernameSignature.isEmpty() || connectionToken.isNull()) {
+        if (!usernameSignature.isEmpty() && canResumeSession(username, usernameSignature, nodeConnection)) {
+            // a returning node inside the resumption window presenting the exact signature we
+            // already verified - restore the session without a token round trip or any crypto
+            verifiedUsername = username.toLower();
+        } else if (usernameSignature.isEmpty() || connectionToken.isNull()) {
             // user is attempting to prove their identity to us, but we don't have enough information
             sendConnectionTokenPacket(username, nodeConnection.senderSockAddr);
 
@@ -424,6 +452,7 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
             // they sent us a username and the signature verifies it
             getGroupMemberships(username);
             verifiedUsername = username.toLower();
+            storeSessionResumption(username, usernameSignature, nodeConnection);
         } else {
             // they sent us a username, but it didn't check out
             requestUserPublicKey(username);
@@ -558,11 +587,150 @@ void DomainGatekeeper::cleanupICEPeerForNode(const QUuid& nodeID) {
     }
 }
 
+// how long a verified session may be resumed without redoing verification
+const quint64 SESSION_RESUMPTION_WINDOW_USECS = 2 * 60 * USECS_PER_SECOND;
+static const QString ENABLE_SESSION_RESUMPTION_SETTING = "security.enable_session_resumption";
+
+bool DomainGatekeeper::sessionResumptionEnabled() {
+    return _server->_settingsManager.valueOrDefaultValueForKeyPath(ENABLE_SESSION_RESUMPTION_SETTING).toBool();
+}
+
+QByteArray DomainGatekeeper::sessionResumptionDigest(const QByteArray& usernameSignature) const {
+    // keyed with the per-run secret so a stored record by itself cannot reconstruct the token
+    QCryptographicHash hasher(QCryptographicHash::Sha256);
+    hasher.addData(_sessionResumptionSecret);
+    hasher.addData(usernameSignature);
+    return hasher.result();
+}
+
+bool DomainGatekeeper::canResumeSession(const QString& username, const QByteArray& usernameSignature,
+                                        const NodeConnectionData& nodeConnection) {
+    if (!sessionResumptionEnabled()) {
+        return false;
+    }
+
+    auto lowerUsername = username.toLower();
+    auto it = _sessionResumptions.find(lowerUsername);
+    if (it == _sessionResumptions.end()) {
+        return false;
+    }
+
+    if (usecTimestampNow() > it->expiryTimestamp) {
+        _sessionResumptions.erase(it);
+        return false;
+    }
+
+    // the signature was verified against the user's key when the record was stored; the machine
+    // fingerprint and the full source sockaddr (address AND port, so a neighbor behind the same
+    // NAT cannot replay a captured packet) must all still match
+    return it->signatureDigest == sessionResumptionDigest(usernameSignature)
+        && it->machineFingerprint == nodeConnection.machineFingerprint
+        && it->senderSockAddr == nodeConnection.senderSockAddr;
+}
+
+void DomainGatekeeper::storeSessionResumption(const QString& username, const QByteArray& usernameSignature,
+                                              const NodeConnectionData& nodeConnection) {
+    if (!sessionResumptionEnabled()) {
+        return;
+    }
+
+    if (_sessionResumptionSecret.isEmpty()) {
+        _sessionResumptionSecret = QUuid::createUuid().toRfc4122() + QUuid::createUuid().toRfc4122();
+    }
+
+    SessionResumption resumption;
+    resumption.signatureDigest = sessionResumptionDigest(usernameSignature);
+    resumption.machineFingerprint = nodeConnection.machineFingerprint;
+    resumption.senderSockAddr = nodeConnection.senderSockAddr;
+    resumption.expiryTimestamp = usecTimestampNow() + SESSION_RESUMPTION_WINDOW_USECS;
+    _sessionResumptions[username.toLower()] = resumption;
+}
+
+QString DomainGatekeeper::signatureVerdictKey(const QString& lowerUsername, const QByteArray& usernameSignature) {
+    return lowerUsername + "." + QString::fromLatin1(
+        QCryptographicHash::hash(usernameSignature, QCryptographicHash::Sha256).toHex());
+}
+
+// the pure crypto from verifyUserSignature, safe to run on any thread: no gatekeeper state
+static bool verifySignatureWithKey(const QByteArray& publicKeyArray, const QString& lowerUsername,
+                                   const QUuid& connectionToken, const QByteArray& usernameSignature) {
+    const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKeyArray.constData());
+    RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, publicKeyArray.size());
+    if (!rsaPublicKey) {
+        return false;
+    }
+
+    QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
+    QByteArray usernameWithToken = QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()),
+                                                            QCryptographicHash::Sha256);
+
+    int verifyResult = RSA_verify(NID_sha256,
+                                  reinterpret_cast<const unsigned char*>(usernameWithToken.constData()),
+                                  usernameWithToken.size(),
+                                  reinterpret_cast<const unsigned char*>(usernameSignature.constData()),
+                                  usernameSignature.size(),
+                                  rsaPublicKey);
+    RSA_free(rsaPublicKey);
+    return verifyResult == 1;
+}
+
+void DomainGatekeeper::queueSignatureVerification(const QString& lowerUsername, const QByteArray& usernameSignature,
+                                                  const QString& verdictKey) {
+    auto publicKeyArray = _userPublicKeys.value(lowerUsername).first;
+    auto connectionToken = _connectionTokenHash.value(lowerUsername);
+
+    QPointer<DomainGatekeeper> self { this };
+    QtConcurrent::run([self, publicKeyArray, lowerUsername, connectionToken, usernameSignature, verdictKey] {
+        bool verified = verifySignatureWithKey(publicKeyArray, lowerUsername, connectionToken, usernameSignature);
+        if (self) {
+            QMetaObject::invokeMethod(self.data(), "signatureVerificationComplete",
+                                      Q_ARG(QString, verdictKey), Q_ARG(bool, verified));
+        }
+    });
+}
+
+void DomainGatekeeper::signatureVerificationComplete(QString verdictKey, bool success) {
+    _signatureVerificationCount++;
+    _signatureVerdicts[verdictKey] = success;
+
+    auto parkedRequest = _pendingSignatureVerifications.take(verdictKey);
+    if (parkedRequest) {
+        // replay the parked connect request; verifyUserSignature consumes the verdict below
+        processConnectRequestPacket(parkedRequest);
+    }
+
+    // verdicts are single-use, so the map stays bounded
+    _signatureVerdicts.remove(verdictKey);
+}
+
 bool DomainGatekeeper::verifyUserSignature(const QString& username,
                                            const QByteArray& usernameSignature,
                                            const HifiSockAddr& senderSockAddr) {
     // it's possible this user can be allowed to connect, but we need to check their username signature
     auto lowerUsername = username.toLower();
+
+    // a verdict computed off-thread for this exact signature short-circuits the RSA work here
+    auto verdict = _signatureVerdicts.constFind(signatureVerdictKey(lowerUsername, usernameSignature));
+    if (verdict != _signatureVerdicts.constEnd()) {
+        if (verdict.value()) {
+            qDebug() << "Username signature matches for" << username;
+            _connectionTokenHash.remove(username);
+            return true;
+        }
+
+        bool isOptimisticKey = _userPublicKeys.value(lowerUsername).second;
+        if (!senderSockAddr.isNull() && !isOptimisticKey) {
+            qDebug() << "Error decrypting username signature for" << username << "- denying connection.";
+            sendConnectionDeniedPacket("Error decrypting username signature.", senderSockAddr,
+                DomainHandler::ConnectionRefusedReason::LoginError);
+        } else if (!senderSockAddr.isNull()) {
+            qDebug() << "Error decrypting username signature for" << username << "with optimisitic key -"
+                << "re-requesting public key and delaying connection";
+        }
+        requestUserPublicKey(username);
+        return false;
+    }
+
     KeyFlagPair publicKeyPair = _userPublicKeys.value(lowerUsername);
 
     QByteArray publicKeyArray = publicKeyPair.first;
@@ -45,6 +45,12 @@ public:
     Node::LocalID findOrCreateLocalID(const QUuid& uuid);
 
     static void sendProtocolMismatchConnectionDenial(const HifiSockAddr& senderSockAddr);
+
+    // admission pipeline metrics, read by the stats surface
+    int getPendingVerificationCount() const { return _pendingSignatureVerifications.size(); }
+    quint64 getAdmittedNodeCount() const { return _admittedNodeCount; }
+    quint64 getSignatureVerificationCount() const { return _signatureVerificationCount; }
+
 public slots:
     void processConnectRequestPacket(QSharedPointer<ReceivedMessage> message);
     void processICEPingPacket(QSharedPointer<ReceivedMessage> message);
@@ -62,6 +68,8 @@ public slots:
 
     void refreshGroupsCache();
 
+    void signatureVerificationComplete(QString verdictKey, bool success);
+
 signals:
     void killNode(SharedNodePointer node);
     void connectedNode(SharedNodePointer node, quint64 requestReceiveTime);
@@ -81,6 +89,15 @@ private:
     
     bool verifyUserSignature(const QString& username, const QByteArray& usernameSignature,
                              const HifiSockAddr& senderSockAddr);
+
+    static QString signatureVerdictKey(const QString& lowerUsername, const QByteArray& usernameSignature);
+
+    bool canResumeSession(const QString& username, const QByteArray& usernameSignature,
+                          const NodeConnectionData& nodeConnection);
+    void storeSessionResumption(const QString& username, const QByteArray& usernameSignature,
+                                const NodeConnectionData& nodeConnection);
+    void queueSignatureVerification(const QString& lowerUsername, const QByteArray& usernameSignature,
+                                    const QString& verdictKey);
     bool isWithinMaxCapacity();
     
     bool shouldAllowConnectionFromNode(const QString& username, const QByteArray& usernameSignature,
@@ -115,6 +132,30 @@ private:
 
     using KeyFlagPair = QPair<QByteArray, bool>;
 
+    // asynchronous username-signature pipeline: the RSA verification runs on worker threads,
+    // the connect request is parked here and replayed once the verdict lands, and node
+    // admission stays serialized on this thread at the final insert
+    QHash<QString, QSharedPointer<ReceivedMessage>> _pendingSignatureVerifications; // verdict key -> parked request
+    QHash<QString, bool> _signatureVerdicts; // single-use verdicts consumed on replay
+
+    // session resumption (opt-in via security.enable_session_resumption): after a successful
+    // verification a digest of the verified signature keyed with a per-run server secret acts as
+    // a short-lived resumption token, so a briefly-disconnected node reconnecting from the same
+    // address, port and machine can skip the connection-token round trip and the RSA
+    // verification; only the digest is stored, so the record alone cannot reproduce the token
+    struct SessionResumption {
+        QByteArray signatureDigest;
+        QUuid machineFingerprint;
+        HifiSockAddr senderSockAddr;
+        quint64 expiryTimestamp { 0 };
+    };
+    bool sessionResumptionEnabled();
+    QByteArray sessionResumptionDigest(const QByteArray& usernameSignature) const;
+    QHash<QString, SessionResumption> _sessionResumptions; // keyed by lowercase username
+    QByteArray _sessionResumptionSecret; // per-run random secret mixed into stored digests
+    quint64 _admittedNodeCount { 0 };
+    quint64 _signatureVerificationCount { 0 };
+
     QHash<QString, KeyFlagPair> _userPublicKeys; // keep track of keys and flag them as optimistic or not
     QHash<QString, bool> _inFlightPublicKeyRequests; // keep track of keys we've asked for (and if it was optimistic)
     QSet<QString> _domainOwnerFriends; // keep track of friends of the domain owner
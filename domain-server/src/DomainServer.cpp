@@ -11,6 +11,8 @@
 
 #include "DomainServer.h"
 
+#include <Metrics.h>
+
 #include <memory>
 #include <random>
 #include <iostream>
@@ -219,6 +221,17 @@ DomainServer::DomainServer(int argc, char* argv[]) :
     // if a connected node loses connection privileges, hang up on it
     connect(&_gatekeeper, &DomainGatekeeper::killNode, this, &DomainServer::handleKillNode);
 
+    // process-level metrics surfaced on the /metrics scrape endpoint
+    _processMetrics.emplace_back(new metrics::Gauge("hifi_domain_pending_verifications",
+        "Connect requests currently awaiting signature verification",
+        [this] { return (double)_gatekeeper.getPendingVerificationCount(); }));
+    _processMetrics.emplace_back(new metrics::Gauge("hifi_domain_signature_verifications_total",
+        "Signature verifications completed since start",
+        [this] { return (double)_gatekeeper.getSignatureVerificationCount(); }));
+    _processMetrics.emplace_back(new metrics::Gauge("hifi_domain_admitted_nodes_total",
+        "Nodes admitted since start",
+        [this] { return (double)_gatekeeper.getAdmittedNodeCount(); }));
+
     // if permissions are updated, relay the changes to the Node datastructures
     connect(&_settingsManager, &DomainServerSettingsManager::updateNodePermissions,
             &_gatekeeper, &DomainGatekeeper::updateNodePermissions);
@@ -316,7 +329,7 @@ DomainServer::DomainServer(int argc, char* argv[]) :
     _contentManager.reset(new DomainContentBackupManager(getContentBackupDir(), _settingsManager));
 
     connect(_contentManager.get(), &DomainContentBackupManager::started, _contentManager.get(), [this](){
-        _contentManager->addBackupHandler(BackupHandlerPointer(new EntitiesBackupHandler(getEntitiesFilePath(), getEntitiesReplacementFilePath())));
+        _contentManager->addBackupHandler(BackupHandlerPointer(new EntitiesBackupHandler(getEntitiesFilePath(), getEntitiesReplacementFilePath(), getContentBackupDir())));
         _contentManager->addBackupHandler(BackupHandlerPointer(new AssetsBackupHandler(getContentBackupDir(), isAssetServerEnabled())));
         _contentManager->addBackupHandler(BackupHandlerPointer(new ContentSettingsBackupHandler(_settingsManager)));
     });
@@ -1833,7 +1846,7 @@ void DomainServer::processOctreeDataRequestMessage(QSharedPointer<ReceivedMessag
 
     auto reply = NLPacketList::create(PacketType::OctreeDataFileReply, QByteArray(), true, true);
     OctreeUtils::RawEntityData data;
-    if (data.readOctreeDataInfoFromFile(entityFilePath)) {
+    if (data.readOctreeDataInfoFromSidecarOrFile(entityFilePath)) {
         if (data.id == id && data.dataVersion <= dataVersion) {
             qCDebug(domain_server) << "ES has sufficient octree data, not sending data";
             reply->writePrimitive(false);
@@ -1960,6 +1973,24 @@ QString DomainServer::pathForRedirect(QString path) const {
 
 
 const QString URI_OAUTH = "/oauth";
+// flattens the numeric leaves of a node's reported stats object into Prometheus gauge samples
+// labeled with the node's type and id
+static void appendNodeStatsMetrics(QByteArray& output, const QString& nodeType, const QString& nodeUUID,
+                                   const QString& prefix, const QJsonObject& statsObject) {
+    for (auto it = statsObject.constBegin(); it != statsObject.constEnd(); ++it) {
+        QString statName = prefix.isEmpty() ? it.key() : prefix + "." + it.key();
+        if (it.value().isObject()) {
+            appendNodeStatsMetrics(output, nodeType, nodeUUID, statName, it.value().toObject());
+        } else if (it.value().isDouble()) {
+            auto escapedStat = statName;
+            escapedStat.replace("\\", "\\\\").replace("\"", "\\\"");
+            output += "hifi_node_stat{type=\"" + nodeType.toUtf8() + "\",id=\"" + nodeUUID.toUtf8()
+                + "\",stat=\"" + escapedStat.toUtf8() + "\"} "
+                + QByteArray::number(it.value().toDouble(), 'g', 15) + "\n";
+        }
+    }
+}
+
 bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler) {
     const QString JSON_MIME_TYPE = "application/json";
 
@@ -2147,6 +2178,23 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             QJsonDocument transactionsDocument(rootObject);
             connection->respond(HTTPConnection::StatusCode200, transactionsDocument.toJson(), qPrintable(JSON_MIME_TYPE));
 
+            return true;
+        } else if (url.path() == "/metrics") {
+            // Prometheus scrape: process-level metrics plus the numeric stats every connected
+            // node (mixers, octree servers) last reported through its stats packets
+            QByteArray metricsOutput = metrics::renderPrometheusText();
+
+            nodeList->eachNode([&](const SharedNodePointer& node) {
+                auto nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+                if (nodeData) {
+                    appendNodeStatsMetrics(metricsOutput, NodeType::getNodeTypeName(node->getType()),
+                                           uuidStringWithoutCurlyBraces(node->getUUID()), QString(),
+                                           nodeData->getStatsJSONObject());
+                }
+            });
+
+            connection->respond(HTTPConnection::StatusCode200, metricsOutput, metrics::PROMETHEUS_MIME_TYPE);
+
             return true;
         } else if (url.path() == QString("%1.json").arg(URI_NODES)) {
             // setup the JSON
@@ -2161,6 +2209,14 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
 
             rootJSON["nodes"] = nodesJSONArray;
 
+            // admission pipeline health: how many handshakes sit in crypto verification and
+            // how much admission work has been done
+            QJsonObject admissionJSON;
+            admissionJSON["pending_verifications"] = _gatekeeper.getPendingVerificationCount();
+            admissionJSON["signature_verifications"] = (qint64)_gatekeeper.getSignatureVerificationCount();
+            admissionJSON["admitted_nodes"] = (qint64)_gatekeeper.getAdmittedNodeCount();
+            rootJSON["admission"] = admissionJSON;
+
             // print out the created JSON
             QJsonDocument nodesDocument(rootJSON);
 
@@ -3519,6 +3575,9 @@ void DomainServer::maybeHandleReplacementEntityFile() {
                     << "Failed to update entities data file with replacement file, unable to open entities file for writing";
             } else {
                 currentFile.write(gzippedData);
+                currentFile.close();
+                OctreeUtils::writeOctreeDataInfoSidecar(getEntitiesFilePath(), data.id, data.dataVersion,
+                                                        data.version, gzippedData);
             }
         }
     }
@@ -12,6 +12,7 @@
 #ifndef hifi_DomainServer_h
 #define hifi_DomainServer_h
 
+#include <Metrics.h>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QHash>
 #include <QtCore/QJsonObject>
@@ -235,6 +236,8 @@ private:
 
     DomainGatekeeper _gatekeeper;
 
+    std::vector<std::unique_ptr<metrics::Metric>> _processMetrics;
+
     HTTPManager _httpManager;
     std::unique_ptr<HTTPSManager> _httpsManager;
 
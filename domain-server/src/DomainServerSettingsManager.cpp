@@ -60,6 +60,10 @@ static const QString SPLIT_MENU_GROUPS_CONTENT_SETTINGS_KEY = "content_settings"
 const QString SETTINGS_VIEWPOINT_KEY = "viewpoint";
 
 DomainServerSettingsManager::DomainServerSettingsManager() {
+    // settings mutations bump the epoch and push per-type deltas to connected assignment clients
+    connect(this, &DomainServerSettingsManager::settingsUpdated,
+            this, &DomainServerSettingsManager::pushSettingsDeltas);
+
     // load the description object from the settings description
     QFile descriptionFile(QCoreApplication::applicationDirPath() + SETTINGS_DESCRIPTION_RELATIVE_PATH);
     descriptionFile.open(QIODevice::ReadOnly);
@@ -188,7 +192,13 @@ void DomainServerSettingsManager::processSettingsRequestPacket(QSharedPointer<Re
     Assignment::Type type;
     message->readPrimitive(&type);
 
-    QJsonObject responseObject = settingsResponseObjectForType(QString::number(type));
+    QString typeKey = QString::number(type);
+    QJsonObject responseObject = settingsResponseObjectForType(typeKey);
+
+    // remember the document this subscriber type now holds, so later mutations can ship deltas
+    _lastSettingsResponses[typeKey] = responseObject;
+    responseObject["_epoch"] = (qint64)_settingsEpoch;
+
     auto json = QJsonDocument(responseObject).toJson();
 
     auto packetList = NLPacketList::create(PacketType::DomainSettings, QByteArray(), true, true);
@@ -199,6 +209,59 @@ void DomainServerSettingsManager::processSettingsRequestPacket(QSharedPointer<Re
     nodeList->sendPacketList(std::move(packetList), message->getSenderSockAddr());
 }
 
+// recursive key diff: values present/changed in newObject are included, keys that vanished map
+// to null (the remove marker the client merge understands)
+static QJsonObject settingsObjectDiff(const QJsonObject& oldObject, const QJsonObject& newObject) {
+    QJsonObject diff;
+    for (auto it = newObject.constBegin(); it != newObject.constEnd(); ++it) {
+        auto oldValue = oldObject.value(it.key());
+        if (oldValue == it.value()) {
+            continue;
+        }
+        if (oldValue.isObject() && it.value().isObject()) {
+            diff[it.key()] = settingsObjectDiff(oldValue.toObject(), it.value().toObject());
+        } else {
+            diff[it.key()] = it.value();
+        }
+    }
+    for (auto it = oldObject.constBegin(); it != oldObject.constEnd(); ++it) {
+        if (!newObject.contains(it.key())) {
+            diff[it.key()] = QJsonValue();
+        }
+    }
+    return diff;
+}
+
+void DomainServerSettingsManager::pushSettingsDeltas() {
+    _settingsEpoch++;
+
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    for (auto it = _lastSettingsResponses.begin(); it != _lastSettingsResponses.end(); ++it) {
+        QJsonObject newResponse = settingsResponseObjectForType(it.key());
+        QJsonObject delta = settingsObjectDiff(it.value(), newResponse);
+        it.value() = newResponse;
+
+        if (delta.isEmpty()) {
+            continue;
+        }
+
+        delta["_epoch"] = (qint64)_settingsEpoch;
+        delta["_delta"] = true;
+        auto json = QJsonDocument(delta).toJson();
+
+        // only the changed keys go out, to every connected node of this assignment type
+        limitedNodeList->eachMatchingNode([&](const SharedNodePointer& node) -> bool {
+            return node->getActiveSocket()
+                && QString::number(Assignment::typeForNodeType(node->getType())) == it.key();
+        }, [&](const SharedNodePointer& node) {
+            auto packetList = NLPacketList::create(PacketType::DomainSettings, QByteArray(), true, true);
+            packetList->write(json);
+            limitedNodeList->sendPacketList(std::move(packetList), *node);
+        });
+    }
+}
+
 void DomainServerSettingsManager::setupConfigMap(const QString& userConfigFilename) {
     // since we're called from the DomainServerSettingsManager constructor, we don't take a write lock here
     // even though we change the underlying config map
@@ -145,6 +145,7 @@ public slots:
 
 private slots:
     void processSettingsRequestPacket(QSharedPointer<ReceivedMessage> message);
+    void pushSettingsDeltas();
     void processNodeKickRequestPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
     void processUsernameFromIDRequestPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
 
@@ -161,6 +162,11 @@ private:
 
     void splitSettingsDescription();
 
+    // versioned delta sync to assignment clients: every settings mutation bumps the epoch, and
+    // subscribers that already hold the previous epoch's document receive only the changed keys
+    quint64 _settingsEpoch { 1 };
+    QHash<QString, QJsonObject> _lastSettingsResponses; // per requested assignment-type key
+
     double _descriptionVersion;
 
     QJsonArray _descriptionArray;
@@ -25,58 +25,273 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include <QCryptographicHash>
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+
+#include <Gzip.h>
 #include <OctreeDataUtils.h>
 
-EntitiesBackupHandler::EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath) :
+EntitiesBackupHandler::EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath,
+                                             QString backupDirectory) :
     _entitiesFilePath(entitiesFilePath),
-    _entitiesReplacementFilePath(entitiesReplacementFilePath)
+    _entitiesReplacementFilePath(entitiesReplacementFilePath),
+    _backupDirectory(backupDirectory)
 {
 }
 
 static const QString ENTITIES_BACKUP_FILENAME = "models.json.gz";
+static const QString ENTITIES_MANIFEST_FILENAME = "models.manifest.json";
+static const QString ENTITY_CHUNKS_DIRNAME = "entity-chunks";
+
+QString EntitiesBackupHandler::chunksDirectory() const {
+    return _backupDirectory + "/" + ENTITY_CHUNKS_DIRNAME;
+}
+
+// Content-defined chunking over the uncompressed entity JSON: a rolling sum picks boundaries
+// that survive insertions and deletions elsewhere in the file, so consecutive backups of a
+// lightly-edited domain share almost all of their chunks.
+static std::vector<QByteArray> chunkEntityData(const QByteArray& data) {
+    const int MIN_CHUNK_SIZE = 256 * 1024;
+    const int MAX_CHUNK_SIZE = 4 * 1024 * 1024;
+    const quint32 BOUNDARY_MASK = (1 << 20) - 1; // ~1MB average chunks
+
+    std::vector<QByteArray> chunks;
+    const char* bytes = data.constData();
+    int size = data.size();
+    int chunkStart = 0;
+    quint32 rollingHash = 0;
+
+    for (int i = 0; i < size; i++) {
+        rollingHash = (rollingHash << 1) + (quint8)bytes[i];
+        int chunkSize = i - chunkStart + 1;
+        if ((chunkSize >= MIN_CHUNK_SIZE && (rollingHash & BOUNDARY_MASK) == 0) || chunkSize >= MAX_CHUNK_SIZE) {
+            chunks.push_back(data.mid(chunkStart, chunkSize));
+            chunkStart = i + 1;
+            rollingHash = 0;
+        }
+    }
+    if (chunkStart < size) {
+        chunks.push_back(data.mid(chunkStart));
+    }
+    return chunks;
+}
+
+// legacy path: the whole gzipped entities file goes straight into the zip
+static void writeFullEntitiesBackup(const QString& entitiesFilePath, const QByteArray& entityData, QuaZip& zip) {
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_FILENAME, entitiesFilePath))) {
+        qCritical().nospace() << "Failed to open " << ENTITIES_BACKUP_FILENAME << " for writing in zip";
+        return;
+    }
+    if (zipFile.write(entityData) != entityData.size()) {
+        qCritical() << "Failed to write entities file to backup";
+        zipFile.close();
+        return;
+    }
+    zipFile.close();
+    if (zipFile.getZipError() != UNZ_OK) {
+        qCritical().nospace() << "Failed to zip " << ENTITIES_BACKUP_FILENAME << ": " << zipFile.getZipError();
+    }
+}
 
 void EntitiesBackupHandler::createBackup(const QString& backupName, QuaZip& zip) {
     QFile entitiesFile { _entitiesFilePath };
 
-    if (entitiesFile.open(QIODevice::ReadOnly)) {
-        QuaZipFile zipFile { &zip };
-        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_FILENAME, _entitiesFilePath))) {
-            qCritical().nospace() << "Failed to open " << ENTITIES_BACKUP_FILENAME << " for writing in zip";
-            return;
+    if (!entitiesFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    auto entityData = entitiesFile.readAll();
+
+    // incremental path: chunk the uncompressed scene, persist only chunks we have not seen
+    // before, and put just a manifest in the backup itself
+    QByteArray rawJson;
+    if (gunzip(entityData, rawJson) && QDir().mkpath(chunksDirectory())) {
+        QDir chunksDir { chunksDirectory() };
+        auto chunks = chunkEntityData(rawJson);
+
+        QJsonArray chunkHashes;
+        bool chunksOk = true;
+        qint64 newChunkBytes = 0;
+        for (const auto& chunk : chunks) {
+            auto hash = QString::fromLatin1(
+                QCryptographicHash::hash(chunk, QCryptographicHash::Sha256).toHex());
+            chunkHashes.append(hash);
+
+            auto chunkPath = chunksDir.absoluteFilePath(hash + ".gz");
+            if (!QFile::exists(chunkPath)) {
+                QByteArray gzChunk;
+                QSaveFile chunkFile { chunkPath };
+                if (!gzip(chunk, gzChunk, -1) || !chunkFile.open(QIODevice::WriteOnly)
+                        || chunkFile.write(gzChunk) != gzChunk.size() || !chunkFile.commit()) {
+                    chunksOk = false;
+                    break;
+                }
+                newChunkBytes += gzChunk.size();
+            }
         }
-        auto entityData = entitiesFile.readAll();
-        if (zipFile.write(entityData) != entityData.size()) {
-            qCritical() << "Failed to write entities file to backup";
-            zipFile.close();
-            return;
+
+        if (chunksOk) {
+            QJsonObject manifest;
+            manifest["totalSize"] = (qint64)rawJson.size();
+            manifest["chunks"] = chunkHashes;
+
+            QuaZipFile manifestFile { &zip };
+            if (manifestFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_MANIFEST_FILENAME))) {
+                manifestFile.write(QJsonDocument(manifest).toJson());
+                manifestFile.close();
+                if (manifestFile.getZipError() == UNZ_OK) {
+                    qDebug() << "Entities backup" << backupName << "wrote" << newChunkBytes
+                        << "bytes of new chunks for" << chunkHashes.size() << "total chunks";
+                    return;
+                }
+            }
         }
-        zipFile.close();
-        if (zipFile.getZipError() != UNZ_OK) {
-            qCritical().nospace() << "Failed to zip " << ENTITIES_BACKUP_FILENAME << ": " << zipFile.getZipError();
+
+        qWarning() << "Incremental entities backup failed, falling back to full copy";
+    }
+
+    writeFullEntitiesBackup(_entitiesFilePath, entityData, zip);
+}
+
+QByteArray EntitiesBackupHandler::assembleFromManifest(const QByteArray& manifestData, QString& errorOut) {
+    auto manifest = QJsonDocument::fromJson(manifestData).object();
+    QDir chunksDir { chunksDirectory() };
+
+    QByteArray assembled;
+    assembled.reserve((int)manifest["totalSize"].toDouble());
+    for (const auto& hashValue : manifest["chunks"].toArray()) {
+        QFile chunkFile { chunksDir.absoluteFilePath(hashValue.toString() + ".gz") };
+        QByteArray chunk;
+        if (!chunkFile.open(QIODevice::ReadOnly) || !gunzip(chunkFile.readAll(), chunk)) {
+            errorOut = "Missing or unreadable entities chunk " + hashValue.toString();
+            return QByteArray();
         }
+        assembled.append(chunk);
     }
+
+    if (assembled.size() != (int)manifest["totalSize"].toDouble()) {
+        errorOut = "Reassembled entities data has the wrong size";
+        return QByteArray();
+    }
+    return assembled;
 }
 
-std::pair<bool, QString> EntitiesBackupHandler::recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) {
-    if (!zip.setCurrentFile(ENTITIES_BACKUP_FILENAME)) {
-        QString errorStr("Failed to find " + ENTITIES_BACKUP_FILENAME + " while recovering backup");
-        qWarning() << errorStr;
-        return { false, errorStr };
+void EntitiesBackupHandler::consolidateBackup(const QString& backupName, QuaZip& zip) {
+    // the zip we're handed is open for appending, so the manifest is read from the original
+    // skeleton backup; full (non-manifest) backups already carry models.json.gz and need nothing
+    QuaZip skeletonZip { _backupDirectory + "/" + backupName };
+    if (!skeletonZip.open(QuaZip::mdUnzip) || !skeletonZip.setCurrentFile(ENTITIES_MANIFEST_FILENAME)) {
+        return;
     }
-    QuaZipFile zipFile { &zip };
-    if (!zipFile.open(QIODevice::ReadOnly)) {
-        QString errorStr("Failed to open " + ENTITIES_BACKUP_FILENAME + " in backup");
-        qCritical() << errorStr;
-        return { false, errorStr };
+    QuaZipFile manifestFile { &skeletonZip };
+    if (!manifestFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    auto manifestData = manifestFile.readAll();
+    manifestFile.close();
+
+    QString error;
+    auto rawJson = assembleFromManifest(manifestData, error);
+    if (rawJson.isNull()) {
+        qCritical() << "Failed to consolidate entities backup" << backupName << "-" << error;
+        return;
+    }
+
+    QByteArray gzJson;
+    if (!gzip(rawJson, gzJson, -1)) {
+        qCritical() << "Failed to gzip reassembled entities data for" << backupName;
+        return;
     }
-    auto rawData = zipFile.readAll();
 
+    QuaZipFile zipFile { &zip };
+    if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_FILENAME))) {
+        qCritical() << "Failed to add reassembled entities file to consolidated backup";
+        return;
+    }
+    zipFile.write(gzJson);
     zipFile.close();
+}
 
-    if (zipFile.getZipError() != UNZ_OK) {
-        QString errorStr("Failed to unzip " + ENTITIES_BACKUP_FILENAME + ": " + zipFile.getZipError());
-        qCritical() << errorStr;
-        return { false, errorStr };
+void EntitiesBackupHandler::deleteBackup(const QString& backupName) {
+    collectGarbageChunks();
+}
+
+void EntitiesBackupHandler::collectGarbageChunks() {
+    QDir chunksDir { chunksDirectory() };
+    if (!chunksDir.exists()) {
+        return;
+    }
+
+    // gather every chunk hash still referenced by any remaining backup's manifest
+    QSet<QString> referencedChunks;
+    QDir backupDir { _backupDirectory };
+    for (const auto& entry : backupDir.entryList({ "*.zip" }, QDir::Files)) {
+        QuaZip zip { backupDir.absoluteFilePath(entry) };
+        if (!zip.open(QuaZip::mdUnzip) || !zip.setCurrentFile(ENTITIES_MANIFEST_FILENAME)) {
+            continue;
+        }
+        QuaZipFile manifestFile { &zip };
+        if (!manifestFile.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        auto manifest = QJsonDocument::fromJson(manifestFile.readAll()).object();
+        for (const auto& hashValue : manifest["chunks"].toArray()) {
+            referencedChunks.insert(hashValue.toString() + ".gz");
+        }
+    }
+
+    for (const auto& chunkName : chunksDir.entryList({ "*.gz" }, QDir::Files)) {
+        if (!referencedChunks.contains(chunkName)) {
+            chunksDir.remove(chunkName);
+        }
+    }
+}
+
+std::pair<bool, QString> EntitiesBackupHandler::recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) {
+    QByteArray rawData;
+
+    if (zip.setCurrentFile(ENTITIES_MANIFEST_FILENAME)) {
+        // incremental backup: rebuild the scene from the chunk store
+        QuaZipFile manifestFile { &zip };
+        if (!manifestFile.open(QIODevice::ReadOnly)) {
+            QString errorStr("Failed to open " + ENTITIES_MANIFEST_FILENAME + " in backup");
+            qCritical() << errorStr;
+            return { false, errorStr };
+        }
+        auto manifestData = manifestFile.readAll();
+        manifestFile.close();
+
+        QString error;
+        rawData = assembleFromManifest(manifestData, error);
+        if (rawData.isNull()) {
+            qCritical() << error;
+            return { false, error };
+        }
+    } else {
+        if (!zip.setCurrentFile(ENTITIES_BACKUP_FILENAME)) {
+            QString errorStr("Failed to find " + ENTITIES_BACKUP_FILENAME + " while recovering backup");
+            qWarning() << errorStr;
+            return { false, errorStr };
+        }
+        QuaZipFile zipFile { &zip };
+        if (!zipFile.open(QIODevice::ReadOnly)) {
+            QString errorStr("Failed to open " + ENTITIES_BACKUP_FILENAME + " in backup");
+            qCritical() << errorStr;
+            return { false, errorStr };
+        }
+        rawData = zipFile.readAll();
+
+        zipFile.close();
+
+        if (zipFile.getZipError() != UNZ_OK) {
+            QString errorStr("Failed to unzip " + ENTITIES_BACKUP_FILENAME + ": " + zipFile.getZipError());
+            qCritical() << errorStr;
+            return { false, errorStr };
+        }
     }
 
     OctreeUtils::RawEntityData data;
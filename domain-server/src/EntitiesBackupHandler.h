@@ -16,7 +16,7 @@
 
 class EntitiesBackupHandler : public BackupHandlerInterface {
 public:
-    EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath);
+    EntitiesBackupHandler(QString entitiesFilePath, QString entitiesReplacementFilePath, QString backupDirectory);
 
     std::pair<bool, float> isAvailable(const QString& backupName) override { return { true, 1.0f }; }
     std::pair<bool, float> getRecoveryStatus() override { return { false, 1.0f }; }
@@ -25,23 +25,29 @@ public:
 
     void loadingComplete() override {}
 
-    // Create a skeleton backup
+    // Create a skeleton backup: a chunk manifest in the zip, with only new content-addressed
+    // chunks written to the shared chunk store
     void createBackup(const QString& backupName, QuaZip& zip) override;
 
     // Recover from a full backup
     std::pair<bool, QString> recoverBackup(const QString& backupName, QuaZip& zip, const QString& username, const QString& sourceFilename) override;
 
-    // Delete a skeleton backup
-    void deleteBackup(const QString& backupName) override {}
+    // Delete a skeleton backup and garbage-collect chunks no remaining backup references
+    void deleteBackup(const QString& backupName) override;
 
-    // Create a full backup
-    void consolidateBackup(const QString& backupName, QuaZip& zip) override {}
+    // Create a full backup: reassembles models.json.gz from the chunk store for download
+    void consolidateBackup(const QString& backupName, QuaZip& zip) override;
 
     bool isCorruptedBackup(const QString& backupName) override { return false; }
 
 private:
+    QString chunksDirectory() const;
+    QByteArray assembleFromManifest(const QByteArray& manifestData, QString& errorOut);
+    void collectGarbageChunks();
+
     QString _entitiesFilePath;
     QString _entitiesReplacementFilePath;
+    QString _backupDirectory;
 };
 
 #endif /* hifi_EntitiesBackupHandler_h */
@@ -28,12 +28,22 @@
 const int CLEAR_INACTIVE_PEERS_INTERVAL_MSECS = 1 * 1000;
 const int PEER_SILENCE_THRESHOLD_MSECS = 5 * 1000;
 
+// one bucket per sweep interval covering the silence threshold, plus the current bucket and one
+// of slack so a bucket is always fully expired before it is reused for new activity
+const int ACTIVITY_WHEEL_BUCKETS = PEER_SILENCE_THRESHOLD_MSECS / CLEAR_INACTIVE_PEERS_INTERVAL_MSECS + 2;
+
 IceServer::IceServer(int argc, char* argv[]) :
     QCoreApplication(argc, argv),
     _id(QUuid::createUuid()),
     _serverSocket(0, false),
     _activePeers()
 {
+    // size for tens of thousands of concurrent peers without rehash storms mid-event
+    const int EXPECTED_PEER_CAPACITY = 65536;
+    _activePeers.reserve(EXPECTED_PEER_CAPACITY);
+    _peerActivityBucket.reserve(EXPECTED_PEER_CAPACITY);
+    _activityWheel.resize(ACTIVITY_WHEEL_BUCKETS);
+
     // start the ice-server socket
     qDebug() << "ice-server socket is listening on" << ICE_SERVER_DEFAULT_PORT;
     _serverSocket.bind(QHostAddress::AnyIPv4, ICE_SERVER_DEFAULT_PORT);
@@ -103,7 +113,9 @@ void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
             QUuid connectRequestID;
             heartbeatStream >> connectRequestID;
             
-            SharedNetworkPeer matchingPeer = _activePeers.value(connectRequestID);
+            auto matchingPeerIt = _activePeers.find(connectRequestID);
+            SharedNetworkPeer matchingPeer =
+                matchingPeerIt != _activePeers.end() ? matchingPeerIt->second : SharedNetworkPeer();
             
             if (matchingPeer) {
                 
@@ -140,22 +152,30 @@ SharedNetworkPeer IceServer::addOrUpdateHeartbeatingPeer(NLPacket& packet) {
     // make sure this is a verified heartbeat before performing any more processing
     if (isVerifiedHeartbeat(senderUUID, signedPlaintext, signature)) {
         // make sure we have this sender in our peer hash
-        SharedNetworkPeer matchingPeer = _activePeers.value(senderUUID);
+        auto matchingPeerIt = _activePeers.find(senderUUID);
+        SharedNetworkPeer matchingPeer;
 
-        if (!matchingPeer) {
+        if (matchingPeerIt == _activePeers.end()) {
             // if we don't have this sender we need to create them now
             matchingPeer = QSharedPointer<NetworkPeer>::create(senderUUID, publicSocket, localSocket);
-            _activePeers.insert(senderUUID, matchingPeer);
+            _activePeers[senderUUID] = matchingPeer;
 
             qDebug() << "Added a new network peer" << *matchingPeer;
         } else {
-            // we already had the peer so just potentially update their sockets
-            matchingPeer->setPublicSocket(publicSocket);
-            matchingPeer->setLocalSocket(localSocket);
+            matchingPeer = matchingPeerIt->second;
+
+            // we already had the peer so just potentially update their sockets, dropping the
+            // cached peer-information reply if they actually changed
+            if (matchingPeer->getPublicSocket() != publicSocket || matchingPeer->getLocalSocket() != localSocket) {
+                matchingPeer->setPublicSocket(publicSocket);
+                matchingPeer->setLocalSocket(localSocket);
+                _peerInformationPackets.erase(senderUUID);
+            }
         }
 
         // update our last heard microstamp for this network peer to now
         matchingPeer->setLastHeardMicrostamp(usecTimestampNow());
+        touchPeerActivity(senderUUID);
         
         return matchingPeer;
     } else {
@@ -281,32 +301,60 @@ void IceServer::publicKeyReplyFinished(QNetworkReply* reply) {
 }
 
 void IceServer::sendPeerInformationPacket(const NetworkPeer& peer, const HifiSockAddr* destinationSockAddr) {
-    auto peerPacket = NLPacket::create(PacketType::ICEServerPeerInformation);
+    // reuse the serialized reply for known peers; it only changes when their sockets do
+    auto cached = _peerInformationPackets.find(peer.getUUID());
+    if (cached == _peerInformationPackets.end() || !cached->second) {
+        auto peerPacket = NLPacket::create(PacketType::ICEServerPeerInformation);
+        peerPacket->write(peer.toByteArray());
+
+        if (_activePeers.count(peer.getUUID())) {
+            cached = _peerInformationPackets.emplace(peer.getUUID(), std::move(peerPacket)).first;
+        } else {
+            // transient peer object (the query side of a pairing) - send without caching
+            _serverSocket.writePacket(*peerPacket, *destinationSockAddr);
+            return;
+        }
+    }
 
-    // get the byte array for this peer
-    peerPacket->write(peer.toByteArray());
-    
     // write the current packet
-    _serverSocket.writePacket(*peerPacket, *destinationSockAddr);
+    _serverSocket.writePacket(*cached->second, *destinationSockAddr);
 }
 
-void IceServer::clearInactivePeers() {
-    NetworkPeerHash::iterator peerItem = _activePeers.begin();
-
-    while (peerItem != _activePeers.end()) {
-        SharedNetworkPeer peer = peerItem.value();
+void IceServer::touchPeerActivity(const QUuid& peerID) {
+    int currentBucket = (int)(_activityWheelTick % ACTIVITY_WHEEL_BUCKETS);
+    auto bucketIt = _peerActivityBucket.find(peerID);
+    if (bucketIt != _peerActivityBucket.end()) {
+        if (bucketIt->second == currentBucket) {
+            return;
+        }
+        _activityWheel[bucketIt->second].erase(peerID);
+        bucketIt->second = currentBucket;
+    } else {
+        _peerActivityBucket[peerID] = currentBucket;
+    }
+    _activityWheel[currentBucket].insert(peerID);
+}
 
-        if ((usecTimestampNow() - peer->getLastHeardMicrostamp()) > (PEER_SILENCE_THRESHOLD_MSECS * 1000)) {
-            qDebug() << "Removing peer from memory for inactivity -" << *peer;
+void IceServer::clearInactivePeers() {
+    // only the wheel bucket that has aged past the silence threshold is visited; every peer in
+    // it has not heartbeated for at least that long, so sweep cost scales with expiries rather
+    // than with the total peer count
+    _activityWheelTick++;
+    auto& expiredBucket = _activityWheel[_activityWheelTick % ACTIVITY_WHEEL_BUCKETS];
+
+    for (const auto& peerID : expiredBucket) {
+        auto peerItem = _activePeers.find(peerID);
+        if (peerItem != _activePeers.end()
+                && (usecTimestampNow() - peerItem->second->getLastHeardMicrostamp()) > (PEER_SILENCE_THRESHOLD_MSECS * 1000)) {
+            qDebug() << "Removing peer from memory for inactivity -" << *peerItem->second;
 
             // if we had a public key for this domain, remove it now
-            _domainPublicKeys.erase(peer->getUUID());
+            _domainPublicKeys.erase(peerID);
+            _peerInformationPackets.erase(peerID);
 
-            // remove the peer object
-            peerItem = _activePeers.erase(peerItem);
-        } else {
-            // we didn't kill this peer, push the iterator forwards
-            ++peerItem;
+            _activePeers.erase(peerItem);
         }
+        _peerActivityBucket.erase(peerID);
     }
+    expiredBucket.clear();
 }
@@ -12,6 +12,10 @@
 #ifndef hifi_IceServer_h
 #define hifi_IceServer_h
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QSharedPointer>
 #include <QUdpSocket>
@@ -48,9 +52,20 @@ private:
     QUuid _id;
     udt::Socket _serverSocket;
 
-    using NetworkPeerHash = QHash<QUuid, SharedNetworkPeer>;
+    using NetworkPeerHash = std::unordered_map<QUuid, SharedNetworkPeer>;
     NetworkPeerHash _activePeers;
 
+    // serialized ICEServerPeerInformation replies, reused until the peer's sockets change
+    std::unordered_map<QUuid, std::unique_ptr<NLPacket>> _peerInformationPackets;
+
+    // activity wheel: every heartbeat files its peer under the current tick's bucket, so the
+    // inactivity sweep only ever visits the one bucket whose peers are old enough to expire
+    std::vector<std::unordered_set<QUuid>> _activityWheel;
+    std::unordered_map<QUuid, int> _peerActivityBucket;
+    quint64 _activityWheelTick { 0 };
+
+    void touchPeerActivity(const QUuid& peerID);
+
     using RSAUniquePtr = std::unique_ptr<RSA, std::function<void(RSA*)>>;
     using DomainPublicKeyHash = std::unordered_map<QUuid, RSAUniquePtr>;
     DomainPublicKeyHash _domainPublicKeys;
@@ -2389,6 +2389,23 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
     connect(_window, SIGNAL(windowMinimizedChanged(bool)), this, SLOT(windowMinimizedChanged(bool)));
     qCDebug(interfaceapp, "Startup time: %4.2f seconds.", (double)startupTimer.elapsed() / 1000.0);
 
+    { // report where singleton initialization time went, slowest first
+        auto initTimings = DependencyManager::getInitTimings();
+        std::sort(initTimings.begin(), initTimings.end(), [](const auto& a, const auto& b) {
+            return a.duration > b.duration;
+        });
+        const size_t MAX_REPORTED_INITS = 20;
+        const int64_t MIN_REPORTED_USECS = 1000;
+        qCDebug(interfaceapp) << "Startup singleton timeline (top" << MAX_REPORTED_INITS << "):";
+        size_t reported = 0;
+        for (const auto& timing : initTimings) {
+            if (reported++ >= MAX_REPORTED_INITS || timing.duration.count() < MIN_REPORTED_USECS) {
+                break;
+            }
+            qCDebug(interfaceapp, "    %8.2f ms  %s", (double)timing.duration.count() / 1000.0, timing.typeName);
+        }
+    }
+
     EntityTreeRenderer::setEntitiesShouldFadeFunction([this]() {
         SharedNodePointer entityServerNode = DependencyManager::get<NodeList>()->soloNodeOfType(NodeType::EntityServer);
         return entityServerNode && !isPhysicsEnabled();
@@ -5597,8 +5614,8 @@ void Application::init() {
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
 
     // connect the _entityCollisionSystem to our EntityTreeRenderer since that's what handles running entity scripts
-    connect(_entitySimulation.get(), &PhysicalEntitySimulation::entityCollisionWithEntity,
-            getEntities().data(), &EntityTreeRenderer::entityCollisionWithEntity);
+    connect(_entitySimulation.get(), &PhysicalEntitySimulation::entityCollisionEvents,
+            getEntities().data(), &EntityTreeRenderer::entityCollisionEvents);
 
     // connect the _entities (EntityTreeRenderer) to our script engine's EntityScriptingInterface for firing
     // of events related clicking, hovering over, and entering entities
@@ -6203,6 +6220,51 @@ void Application::tryToEnablePhysics() {
     }
 }
 
+// Budgeted wrapper for the named stages of Application::update. It times the scope through the
+// normal PerformanceTimer (so existing stats and captures are unchanged) and additionally
+// accounts budget overruns per stage, logging a rate-limited warning when a stage chronically
+// blows its slice of the frame. The stages run in declaration order; their data dependencies
+// (input -> simulation -> avatars -> render prep) are what that order encodes.
+class UpdateStage {
+public:
+    UpdateStage(const char* name, float budgetMsecs) :
+        _name(name),
+        _budgetUsecs((quint64)(budgetMsecs * (float)USECS_PER_MSEC)),
+        _startTime(usecTimestampNow()),
+        _perfTimer(name) {
+    }
+
+    ~UpdateStage() {
+        auto elapsed = usecTimestampNow() - _startTime;
+        if (elapsed <= _budgetUsecs) {
+            return;
+        }
+
+        // main-thread only, like the update loop itself
+        static QHash<QString, quint64> overrunCounts;
+        static QHash<QString, quint64> lastWarnTimes;
+
+        auto& overruns = overrunCounts[_name];
+        overruns++;
+
+        const quint64 WARN_INTERVAL_USECS = 5 * USECS_PER_SECOND;
+        auto& lastWarn = lastWarnTimes[_name];
+        auto now = usecTimestampNow();
+        if (now - lastWarn > WARN_INTERVAL_USECS) {
+            lastWarn = now;
+            qCDebug(interfaceapp) << "Update stage" << _name << "over its" << (_budgetUsecs / USECS_PER_MSEC)
+                << "ms budget:" << (double)elapsed / (double)USECS_PER_MSEC << "ms ("
+                << overruns << "overruns so far)";
+        }
+    }
+
+private:
+    QString _name;
+    quint64 _budgetUsecs;
+    quint64 _startTime;
+    PerformanceTimer _perfTimer;
+};
+
 void Application::update(float deltaTime) {
     PROFILE_RANGE_EX(app, __FUNCTION__, 0xffff0000, (uint64_t)_graphicsEngine._renderFrameCount + 1);
 
@@ -6237,7 +6299,7 @@ void Application::update(float deltaTime) {
 
     auto myAvatar = getMyAvatar();
     {
-        PerformanceTimer perfTimer("devices");
+        UpdateStage stage("devices", 2.0f);
         auto userInputMapper = DependencyManager::get<UserInputMapper>();
 
         controller::HmdAvatarAlignmentType hmdAvatarAlignmentType;
@@ -6419,13 +6481,13 @@ void Application::update(float deltaTime) {
     // TODO: break these out into distinct perfTimers when they prove interesting
     {
         PROFILE_RANGE(app, "PickManager");
-        PerformanceTimer perfTimer("pickManager");
+        UpdateStage stage("pickManager", 1.0f);
         DependencyManager::get<PickManager>()->update();
     }
 
     {
         PROFILE_RANGE(app, "PointerManager");
-        PerformanceTimer perfTimer("pointerManager");
+        UpdateStage stage("pointerManager", 1.0f);
         DependencyManager::get<PointerManager>()->update();
     }
 
@@ -6433,7 +6495,7 @@ void Application::update(float deltaTime) {
 
     {
         PROFILE_RANGE(simulation_physics, "Simulation");
-        PerformanceTimer perfTimer("simulation");
+        UpdateStage stage("simulation", 8.0f);
 
         getEntities()->preUpdate();
         _entitySimulation->removeDeadEntities();
@@ -6558,13 +6620,13 @@ void Application::update(float deltaTime) {
     {
         {
             PROFILE_RANGE(simulation, "OtherAvatars");
-            PerformanceTimer perfTimer("otherAvatars");
+            UpdateStage stage("otherAvatars", 3.0f);
             avatarManager->updateOtherAvatars(deltaTime);
         }
 
         {
             PROFILE_RANGE(simulation, "MyAvatar");
-            PerformanceTimer perfTimer("MyAvatar");
+            UpdateStage stage("MyAvatar", 2.0f);
             qApp->updateMyAvatarLookAtPosition(deltaTime);
             avatarManager->updateMyAvatar(deltaTime);
         }
@@ -6582,7 +6644,7 @@ void Application::update(float deltaTime) {
 
     {
         PROFILE_RANGE_EX(app, "Overlays", 0xffff0000, (uint64_t)getActiveDisplayPlugin()->presentCount());
-        PerformanceTimer perfTimer("overlays");
+        UpdateStage stage("overlays", 1.0f);
         _overlays.update(deltaTime);
     }
 
@@ -6609,7 +6671,7 @@ void Application::update(float deltaTime) {
     // Update my voxel servers with my current voxel query...
     {
         PROFILE_RANGE_EX(app, "QueryOctree", 0xffff0000, (uint64_t)getActiveDisplayPlugin()->presentCount());
-        PerformanceTimer perfTimer("queryOctree");
+        UpdateStage stage("queryOctree", 1.0f);
         QMutexLocker viewLocker(&_viewMutex);
 
         bool viewIsDifferentEnough = false;
@@ -6660,7 +6722,7 @@ void Application::update(float deltaTime) {
     }
 
     {
-        PerformanceTimer perfTimer("avatarManager/postUpdate");
+        UpdateStage stage("avatarManager/postUpdate", 2.0f);
         avatarManager->postUpdate(deltaTime, getMain3DScene());
     }
 
@@ -6684,7 +6746,7 @@ void Application::update(float deltaTime) {
 
 
     { // Game loop is done, mark the end of the frame for the scene transactions and the render loop to take over
-        PerformanceTimer perfTimer("enqueueFrame");
+        UpdateStage stage("enqueueFrame", 1.0f);
         getMain3DScene()->enqueueFrame();
     }
 
@@ -8519,16 +8581,26 @@ bool Application::takeSnapshotOperators(std::queue<SnapshotOperator>& snapshotOp
 
 void Application::takeSnapshot(bool notify, bool includeAnimated, float aspectRatio, const QString& filename) {
     addSnapshotOperator(std::make_tuple([notify, includeAnimated, aspectRatio, filename](const QImage& snapshot) {
-        qApp->postLambdaEvent([snapshot, notify, includeAnimated, aspectRatio, filename] {
+        if (!includeAnimated) {
+            // encode and write on a worker thread; only the notification hops back to the
+            // main thread, so a 4K snapshot never costs a frame
+            QtConcurrent::run([snapshot, notify, filename] {
+                QString path = DependencyManager::get<Snapshot>()->saveSnapshot(snapshot, filename, TestScriptingInterface::getInstance()->getTestResultsLocation());
+                qApp->postLambdaEvent([path, notify] {
+                    if (!path.isEmpty()) {
+                        // Tell the dependency manager that the capture of the still snapshot has taken place.
+                        emit DependencyManager::get<WindowScriptingInterface>()->stillSnapshotTaken(path, notify);
+                    }
+                });
+            });
+            return;
+        }
+
+        // the animated capture drives further main-thread work from the saved still
+        qApp->postLambdaEvent([snapshot, notify, aspectRatio, filename] {
             QString path = DependencyManager::get<Snapshot>()->saveSnapshot(snapshot, filename, TestScriptingInterface::getInstance()->getTestResultsLocation());
 
-            // If we're not doing an animated snapshot as well...
-            if (!includeAnimated) {
-                if (!path.isEmpty()) {
-                    // Tell the dependency manager that the capture of the still snapshot has taken place.
-                    emit DependencyManager::get<WindowScriptingInterface>()->stillSnapshotTaken(path, notify);
-                }
-            } else if (!SnapshotAnimated::isAlreadyTakingSnapshotAnimated()) {
+            if (!SnapshotAnimated::isAlreadyTakingSnapshotAnimated()) {
                 // Get an animated GIF snapshot and save it
                 SnapshotAnimated::saveSnapshotAnimated(path, aspectRatio, DependencyManager::get<WindowScriptingInterface>());
             }
@@ -8538,10 +8610,11 @@ void Application::takeSnapshot(bool notify, bool includeAnimated, float aspectRa
 
 void Application::takeSecondaryCameraSnapshot(const bool& notify, const QString& filename) {
     addSnapshotOperator(std::make_tuple([notify, filename](const QImage& snapshot) {
-        qApp->postLambdaEvent([snapshot, notify, filename] {
+        QtConcurrent::run([snapshot, notify, filename] {
             QString snapshotPath = DependencyManager::get<Snapshot>()->saveSnapshot(snapshot, filename, TestScriptingInterface::getInstance()->getTestResultsLocation());
-
-            emit DependencyManager::get<WindowScriptingInterface>()->stillSnapshotTaken(snapshotPath, notify);
+            qApp->postLambdaEvent([snapshotPath, notify] {
+                emit DependencyManager::get<WindowScriptingInterface>()->stillSnapshotTaken(snapshotPath, notify);
+            });
         });
     }, 0.0f, false));
 }
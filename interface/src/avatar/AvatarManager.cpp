@@ -11,6 +11,8 @@
 
 #include "AvatarManager.h"
 
+#include <TBBHelpers.h>
+
 #include <string>
 
 #include <QScriptEngine>
@@ -109,6 +111,7 @@ void AvatarManager::init() {
     {
         QWriteLocker locker(&_hashLock);
         _avatarHash.insert(MY_AVATAR_KEY, _myAvatar);
+        shardInsert(MY_AVATAR_KEY, _myAvatar);
     }
 
     _shouldRender = DependencyManager::get<SceneScriptingInterface>()->shouldRenderAvatars();
@@ -191,6 +194,26 @@ void AvatarManager::updateMyAvatar(float deltaTime) {
 
 Q_LOGGING_CATEGORY(trace_simulation_avatar, "trace.simulation.avatar");
 
+void AvatarManager::setCrowdRenderLimits(float radius, int maxFullAvatars) {
+    _crowdRenderRadius = std::max(0.0f, radius);
+    _crowdRenderMaxFullAvatars = maxFullAvatars;
+
+    if (_crowdRenderRadius == 0.0f && _crowdRenderMaxFullAvatars < 0) {
+        // cap disabled - restore any avatars it had hidden
+        auto avatarMap = getHashCopy();
+        for (auto it = avatarMap.begin(); it != avatarMap.end(); ++it) {
+            auto avatar = std::static_pointer_cast<Avatar>(it.value());
+            if (avatar != _myAvatar) {
+                auto otherAvatar = std::static_pointer_cast<OtherAvatar>(avatar);
+                if (otherAvatar->_crowdCulled) {
+                    otherAvatar->_crowdCulled = false;
+                    otherAvatar->setEnableMeshVisible(true);
+                }
+            }
+        }
+    }
+}
+
 float AvatarManager::getAvatarDataRate(const QUuid& sessionID, const QString& rateName) const {
     auto avatar = getAvatarBySessionID(sessionID);
     return avatar ? avatar->getDataRate(rateName) : 0.0f;
@@ -296,6 +319,35 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
     render::Transaction renderTransaction;
     workload::Transaction workloadTransaction;
 
+    // Parallel pre-pass: apply freshly received joint data to each avatar's rig
+    // across worker threads. Each call touches only that avatar's rig (the
+    // joint data itself is lock-guarded against the network thread), and the
+    // serial update below consumes the prepared poses.
+    {
+        PROFILE_RANGE(simulation, "parallelJointData");
+        std::vector<OtherAvatar*> avatarsWithNewJointData;
+        for (auto it = avatarMap.begin(); it != avatarMap.end(); ++it) {
+            const auto& avatar = std::static_pointer_cast<Avatar>(*it);
+            if (avatar != _myAvatar && avatar->hasNewJointData() && avatar->getSkeletonModel()->isLoaded()) {
+                avatarsWithNewJointData.push_back(static_cast<OtherAvatar*>(avatar.get()));
+            }
+        }
+        if (avatarsWithNewJointData.size() > 1) {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, avatarsWithNewJointData.size()),
+                              [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    avatarsWithNewJointData[i]->applyPendingJointData();
+                }
+            });
+        }
+    }
+
+    ++_simulationFrameCount;
+    uint32_t simulationRank = 0;
+    uint32_t renderRank = 0;
+    bool crowdCapEnabled = (_crowdRenderMaxFullAvatars >= 0) || (_crowdRenderRadius > 0.0f);
+    glm::vec3 crowdCenter = _myAvatar->getWorldPosition();
+
     for (int p = kHero; p < NumVariants; p++) {
         auto& priorityQueue = avatarPriorityQueues[p];
         // Sorting the current queue HERE as part of the measured timing.
@@ -327,30 +379,74 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
 
             avatar->animateScaleChanges(deltaTime);
 
+            if (crowdCapEnabled) {
+                // Crowd rendering cap: past the radius or the prominence cap, the full skinned
+                // draw is skipped outright. Hysteresis around the radius keeps avatars walking
+                // along the boundary from flickering in and out.
+                bool fullRender = (_crowdRenderMaxFullAvatars < 0) || (renderRank < (uint32_t)_crowdRenderMaxFullAvatars);
+                if (fullRender && _crowdRenderRadius > 0.0f) {
+                    const float CROWD_RADIUS_HYSTERESIS = 0.1f;
+                    float threshold = avatar->_crowdCulled
+                        ? _crowdRenderRadius * (1.0f - CROWD_RADIUS_HYSTERESIS)
+                        : _crowdRenderRadius * (1.0f + CROWD_RADIUS_HYSTERESIS);
+                    fullRender = glm::distance(avatar->getWorldPosition(), crowdCenter) < threshold;
+                }
+                bool culled = !fullRender;
+                if (culled != avatar->_crowdCulled) {
+                    avatar->_crowdCulled = culled;
+                    avatar->setEnableMeshVisible(!culled);
+                }
+            }
+            ++renderRank;
+
             uint64_t now = usecTimestampNow();
             if (now < passExpiry) {
                 // we're within budget
                 bool inView = sortData.getPriority() > OUT_OF_VIEW_THRESHOLD;
-                if (inView && avatar->hasNewJointData()) {
-                    numAvatarsUpdated++;
-                }
-                auto transitStatus = avatar->_transit.update(deltaTime, avatar->_serverPosition, _transitConfig);
-                if (avatar->getIsNewAvatar() && (transitStatus == AvatarTransit::Status::START_TRANSIT ||
-                                                 transitStatus == AvatarTransit::Status::ABORT_TRANSIT)) {
-                    avatar->_transit.reset();
-                    avatar->setIsNewAvatar(false);
-                }
-                avatar->simulate(deltaTime, inView);
-                if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
-                    _myAvatar->addAvatarHandsToFlow(avatar);
+
+                // Graduated simulation LOD: beyond the most prominent avatars,
+                // simulate at half then quarter rate with staggered phases; a
+                // skipped avatar keeps its stale update timestamp, which raises
+                // its age priority until it comes due. The delta time passed on
+                // due frames covers the skipped ones.
+                const uint32_t FULL_RATE_RANK = 10;
+                const uint32_t HALF_RATE_RANK = 30;
+                uint32_t simulationInterval = 1;
+                if (p == kNonHero) {
+                    if (simulationRank >= HALF_RATE_RANK) {
+                        simulationInterval = 4;
+                    } else if (simulationRank >= FULL_RATE_RANK) {
+                        simulationInterval = 2;
+                    }
                 }
-                if (_drawOtherAvatarSkeletons) {
-                    avatar->debugJointData();
+                ++simulationRank;
+
+                bool dueThisFrame = (simulationInterval == 1) ||
+                    (((_simulationFrameCount + simulationRank) % simulationInterval) == 0);
+
+                if (dueThisFrame) {
+                    float tierDeltaTime = deltaTime * (float)simulationInterval;
+                    if (inView && avatar->hasNewJointData()) {
+                        numAvatarsUpdated++;
+                    }
+                    auto transitStatus = avatar->_transit.update(tierDeltaTime, avatar->_serverPosition, _transitConfig);
+                    if (avatar->getIsNewAvatar() && (transitStatus == AvatarTransit::Status::START_TRANSIT ||
+                                                     transitStatus == AvatarTransit::Status::ABORT_TRANSIT)) {
+                        avatar->_transit.reset();
+                        avatar->setIsNewAvatar(false);
+                    }
+                    avatar->simulate(tierDeltaTime, inView);
+                    if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
+                        _myAvatar->addAvatarHandsToFlow(avatar);
+                    }
+                    if (_drawOtherAvatarSkeletons) {
+                        avatar->debugJointData();
+                    }
+                    avatar->setEnableMeshVisible(!_drawOtherAvatarSkeletons && !avatar->_crowdCulled);
+                    avatar->updateRenderItem(renderTransaction);
+                    avatar->updateSpaceProxy(workloadTransaction);
+                    avatar->setLastRenderUpdateTime(startTime);
                 }
-                avatar->setEnableMeshVisible(!_drawOtherAvatarSkeletons);
-                avatar->updateRenderItem(renderTransaction);
-                avatar->updateSpaceProxy(workloadTransaction);
-                avatar->setLastRenderUpdateTime(startTime);
 
             } else {
                 // we've spent our time budget for this priority bucket
@@ -621,6 +717,7 @@ void AvatarManager::clearOtherAvatars() {
             auto avatar = std::static_pointer_cast<Avatar>(avatarIterator.value());
             if (avatar != _myAvatar) {
                 removedAvatars.push_back(avatar);
+                shardRemove(avatarIterator.key());
                 avatarIterator = _avatarHash.erase(avatarIterator);
             } else {
                 ++avatarIterator;
@@ -639,6 +736,7 @@ void AvatarManager::deleteAllAvatars() {
     AvatarHash::iterator avatarIterator = _avatarHash.begin();
     while (avatarIterator != _avatarHash.end()) {
         auto avatar = std::static_pointer_cast<Avatar>(avatarIterator.value());
+        shardRemove(avatarIterator.key());
         avatarIterator = _avatarHash.erase(avatarIterator);
         avatar->die();
         if (avatar != _myAvatar) {
@@ -145,6 +145,18 @@ public:
      */
     Q_INVOKABLE float getAvatarDataRate(const QUuid& sessionID, const QString& rateName = QString("")) const;
 
+    /**jsdoc
+     * Limits how many distant avatars get full skinned rendering in dense crowds. Avatars beyond
+     * the radius or the prominence cap have their meshes hidden (with hysteresis at the radius
+     * so the swap doesn't flicker); disabled by default.
+     * @function AvatarManager.setCrowdRenderLimits
+     * @param {number} radius - Full rendering within this many meters; pass <code>0</code> for no
+     *     radius limit.
+     * @param {number} maxFullAvatars - At most this many avatars (most prominent first) render
+     *     fully; pass <code>-1</code> for no count limit.
+     */
+    Q_INVOKABLE void setCrowdRenderLimits(float radius, int maxFullAvatars);
+
     /**jsdoc
      * Gets the update rate of avatar mixer data being generated by an avatar other than your own.
      * @function AvatarManager.getAvatarUpdateRate
@@ -294,6 +306,13 @@ private:
     using SetOfOtherAvatars = std::set<OtherAvatarPointer>;
     SetOfOtherAvatars _otherAvatarsToChangeInPhysics;
 
+    // crowd rendering cap (disabled by default): see setCrowdRenderLimits
+
+    float _crowdRenderRadius { 0.0f };
+
+    int _crowdRenderMaxFullAvatars { -1 };
+
+
     std::shared_ptr<MyAvatar> _myAvatar;
     quint64 _lastSendAvatarDataTime = 0; // Controls MyAvatar send data rate.
 
@@ -306,6 +325,7 @@ private:
     int _numHeroAvatarsUpdated{ 0 };
     float _avatarSimulationTime { 0.0f };
     bool _shouldRender { true };
+    uint32_t _simulationFrameCount { 0 };   // phase for graduated simulation LOD
     bool _myAvatarDataPacketsPaused { false };
 
     mutable std::mutex _spaceLock;
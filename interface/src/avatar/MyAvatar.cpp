@@ -1110,29 +1110,52 @@ void MyAvatar::updateSensorToWorldMatrix() {
     // update the sensor mat so that the body position will end up in the desired
     // position when driven from the head.
     float sensorToWorldScale = getEyeHeight() / getUserEyeHeight();
-    glm::mat4 desiredMat = createMatFromScaleQuatAndPos(glm::vec3(sensorToWorldScale), getWorldOrientation(), getWorldPosition());
-    _sensorToWorldMatrix = desiredMat * glm::inverse(_bodySensorMatrix);
+    glm::quat worldOrientation = getWorldOrientation();
+    glm::vec3 worldPosition = getWorldPosition();
 
-    bool hasSensorToWorldScaleChanged = false;
-    if (fabsf(getSensorToWorldScale() - sensorToWorldScale) > MIN_SCALE_CHANGED_DELTA) {
-        hasSensorToWorldScaleChanged = true;
-    }
+    // Incremental: this runs several times per frame and its inputs usually
+    // have not changed between calls; only redo the matrix math when one of
+    // them moved. The palm caches and controller joint caches update
+    // regardless, since hand joints and controller poses change on their own.
+    bool inputsChanged = !_sensorToWorldInputsValid ||
+        sensorToWorldScale != _lastSensorToWorldScale ||
+        worldOrientation != _lastSensorToWorldOrientation ||
+        worldPosition != _lastSensorToWorldPosition ||
+        _bodySensorMatrix != _lastBodySensorMatrix;
 
-    lateUpdatePalms();
+    if (inputsChanged) {
+        _sensorToWorldInputsValid = true;
+        _lastSensorToWorldScale = sensorToWorldScale;
+        _lastSensorToWorldOrientation = worldOrientation;
+        _lastSensorToWorldPosition = worldPosition;
+        _lastBodySensorMatrix = _bodySensorMatrix;
+
+        glm::mat4 desiredMat = createMatFromScaleQuatAndPos(glm::vec3(sensorToWorldScale), worldOrientation, worldPosition);
+        _sensorToWorldMatrix = desiredMat * glm::inverse(_bodySensorMatrix);
+
+        bool hasSensorToWorldScaleChanged = false;
+        if (fabsf(getSensorToWorldScale() - sensorToWorldScale) > MIN_SCALE_CHANGED_DELTA) {
+            hasSensorToWorldScaleChanged = true;
+        }
+
+        if (_enableDebugDrawSensorToWorldMatrix) {
+            DebugDraw::getInstance().addMarker("sensorToWorldMatrix", glmExtractRotation(_sensorToWorldMatrix),
+                                               extractTranslation(_sensorToWorldMatrix), glm::vec4(1));
+        }
+
+        _sensorToWorldMatrixCache.set(_sensorToWorldMatrix);
 
-    if (_enableDebugDrawSensorToWorldMatrix) {
-        DebugDraw::getInstance().addMarker("sensorToWorldMatrix", glmExtractRotation(_sensorToWorldMatrix),
-                                           extractTranslation(_sensorToWorldMatrix), glm::vec4(1));
+        if (hasSensorToWorldScaleChanged) {
+            emit sensorToWorldScaleChanged(sensorToWorldScale);
+        }
     }
 
-    _sensorToWorldMatrixCache.set(_sensorToWorldMatrix);
+    // the palm caches depend on the skeleton's hand joints, which animate even while every
+    // tracked input above is static - refresh them every call
+    lateUpdatePalms();
+
     updateJointFromController(controller::Action::LEFT_HAND, _controllerLeftHandMatrixCache);
     updateJointFromController(controller::Action::RIGHT_HAND, _controllerRightHandMatrixCache);
-    
-    if (hasSensorToWorldScaleChanged) {
-        emit sensorToWorldScaleChanged(sensorToWorldScale);
-    }
-    
 }
 
 glm::vec3 MyAvatar::getLeftHandPosition() const {
@@ -2811,6 +2811,12 @@ private:
 
     // working copy -- see AvatarData for thread-safe _sensorToWorldMatrixCache, used for outward facing access
     glm::mat4 _sensorToWorldMatrix { glm::mat4() };
+    // cached inputs for the incremental sensor-to-world update
+    bool _sensorToWorldInputsValid { false };
+    float _lastSensorToWorldScale { 0.0f };
+    glm::quat _lastSensorToWorldOrientation;
+    glm::vec3 _lastSensorToWorldPosition;
+    glm::mat4 _lastBodySensorMatrix;
 
     // cache of the current HMD sensor position and orientation in sensor space.
     glm::mat4 _hmdSensorMatrix;
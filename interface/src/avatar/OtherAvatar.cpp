@@ -243,6 +243,15 @@ void OtherAvatar::setCollisionWithOtherAvatarsFlags() {
     }
 }
 
+void OtherAvatar::applyPendingJointData() {
+    if (_hasNewJointData || _transit.isActive()) {
+        _skeletonModel->getRig().copyJointsFromJointData(_jointData);
+        glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
+        _skeletonModel->getRig().computeExternalPoses(rootTransform);
+        _jointDataApplied = true;
+    }
+}
+
 void OtherAvatar::simulate(float deltaTime, bool inView) {
     PROFILE_RANGE(simulation, "simulate");
 
@@ -262,9 +271,11 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
         if (inView) {
             Head* head = getHead();
             if (_hasNewJointData || _transit.isActive()) {
-                _skeletonModel->getRig().copyJointsFromJointData(_jointData);
-                glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
-                _skeletonModel->getRig().computeExternalPoses(rootTransform);
+                if (!_jointDataApplied) {
+                    _skeletonModel->getRig().copyJointsFromJointData(_jointData);
+                    glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
+                    _skeletonModel->getRig().computeExternalPoses(rootTransform);
+                }
                 _jointDataSimulationRate.increment();
 
                 head->simulate(deltaTime);
@@ -289,6 +300,7 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
             _skeletonModel->simulate(deltaTime, false);
         }
         _skeletonModelSimulationRate.increment();
+        _jointDataApplied = false;
     }
 
     // update animation for display name fade in/out
@@ -58,12 +58,21 @@ public:
     BodyLOD getBodyLOD() { return _bodyLOD; }
     void computeShapeLOD();
 
+    // whether the crowd-render cap currently has this avatar's skinned mesh hidden
+    bool _crowdCulled { false };
+
     void updateCollisionGroup(bool myAvatarCollide);
     bool getCollideWithOtherAvatars() const { return _collideWithOtherAvatars; } 
 
     void setCollisionWithOtherAvatarsFlags() override;
 
     void simulate(float deltaTime, bool inView) override;
+
+    
+    // Pre-pass: apply freshly received joint data to this avatar's rig. Touches
+    // only this avatar's state, so it is safe to run for many avatars in
+    // parallel; simulate() consumes the result within the same frame.
+    void applyPendingJointData();
     void debugJointData() const;
     friend AvatarManager;
 
@@ -89,6 +98,7 @@ protected:
     std::vector<DetailedMotionState*> _detailedMotionStates;
     int32_t _spaceIndex { -1 };
     uint8_t _workloadRegion { workload::Region::INVALID };
+    bool _jointDataApplied { false };
     BodyLOD _bodyLOD { BodyLOD::Sphere };
     bool _needsDetailedRebuild { false };
 };
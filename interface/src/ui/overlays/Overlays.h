@@ -747,6 +747,7 @@ private:
     void cleanupOverlaysToDelete();
 
     mutable QMutex _mutex { QMutex::Recursive };
+
     QMap<QUuid, Overlay::Pointer> _overlays;
     QList<Overlay::Pointer> _overlaysToDelete;
 
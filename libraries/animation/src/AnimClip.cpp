@@ -10,6 +10,9 @@
 
 #include "AnimClip.h"
 
+#include <map>
+#include <mutex>
+
 #include <assert.h>
 
 #include "GLMHelpers.h"
@@ -89,7 +92,7 @@ void bakeAbsoluteDeltaAnim(std::vector<AnimPoseVec>& anim, const AnimPoseVec& ba
     }
 }
 
-static std::vector<AnimPoseVec> copyAndRetargetFromNetworkAnim(AnimationPointer networkAnim, AnimSkeleton::ConstPointer avatarSkeleton) {
+static std::vector<AnimPoseVec> retargetFromNetworkAnim(AnimationPointer networkAnim, AnimSkeleton::ConstPointer avatarSkeleton) {
     ASSERT(networkAnim && networkAnim->isLoaded() && avatarSkeleton);
     std::vector<AnimPoseVec> anim;
 
@@ -223,6 +226,50 @@ static std::vector<AnimPoseVec> copyAndRetargetFromNetworkAnim(AnimationPointer
     return anim;
 }
 
+// The decoded and retargeted frames are identical for every avatar instance
+// that shares the animation and an equivalent skeleton, so a crowd of
+// identical avatars retargets each clip once and copies the cached result.
+static uint64_t computeSkeletonSignature(const AnimSkeleton::ConstPointer& skeleton) {
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ull;
+    };
+    int numJoints = skeleton->getNumJoints();
+    mix((uint64_t)numJoints);
+    for (int i = 0; i < numJoints; ++i) {
+        mix((uint64_t)qHash(skeleton->getJointName(i)));
+        const AnimPose& pose = skeleton->getRelativeDefaultPose(i);
+        const float* values = (const float*)&pose.trans();
+        for (int c = 0; c < 3; ++c) {
+            int32_t quantized = (int32_t)(values[c] * 10000.0f);
+            mix((uint64_t)(uint32_t)quantized);
+        }
+    }
+    return hash;
+}
+
+static std::vector<AnimPoseVec> copyAndRetargetFromNetworkAnim(AnimationPointer networkAnim,
+                                                               AnimSkeleton::ConstPointer avatarSkeleton) {
+    static std::mutex cacheMutex;
+    static std::map<std::pair<QString, uint64_t>, std::vector<AnimPoseVec>> retargetCache;
+    const size_t MAX_CACHED_RETARGETED_ANIMS = 64;
+
+    auto key = std::make_pair(networkAnim->getURL().toString(), computeSkeletonSignature(avatarSkeleton));
+
+    // returned by value, copied under the lock: a reference into the cache would dangle when
+    // another thread trips the size cap and clears the storage
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto itr = retargetCache.find(key);
+    if (itr == retargetCache.end()) {
+        if (retargetCache.size() >= MAX_CACHED_RETARGETED_ANIMS) {
+            retargetCache.clear();
+        }
+        itr = retargetCache.emplace(key, retargetFromNetworkAnim(networkAnim, avatarSkeleton)).first;
+    }
+    return itr->second;
+}
+
 AnimClip::AnimClip(const QString& id, const QString& url, float startFrame, float endFrame, float timeScale, bool loopFlag, bool mirrorFlag,
                    AnimBlendType blendType, const QString& baseURL, float baseFrame) :
     AnimNode(AnimNode::Type::Clip, id),
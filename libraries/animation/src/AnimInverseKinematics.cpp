@@ -333,6 +333,15 @@ void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<
                 }
             }
         }
+
+        // Convergence early-out: once every positional target is within
+        // tolerance, skip ahead so the next iteration is the final one (which
+        // still runs the chain interpolation and debug-draw work that only
+        // happens on the last loop).
+        const float IK_CONVERGENCE_ERROR = 0.001f;  // meters
+        if (maxError < IK_CONVERGENCE_ERROR && numLoops < MAX_IK_LOOPS - 1) {
+            numLoops = MAX_IK_LOOPS - 1;
+        }
     }
     _maxErrorOnLastSolve = maxError;
 
@@ -68,12 +68,27 @@ glm::vec3 AnimPose::xformVectorFast(const glm::vec3& rhs) const {
 }
 
 AnimPose AnimPose::operator*(const AnimPose& rhs) const {
+    // Fast path: with unit scale on both sides - the overwhelmingly common case
+    // for avatar joints - the poses compose directly, skipping two quat-to-mat4
+    // conversions, a 4x4 multiply and a matrix decomposition per joint.
+    const glm::vec3 ONE(1.0f);
+    if (_scale == ONE && rhs._scale == ONE) {
+        return AnimPose(_rot * rhs._rot, _trans + _rot * rhs._trans);
+    }
+
     glm::mat4 result;
     glm_mat4u_mul(*this, rhs, result);
     return AnimPose(result);
 }
 
 AnimPose AnimPose::inverse() const {
+    // matching fast path for unit scale
+    const glm::vec3 ONE(1.0f);
+    if (_scale == ONE) {
+        glm::quat invRot = glm::inverse(_rot);
+        return AnimPose(invRot, invRot * -_trans);
+    }
+
     return AnimPose(glm::inverse(static_cast<glm::mat4>(*this)));
 }
 
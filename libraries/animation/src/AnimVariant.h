@@ -16,6 +16,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <QScriptValue>
 #include <StreamUtils.h>
@@ -268,7 +269,13 @@ public:
 #endif
 
 protected:
-    std::map<QString, AnimVariant> _map;
+    // Hashed storage: animation-graph lookups hit this map hundreds of times per
+    // frame with short interned-style QString keys, so a single hash per lookup
+    // beats the ordered map's chain of string comparisons.
+    struct KeyHasher {
+        std::size_t operator()(const QString& key) const { return (std::size_t)qHash(key); }
+    };
+    std::unordered_map<QString, AnimVariant, KeyHasher> _map;
     std::set<QString> _triggers;
     glm::mat4 _rigToGeometryMat;
     glm::quat _rigToGeometryRot;
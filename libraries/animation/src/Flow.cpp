@@ -210,12 +210,13 @@ void FlowNode::update(float deltaTime, const glm::vec3& accelerationOffset) {
         float timeRatio = _scale * (FPS * deltaTime);
         float invertedTimeRatio = timeRatio > 0.0f ? 1.0f / timeRatio : 1.0f;
         auto deltaVelocity = _previousVelocity - _currentVelocity;
-        auto centrifugeVector = glm::length(deltaVelocity) != 0.0f ? glm::normalize(deltaVelocity) : glm::vec3();
+        float deltaVelocityLength = glm::length(deltaVelocity);
+        auto centrifugeVector = deltaVelocityLength != 0.0f ? deltaVelocity / deltaVelocityLength : glm::vec3();
         _acceleration = _acceleration + centrifugeVector * _settings._inertia * glm::length(_currentVelocity) * invertedTimeRatio;
 
         // Add offset
         _acceleration += accelerationOffset;
-        float accelerationFactor = powf(_settings._delta, 2.0f) * timeRatio;
+        float accelerationFactor = _settings._delta * _settings._delta * timeRatio;
         glm::vec3 deltaAcceleration = _acceleration * accelerationFactor;
         // Calculate new position        
         _currentPosition = _currentPosition + (_currentVelocity * _settings._damping) + deltaAcceleration;
@@ -287,7 +288,8 @@ void FlowJoint::update(float deltaTime) {
         glm::vec3 accelerationOffset = glm::vec3(0.0f);
         if (_settings._stiffness > 0.0f) {
             glm::vec3 recoveryVector = _recoveryPosition - _currentPosition;
-            float recoveryFactor = powf(_settings._stiffness, 3.0f);
+            float stiffness = _settings._stiffness;
+            float recoveryFactor = stiffness * stiffness * stiffness;
             accelerationOffset = recoveryVector * recoveryFactor;
         }
         FlowNode::update(deltaTime, accelerationOffset);
@@ -11,6 +11,7 @@
 
 #include "Rig.h"
 
+#include <SpatiallyNestable.h>
 #include <glm/gtx/vector_angle.hpp>
 #include <queue>
 #include <QScriptValueIterator>
@@ -1723,9 +1724,11 @@ void Rig::updateAnimations(float deltaTime, const glm::mat4& rootTransform, cons
             // animations haven't fully loaded yet.
             _networkPoseSet._relativePoses = _animSkeleton->getRelativeDefaultPoses();
         }
-        _lastAnimVars = _animVars;
-        _animVars = triggersOut;
-        _networkVars = networkTriggersOut;
+        // moves: these maps are rebuilt every frame, so handing the storage
+        // along beats copying every variant
+        _lastAnimVars = std::move(_animVars);
+        _animVars = std::move(triggersOut);
+        _networkVars = std::move(networkTriggersOut);
         _lastContext = context;
     }
     
@@ -1750,6 +1753,9 @@ void Rig::updateAnimations(float deltaTime, const glm::mat4& rootTransform, cons
         
         _externalPoseSet = _internalPoseSet;
     }
+
+    // joint poses just advanced; invalidate cached world transforms of joint-parented objects
+    SpatiallyNestable::bumpWorldTransformEpoch();
 }
 
 void Rig::updateFromEyeParameters(const EyeParameters& params) {
@@ -2530,9 +2536,13 @@ void Rig::applyOverridePoses() {
     ASSERT(_animSkeleton->getNumJoints() == (int)_internalPoseSet._overrideFlags.size());
     ASSERT(_animSkeleton->getNumJoints() == (int)_internalPoseSet._overridePoses.size());
 
-    for (size_t i = 0; i < _internalPoseSet._overrideFlags.size(); i++) {
+    // _numOverrides tells us how many joints are touched; stop as soon as the
+    // remainder of the flag scan cannot contain another one
+    int overridesRemaining = _numOverrides;
+    for (size_t i = 0; i < _internalPoseSet._overrideFlags.size() && overridesRemaining > 0; i++) {
         if (_internalPoseSet._overrideFlags[i]) {
             _internalPoseSet._relativePoses[i] = _internalPoseSet._overridePoses[i];
+            --overridesRemaining;
         }
     }
 }
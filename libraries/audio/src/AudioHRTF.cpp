@@ -91,7 +91,7 @@ static const float azimuthTable[NAZIMUTH][3] = {
 // A first-order shelving filter is used to minimize the disturbance in ITD.
 //
 // Loosely based on data from S. Spagnol, "Distance rendering and perception of nearby virtual sound sources
-// with a near-field filter model,� Applied Acoustics (2017)
+// with a near-field filter model,� Applied Acoustics (2017)
 // 
 static const int NNEARFIELD = 9;
 static const float nearFieldTable[NNEARFIELD][3] = {    // { b0, b1, a1 }
@@ -382,6 +382,10 @@ static void interpolate_SSE(const float* src0, const float* src1, float* dst, fl
 
 void FIR_1x4_AVX2(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames);
 void FIR_1x4_AVX512(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames);
+void FIR_2x4_AVX512(float* src0, float* src1,
+                    float* dst0, float* dst1, float* dst2, float* dst3,
+                    float* dst4, float* dst5, float* dst6, float* dst7,
+                    float coef0[4][HRTF_TAPS], float coef1[4][HRTF_TAPS], int numFrames);
 void interleave_4x4_AVX2(float* src0, float* src1, float* src2, float* src3, float* dst, int numFrames);
 void biquad2_4x4_AVX2(float* src, float* dst, float coef[5][8], float state[3][8], int numFrames);
 void crossfade_4x2_AVX2(float* src, float* dst, const float* win, int numFrames);
@@ -392,6 +396,20 @@ static void FIR_1x4(float* src, float* dst0, float* dst1, float* dst2, float* ds
     (*f)(src, dst0, dst1, dst2, dst3, coef, numFrames); // dispatch
 }
 
+// returns true when a paired (2-source) FIR kernel is available
+static bool FIR_2x4_present() {
+    static bool present = cpuSupportsAVX512();
+    return present;
+}
+
+static void FIR_2x4(float* src0, float* src1,
+                    float* dst0, float* dst1, float* dst2, float* dst3,
+                    float* dst4, float* dst5, float* dst6, float* dst7,
+                    float coef0[4][HRTF_TAPS], float coef1[4][HRTF_TAPS], int numFrames) {
+    assert(FIR_2x4_present());
+    FIR_2x4_AVX512(src0, src1, dst0, dst1, dst2, dst3, dst4, dst5, dst6, dst7, coef0, coef1, numFrames);
+}
+
 static void interleave_4x4(float* src0, float* src1, float* src2, float* src3, float* dst, int numFrames) {
     static auto f = cpuSupportsAVX2() ? interleave_4x4_AVX2 : interleave_4x4_SSE;
     (*f)(src0, src1, src2, src3, dst, numFrames); // dispatch
@@ -684,6 +702,22 @@ static void interpolate(const float* src0, const float* src1, float* dst, float
     }
 }
 
+// no paired FIR kernel in the portable build
+static bool FIR_2x4_present() {
+    return false;
+}
+
+static void FIR_2x4(float* src0, float* src1,
+                    float* dst0, float* dst1, float* dst2, float* dst3,
+                    float* dst4, float* dst5, float* dst6, float* dst7,
+                    float coef0[4][HRTF_TAPS], float coef1[4][HRTF_TAPS], int numFrames) {
+    (void)src0; (void)src1;
+    (void)dst0; (void)dst1; (void)dst2; (void)dst3;
+    (void)dst4; (void)dst5; (void)dst6; (void)dst7;
+    (void)coef0; (void)coef1; (void)numFrames;
+    assert(false);  // never dispatched when FIR_2x4_present() is false
+}
+
 #endif
 
 // apply gain crossfade with accumulation (interleaved)
@@ -1055,19 +1089,27 @@ static void setFilters(float firCoef[4][HRTF_TAPS], float bqCoef[5][8], int dela
     }
 }
 
-void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
-                       float lpfDistance) {
-
-    assert(index >= 0);
-    assert(index < HRTF_TABLES);
-    assert(numFrames == HRTF_BLOCK);
-
+//
+// Per-block work buffers. render() uses one instance on the stack,
+// renderBatch() reuses two instances across the whole batch.
+//
+struct AudioHRTF::Workspace {
     ALIGN32 float in[HRTF_TAPS + HRTF_BLOCK];               // mono
     ALIGN32 float firCoef[4][HRTF_TAPS];                    // 4-channel
     ALIGN32 float firBuffer[4][HRTF_DELAY + HRTF_BLOCK];    // 4-channel
     ALIGN32 float bqCoef[5][8];                             // 4-channel (interleaved)
     ALIGN32 float bqBuffer[4 * HRTF_BLOCK];                 // 4-channel (interleaved)
     int delay[4];                                           // 4-channel (interleaved)
+};
+
+//
+// Everything before the FIR stage: filter design, input conversion, FIR state update.
+//
+void AudioHRTF::setupBlock(Workspace& ws, int16_t* input, int index, float azimuth, float distance, float gain,
+                           float lpfDistance) {
+
+    assert(index >= 0);
+    assert(index < HRTF_TABLES);
 
     // apply global and local gain adjustment
     gain *= _gainAdjust;
@@ -1085,10 +1127,10 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     }
 
     // to avoid polluting the cache, old filters are recomputed instead of stored
-    setFilters(firCoef, bqCoef, delay, index, _azimuthState, _distanceState, _gainState, _lpfState, L0);
+    setFilters(ws.firCoef, ws.bqCoef, ws.delay, index, _azimuthState, _distanceState, _gainState, _lpfState, L0);
 
     // compute new filters
-    setFilters(firCoef, bqCoef, delay, index, azimuth, distance, gain, lpf, L1);
+    setFilters(ws.firCoef, ws.bqCoef, ws.delay, index, azimuth, distance, gain, lpf, L1);
 
     // new parameters become old
     _azimuthState = azimuth;
@@ -1098,20 +1140,20 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
 
     // convert mono input to float
     for (int i = 0; i < HRTF_BLOCK; i++) {
-        in[HRTF_TAPS+i] = (float)input[i] * (1/32768.0f);
+        ws.in[HRTF_TAPS+i] = (float)input[i] * (1/32768.0f);
     }
 
     // FIR state update
-    memcpy(in, _firState, HRTF_TAPS * sizeof(float));
-    memcpy(_firState, &in[HRTF_BLOCK], HRTF_TAPS * sizeof(float));
+    memcpy(ws.in, _firState, HRTF_TAPS * sizeof(float));
+    memcpy(_firState, &ws.in[HRTF_BLOCK], HRTF_TAPS * sizeof(float));
+}
 
-    // process old/new FIR
-    FIR_1x4(&in[HRTF_TAPS], 
-            &firBuffer[L0][HRTF_DELAY], 
-            &firBuffer[R0][HRTF_DELAY], 
-            &firBuffer[L1][HRTF_DELAY], 
-            &firBuffer[R1][HRTF_DELAY], 
-            firCoef, HRTF_BLOCK);
+//
+// Everything after the FIR stage: integer delay, biquads, crossfade and accumulate.
+//
+void AudioHRTF::processBlock(Workspace& ws, float* output) {
+
+    float (&firBuffer)[4][HRTF_DELAY + HRTF_BLOCK] = ws.firBuffer;
 
     // delay state update
     memcpy(firBuffer[L0], _delayState[L0], HRTF_DELAY * sizeof(float));
@@ -1125,14 +1167,14 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     memcpy(_delayState[R1], &firBuffer[R1][HRTF_BLOCK], HRTF_DELAY * sizeof(float));
 
     // interleave with old/new integer delay
-    interleave_4x4(&firBuffer[L0][HRTF_DELAY] - delay[L0],
-                   &firBuffer[R0][HRTF_DELAY] - delay[R0],
-                   &firBuffer[L1][HRTF_DELAY] - delay[L1],
-                   &firBuffer[R1][HRTF_DELAY] - delay[R1],
-                   bqBuffer, HRTF_BLOCK);
+    interleave_4x4(&firBuffer[L0][HRTF_DELAY] - ws.delay[L0],
+                   &firBuffer[R0][HRTF_DELAY] - ws.delay[R0],
+                   &firBuffer[L1][HRTF_DELAY] - ws.delay[L1],
+                   &firBuffer[R1][HRTF_DELAY] - ws.delay[R1],
+                   ws.bqBuffer, HRTF_BLOCK);
 
     // process old/new biquads
-    biquad2_4x4(bqBuffer, bqBuffer, bqCoef, _bqState, HRTF_BLOCK);
+    biquad2_4x4(ws.bqBuffer, ws.bqBuffer, ws.bqCoef, _bqState, HRTF_BLOCK);
 
     // new state becomes old
     _bqState[0][L0] = _bqState[0][L1];
@@ -1152,11 +1194,86 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     _bqState[2][R2] = _bqState[2][R3];
 
     // crossfade old/new output and accumulate
-    crossfade_4x2(bqBuffer, output, crossfadeTable, HRTF_BLOCK);
+    crossfade_4x2(ws.bqBuffer, output, crossfadeTable, HRTF_BLOCK);
 
     _resetState = false;
 }
 
+void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
+                       float lpfDistance) {
+
+    assert(numFrames == HRTF_BLOCK);
+
+    Workspace ws;
+
+    setupBlock(ws, input, index, azimuth, distance, gain, lpfDistance);
+
+    // process old/new FIR
+    FIR_1x4(&ws.in[HRTF_TAPS],
+            &ws.firBuffer[L0][HRTF_DELAY],
+            &ws.firBuffer[R0][HRTF_DELAY],
+            &ws.firBuffer[L1][HRTF_DELAY],
+            &ws.firBuffer[R1][HRTF_DELAY],
+            ws.firCoef, HRTF_BLOCK);
+
+    processBlock(ws, output);
+}
+
+void AudioHRTF::renderBatch(BatchedSource* sources, int numSources, float* output, int index, int numFrames,
+                            float lpfDistance) {
+
+    assert(numFrames == HRTF_BLOCK);
+
+    // work buffers are reused across the batch, to keep them hot in cache
+    Workspace ws[2];
+
+    int i = 0;
+
+    // pair sources through the wide FIR kernel, when present
+    if (FIR_2x4_present()) {
+        for (; i + 1 < numSources; i += 2) {
+
+            BatchedSource& s0 = sources[i+0];
+            BatchedSource& s1 = sources[i+1];
+
+            s0.hrtf->setupBlock(ws[0], s0.input, index, s0.azimuth, s0.distance, s0.gain, lpfDistance);
+            s1.hrtf->setupBlock(ws[1], s1.input, index, s1.azimuth, s1.distance, s1.gain, lpfDistance);
+
+            // process old/new FIR for both sources
+            FIR_2x4(&ws[0].in[HRTF_TAPS], &ws[1].in[HRTF_TAPS],
+                    &ws[0].firBuffer[L0][HRTF_DELAY],
+                    &ws[0].firBuffer[R0][HRTF_DELAY],
+                    &ws[0].firBuffer[L1][HRTF_DELAY],
+                    &ws[0].firBuffer[R1][HRTF_DELAY],
+                    &ws[1].firBuffer[L0][HRTF_DELAY],
+                    &ws[1].firBuffer[R0][HRTF_DELAY],
+                    &ws[1].firBuffer[L1][HRTF_DELAY],
+                    &ws[1].firBuffer[R1][HRTF_DELAY],
+                    ws[0].firCoef, ws[1].firCoef, HRTF_BLOCK);
+
+            s0.hrtf->processBlock(ws[0], output);
+            s1.hrtf->processBlock(ws[1], output);
+        }
+    }
+
+    // remaining sources take the single-source path
+    for (; i < numSources; i++) {
+
+        BatchedSource& s = sources[i];
+
+        s.hrtf->setupBlock(ws[0], s.input, index, s.azimuth, s.distance, s.gain, lpfDistance);
+
+        FIR_1x4(&ws[0].in[HRTF_TAPS],
+                &ws[0].firBuffer[L0][HRTF_DELAY],
+                &ws[0].firBuffer[R0][HRTF_DELAY],
+                &ws[0].firBuffer[L1][HRTF_DELAY],
+                &ws[0].firBuffer[R1][HRTF_DELAY],
+                ws[0].firCoef, HRTF_BLOCK);
+
+        s.hrtf->processBlock(ws[0], output);
+    }
+}
+
 void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames) {
 
     assert(numFrames == HRTF_BLOCK);
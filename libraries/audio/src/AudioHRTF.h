@@ -58,6 +58,23 @@ public:
     void render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
                 float lpfDistance = LPF_DISTANCE_REF);
 
+    //
+    // Batched render of multiple mono sources into one mix buffer.
+    //
+    // Equivalent to calling render() once per source, but reuses a single set of work
+    // buffers across the batch and pairs sources through the FIR stage, so wide SIMD
+    // kernels amortize loop overhead and coefficient broadcasts across two convolutions.
+    //
+    struct BatchedSource {
+        AudioHRTF* hrtf;
+        int16_t* input;
+        float azimuth;
+        float distance;
+        float gain;
+    };
+    static void renderBatch(BatchedSource* sources, int numSources, float* output, int index, int numFrames,
+                            float lpfDistance = LPF_DISTANCE_REF);
+
     //
     // Non-spatialized direct mix (accumulates into existing output)
     //
@@ -111,6 +128,13 @@ private:
     AudioHRTF(const AudioHRTF&) = delete;
     AudioHRTF& operator=(const AudioHRTF&) = delete;
 
+    // per-block work buffers, shared across a batch (defined in AudioHRTF.cpp)
+    struct Workspace;
+
+    // render() split at the FIR stage, so renderBatch() can pair sources through a wide kernel
+    void setupBlock(Workspace& ws, int16_t* input, int index, float azimuth, float distance, float gain, float lpfDistance);
+    void processBlock(Workspace& ws, float* output);
+
     // SIMD channel assignmentS
     enum Channel {
         L0, R0,
@@ -100,17 +100,18 @@ int AudioRingBufferTemplate<T>::readData(char *data, int maxSize) {
     int maxSamples = maxSize / SampleSize;
     int numReadSamples = std::min(maxSamples, samplesAvailable());
 
-    if (_nextOutput + numReadSamples > _buffer + _bufferLength) {
+    Sample* nextOutput = _nextOutput.load(std::memory_order_relaxed);  // consumer owns _nextOutput
+    if (nextOutput + numReadSamples > _buffer + _bufferLength) {
         // we're going to need to do two reads to get this data, it wraps around the edge
-        int numSamplesToEnd = (_buffer + _bufferLength) - _nextOutput;
+        int numSamplesToEnd = (_buffer + _bufferLength) - nextOutput;
 
         // read to the end of the buffer
-        memcpy(data, _nextOutput, numSamplesToEnd * SampleSize);
+        memcpy(data, nextOutput, numSamplesToEnd * SampleSize);
 
         // read the rest from the beginning of the buffer
         memcpy(data + (numSamplesToEnd * SampleSize), _buffer, (numReadSamples - numSamplesToEnd) * SampleSize);
     } else {
-        memcpy(data, _nextOutput, numReadSamples * SampleSize);
+        memcpy(data, nextOutput, numReadSamples * SampleSize);
     }
 
     shiftReadPosition(numReadSamples);
@@ -125,10 +126,10 @@ int AudioRingBufferTemplate<T>::appendData(char *data, int maxSize) {
     int numReadSamples = std::min(maxSamples, samplesAvailable());
 
     Sample* dest = reinterpret_cast<Sample*>(data);
-    Sample* output = _nextOutput;
-    if (_nextOutput + numReadSamples > _buffer + _bufferLength) {
+    Sample* output = _nextOutput.load(std::memory_order_relaxed);  // consumer owns _nextOutput
+    if (output + numReadSamples > _buffer + _bufferLength) {
         // we're going to need to do two reads to get this data, it wraps around the edge
-        int numSamplesToEnd = (_buffer + _bufferLength) - _nextOutput;
+        int numSamplesToEnd = (_buffer + _bufferLength) - output;
 
         // read to the end of the buffer
         for (int i = 0; i < numSamplesToEnd; i++) {
@@ -166,7 +167,9 @@ int AudioRingBufferTemplate<T>::writeData(const char* data, int maxSize) {
     if (numWriteSamples > samplesRoomFor) {
         // there's not enough room for this write. erase old data to make room for this new data
         int samplesToDelete = numWriteSamples - samplesRoomFor;
-        _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, samplesToDelete);
+        // NOTE: only safe when producer and consumer share a thread - see header
+        _nextOutput.store(shiftedPositionAccomodatingWrap(_nextOutput.load(std::memory_order_relaxed), samplesToDelete),
+                          std::memory_order_relaxed);
         _overflowCount++;
 
         std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
@@ -174,31 +177,35 @@ int AudioRingBufferTemplate<T>::writeData(const char* data, int maxSize) {
         HIFI_FCDEBUG_ID(audio(), repeatedOverflowMessageID, RING_BUFFER_OVERFLOW_DEBUG);
     }
 
-    if (_endOfLastWrite + numWriteSamples > _buffer + _bufferLength) {
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_relaxed);  // producer owns _endOfLastWrite
+    if (endOfLastWrite + numWriteSamples > _buffer + _bufferLength) {
         // we're going to need to do two writes to set this data, it wraps around the edge
-        int numSamplesToEnd = (_buffer + _bufferLength) - _endOfLastWrite;
+        int numSamplesToEnd = (_buffer + _bufferLength) - endOfLastWrite;
 
         // write to the end of the buffer
-        memcpy(_endOfLastWrite, data, numSamplesToEnd * SampleSize);
+        memcpy(endOfLastWrite, data, numSamplesToEnd * SampleSize);
 
         // write the rest to the beginning of the buffer
         memcpy(_buffer, data + (numSamplesToEnd * SampleSize), (numWriteSamples - numSamplesToEnd) * SampleSize);
     } else {
-        memcpy(_endOfLastWrite, data, numWriteSamples * SampleSize);
+        memcpy(endOfLastWrite, data, numWriteSamples * SampleSize);
     }
 
-    _endOfLastWrite = shiftedPositionAccomodatingWrap(_endOfLastWrite, numWriteSamples);
+    // release publishes the samples to the consumer before the new write position
+    _endOfLastWrite.store(shiftedPositionAccomodatingWrap(endOfLastWrite, numWriteSamples), std::memory_order_release);
 
     return numWriteSamples * SampleSize;
 }
 
 template <class T>
 int AudioRingBufferTemplate<T>::samplesAvailable() const {
-    if (!_endOfLastWrite) {
+    // acquire both positions, so either side sees the other's latest publish
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_acquire);
+    if (!endOfLastWrite) {
         return 0;
     }
 
-    int sampleDifference = _endOfLastWrite - _nextOutput;
+    int sampleDifference = endOfLastWrite - _nextOutput.load(std::memory_order_acquire);
     if (sampleDifference < 0) {
         sampleDifference += _bufferLength;
     }
@@ -231,15 +238,17 @@ int AudioRingBufferTemplate<T>::addSilentSamples(int silentSamples) {
         HIFI_FCDEBUG(audio(), DROPPED_SILENT_DEBUG);
     }
 
-    if (_endOfLastWrite + numWriteSamples > _buffer + _bufferLength) {
-        int numSamplesToEnd = (_buffer + _bufferLength) - _endOfLastWrite;
-        memset(_endOfLastWrite, 0, numSamplesToEnd * SampleSize);
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_relaxed);  // producer owns _endOfLastWrite
+    if (endOfLastWrite + numWriteSamples > _buffer + _bufferLength) {
+        int numSamplesToEnd = (_buffer + _bufferLength) - endOfLastWrite;
+        memset(endOfLastWrite, 0, numSamplesToEnd * SampleSize);
         memset(_buffer, 0, (numWriteSamples - numSamplesToEnd) * SampleSize);
     } else {
-        memset(_endOfLastWrite, 0, numWriteSamples * SampleSize);
+        memset(endOfLastWrite, 0, numWriteSamples * SampleSize);
     }
 
-    _endOfLastWrite = shiftedPositionAccomodatingWrap(_endOfLastWrite, numWriteSamples);
+    // release publishes the samples to the consumer before the new write position
+    _endOfLastWrite.store(shiftedPositionAccomodatingWrap(endOfLastWrite, numWriteSamples), std::memory_order_release);
 
     return numWriteSamples;
 }
@@ -277,7 +286,9 @@ int AudioRingBufferTemplate<T>::writeSamples(ConstIterator source, int maxSample
     if (samplesToCopy > samplesRoomFor) {
         // there's not enough room for this write.  erase old data to make room for this new data
         int samplesToDelete = samplesToCopy - samplesRoomFor;
-        _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, samplesToDelete);
+        // NOTE: only safe when producer and consumer share a thread - see header
+        _nextOutput.store(shiftedPositionAccomodatingWrap(_nextOutput.load(std::memory_order_relaxed), samplesToDelete),
+                          std::memory_order_relaxed);
         _overflowCount++;
 
         std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
@@ -286,12 +297,16 @@ int AudioRingBufferTemplate<T>::writeSamples(ConstIterator source, int maxSample
     }
 
     Sample* bufferLast = _buffer + _bufferLength - 1;
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_relaxed);  // producer owns _endOfLastWrite
     for (int i = 0; i < samplesToCopy; i++) {
-        *_endOfLastWrite = *source;
-        _endOfLastWrite = (_endOfLastWrite == bufferLast) ? _buffer : _endOfLastWrite + 1;
+        *endOfLastWrite = *source;
+        endOfLastWrite = (endOfLastWrite == bufferLast) ? _buffer : endOfLastWrite + 1;
         ++source;
     }
 
+    // release publishes the samples to the consumer before the new write position
+    _endOfLastWrite.store(endOfLastWrite, std::memory_order_release);
+
     return samplesToCopy;
 }
 
@@ -302,7 +317,9 @@ int AudioRingBufferTemplate<T>::writeSamplesWithFade(ConstIterator source, int m
     if (samplesToCopy > samplesRoomFor) {
         // there's not enough room for this write.  erase old data to make room for this new data
         int samplesToDelete = samplesToCopy - samplesRoomFor;
-        _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, samplesToDelete);
+        // NOTE: only safe when producer and consumer share a thread - see header
+        _nextOutput.store(shiftedPositionAccomodatingWrap(_nextOutput.load(std::memory_order_relaxed), samplesToDelete),
+                          std::memory_order_relaxed);
         _overflowCount++;
 
         std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
@@ -311,12 +328,16 @@ int AudioRingBufferTemplate<T>::writeSamplesWithFade(ConstIterator source, int m
     }
 
     Sample* bufferLast = _buffer + _bufferLength - 1;
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_relaxed);  // producer owns _endOfLastWrite
     for (int i = 0; i < samplesToCopy; i++) {
-        *_endOfLastWrite = (Sample)((float)(*source) * fade);
-        _endOfLastWrite = (_endOfLastWrite == bufferLast) ? _buffer : _endOfLastWrite + 1;
+        *endOfLastWrite = (Sample)((float)(*source) * fade);
+        endOfLastWrite = (endOfLastWrite == bufferLast) ? _buffer : endOfLastWrite + 1;
         ++source;
     }
 
+    // release publishes the samples to the consumer before the new write position
+    _endOfLastWrite.store(endOfLastWrite, std::memory_order_release);
+
     return samplesToCopy;
 }
 
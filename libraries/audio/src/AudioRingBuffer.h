@@ -14,6 +14,8 @@
 
 #include "AudioConstants.h"
 
+#include <atomic>
+
 #include <QtCore/QIODevice>
 
 #include <SharedUtil.h>
@@ -47,7 +49,16 @@ public:
 
     // Reading and writing to the buffer uses minimal shared data, such that
     // in cases that avoid overwriting the buffer, a single producer/consumer
-    // may use this as a lock-free pipe (see audio-client/src/AudioClient.cpp).
+    // may use this as a lock-free pipe (see audio-client/src/AudioClient.cpp and
+    // InboundAudioStream, where the network thread produces and the mixer consumes).
+    //
+    // The shared positions are atomics: the consumer owns _nextOutput and the
+    // producer owns _endOfLastWrite. Each side publishes its own position with
+    // memory_order_release after touching the sample data, and observes the other
+    // side's position with memory_order_acquire, so the sample data written before
+    // a publish is visible to the other thread after it observes the new position.
+    // On overflow the producer also moves _nextOutput, which is only safe when
+    // both sides run on one thread - steady-state SPSC use never overflows.
     // IMPORTANT: Avoid changes to the implementation that touch shared data unless you can
     // maintain this behavior.
 
@@ -85,13 +96,21 @@ public:
     int writeData(const char* source, int maxSize);
 
     /// Returns a reference to the index-th sample offset from the current read sample
-    Sample& operator[](const int index) { return *shiftedPositionAccomodatingWrap(_nextOutput, index); }
-    const Sample& operator[] (const int index) const { return *shiftedPositionAccomodatingWrap(_nextOutput, index); }
+    Sample& operator[](const int index) {
+        return *shiftedPositionAccomodatingWrap(_nextOutput.load(std::memory_order_relaxed), index);
+    }
+    const Sample& operator[] (const int index) const {
+        return *shiftedPositionAccomodatingWrap(_nextOutput.load(std::memory_order_relaxed), index);
+    }
 
     /// Essentially discards the next numSamples from the ring buffer
     /// NOTE: This is not checked - it is possible to shift past written data
     ///       Use samplesAvailable() to see the distance a valid shift can go
-    void shiftReadPosition(unsigned int numSamples) { _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, numSamples); }
+    void shiftReadPosition(unsigned int numSamples) {
+        // release publishes the consumed region back to the producer
+        _nextOutput.store(shiftedPositionAccomodatingWrap(_nextOutput.load(std::memory_order_relaxed), numSamples),
+                          std::memory_order_release);
+    }
 
     int samplesAvailable() const;
     int framesAvailable() const { return (_numFrameSamples == 0) ? 0 : samplesAvailable() / _numFrameSamples; }
@@ -199,10 +218,11 @@ public:
     };
 
     ConstIterator nextOutput() const {
-        return ConstIterator(_buffer, _bufferLength, _nextOutput);
+        return ConstIterator(_buffer, _bufferLength, _nextOutput.load(std::memory_order_relaxed));
     }
     ConstIterator lastFrameWritten() const {
-        return ConstIterator(_buffer, _bufferLength, _endOfLastWrite) - _numFrameSamples;
+        // acquire, so the consumer sees the samples behind the producer's position
+        return ConstIterator(_buffer, _bufferLength, _endOfLastWrite.load(std::memory_order_acquire)) - _numFrameSamples;
     }
 
     int writeSamples(ConstIterator source, int maxSamples);
@@ -220,8 +240,9 @@ protected:
     int _bufferLength; // actual _buffer length (_sampleCapacity + 1)
     int _overflowCount{ 0 }; // times the ring buffer has overwritten data
 
-    Sample* _nextOutput{ nullptr };
-    Sample* _endOfLastWrite{ nullptr };
+    // shared SPSC positions - see the memory-order notes above
+    std::atomic<Sample*> _nextOutput{ nullptr };
+    std::atomic<Sample*> _endOfLastWrite{ nullptr };
     Sample* _buffer{ nullptr };
 };
 
@@ -0,0 +1,149 @@
+//
+//  AudioSPSCRingBuffer.h
+//  libraries/audio/src
+//
+//  Created by High Fidelity on 9/1/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSPSCRingBuffer_h
+#define hifi_AudioSPSCRingBuffer_h
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+
+//
+// Wait-free single-producer/single-consumer ring buffer of audio samples.
+//
+// Unlike AudioRingBuffer, the capacity is a compile-time power of two, so all
+// index arithmetic is a mask instead of a wrap test, and there is no overflow
+// path that moves the read position from the producer side - write() never
+// overwrites unread data, it returns a short count instead. This makes the
+// buffer safe for cross-thread use unconditionally: the network thread can
+// write decoded frames while the mixer thread reads them, without ever blocking.
+//
+// Memory ordering:
+//  - the producer owns _writeIndex: it loads it relaxed, and stores it with
+//    memory_order_release after the samples are written, which publishes the
+//    samples to the consumer.
+//  - the consumer owns _readIndex: it loads it relaxed, and stores it with
+//    memory_order_release after the samples are read, which returns the space
+//    to the producer.
+//  - each side loads the other side's index with memory_order_acquire, pairing
+//    with the release store above.
+//
+// Indices increase monotonically and are masked on access, so a full buffer
+// (writeIndex - readIndex == N) is distinct from an empty one, and all N
+// samples of capacity are usable.
+//
+template <class T, uint32_t N>
+class AudioSPSCRingBuffer {
+    using Sample = T;
+    static const int SampleSize = sizeof(Sample);
+
+    static_assert((N & (N - 1)) == 0, "AudioSPSCRingBuffer capacity must be a power of two");
+    static_assert(N != 0, "AudioSPSCRingBuffer capacity must be nonzero");
+
+public:
+    AudioSPSCRingBuffer() {
+        memset(_buffer, 0, sizeof(_buffer));
+    }
+
+    // disallow copying
+    AudioSPSCRingBuffer(const AudioSPSCRingBuffer&) = delete;
+    AudioSPSCRingBuffer& operator=(const AudioSPSCRingBuffer&) = delete;
+
+    static constexpr uint32_t getSampleCapacity() { return N; }
+
+    //
+    // Producer side
+    //
+
+    /// Samples that can be written without overwriting unread data
+    uint32_t samplesWritable() const {
+        uint32_t writeIndex = _writeIndex.load(std::memory_order_relaxed);       // own index
+        uint32_t readIndex = _readIndex.load(std::memory_order_acquire);         // other side's publish
+        return N - (writeIndex - readIndex);
+    }
+
+    /// Write up to maxSamples from source, never overwriting unread data
+    /// Returns number of written samples
+    uint32_t write(const Sample* source, uint32_t maxSamples) {
+        uint32_t writeIndex = _writeIndex.load(std::memory_order_relaxed);
+        uint32_t readIndex = _readIndex.load(std::memory_order_acquire);
+
+        uint32_t numSamples = std::min(maxSamples, N - (writeIndex - readIndex));
+
+        uint32_t offset = writeIndex & (N - 1);
+        uint32_t numSamplesToEnd = std::min(numSamples, N - offset);
+
+        memcpy(&_buffer[offset], source, numSamplesToEnd * SampleSize);
+        memcpy(&_buffer[0], source + numSamplesToEnd, (numSamples - numSamplesToEnd) * SampleSize);
+
+        // release publishes the samples before the new write index
+        _writeIndex.store(writeIndex + numSamples, std::memory_order_release);
+
+        return numSamples;
+    }
+
+    //
+    // Consumer side
+    //
+
+    /// Samples available to read
+    uint32_t samplesAvailable() const {
+        uint32_t writeIndex = _writeIndex.load(std::memory_order_acquire);       // other side's publish
+        uint32_t readIndex = _readIndex.load(std::memory_order_relaxed);         // own index
+        return writeIndex - readIndex;
+    }
+
+    /// Read up to maxSamples into destination
+    /// Returns number of read samples
+    uint32_t read(Sample* destination, uint32_t maxSamples) {
+        uint32_t writeIndex = _writeIndex.load(std::memory_order_acquire);
+        uint32_t readIndex = _readIndex.load(std::memory_order_relaxed);
+
+        uint32_t numSamples = std::min(maxSamples, writeIndex - readIndex);
+
+        uint32_t offset = readIndex & (N - 1);
+        uint32_t numSamplesToEnd = std::min(numSamples, N - offset);
+
+        memcpy(destination, &_buffer[offset], numSamplesToEnd * SampleSize);
+        memcpy(destination + numSamplesToEnd, &_buffer[0], (numSamples - numSamplesToEnd) * SampleSize);
+
+        // release returns the space to the producer
+        _readIndex.store(readIndex + numSamples, std::memory_order_release);
+
+        return numSamples;
+    }
+
+    /// Discard up to maxSamples without copying
+    /// Returns number of skipped samples
+    uint32_t skip(uint32_t maxSamples) {
+        uint32_t writeIndex = _writeIndex.load(std::memory_order_acquire);
+        uint32_t readIndex = _readIndex.load(std::memory_order_relaxed);
+
+        uint32_t numSamples = std::min(maxSamples, writeIndex - readIndex);
+
+        _readIndex.store(readIndex + numSamples, std::memory_order_release);
+
+        return numSamples;
+    }
+
+private:
+    static const int CACHE_LINE_SIZE = 64;
+
+    // indices are kept on separate cache lines from each other and the sample
+    // data, so the producer and consumer never false-share
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> _writeIndex{ 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> _readIndex{ 0 };
+    alignas(CACHE_LINE_SIZE) Sample _buffer[N];
+};
+
+#endif // hifi_AudioSPSCRingBuffer_h
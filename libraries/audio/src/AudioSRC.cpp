@@ -1548,6 +1548,111 @@ int AudioSRC::render(const float* input, float* output, int inputFrames) {
     return outputFrames;
 }
 
+// two converters are in lockstep when the same kernel invocation can advance both
+bool AudioSRC::inLockstepWith(const AudioSRC& other) const {
+    return _inputSampleRate == other._inputSampleRate &&
+           _outputSampleRate == other._outputSampleRate &&
+           _numTaps == other._numTaps &&
+           _phase == other._phase &&
+           _offset == other._offset &&
+           _step == other._step;
+}
+
+//
+// Paired mono render of one block (deinterleaved float), using the 2-channel kernel.
+// Both converters must be mono and in lockstep, with input already converted.
+//
+int AudioSRC::renderPairBlock(AudioSRC& other, int inputFrames) {
+    assert(_numChannels == 1);
+    assert(other._numChannels == 1);
+    assert(inLockstepWith(other));
+
+    int outputFrames = 0;
+
+    int nh = MIN(_numHistory, inputFrames); // number of frames from history buffer
+    int ni = inputFrames - nh;              // number of frames from remaining input
+
+    // refill history buffers
+    memcpy(_history[0] + _numHistory, _inputs[0], nh * sizeof(float));
+    memcpy(other._history[0] + other._numHistory, other._inputs[0], nh * sizeof(float));
+
+    // process history buffers
+    outputFrames += multirateFilter2(_history[0], other._history[0], _outputs[0], other._outputs[0], nh);
+
+    // process remaining input
+    if (ni) {
+        outputFrames += multirateFilter2(_inputs[0], other._inputs[0],
+                                         _outputs[0] + outputFrames, other._outputs[0] + outputFrames, ni);
+    }
+
+    // shift history buffers
+    if (ni) {
+        memcpy(_history[0], _inputs[0] + ni, _numHistory * sizeof(float));
+        memcpy(other._history[0], other._inputs[0] + ni, other._numHistory * sizeof(float));
+    } else {
+        memmove(_history[0], _history[0] + nh, _numHistory * sizeof(float));
+        memmove(other._history[0], other._history[0] + nh, other._numHistory * sizeof(float));
+    }
+
+    // the kernel advanced only this converter's state; keep the pair in lockstep
+    other._phase = _phase;
+    other._offset = _offset;
+
+    return outputFrames;
+}
+
+//
+// Paired mono render, interleaved int16_t input/output
+//
+int AudioSRC::renderPair(AudioSRC& other, const int16_t* input0, const int16_t* input1,
+                         int16_t* output0, int16_t* output1, int inputFrames) {
+    int outputFrames = 0;
+
+    while (inputFrames) {
+        int ni = MIN(inputFrames, _inputBlock);
+
+        convertInput(input0, _inputs, ni);
+        other.convertInput(input1, other._inputs, ni);
+
+        int no = renderPairBlock(other, ni);
+        assert(no <= SRC_BLOCK);
+
+        convertOutput(_outputs, output0, no);
+        other.convertOutput(other._outputs, output1, no);
+
+        input0 += ni;
+        input1 += ni;
+        output0 += no;
+        output1 += no;
+        inputFrames -= ni;
+        outputFrames += no;
+    }
+
+    return outputFrames;
+}
+
+int AudioSRC::renderBatch(AudioSRC** srcs, const int16_t** inputs, int16_t** outputs, int numStreams, int inputFrames) {
+    int outputFrames = 0;
+
+    int i = 0;
+    while (i < numStreams) {
+
+        // pair adjacent mono streams in lockstep through the 2-channel kernel
+        if (i + 1 < numStreams &&
+            srcs[i]->_numChannels == 1 && srcs[i+1]->_numChannels == 1 &&
+            srcs[i]->inLockstepWith(*srcs[i+1])) {
+
+            outputFrames = srcs[i]->renderPair(*srcs[i+1], inputs[i], inputs[i+1], outputs[i], outputs[i+1], inputFrames);
+            i += 2;
+        } else {
+            outputFrames = srcs[i]->render(inputs[i], outputs[i], inputFrames);
+            i += 1;
+        }
+    }
+
+    return outputFrames;
+}
+
 // the min output frames that will be produced by inputFrames
 int AudioSRC::getMinOutput(int inputFrames) {
     if (_step == 0) {
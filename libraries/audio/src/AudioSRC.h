@@ -49,6 +49,18 @@ public:
     // interleaved float input/output
     int render(const float* input, float* output, int inputFrames);
 
+    //
+    // Batched render of multiple independent streams in one call.
+    //
+    // Adjacent mono streams whose converters are in lockstep (same rates and
+    // filter state, as when created together and always rendered the same frame
+    // counts) are paired through the 2-channel SIMD kernel, so each coefficient
+    // load serves two streams; the rest take the single-stream path.
+    //
+    // Returns the output frame count of the last stream rendered.
+    //
+    static int renderBatch(AudioSRC** srcs, const int16_t** inputs, int16_t** outputs, int numStreams, int inputFrames);
+
     int getMinOutput(int inputFrames);
     int getMaxOutput(int inputFrames);
     int getMinInput(int outputFrames);
@@ -94,6 +106,11 @@ private:
     int multirateFilter4_AVX2(const float* input0, const float* input1, const float* input2, const float* input3, 
                               float* output0, float* output1, float* output2, float* output3, int inputFrames);
 
+    bool inLockstepWith(const AudioSRC& other) const;
+    int renderPair(AudioSRC& other, const int16_t* input0, const int16_t* input1,
+                   int16_t* output0, int16_t* output1, int inputFrames);
+    int renderPairBlock(AudioSRC& other, int inputFrames);
+
     void convertInput(const int16_t* input, float** outputs, int numFrames);
     void convertOutput(float** inputs, int16_t* output, int numFrames);
 
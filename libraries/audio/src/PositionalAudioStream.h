@@ -66,6 +66,12 @@ public:
 
     const glm::vec3& getPosition() const { return _position; }
     const glm::quat& getOrientation() const { return _orientation; }
+
+    // Cached audio-zone membership bitmask (bit N set when the stream position is
+    // inside zone N). Refreshed by the mixer once per frame while processing the
+    // owning node's packets, then read by every listener mixing this stream.
+    void setZoneMask(uint32_t zoneMask) { _zoneMask = zoneMask; }
+    uint32_t getZoneMask() const { return _zoneMask; }
     const glm::vec3& getAvatarBoundingBoxCorner() const { return _avatarBoundingBoxCorner; }
     const glm::vec3& getAvatarBoundingBoxScale() const { return _avatarBoundingBoxScale; }
 
@@ -92,6 +98,7 @@ protected:
     Type _type;
     glm::vec3 _position;
     glm::quat _orientation;
+    uint32_t _zoneMask { 0 };
 
     glm::vec3 _avatarBoundingBoxCorner;
     glm::vec3 _avatarBoundingBoxScale;
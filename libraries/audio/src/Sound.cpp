@@ -16,6 +16,7 @@
 #include <glm/glm.hpp>
 
 #include <QRunnable>
+#include <QThread>
 #include <QThreadPool>
 #include <QDataStream>
 #include <QtCore/QDebug>
@@ -69,6 +70,24 @@ AudioData::AudioData(uint32_t numSamples, uint32_t numChannels, const AudioSampl
       _data(samples)
 {}
 
+//
+// Sounds are decoded on a dedicated pool, so decodes are neither queued behind
+// unrelated global-pool work nor able to starve it. Decodes start in
+// load-priority order, so a sound requested for immediate playback jumps ahead
+// of speculative cache prefetches.
+//
+static QThreadPool* soundProcessorPool() {
+    class Pool : public QThreadPool {
+    public:
+        Pool() {
+            static const int MAX_SOUND_DECODE_THREADS = 2;
+            setMaxThreadCount(std::max(1, std::min(MAX_SOUND_DECODE_THREADS, QThread::idealThreadCount())));
+        }
+    };
+    static Pool pool;
+    return &pool;
+}
+
 void Sound::downloadFinished(const QByteArray& data) {
     if (!_self) {
         soundProcessError(301, "Sound object has gone out of scope");
@@ -79,7 +98,7 @@ void Sound::downloadFinished(const QByteArray& data) {
     auto soundProcessor = new SoundProcessor(_self, data);
     connect(soundProcessor, &SoundProcessor::onSuccess, this, &Sound::soundProcessSuccess);
     connect(soundProcessor, &SoundProcessor::onError, this, &Sound::soundProcessError);
-    QThreadPool::globalInstance()->start(soundProcessor);
+    soundProcessorPool()->start(soundProcessor, (int)getLoadPriority());
 }
 
 void Sound::soundProcessSuccess(AudioDataPointer audioData) {
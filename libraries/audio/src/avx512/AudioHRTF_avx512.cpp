@@ -87,4 +87,80 @@ void FIR_1x4_AVX512(float* src, float* dst0, float* dst1, float* dst2, float* ds
     _mm256_zeroupper();
 }
 
+// 2 sources, each 1 channel input and 4 channel output
+// Interleaving two convolutions hides FMA latency and halves the loop overhead
+// per output sample, for the batched render path in AudioHRTF::renderBatch().
+void FIR_2x4_AVX512(float* src0, float* src1,
+                    float* dst0, float* dst1, float* dst2, float* dst3,
+                    float* dst4, float* dst5, float* dst6, float* dst7,
+                    float coef0[4][HRTF_TAPS], float coef1[4][HRTF_TAPS], int numFrames) {
+
+    float* coefA0 = coef0[0] + HRTF_TAPS - 1;   // process backwards
+    float* coefA1 = coef0[1] + HRTF_TAPS - 1;
+    float* coefA2 = coef0[2] + HRTF_TAPS - 1;
+    float* coefA3 = coef0[3] + HRTF_TAPS - 1;
+
+    float* coefB0 = coef1[0] + HRTF_TAPS - 1;
+    float* coefB1 = coef1[1] + HRTF_TAPS - 1;
+    float* coefB2 = coef1[2] + HRTF_TAPS - 1;
+    float* coefB3 = coef1[3] + HRTF_TAPS - 1;
+
+    assert(numFrames % 16 == 0);
+
+    for (int i = 0; i < numFrames; i += 16) {
+
+        __m512 acc0 = _mm512_setzero_ps();
+        __m512 acc1 = _mm512_setzero_ps();
+        __m512 acc2 = _mm512_setzero_ps();
+        __m512 acc3 = _mm512_setzero_ps();
+        __m512 acc4 = _mm512_setzero_ps();
+        __m512 acc5 = _mm512_setzero_ps();
+        __m512 acc6 = _mm512_setzero_ps();
+        __m512 acc7 = _mm512_setzero_ps();
+
+        float* psA = &src0[i - HRTF_TAPS + 1];  // process forwards
+        float* psB = &src1[i - HRTF_TAPS + 1];
+
+        static_assert(HRTF_TAPS % 2 == 0, "HRTF_TAPS must be a multiple of 2");
+
+        for (int k = 0; k < HRTF_TAPS; k += 2) {
+
+            __m512 x0 = _mm512_loadu_ps(&psA[k+0]);
+            acc0 = _mm512_fmadd_ps(_mm512_set1_ps(coefA0[-k-0]), x0, acc0);
+            acc1 = _mm512_fmadd_ps(_mm512_set1_ps(coefA1[-k-0]), x0, acc1);
+            acc2 = _mm512_fmadd_ps(_mm512_set1_ps(coefA2[-k-0]), x0, acc2);
+            acc3 = _mm512_fmadd_ps(_mm512_set1_ps(coefA3[-k-0]), x0, acc3);
+
+            __m512 y0 = _mm512_loadu_ps(&psB[k+0]);
+            acc4 = _mm512_fmadd_ps(_mm512_set1_ps(coefB0[-k-0]), y0, acc4);
+            acc5 = _mm512_fmadd_ps(_mm512_set1_ps(coefB1[-k-0]), y0, acc5);
+            acc6 = _mm512_fmadd_ps(_mm512_set1_ps(coefB2[-k-0]), y0, acc6);
+            acc7 = _mm512_fmadd_ps(_mm512_set1_ps(coefB3[-k-0]), y0, acc7);
+
+            __m512 x1 = _mm512_loadu_ps(&psA[k+1]);
+            acc0 = _mm512_fmadd_ps(_mm512_set1_ps(coefA0[-k-1]), x1, acc0);
+            acc1 = _mm512_fmadd_ps(_mm512_set1_ps(coefA1[-k-1]), x1, acc1);
+            acc2 = _mm512_fmadd_ps(_mm512_set1_ps(coefA2[-k-1]), x1, acc2);
+            acc3 = _mm512_fmadd_ps(_mm512_set1_ps(coefA3[-k-1]), x1, acc3);
+
+            __m512 y1 = _mm512_loadu_ps(&psB[k+1]);
+            acc4 = _mm512_fmadd_ps(_mm512_set1_ps(coefB0[-k-1]), y1, acc4);
+            acc5 = _mm512_fmadd_ps(_mm512_set1_ps(coefB1[-k-1]), y1, acc5);
+            acc6 = _mm512_fmadd_ps(_mm512_set1_ps(coefB2[-k-1]), y1, acc6);
+            acc7 = _mm512_fmadd_ps(_mm512_set1_ps(coefB3[-k-1]), y1, acc7);
+        }
+
+        _mm512_storeu_ps(&dst0[i], acc0);
+        _mm512_storeu_ps(&dst1[i], acc1);
+        _mm512_storeu_ps(&dst2[i], acc2);
+        _mm512_storeu_ps(&dst3[i], acc3);
+        _mm512_storeu_ps(&dst4[i], acc4);
+        _mm512_storeu_ps(&dst5[i], acc5);
+        _mm512_storeu_ps(&dst6[i], acc6);
+        _mm512_storeu_ps(&dst7[i], acc7);
+    }
+
+    _mm256_zeroupper();
+}
+
 #endif
@@ -282,11 +282,42 @@ QByteArray AvatarData::toByteArrayStateful(AvatarDataDetail dataDetail, bool dro
     return avatarByteArray;
 }
 
+int AvatarData::maxAvatarDataSize() const {
+    lazyInitHeadData();
+
+    return (int)(AvatarDataPacket::MAX_CONSTANT_HEADER_SIZE + NUM_BYTES_RFC4122_UUID +
+        AvatarDataPacket::maxFaceTrackerInfoSize(_headData->getBlendshapeCoefficients().size()) +
+        AvatarDataPacket::maxJointDataSize(_jointData.size()) +
+        AvatarDataPacket::maxJointDefaultPoseFlagsSize(_jointData.size()) +
+        AvatarDataPacket::FAR_GRAB_JOINTS_SIZE);
+}
+
 QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime,
                                    const QVector<JointData>& lastSentJointData, AvatarDataPacket::SendStatus& sendStatus,
                                    bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
                                    QVector<JointData>* sentJointDataOut,
                                    int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
+    // serialize into a reusable scratch buffer, so each call costs one exact-size
+    // copy instead of a zero-filled worst-case allocation plus a trailing copy
+    static thread_local QByteArray avatarDataBuffer;
+    int bufferSize = maxAvatarDataSize();
+    if (avatarDataBuffer.size() < bufferSize) {
+        avatarDataBuffer.resize(bufferSize);
+    }
+
+    int avatarDataSize = toByteArray(dataDetail, lastSentTime, lastSentJointData, sendStatus, dropFaceTracking,
+                                     distanceAdjust, viewerPosition, sentJointDataOut,
+                                     reinterpret_cast<unsigned char*>(avatarDataBuffer.data()), maxDataSize,
+                                     outboundDataRateOut);
+
+    return QByteArray(avatarDataBuffer.constData(), avatarDataSize);
+}
+
+int AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime,
+                            const QVector<JointData>& lastSentJointData, AvatarDataPacket::SendStatus& sendStatus,
+                            bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
+                            QVector<JointData>* sentJointDataOut, unsigned char* destinationBuffer,
+                            int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
 
     bool cullSmallChanges = (dataDetail == CullSmallData);
     bool sendAll = (dataDetail == SendAllData);
@@ -305,13 +336,15 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
     if (dataDetail == NoData) {
         sendStatus.itemFlags = wantedFlags;
 
-        QByteArray avatarDataByteArray;
+        const unsigned char* const noDataStart = destinationBuffer;
         if (sendStatus.sendUUID) {
-            avatarDataByteArray.append(getSessionUUID().toRfc4122().data(), NUM_BYTES_RFC4122_UUID);
+            memcpy(destinationBuffer, getSessionUUID().toRfc4122().data(), NUM_BYTES_RFC4122_UUID);
+            destinationBuffer += NUM_BYTES_RFC4122_UUID;
         }
 
-        avatarDataByteArray.append((char*) &wantedFlags, sizeof wantedFlags);
-        return avatarDataByteArray;
+        memcpy(destinationBuffer, &wantedFlags, sizeof wantedFlags);
+        destinationBuffer += sizeof wantedFlags;
+        return (int)(destinationBuffer - noDataStart);
     }
 
     // FIXME -
@@ -434,18 +467,12 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         parentID = getParentID();
     }
 
-    const size_t byteArraySize = AvatarDataPacket::MAX_CONSTANT_HEADER_SIZE + NUM_BYTES_RFC4122_UUID +
-        AvatarDataPacket::maxFaceTrackerInfoSize(_headData->getBlendshapeCoefficients().size()) +
-        AvatarDataPacket::maxJointDataSize(_jointData.size()) +
-        AvatarDataPacket::maxJointDefaultPoseFlagsSize(_jointData.size()) +
-        AvatarDataPacket::FAR_GRAB_JOINTS_SIZE;
+    const size_t byteArraySize = (size_t)maxAvatarDataSize();
 
     if (maxDataSize == 0) {
         maxDataSize = (int)byteArraySize;
     }
 
-    QByteArray avatarDataByteArray((int)byteArraySize, 0);
-    unsigned char* destinationBuffer = reinterpret_cast<unsigned char*>(avatarDataByteArray.data());
     const unsigned char* const startPosition = destinationBuffer;
     const unsigned char* const packetEnd = destinationBuffer + maxDataSize;
 
@@ -728,12 +755,17 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         float minRotationDOT = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinRotationDOT(viewerPosition) : AVATAR_MIN_ROTATION_DOT;
 
+        // gather the rotations to send, then compress them in one SIMD batch
+        static thread_local std::vector<glm::quat> rotationsToSend;
+        rotationsToSend.clear();
+
         int i = sendStatus.rotationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
             const JointData& last = lastSentJointData[i];
 
-            if (packetEnd - destinationBuffer >= minSizeForJoint) {
+            if (packetEnd - (destinationBuffer + sizeof(AvatarDataPacket::SixByteQuat) * rotationsToSend.size())
+                    >= (ptrdiff_t)minSizeForJoint) {
                 if (!data.rotationIsDefaultPose) {
                     // The dot product for larger rotations is a lower number,
                     // so if the dot() is less than the value, then the rotation is a larger angle of rotation
@@ -743,7 +775,7 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #ifdef WANT_DEBUG
                         rotationSentCount++;
 #endif
-                        destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
+                        rotationsToSend.push_back(data.rotation);
 
                         if (sentJoints) {
                             sentJoints[i].rotation = data.rotation;
@@ -761,6 +793,9 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         }
         sendStatus.rotationsSent = i;
 
+        destinationBuffer += packOrientationQuatsToSixBytes(destinationBuffer, rotationsToSend.data(),
+                                                            (int)rotationsToSend.size());
+
         // joint translation data
         validityPosition = destinationBuffer;
 
@@ -895,7 +930,7 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         ASSERT(false);
     }
 
-    return avatarDataByteArray.left(avatarDataSize);
+    return avatarDataSize;
 
 #undef AVATAR_MEMCPY
 #undef IF_AVATAR_SPACE
@@ -1329,8 +1364,10 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
         PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
 
         int numValidJointRotations = 0;
-        QVector<bool> validRotations;
-        validRotations.resize(numJoints);
+        // reused scratch: this parse runs per packet per avatar, so the validity
+        // arrays must not allocate each time
+        static thread_local std::vector<uint8_t> validRotations;
+        validRotations.assign(numJoints, 0);
         { // rotation validity bits
             unsigned char validity = 0;
             int validityBit = 0;
@@ -1366,8 +1403,8 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
 
         // get translation validity bits -- these indicate which translations were packed
         int numValidJointTranslations = 0;
-        QVector<bool> validTranslations;
-        validTranslations.resize(numJoints);
+        static thread_local std::vector<uint8_t> validTranslations;
+        validTranslations.assign(numJoints, 0);
         { // translation validity bits
             unsigned char validity = 0;
             int validityBit = 0;
@@ -1488,6 +1525,10 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     _parseBufferRate.increment(numBytesRead);
     _parseBufferUpdateRate.increment();
 
+    // joint poses may have moved without any transform setter running; objects parented to
+    // joints depend on the world-transform epoch noticing
+    bumpWorldTransformEpoch();
+
     return numBytesRead;
 }
 
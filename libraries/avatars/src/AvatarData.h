@@ -627,6 +627,16 @@ public:
         AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
         QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr) const;
 
+    // Zero-copy core of toByteArray: serializes directly into destinationBuffer,
+    // which must hold at least maxAvatarDataSize() bytes. Returns bytes written.
+    virtual int toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime, const QVector<JointData>& lastSentJointData,
+        AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
+        QVector<JointData>* sentJointDataOut, unsigned char* destinationBuffer, int maxDataSize = 0,
+        AvatarDataRate* outboundDataRateOut = nullptr) const;
+
+    // worst-case serialized size of this avatar, for sizing destination buffers
+    int maxAvatarDataSize() const;
+
     virtual void doneEncoding(bool cullSmallChanges);
 
     /// \return true if an error should be logged
@@ -213,6 +213,7 @@ AvatarSharedPointer AvatarHashMap::addAvatar(const QUuid& sessionUUID, const QWe
     {
         QWriteLocker locker(&_hashLock);
         _avatarHash.insert(sessionUUID, avatar);
+        shardInsert(sessionUUID, avatar);
     }
     emit avatarAddedEvent(sessionUUID);
     return avatar;
@@ -229,10 +230,30 @@ AvatarSharedPointer AvatarHashMap::newOrExistingAvatar(const QUuid& sessionUUID,
     return avatar;
 }
 
+void AvatarHashMap::shardInsert(const QUuid& sessionUUID, const AvatarSharedPointer& avatar) {
+    auto& shard = shardFor(sessionUUID);
+    QWriteLocker locker(&shard.lock);
+    shard.hash.insert(sessionUUID, avatar);
+}
+
+void AvatarHashMap::shardRemove(const QUuid& sessionUUID) {
+    auto& shard = shardFor(sessionUUID);
+    QWriteLocker locker(&shard.lock);
+    shard.hash.remove(sessionUUID);
+}
+
+void AvatarHashMap::shardClear() {
+    for (auto& shard : _shards) {
+        QWriteLocker locker(&shard.lock);
+        shard.hash.clear();
+    }
+}
+
 AvatarSharedPointer AvatarHashMap::findAvatar(const QUuid& sessionUUID) const {
-    QReadLocker locker(&_hashLock);
-    auto avatarIter = _avatarHash.find(sessionUUID);
-    if (avatarIter != _avatarHash.end()) {
+    auto& shard = shardFor(sessionUUID);
+    QReadLocker locker(&shard.lock);
+    auto avatarIter = shard.hash.find(sessionUUID);
+    if (avatarIter != shard.hash.end()) {
         return avatarIter.value();
     }
     return nullptr;
@@ -484,12 +505,14 @@ void AvatarHashMap::removeAvatar(const QUuid& sessionUUID, KillAvatarReason remo
 
         for (auto& replica : replicas) {
             auto removedReplica = _avatarHash.take(replica->getID());
+            shardRemove(replica->getID());
             if (removedReplica) {
                 removedAvatars.push_back(removedReplica);
             }
         }
 
         auto removedAvatar = _avatarHash.take(sessionUUID);
+        shardRemove(sessionUUID);
         if (removedAvatar) {
             removedAvatars.push_back(removedAvatar);
         }
@@ -524,6 +547,7 @@ void AvatarHashMap::clearOtherAvatars() {
         removedAvatars = _avatarHash.values();
 
         _avatarHash.clear();
+        shardClear();
     }
 
     for (auto& av : removedAvatars) {
@@ -239,6 +239,22 @@ protected:
     mutable QReadWriteLock _hashLock;
     AvatarHash _avatarHash;
 
+    // Sharded lookup index over _avatarHash. findAvatar() runs hot (scripts,
+    // per-frame packet processing) and contended lookups on the single
+    // _hashLock stalled against writers; spreading entries across shards with
+    // their own locks lets concurrent lookups and updates proceed. Any direct
+    // mutation of _avatarHash must be mirrored through the shard helpers below.
+    static const int NUM_AVATAR_SHARDS = 16;
+    struct AvatarShard {
+        mutable QReadWriteLock lock;
+        AvatarHash hash;
+    };
+    AvatarShard& shardFor(const QUuid& sessionUUID) const { return _shards[qHash(sessionUUID) & (NUM_AVATAR_SHARDS - 1)]; }
+    void shardInsert(const QUuid& sessionUUID, const AvatarSharedPointer& avatar);
+    void shardRemove(const QUuid& sessionUUID);
+    void shardClear();
+    mutable AvatarShard _shards[NUM_AVATAR_SHARDS];
+
     std::unordered_map<QUuid, AvatarTraits::TraitVersions> _processedTraitVersions;
     AvatarReplicas _replicas;
 
@@ -40,7 +40,11 @@ namespace AvatarTraits {
     qint64 packVersionedTrait(TraitType traitType, ExtendedIODevice& destination,
                               TraitVersion traitVersion, const AvatarData& avatar) {
         // Call packer function
-        auto traitBinaryData = avatar.packTrait(traitType);
+        return packVersionedTrait(traitType, destination, traitVersion, avatar.packTrait(traitType));
+    }
+
+    qint64 packVersionedTrait(TraitType traitType, ExtendedIODevice& destination,
+                              TraitVersion traitVersion, const QByteArray& traitBinaryData) {
         auto traitBinaryDataSize = traitBinaryData.size();
 
         // Verify packed data
@@ -93,9 +97,14 @@ namespace AvatarTraits {
                                       ExtendedIODevice& destination, TraitVersion traitVersion,
                                       AvatarData& avatar) {
         // Call packer function
-        auto traitBinaryData = avatar.packTraitInstance(traitType, traitInstanceID);
-        auto traitBinaryDataSize = traitBinaryData.size();
+        return packVersionedTraitInstance(traitType, traitInstanceID, destination, traitVersion,
+                                          avatar.packTraitInstance(traitType, traitInstanceID));
+    }
 
+    qint64 packVersionedTraitInstance(TraitType traitType, TraitInstanceID traitInstanceID,
+                                      ExtendedIODevice& destination, TraitVersion traitVersion,
+                                      const QByteArray& traitBinaryData) {
+        auto traitBinaryDataSize = traitBinaryData.size();
 
         // Verify packed data
         if (traitBinaryDataSize > AvatarTraits::MAXIMUM_TRAIT_SIZE) {
@@ -64,12 +64,19 @@ namespace AvatarTraits {
     qint64 packTrait(TraitType traitType, ExtendedIODevice& destination, const AvatarData& avatar);
     qint64 packVersionedTrait(TraitType traitType, ExtendedIODevice& destination,
                               TraitVersion traitVersion, const AvatarData& avatar);
+    // variant taking already-packed trait bytes, for callers that cache them
+    qint64 packVersionedTrait(TraitType traitType, ExtendedIODevice& destination,
+                              TraitVersion traitVersion, const QByteArray& traitBinaryData);
 
     qint64 packTraitInstance(TraitType traitType, TraitInstanceID traitInstanceID,
                              ExtendedIODevice& destination, AvatarData& avatar);
     qint64 packVersionedTraitInstance(TraitType traitType, TraitInstanceID traitInstanceID,
                                       ExtendedIODevice& destination, TraitVersion traitVersion,
                                       AvatarData& avatar);
+    // variant taking already-packed trait bytes, for callers that cache them
+    qint64 packVersionedTraitInstance(TraitType traitType, TraitInstanceID traitInstanceID,
+                                      ExtendedIODevice& destination, TraitVersion traitVersion,
+                                      const QByteArray& traitBinaryData);
 
     qint64 packInstancedTraitDelete(TraitType traitType, TraitInstanceID instanceID, ExtendedIODevice& destination,
                                            TraitVersion traitVersion = NULL_TRAIT_VERSION);
@@ -0,0 +1,136 @@
+//
+//  BakeCache.cpp
+//  libraries/baking/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakeCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "ModelBakingLoggingCategory.h"
+
+static const QString MANIFEST_FILENAME = "manifest.json";
+static const QString MANIFEST_FILES_KEY = "files";
+
+BakeCache& BakeCache::instance() {
+    static BakeCache cache;
+    return cache;
+}
+
+void BakeCache::setCacheDirectory(const QString& path) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cacheDirectory = path;
+    if (!_cacheDirectory.isEmpty()) {
+        QDir().mkpath(_cacheDirectory);
+    }
+}
+
+bool BakeCache::isEnabled() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return !_cacheDirectory.isEmpty();
+}
+
+QString BakeCache::cacheKey(const QByteArray& sourceHash, int bakerVersion, const QByteArray& settings) {
+    QCryptographicHash hasher(QCryptographicHash::Sha256);
+    hasher.addData(sourceHash);
+    hasher.addData(reinterpret_cast<const char*>(&bakerVersion), sizeof(bakerVersion));
+    hasher.addData(settings);
+    return hasher.result().toHex();
+}
+
+QString BakeCache::entryPath(const QString& cacheKey) const {
+    // fan entries out over two-character prefix directories to keep listings manageable
+    return _cacheDirectory + "/" + cacheKey.left(2) + "/" + cacheKey;
+}
+
+bool BakeCache::fetch(const QString& cacheKey, const QDir& outputDirectory, std::vector<QString>& outputFiles) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_cacheDirectory.isEmpty()) {
+        return false;
+    }
+
+    QDir entryDir { entryPath(cacheKey) };
+    QFile manifestFile { entryDir.absoluteFilePath(MANIFEST_FILENAME) };
+    if (!manifestFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    auto manifest = QJsonDocument::fromJson(manifestFile.readAll()).object();
+    auto fileNames = manifest[MANIFEST_FILES_KEY].toArray();
+
+    // verify every product is present before touching the output directory
+    for (const auto& fileName : fileNames) {
+        if (!entryDir.exists(fileName.toString())) {
+            qCWarning(model_baking) << "Bake cache entry" << cacheKey << "is missing" << fileName.toString() << "- ignoring it";
+            return false;
+        }
+    }
+
+    std::vector<QString> restoredFiles;
+    for (const auto& fileName : fileNames) {
+        auto destinationPath = outputDirectory.absoluteFilePath(fileName.toString());
+        QFile::remove(destinationPath);
+        if (!QFile::copy(entryDir.absoluteFilePath(fileName.toString()), destinationPath)) {
+            qCWarning(model_baking) << "Could not restore" << fileName.toString() << "from bake cache entry" << cacheKey;
+            return false;
+        }
+        restoredFiles.push_back(destinationPath);
+    }
+
+    outputFiles.insert(outputFiles.end(), restoredFiles.begin(), restoredFiles.end());
+    return true;
+}
+
+void BakeCache::store(const QString& cacheKey, const std::vector<QString>& outputFiles) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_cacheDirectory.isEmpty() || outputFiles.empty()) {
+        return;
+    }
+
+    auto finalPath = entryPath(cacheKey);
+    if (QDir(finalPath).exists()) {
+        return;
+    }
+
+    // stage into a partial directory and rename so a crashed bake never leaves a half entry
+    auto partialPath = finalPath + ".partial";
+    QDir partialDir { partialPath };
+    partialDir.removeRecursively();
+    if (!QDir().mkpath(partialPath)) {
+        return;
+    }
+
+    QJsonArray fileNames;
+    for (const auto& outputFile : outputFiles) {
+        QFileInfo fileInfo { outputFile };
+        if (!QFile::copy(outputFile, partialDir.absoluteFilePath(fileInfo.fileName()))) {
+            qCWarning(model_baking) << "Could not store" << outputFile << "in bake cache entry" << cacheKey;
+            partialDir.removeRecursively();
+            return;
+        }
+        fileNames.append(fileInfo.fileName());
+    }
+
+    QFile manifestFile { partialDir.absoluteFilePath(MANIFEST_FILENAME) };
+    if (!manifestFile.open(QIODevice::WriteOnly)
+            || manifestFile.write(QJsonDocument(QJsonObject { { MANIFEST_FILES_KEY, fileNames } }).toJson()) == -1) {
+        partialDir.removeRecursively();
+        return;
+    }
+    manifestFile.close();
+
+    if (!QDir().rename(partialPath, finalPath)) {
+        partialDir.removeRecursively();
+    }
+}
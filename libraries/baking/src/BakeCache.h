@@ -0,0 +1,49 @@
+//
+//  BakeCache.h
+//  libraries/baking/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakeCache_h
+#define hifi_BakeCache_h
+
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDir>
+#include <QtCore/QString>
+
+// A persistent cache of bake products keyed on (source content hash, baker version, settings
+// hash). Bakers consult it before doing any processing and record their output files after a
+// successful bake, so re-baking a domain only re-does work for assets that actually changed.
+class BakeCache {
+public:
+    static BakeCache& instance();
+
+    // An empty path disables the cache
+    void setCacheDirectory(const QString& path);
+    bool isEnabled() const;
+
+    static QString cacheKey(const QByteArray& sourceHash, int bakerVersion, const QByteArray& settings);
+
+    // When the key is present and every cached product is intact, copies the products into
+    // outputDirectory, fills outputFiles with their new absolute paths and returns true
+    bool fetch(const QString& cacheKey, const QDir& outputDirectory, std::vector<QString>& outputFiles);
+
+    // Records the given product files (already written by a completed bake) under the key
+    void store(const QString& cacheKey, const std::vector<QString>& outputFiles);
+
+private:
+    QString entryPath(const QString& cacheKey) const;
+
+    mutable std::mutex _mutex;
+    QString _cacheDirectory;
+};
+
+#endif // hifi_BakeCache_h
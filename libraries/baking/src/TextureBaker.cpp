@@ -24,12 +24,16 @@
 
 #include <OwningBuffer.h>
 
+#include "BakeCache.h"
 #include "ModelBakingLoggingCategory.h"
 
 const QString BAKED_TEXTURE_KTX_EXT = ".ktx";
 const QString BAKED_TEXTURE_BCN_SUFFIX = "_bcn.ktx";
 const QString BAKED_META_TEXTURE_SUFFIX = ".texmeta.json";
 
+// Bump whenever the produced KTX/meta layout changes so stale bake-cache entries are ignored
+const int TEXTURE_BAKE_CACHE_VERSION = 1;
+
 bool TextureBaker::_compressionEnabled = true;
 
 TextureBaker::TextureBaker(const QUrl& textureURL, image::TextureUsage::Type textureType,
@@ -136,6 +140,20 @@ void TextureBaker::processTexture() {
     auto hashData = hasher.result();
     std::string hash = hashData.toHex().toStdString();
 
+    // consult the persistent bake cache before doing any work; the output file names depend on
+    // the base filename, so it participates in the settings hash
+    QByteArray cacheSettings;
+    cacheSettings.append(reinterpret_cast<const char*>(&_compressionEnabled), sizeof(_compressionEnabled));
+    cacheSettings.append(_baseFilename.toUtf8());
+    auto cacheKey = BakeCache::cacheKey(hashData, TEXTURE_BAKE_CACHE_VERSION, cacheSettings);
+    if (BakeCache::instance().fetch(cacheKey, _outputDirectory, _outputFiles)) {
+        qCDebug(model_baking) << "Bake cache hit for texture" << _textureURL;
+        _originalTexture.clear();
+        _metaTextureFileName = _outputDirectory.absoluteFilePath(_baseFilename + BAKED_META_TEXTURE_SUFFIX);
+        setIsFinished(true);
+        return;
+    }
+
     TextureMeta meta;
 
     QString originalCopyFilePath = _originalCopyFilePath.toString();
@@ -180,30 +198,44 @@ void TextureBaker::processTexture() {
                 return;
             }
 
-            auto memKTX = gpu::Texture::serialize(*processedTexture);
-            if (!memKTX) {
+            // stream the KTX to disk one mip at a time instead of staging the whole
+            // serialized blob in memory alongside the texture's stored mips
+            auto tempFilePath = _outputDirectory.absoluteFilePath(_baseFilename + ".ktx.partial");
+            QFile bakedTextureFile { tempFilePath };
+            if (!bakedTextureFile.open(QIODevice::WriteOnly)) {
+                handleError("Could not write baked texture for " + _textureURL.toString());
+                return;
+            }
+
+            ktx::Header ktxHeader;
+            bool serialized = gpu::Texture::serializeToWriter(*processedTexture,
+                [&bakedTextureFile](const ktx::Byte* data, size_t byteSize) {
+                    return bakedTextureFile.write(reinterpret_cast<const char*>(data), byteSize) == (qint64)byteSize;
+                }, &ktxHeader);
+            bakedTextureFile.close();
+            if (!serialized) {
+                bakedTextureFile.remove();
                 handleError("Could not serialize " + _textureURL.toString() + " to KTX");
                 return;
             }
 
-            const char* name = khronos::gl::texture::toString(memKTX->_header.getGLInternaFormat());
+            const char* name = khronos::gl::texture::toString(ktxHeader.getGLInternaFormat());
             if (name == nullptr) {
+                bakedTextureFile.remove();
                 handleError("Could not determine internal format for compressed KTX: " + _textureURL.toString());
                 return;
             }
 
-            const char* data = reinterpret_cast<const char*>(memKTX->_storage->data());
-            const size_t length = memKTX->_storage->size();
-
             auto fileName = _baseFilename + "_" + name + ".ktx";
             auto filePath = _outputDirectory.absoluteFilePath(fileName);
-            QFile bakedTextureFile { filePath };
-            if (!bakedTextureFile.open(QIODevice::WriteOnly) || bakedTextureFile.write(data, length) == -1) {
+            QFile::remove(filePath);
+            if (!bakedTextureFile.rename(filePath)) {
+                bakedTextureFile.remove();
                 handleError("Could not write baked texture for " + _textureURL.toString());
                 return;
             }
             _outputFiles.push_back(filePath);
-            meta.availableTextureTypes[memKTX->_header.getGLInternaFormat()] = fileName;
+            meta.availableTextureTypes[ktxHeader.getGLInternaFormat()] = fileName;
         }
     }
 
@@ -222,19 +254,16 @@ void TextureBaker::processTexture() {
             return;
         }
 
-        auto memKTX = gpu::Texture::serialize(*processedTexture);
-        if (!memKTX) {
-            handleError("Could not serialize " + _textureURL.toString() + " to KTX");
-            return;
-        }
-
-        const char* data = reinterpret_cast<const char*>(memKTX->_storage->data());
-        const size_t length = memKTX->_storage->size();
-
         auto fileName = _baseFilename + ".ktx";
         auto filePath = _outputDirectory.absoluteFilePath(fileName);
         QFile bakedTextureFile { filePath };
-        if (!bakedTextureFile.open(QIODevice::WriteOnly) || bakedTextureFile.write(data, length) == -1) {
+        bool serialized = bakedTextureFile.open(QIODevice::WriteOnly)
+            && gpu::Texture::serializeToWriter(*processedTexture,
+                [&bakedTextureFile](const ktx::Byte* data, size_t byteSize) {
+                    return bakedTextureFile.write(reinterpret_cast<const char*>(data), byteSize) == (qint64)byteSize;
+                });
+        bakedTextureFile.close();
+        if (!serialized) {
             handleError("Could not write baked texture for " + _textureURL.toString());
             return;
         }
@@ -256,6 +285,8 @@ void TextureBaker::processTexture() {
         }
     }
 
+    BakeCache::instance().store(cacheKey, _outputFiles);
+
     qCDebug(model_baking) << "Baked texture" << _textureURL;
     setIsFinished(true);
 }
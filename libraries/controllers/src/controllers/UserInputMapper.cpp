@@ -8,6 +8,7 @@
 
 #include "UserInputMapper.h"
 
+#include <algorithm>
 #include <set>
 
 #include <QtCore/QThread>
@@ -96,6 +97,7 @@ void UserInputMapper::registerDevice(InputDevice::Pointer device) {
     }
 
     _registeredDevices[deviceID] = device;
+    _routeTablesDirty = true;
 
     auto mapping = loadMappings(device->getDefaultMappingConfigs());
     if (mapping) {
@@ -138,6 +140,7 @@ void UserInputMapper::removeDevice(int deviceID) {
     }
 
     _registeredDevices.erase(proxyEntry);
+    _routeTablesDirty = true;
 
     emit hardwareChanged();
 }
@@ -477,20 +480,25 @@ void UserInputMapper::runMappings() {
     if (debugRoutes) {
         qCDebug(controllers) << "Beginning mapping frame";
     }
-    for (const auto& endpointEntry : _endpointsByInput) {
-        endpointEntry.second->reset();
+
+    if (_routeTablesDirty) {
+        rebuildRouteTables();
+    }
+
+    for (auto endpoint : _resetEndpoints) {
+        endpoint->reset();
     }
 
     if (debugRoutes) {
         qCDebug(controllers) << "Processing device routes";
     }
     // Now process the current values for each level of the stack
-    applyRoutes(_deviceRoutes);
+    applyCompiledRoutes(_compiledDeviceRoutes);
 
     if (debugRoutes) {
         qCDebug(controllers) << "Processing standard routes";
     }
-    applyRoutes(_standardRoutes);
+    applyCompiledRoutes(_compiledStandardRoutes);
 
     InputRecorder* inputRecorder = InputRecorder::getInstance();
     if (inputRecorder->isPlayingback()) {
@@ -513,41 +521,59 @@ void UserInputMapper::runMappings() {
     debugRoutes = false;
 }
 
-// Encapsulate the logic that routes should not be read before they are written
-void UserInputMapper::applyRoutes(const Route::List& routes) {
-    Route::List deferredRoutes;
-
-    for (const auto& route : routes) {
-        if (!route) {
-            continue;
+void UserInputMapper::rebuildRouteTables() {
+    auto compile = [](const Route::List& routes, std::vector<CompiledRoute>& compiled) {
+        compiled.clear();
+        compiled.reserve(routes.size());
+        for (const auto& route : routes) {
+            if (route) {
+                compiled.push_back({ route.get(), route->source->getInput().device == STANDARD_DEVICE });
+            }
         }
+    };
+    compile(_deviceRoutes, _compiledDeviceRoutes);
+    compile(_standardRoutes, _compiledStandardRoutes);
 
+    _resetEndpoints.clear();
+    _resetEndpoints.reserve(_endpointsByInput.size());
+    for (const auto& endpointEntry : _endpointsByInput) {
+        _resetEndpoints.push_back(endpointEntry.second.get());
+    }
+
+    _routeTablesDirty = false;
+}
+
+// Encapsulate the logic that routes should not be read before they are written
+void UserInputMapper::applyCompiledRoutes(const std::vector<CompiledRoute>& routes) {
+    std::vector<CompiledRoute> deferredRoutes;
+    deferredRoutes.reserve(8);
+
+    for (const auto& compiledRoute : routes) {
         // Try all the deferred routes
-        deferredRoutes.remove_if([](Route::Pointer route) {
-            return UserInputMapper::applyRoute(route);
-        });
+        deferredRoutes.erase(std::remove_if(deferredRoutes.begin(), deferredRoutes.end(),
+            [](const CompiledRoute& deferred) {
+                return applyCompiledRoute(deferred.route, deferred.sourceIsStandard);
+            }), deferredRoutes.end());
 
-        if (!applyRoute(route)) {
-            deferredRoutes.push_back(route);
+        if (!applyCompiledRoute(compiledRoute.route, compiledRoute.sourceIsStandard)) {
+            deferredRoutes.push_back(compiledRoute);
         }
     }
 
     bool force = true;
-    for (const auto& route : deferredRoutes) {
-        UserInputMapper::applyRoute(route, force);
+    for (const auto& deferred : deferredRoutes) {
+        applyCompiledRoute(deferred.route, deferred.sourceIsStandard, force);
     }
 }
 
-
-bool UserInputMapper::applyRoute(const Route::Pointer& route, bool force) {
+bool UserInputMapper::applyCompiledRoute(Route* route, bool sourceIsStandard, bool force) {
     if (debugRoutes && route->debug) {
         qCDebug(controllers) << "Applying route " << route->json;
     }
 
     // If the source hasn't been written yet, defer processing of this route
     auto& source = route->source;
-    auto& sourceInput = source->getInput();
-    if (sourceInput.device == STANDARD_DEVICE && !force && source->writeable()) {
+    if (sourceIsStandard && !force && source->writeable()) {
         if (debugRoutes && route->debug) {
             qCDebug(controllers) << "Source not yet written, deferring";
         }
@@ -1218,6 +1244,8 @@ void UserInputMapper::enableMapping(const Mapping::Pointer& mapping) {
     if (!debuggableRoutes) {
         debuggableRoutes = hasDebuggableRoute(_deviceRoutes) || hasDebuggableRoute(_standardRoutes);
     }
+
+    _routeTablesDirty = true;
 }
 
 void UserInputMapper::disableMapping(const Mapping::Pointer& mapping) {
@@ -1234,6 +1262,8 @@ void UserInputMapper::disableMapping(const Mapping::Pointer& mapping) {
     if (debuggableRoutes) {
         debuggableRoutes = hasDebuggableRoute(_deviceRoutes) || hasDebuggableRoute(_standardRoutes);
     }
+
+    _routeTablesDirty = true;
 }
 
 void UserInputMapper::setActionState(Action action, float value, bool valid) {
@@ -13,6 +13,7 @@
 #include <glm/glm.hpp>
 
 #include <unordered_set>
+#include <vector>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -159,8 +160,6 @@ namespace controller {
 
         void runMappings();
 
-        static void applyRoutes(const RouteList& route);
-        static bool applyRoute(const RoutePointer& route, bool force = false);
         void enableMapping(const MappingPointer& mapping);
         void disableMapping(const MappingPointer& mapping);
         EndpointPointer endpointFor(const QJSValue& endpoint);
@@ -192,6 +191,22 @@ namespace controller {
         RouteList _deviceRoutes;
         RouteList _standardRoutes;
 
+        // Flat evaluation tables compiled from the route lists whenever mappings or devices
+        // change: raw pointers (owned by the lists above) with the per-route source-device test
+        // resolved up front, plus a flat endpoint array for the per-frame reset. runMappings
+        // walks these instead of chasing shared_ptr lists at 90Hz.
+        struct CompiledRoute {
+            Route* route;
+            bool sourceIsStandard;
+        };
+        std::vector<CompiledRoute> _compiledDeviceRoutes;
+        std::vector<CompiledRoute> _compiledStandardRoutes;
+        std::vector<Endpoint*> _resetEndpoints;
+        bool _routeTablesDirty { true };
+        void rebuildRouteTables();
+        void applyCompiledRoutes(const std::vector<CompiledRoute>& routes);
+        static bool applyCompiledRoute(Route* route, bool sourceIsStandard, bool force = false);
+
         QSet<QString> _loadedRouteJsonFiles;
 
         InputCalibrationData inputCalibrationData;
@@ -719,19 +719,19 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
             compositeLayers();
         }
 
-        { // If we have any snapshots this frame, handle them
+        { // If we have any snapshots this frame, kick their readbacks off asynchronously
             PROFILE_RANGE_EX(render, "snapshotOperators", 0xffff00ff, frameId)
             while (!_currentFrame->snapshotOperators.empty()) {
                 auto& snapshotOperator = _currentFrame->snapshotOperators.front();
-                if (std::get<2>(snapshotOperator)) {
-                    std::get<0>(snapshotOperator)(getScreenshot(std::get<1>(snapshotOperator)));
-                } else {
-                    std::get<0>(snapshotOperator)(getSecondaryCameraScreenshot());
-                }
+                startAsyncScreenshot(std::get<1>(snapshotOperator), std::get<2>(snapshotOperator),
+                                     std::get<0>(snapshotOperator));
                 _currentFrame->snapshotOperators.pop();
             }
         }
 
+        // resolve any earlier snapshot readbacks whose fences have signaled
+        pollAsyncScreenshots();
+
         // Take the composite framebuffer and send it to the output device
         refreshRateController->clockEndTime();
         {
@@ -827,6 +827,58 @@ QImage OpenGLDisplayPlugin::getScreenshot(float aspectRatio) {
     return screenshot.mirrored(false, true);
 }
 
+void OpenGLDisplayPlugin::startAsyncScreenshot(float aspectRatio, bool isPrimary,
+                                               std::function<void(const QImage&)> callback) {
+    gpu::FramebufferPointer framebuffer;
+    ivec4 region;
+    if (isPrimary) {
+        auto size = _compositeFramebuffer->getSize();
+        if (isHmd()) {
+            size.x /= 2;
+        }
+        auto bestSize = size;
+        uvec2 corner(0);
+        if (aspectRatio != 0.0f) { // Pick out the largest piece of the center that produces the requested width/height aspectRatio
+            if (ceil(size.y * aspectRatio) < size.x) {
+                bestSize.x = round(size.y * aspectRatio);
+            } else {
+                bestSize.y = round(size.x / aspectRatio);
+            }
+            corner.x = round((size.x - bestSize.x) / 2.0f);
+            corner.y = round((size.y - bestSize.y) / 2.0f);
+        }
+        framebuffer = _compositeFramebuffer;
+        region = ivec4(corner, bestSize);
+    } else {
+        auto secondaryCameraFramebuffer = DependencyManager::get<TextureCache>()->getSpectatorCameraFramebuffer();
+        framebuffer = secondaryCameraFramebuffer;
+        region = ivec4(0, 0, secondaryCameraFramebuffer->getWidth(), secondaryCameraFramebuffer->getHeight());
+    }
+
+    auto handle = getGLBackend()->downloadFramebufferAsync(framebuffer, region);
+    if (handle == 0) {
+        // backend has no async path; do it the old synchronous way
+        QImage screenshot(region.z, region.w, QImage::Format_ARGB32);
+        getGLBackend()->downloadFramebuffer(framebuffer, region, screenshot);
+        callback(screenshot.mirrored(false, true));
+        return;
+    }
+
+    _pendingScreenshots.push_back({ handle, region.z, region.w, callback });
+}
+
+void OpenGLDisplayPlugin::pollAsyncScreenshots() {
+    for (auto it = _pendingScreenshots.begin(); it != _pendingScreenshots.end();) {
+        QImage screenshot(it->width, it->height, QImage::Format_ARGB32);
+        if (getGLBackend()->pollFramebufferDownload(it->handle, screenshot)) {
+            it->callback(screenshot.mirrored(false, true));
+            it = _pendingScreenshots.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 QImage OpenGLDisplayPlugin::getSecondaryCameraScreenshot() {
     auto textureCache = DependencyManager::get<TextureCache>();
     auto secondaryCameraFramebuffer = textureCache->getSpectatorCameraFramebuffer();
@@ -886,9 +938,11 @@ gpu::gl::GLBackend* OpenGLDisplayPlugin::getGLBackend() {
 }
 
 void OpenGLDisplayPlugin::render(std::function<void(gpu::Batch& batch)> f) {
-    gpu::Batch batch;
-    f(batch);
-    _gpuContext->executeBatch(batch);
+    // batches come from the shared pool, so present-rate rendering reuses
+    // command storage across frames instead of reallocating every vector here
+    auto batch = gpu::Context::acquireBatch(nullptr);
+    f(*batch);
+    _gpuContext->executeBatch(*batch);
 }
 
 OpenGLDisplayPlugin::~OpenGLDisplayPlugin() {
@@ -9,6 +9,7 @@
 
 #include "DisplayPlugin.h"
 
+#include <list>
 #include <condition_variable>
 #include <memory>
 #include <queue>
@@ -201,4 +202,17 @@ protected:
 
     QImage getScreenshot(float aspectRatio);
     QImage getSecondaryCameraScreenshot();
+
+    // pipelined snapshot capture: the readback is kicked into a PBO and polled on later
+    // presents, so taking a snapshot never stalls the frame that requested it
+    void startAsyncScreenshot(float aspectRatio, bool isPrimary, std::function<void(const QImage&)> callback);
+    void pollAsyncScreenshots();
+
+    struct AsyncScreenshot {
+        uint32_t handle { 0 };
+        int width { 0 };
+        int height { 0 };
+        std::function<void(const QImage&)> callback;
+    };
+    std::list<AsyncScreenshot> _pendingScreenshots;
 };
@@ -222,10 +222,10 @@ void HTTPConnection::respond(const char* code, const QByteArray& content, const
 
     _socket->write(content);
 
-    _socket->disconnectFromHost();
-
-    // make sure we receive no further read notifications
+    // make sure we receive no further read notifications while this response finishes
     disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
+
+    finishResponse();
 }
 
 void HTTPConnection::respond(const char* code, std::unique_ptr<QIODevice> device, const char* contentType, const Headers& headers) {
@@ -239,27 +239,29 @@ void HTTPConnection::respond(const char* code, std::unique_ptr<QIODevice> device
         return;
     }
 
-    int totalToBeWritten = _responseDevice->size();
+    qint64 totalToBeWritten = _responseDevice->size();
     respondWithStatusAndHeaders(code, contentType, headers, totalToBeWritten);
 
+    // make sure we receive no further read notifications while this response streams
+    disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
+
     if (_responseDevice->atEnd()) {
-        _socket->disconnectFromHost();
+        finishResponse();
     } else {
-        connect(_socket, &QTcpSocket::bytesWritten, this, [this, totalToBeWritten](size_t bytes) mutable {
-            constexpr size_t HTTP_RESPONSE_CHUNK_SIZE = 1024 * 10;
-            if (!_responseDevice->atEnd()) {
+        connect(_socket, &QTcpSocket::bytesWritten, this, [this, totalToBeWritten](qint64 bytes) mutable {
+            // stream from the device in large chunks, paced by the socket draining, so
+            // multi-gigabyte responses never sit in memory and never stall the event loop
+            constexpr qint64 HTTP_RESPONSE_CHUNK_SIZE = 256 * 1024;
+            constexpr qint64 MAX_BUFFERED_RESPONSE_BYTES = 2 * HTTP_RESPONSE_CHUNK_SIZE;
+            while (!_responseDevice->atEnd() && _socket->bytesToWrite() < MAX_BUFFERED_RESPONSE_BYTES) {
                 totalToBeWritten -= _socket->write(_responseDevice->read(HTTP_RESPONSE_CHUNK_SIZE));
-                if (_responseDevice->atEnd()) {
-                    _socket->disconnectFromHost();
-                    disconnect(_socket, &QTcpSocket::bytesWritten, this, nullptr);
-                }
+            }
+            if (_responseDevice->atEnd()) {
+                disconnect(_socket, &QTcpSocket::bytesWritten, this, nullptr);
+                finishResponse();
             }
         });
-
     }
-
-    // make sure we receive no further read notifications
-    disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
 }
 
 void HTTPConnection::respondWithStatusAndHeaders(const char* code, const char* contentType, const Headers& headers, qint64 contentLength) {
@@ -285,7 +287,29 @@ void HTTPConnection::respondWithStatusAndHeaders(const char* code, const char* c
         _socket->write(contentType);
         _socket->write("\r\n");
     }
-    _socket->write("Connection: close\r\n\r\n");
+    _socket->write(_keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n");
+}
+
+void HTTPConnection::finishResponse() {
+    if (!_keepAlive) {
+        _socket->disconnectFromHost();
+        return;
+    }
+
+    // reset per-request state and go back to waiting for a request line on the same socket
+    _requestUrl.clear();
+    _requestHeaders.clear();
+    _lastRequestHeader.clear();
+    _requestContent.reset();
+    _responseDevice.reset();
+    _keepAlive = false;
+
+    connect(_socket, SIGNAL(readyRead()), SLOT(readRequest()));
+
+    // handle any pipelined request already buffered
+    if (_socket->canReadLine()) {
+        readRequest();
+    }
 }
 
 void HTTPConnection::readRequest() {
@@ -336,6 +360,9 @@ void HTTPConnection::readHeaders() {
         if (trimmed.isEmpty()) {
             _socket->disconnect(this, SLOT(readHeaders()));
 
+            // HTTP/1.1 defaults to connection reuse unless the client opts out
+            _keepAlive = requestHeader("Connection").toLower() != "close";
+
             QByteArray clength = requestHeader("Content-Length");
             if (clength.isEmpty()) {
                 _parentManager->handleHTTPRequest(this, _requestUrl);
@@ -119,6 +119,10 @@ protected slots:
 protected:
     void respondWithStatusAndHeaders(const char* code, const char* contentType, const Headers& headers, qint64 size);
 
+    /// Finishes a response: either resets state for the next request on a kept-alive
+    /// connection, or closes the socket as before.
+    void finishResponse();
+
     /// The parent HTTP manager
     HTTPManager* _parentManager;
 
@@ -145,6 +149,9 @@ protected:
 
     /// Response content
     std::unique_ptr<QIODevice> _responseDevice;
+
+    /// Whether the client asked for (or defaulted to) connection reuse for this request
+    bool _keepAlive { false };
 };
 
 #endif // hifi_HTTPConnection_h
@@ -115,13 +115,22 @@ bool HTTPManager::handleHTTPRequest(HTTPConnection* connection, const QUrl& url,
         if (!filePath.isEmpty()) {
             // file exists, serve it
             static QMimeDatabase mimeDatabase;
-            
+
+            QFileInfo localFileInfo(filePath);
+
+            // hot static assets come straight from memory while the file is unchanged on disk
+            auto cachedFile = _staticFileCache.constFind(filePath);
+            if (cachedFile != _staticFileCache.constEnd()
+                    && cachedFile->lastModified == localFileInfo.lastModified()) {
+                connection->respond(HTTPConnection::StatusCode200, cachedFile->data,
+                                    qPrintable(cachedFile->mimeType));
+                return true;
+            }
+
             auto localFile = std::unique_ptr<QFile>(new QFile(filePath));
             localFile->open(QIODevice::ReadOnly);
             QByteArray localFileData;
             
-            QFileInfo localFileInfo(filePath);
-            
             if (localFileInfo.completeSuffix() == "shtml") {
                 localFileData = localFile->readAll();
                 // this is a file that may have some SSI statements
@@ -172,10 +181,29 @@ bool HTTPManager::handleHTTPRequest(HTTPConnection* connection, const QUrl& url,
                 ? QString { "text/html" }
                 : mimeDatabase.mimeTypeForFile(filePath).name();
 
+            const qint64 MAX_CACHEABLE_FILE_SIZE = 256 * 1024;
+            const qint64 MAX_STATIC_CACHE_BYTES = 8 * 1024 * 1024;
+
+            if (localFileData.isNull() && localFileInfo.size() <= MAX_CACHEABLE_FILE_SIZE) {
+                // small plain files are read whole so they can be cached; big ones keep
+                // streaming from the device below
+                localFileData = localFile->readAll();
+            }
+
             if (localFileData.isNull()) {
                 connection->respond(HTTPConnection::StatusCode200, std::move(localFile), qPrintable(mimeType));
             } else {
                 connection->respond(HTTPConnection::StatusCode200, localFileData, qPrintable(mimeType));
+
+                // processed SSI output depends on its includes, so only plain files are cached
+                if (localFileInfo.completeSuffix() != "shtml" && localFileData.size() <= MAX_CACHEABLE_FILE_SIZE) {
+                    if (_staticFileCacheBytes + localFileData.size() > MAX_STATIC_CACHE_BYTES) {
+                        _staticFileCache.clear();
+                        _staticFileCacheBytes = 0;
+                    }
+                    _staticFileCacheBytes += localFileData.size();
+                    _staticFileCache.insert(filePath, { localFileData, localFileInfo.lastModified(), mimeType });
+                }
             }
 
             return true;
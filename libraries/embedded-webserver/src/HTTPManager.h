@@ -16,6 +16,7 @@
 #ifndef hifi_HTTPManager_h
 #define hifi_HTTPManager_h
 
+#include <QtCore/QDateTime>
 #include <QtNetwork/QTcpServer>
 #include <QtCore/QTimer>
 
@@ -51,6 +52,15 @@ protected:
     
     QHostAddress _listenAddress;
     QString _documentRoot;
+
+    // small in-memory cache for hot static assets, validated against on-disk modification time
+    struct CachedStaticFile {
+        QByteArray data;
+        QDateTime lastModified;
+        QString mimeType;
+    };
+    QHash<QString, CachedStaticFile> _staticFileCache;
+    qint64 _staticFileCacheBytes { 0 };
     HTTPRequestHandler* _requestHandler;
     QTimer* _isListeningTimer;
     const quint16 _port;
@@ -385,7 +385,9 @@ void EntityTreeRenderer::addPendingEntities(const render::ScenePointer& scene, r
                 transaction.reset(spaceIndex, sphere, workload::Owner(nestable));
                 _space->enqueueTransaction(transaction);
                 entity->setSpaceIndex(spaceIndex);
-                connect(entity.get(), &EntityItem::spaceUpdate, this, &EntityTreeRenderer::handleSpaceUpdate, Qt::QueuedConnection);
+                // direct: the handler only appends to the locked change buffer, and a queued
+                // event per transform change is exactly the per-entity overhead mass motion hits
+                connect(entity.get(), &EntityItem::spaceUpdate, this, &EntityTreeRenderer::handleSpaceUpdate, Qt::DirectConnection);
             }
 
             auto entityID = entity->getEntityItemID();
@@ -539,6 +541,7 @@ void EntityTreeRenderer::update(bool simulate) {
                 std::unique_lock<std::mutex> lock(_spaceLock);
                 spaceTransaction.update(_spaceUpdates);
                 _spaceUpdates.clear();
+                _spaceUpdateIndices.clear();
             }
             {
                 std::vector<int32_t> staleProxies;
@@ -568,6 +571,14 @@ void EntityTreeRenderer::update(bool simulate) {
 
 void EntityTreeRenderer::handleSpaceUpdate(std::pair<int32_t, glm::vec4> proxyUpdate) {
     std::unique_lock<std::mutex> lock(_spaceLock);
+    // coalesce repeated updates to the same proxy within the frame (moving entities produce
+    // several per tick), so the space transaction applies one entry per proxy
+    auto indexIt = _spaceUpdateIndices.find(proxyUpdate.first);
+    if (indexIt != _spaceUpdateIndices.end()) {
+        _spaceUpdates[indexIt->second].second = proxyUpdate.second;
+        return;
+    }
+    _spaceUpdateIndices[proxyUpdate.first] = _spaceUpdates.size();
     _spaceUpdates.emplace_back(proxyUpdate.first, proxyUpdate.second);
 }
 
@@ -641,11 +652,24 @@ void EntityTreeRenderer::checkEnterLeaveEntities() {
         // elapsed because zones or entities might have been created "around us" while we've
         // been stationary
         auto movedEnough = glm::distance(avatarPosition, _avatarPosition) > ZONE_CHECK_DISTANCE;
-        auto enoughTimeElapsed = (now - _lastZoneCheck) > ZONE_CHECK_INTERVAL;
-        
+
+        // The periodic recheck exists to catch zones and scripted entities
+        // created or edited "around us" while stationary; gate it on the tree's
+        // change stamp so a static scene doesn't pay the containment query at
+        // all. Every structural or content change marks the element path to the
+        // root, so the root stamp is authoritative.
+        quint64 treeChangeStamp = 0;
+        {
+            auto root = _tree->getRoot();
+            treeChangeStamp = std::max(root->getLastChanged(), root->getLastChangedContent());
+        }
+        auto enoughTimeElapsed = (now - _lastZoneCheck) > ZONE_CHECK_INTERVAL &&
+                                 treeChangeStamp != _lastZoneCheckTreeStamp;
+
         if (_forceRecheckEntities || movedEnough || enoughTimeElapsed) {
             _avatarPosition = avatarPosition;
             _lastZoneCheck = now;
+            _lastZoneCheckTreeStamp = treeChangeStamp;
             _forceRecheckEntities = false;
 
             QSet<EntityItemID> entitiesContainingAvatar;
@@ -1136,6 +1160,16 @@ void EntityTreeRenderer::playEntityCollisionSound(const EntityItemPointer& entit
     DependencyManager::get<AudioInjectorManager>()->playSound(collisionSound, options, true);
 }
 
+void EntityTreeRenderer::entityCollisionEvents(const CollisionEvents& events) {
+    // NOTE: the collision events are always aligned such that idA is never NULL;
+    // idB may be NULL.
+    for (const Collision& collision : events) {
+        if (!collision.idB.isNull()) {
+            entityCollisionWithEntity(collision.idA, collision.idB, collision);
+        }
+    }
+}
+
 void EntityTreeRenderer::entityCollisionWithEntity(const EntityItemID& idA, const EntityItemID& idB,
                                                     const Collision& collision) {
     // If we don't have a tree, or we're in the process of shutting down, then don't
@@ -50,6 +50,8 @@ using ModelWeakPointer = std::weak_ptr<Model>;
 using CalculateEntityLoadingPriority = std::function<float(const EntityItem& item)>;
 
 // Generic client side Octree renderer class.
+using CollisionEvents = std::vector<Collision>;
+
 class EntityTreeRenderer : public OctreeProcessor, public Dependency {
     Q_OBJECT
 public:
@@ -145,6 +147,7 @@ public slots:
     void addingEntity(const EntityItemID& entityID);
     void deletingEntity(const EntityItemID& entityID);
     void entityScriptChanging(const EntityItemID& entityID, const bool reload);
+    void entityCollisionEvents(const CollisionEvents& events);
     void entityCollisionWithEntity(const EntityItemID& idA, const EntityItemID& idB, const Collision& collision);
     void updateEntityRenderStatus(bool shouldRenderEntities);
     void updateZone(const EntityItemID& id);
@@ -242,6 +245,7 @@ private:
 
     LayeredZones _layeredZones;
     uint64_t _lastZoneCheck { 0 };
+    quint64 _lastZoneCheckTreeStamp { 0 };  // tree change stamp at the last zone evaluation
     const uint64_t ZONE_CHECK_INTERVAL = USECS_PER_MSEC * 100; // ~10hz
     const float ZONE_CHECK_DISTANCE = 0.001f;
 
@@ -264,6 +268,7 @@ private:
     mutable std::mutex _spaceLock;
     workload::SpacePointer _space{ new workload::Space() };
     workload::Transaction::Updates _spaceUpdates;
+    std::unordered_map<int32_t, size_t> _spaceUpdateIndices; // proxy id -> slot in _spaceUpdates
 
     static std::function<bool(const QUuid&, graphics::MaterialLayer, const std::string&)> _addMaterialToEntityOperator;
     static std::function<bool(const QUuid&, graphics::MaterialPointer, const std::string&)> _removeMaterialFromEntityOperator;
@@ -41,9 +41,11 @@ static ShapePipelinePointer shapePipelineFactory(const ShapePlumber& plumber, co
 }
 
 struct GpuParticle {
-    GpuParticle(const glm::vec3& xyzIn, const glm::vec2& uvIn) : xyz(xyzIn), uv(uvIn) {}
-    glm::vec3 xyz; // Position
-    glm::vec2 uv; // Lifetime + seed
+    GpuParticle(const glm::vec4& positionBirthIn, const glm::vec4& velocitySeedIn, const glm::vec4& accelerationIn) :
+        positionBirth(positionBirthIn), velocitySeed(velocitySeedIn), acceleration(accelerationIn) {}
+    glm::vec4 positionBirth;    // xyz = position at emission, w = birth time (seconds since epoch)
+    glm::vec4 velocitySeed;     // xyz = velocity at emission, w = seed
+    glm::vec4 acceleration;     // xyz = acceleration
 };
 
 using GpuParticles = std::vector<GpuParticle>;
@@ -57,10 +59,12 @@ ParticleEffectEntityRenderer::ParticleEffectEntityRenderer(const EntityItemPoint
         // As we create the first ParticuleSystem entity, let s register its special shapePIpeline factory:
         CUSTOM_PIPELINE_NUMBER = render::ShapePipeline::registerCustomShapePipelineFactory(shapePipelineFactory);
         _vertexFormat = std::make_shared<Format>();
-        _vertexFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element::VEC3F_XYZ,
-            offsetof(GpuParticle, xyz), gpu::Stream::PER_INSTANCE);
-        _vertexFormat->setAttribute(gpu::Stream::COLOR, 0, gpu::Element::VEC2F_UV,
-            offsetof(GpuParticle, uv), gpu::Stream::PER_INSTANCE);
+        _vertexFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element::VEC4F_XYZW,
+            offsetof(GpuParticle, positionBirth), gpu::Stream::PER_INSTANCE);
+        _vertexFormat->setAttribute(gpu::Stream::COLOR, 0, gpu::Element::VEC4F_XYZW,
+            offsetof(GpuParticle, velocitySeed), gpu::Stream::PER_INSTANCE);
+        _vertexFormat->setAttribute(gpu::Stream::TEXCOORD, 0, gpu::Element::VEC4F_XYZW,
+            offsetof(GpuParticle, acceleration), gpu::Stream::PER_INSTANCE);
     });
 }
 
@@ -376,6 +380,7 @@ ParticleEffectEntityRenderer::CpuParticle ParticleEffectEntityRenderer::createPa
 void ParticleEffectEntityRenderer::stepSimulation() {
     if (_lastSimulated == 0) {
         _lastSimulated = usecTimestampNow();
+        _simulationEpoch = _lastSimulated;
         return;
     }
 
@@ -404,6 +409,8 @@ void ParticleEffectEntityRenderer::stepSimulation() {
                 }
                 // emit particle
                 _cpuParticles.push_back(createParticle(now, modelTransform, particleProperties, shapeType, geometryResource, _triangleInfo));
+                _cpuParticles.back().birth = now;
+                _particleBufferNeedsRebuild = true;
                 _timeUntilNextEmit = emitInterval;
                 if (emitInterval < timeRemaining) {
                     timeRemaining -= emitInterval;
@@ -417,36 +424,65 @@ void ParticleEffectEntityRenderer::stepSimulation() {
     // Kill any particles that have expired or are over the max size
     while (_cpuParticles.size() > particleProperties.maxParticles || (!_cpuParticles.empty() && _cpuParticles.front().expiration <= now)) {
         _cpuParticles.pop_front();
+        _particleBufferNeedsRebuild = true;
     }
 
-    const float deltaTime = (float)interval / (float)USECS_PER_SECOND;
-    // update the particles
-    for (auto& particle : _cpuParticles) {
-        if (_prevEmitterShouldTrail != particleProperties.emission.shouldTrail) {
+    // Rebase the float time origin periodically: births and ages reach the shader as float
+    // seconds relative to _simulationEpoch, and after hours of uptime the ulp at that magnitude
+    // exceeds a millisecond, visibly quantizing long-lived emitters. Rebasing to "now" keeps
+    // the magnitudes within one epoch window; live particles simply carry small negative
+    // relative births, which the shader's age math already handles.
+    const uint64_t MAX_EPOCH_AGE_USECS = 30 * 60 * USECS_PER_SECOND;
+    if (now - _simulationEpoch > MAX_EPOCH_AGE_USECS) {
+        _simulationEpoch = now;
+        _particleBufferNeedsRebuild = true;
+    }
+
+    if (_prevEmitterShouldTrail != particleProperties.emission.shouldTrail) {
+        // collapse each particle's analytic state to "now", then rebase between
+        // the trailing (world-baked) and emitter-relative forms
+        for (auto& particle : _cpuParticles) {
+            float age = (float)(now - particle.birth) / (float)USECS_PER_SECOND;
+            particle.relativePosition += particle.velocity * age + (0.5f * age * age) * particle.acceleration;
+            particle.velocity += particle.acceleration * age;
+            particle.birth = now;
             if (_prevEmitterShouldTrail) {
                 particle.relativePosition = particle.relativePosition + particle.basePosition - modelTransform.getTranslation();
             }
             particle.basePosition = modelTransform.getTranslation();
         }
-        particle.integrate(deltaTime);
+        _particleBufferNeedsRebuild = true;
     }
     _prevEmitterShouldTrail = particleProperties.emission.shouldTrail;
 
-    // Build particle primitives
-    static GpuParticles gpuParticles;
-    gpuParticles.clear();
-    gpuParticles.reserve(_cpuParticles.size()); // Reserve space
-    std::transform(_cpuParticles.begin(), _cpuParticles.end(), std::back_inserter(gpuParticles), [&particleProperties, &modelTransform] (const CpuParticle& particle) {
-        glm::vec3 position = particle.relativePosition + (particleProperties.emission.shouldTrail ? particle.basePosition : modelTransform.getTranslation());
-        return GpuParticle(position, glm::vec2(particle.lifetime, particle.seed));
-    });
+    // The GPU integrates particle motion from the emission-time state, so the
+    // buffer only needs rebuilding when the particle set itself changed.
+    if (_particleBufferNeedsRebuild) {
+        _particleBufferNeedsRebuild = false;
+
+        static GpuParticles gpuParticles;
+        gpuParticles.clear();
+        gpuParticles.reserve(_cpuParticles.size()); // Reserve space
+        uint64_t epoch = _simulationEpoch;
+        std::transform(_cpuParticles.begin(), _cpuParticles.end(), std::back_inserter(gpuParticles),
+                       [&particleProperties, epoch] (const CpuParticle& particle) {
+            // trailing particles bake their emitter position in; non-trailing ones
+            // get the live emitter translation in the vertex shader
+            glm::vec3 position = particle.relativePosition
+                + (particleProperties.emission.shouldTrail ? particle.basePosition : glm::vec3(0.0f));
+            float birth = (float)((int64_t)(particle.birth - epoch)) / (float)USECS_PER_SECOND;
+            return GpuParticle(glm::vec4(position, birth),
+                               glm::vec4(particle.velocity, particle.seed),
+                               glm::vec4(particle.acceleration, 0.0f));
+        });
 
-    // Update particle buffer
-    auto& particleBuffer = _particleBuffer;
-    size_t numBytes = sizeof(GpuParticle) * gpuParticles.size();
-    particleBuffer->resize(numBytes);
-    if (numBytes != 0) {
-        particleBuffer->setData(numBytes, (const gpu::Byte*)gpuParticles.data());
+        // Update particle buffer
+        auto& particleBuffer = _particleBuffer;
+        size_t numBytes = sizeof(GpuParticle) * gpuParticles.size();
+        particleBuffer->resize(numBytes);
+        if (numBytes != 0) {
+            particleBuffer->setData(numBytes, (const gpu::Byte*)gpuParticles.data());
+        }
     }
 }
 
@@ -466,6 +502,10 @@ void ParticleEffectEntityRenderer::doRender(RenderArgs* args) {
     // if the particles are marked rotateWithEntity
     withReadLock([&] {
         transform.setRotation(_renderTransform.getRotation());
+        auto& uniforms = _uniformBuffer.edit<ParticleUniforms>();
+        uniforms.simulationAge = (float)((int64_t)(usecTimestampNow() - _simulationEpoch)) / (float)USECS_PER_SECOND;
+        uniforms.emitterTranslationTrail = glm::vec4(_renderTransform.getTranslation(),
+                                                     _particleProperties.emission.shouldTrail ? 1.0f : 0.0f);
         auto& color = _uniformBuffer.edit<ParticleUniforms>().color;
         color.start = EntityRenderer::calculatePulseColor(_particleProperties.getColorStart(), _pulseProperties, _created);
         color.middle = EntityRenderer::calculatePulseColor(_particleProperties.getColorMiddle(), _pulseProperties, _created);
@@ -43,21 +43,17 @@ private:
 
     // CPU particles
     // FIXME either switch to GPU compute particles or switch to simd updating of the particles
+    // Emission-time particle state. Positions integrate analytically on the GPU
+    // (constant acceleration), so after emission the CPU only tracks expiry.
     struct CpuParticle {
         float seed { 0.0f };
+        uint64_t birth { 0 };
         uint64_t expiration { 0 };
         float lifetime { 0.0f };
         glm::vec3 basePosition;
         glm::vec3 relativePosition;
         glm::vec3 velocity;
         glm::vec3 acceleration;
-
-        void integrate(float deltaTime) {
-            glm::vec3 atSquared = (0.5f * deltaTime * deltaTime) * acceleration;
-            relativePosition += velocity * deltaTime + atSquared;
-            velocity += acceleration * deltaTime;
-            lifetime += deltaTime;
-        }
     };
     using CpuParticles = std::deque<CpuParticle>;
 
@@ -76,7 +72,9 @@ private:
         InterpolationData<float> spin;
         float lifespan;
         int rotateWithEntity;
-        glm::vec2 spare;
+        float simulationAge { 0.0f };       // seconds since _simulationEpoch
+        float spare { 0.0f };
+        glm::vec4 emitterTranslationTrail { 0.0f, 0.0f, 0.0f, 0.0f };
     };
 
     void computeTriangles(const hfm::Model& hfmModel);
@@ -93,6 +91,9 @@ private:
                                       const TriangleInfo& triangleInfo);
     void stepSimulation();
 
+    uint64_t _simulationEpoch { 0 };    // shader birth/age times are relative to this
+    bool _particleBufferNeedsRebuild { false };
+
     particle::Properties _particleProperties;
     bool _prevEmitterShouldTrail;
     bool _prevEmitterShouldTrailInitialized { false };
@@ -1012,8 +1012,10 @@ bool RenderablePolyVoxEntityItem::setVoxelInternal(const ivec3& v, uint8_t toVal
     if (result) {
         if (isEdged()) {
             setVoxelMarkNeighbors(v.x + 1, v.y + 1, v.z + 1, toValue);
+            markChunksDirty(ivec3(v.x + 1, v.y + 1, v.z + 1));
         } else {
             setVoxelMarkNeighbors(v.x, v.y, v.z, toValue);
+            markChunksDirty(v);
         }
         _volDataDirty = true;
         startUpdates();
@@ -1244,6 +1246,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(ivec3(x, y, z));
                             _volDataDirty = true;
                         }
                     }
@@ -1264,6 +1267,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(ivec3(x, y, z));
                             _volDataDirty = true;
                         }
                     }
@@ -1284,6 +1288,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(ivec3(x, y, z));
                             _volDataDirty = true;
                         }
                     }
@@ -1323,6 +1328,105 @@ void RenderablePolyVoxEntityItem::tellNeighborsToRecopyEdges(bool force) {
 }
 
 
+static const int POLYVOX_CHUNK_SIZE = 16;
+
+void RenderablePolyVoxEntityItem::markChunksDirty(const ivec3& voxelCoord) {
+    // caller must hold the write lock. A voxel affects the surface of the cell
+    // around it, so neighbouring chunks are dirtied when the voxel sits on a
+    // chunk boundary.
+    if (_chunkMeshes.empty()) {
+        return;     // the grid isn't built yet; everything starts dirty
+    }
+    for (int dz = -1; dz <= 1; dz++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                int cx = glm::clamp((voxelCoord.x + dx) / POLYVOX_CHUNK_SIZE, 0, _chunkCounts.x - 1);
+                int cy = glm::clamp((voxelCoord.y + dy) / POLYVOX_CHUNK_SIZE, 0, _chunkCounts.y - 1);
+                int cz = glm::clamp((voxelCoord.z + dz) / POLYVOX_CHUNK_SIZE, 0, _chunkCounts.z - 1);
+                _chunkMeshes[(cz * _chunkCounts.y + cy) * _chunkCounts.x + cx].dirty = true;
+            }
+        }
+    }
+}
+
+void RenderablePolyVoxEntityItem::rebuildDirtyChunks(PolyVoxSurfaceStyle voxelSurfaceStyle) {
+    // caller must hold the write lock
+    auto enclosingRegion = _volData->getEnclosingRegion();
+    glm::ivec3 counts((_volData->getWidth() + POLYVOX_CHUNK_SIZE - 1) / POLYVOX_CHUNK_SIZE,
+                      (_volData->getHeight() + POLYVOX_CHUNK_SIZE - 1) / POLYVOX_CHUNK_SIZE,
+                      (_volData->getDepth() + POLYVOX_CHUNK_SIZE - 1) / POLYVOX_CHUNK_SIZE);
+
+    // a resize or surface-style change invalidates the whole cache
+    if (counts != _chunkCounts || (int)voxelSurfaceStyle != _chunkSurfaceStyle) {
+        _chunkCounts = counts;
+        _chunkSurfaceStyle = (int)voxelSurfaceStyle;
+        _chunkMeshes.assign((size_t)counts.x * counts.y * counts.z, ChunkMesh());
+    }
+
+    for (int cz = 0; cz < _chunkCounts.z; cz++) {
+        for (int cy = 0; cy < _chunkCounts.y; cy++) {
+            for (int cx = 0; cx < _chunkCounts.x; cx++) {
+                ChunkMesh& chunk = _chunkMeshes[(cz * _chunkCounts.y + cy) * _chunkCounts.x + cx];
+                if (!chunk.dirty) {
+                    continue;
+                }
+                chunk.dirty = false;
+
+                PolyVox::Vector3DInt32 lowerCorner(enclosingRegion.getLowerCorner().getX() + cx * POLYVOX_CHUNK_SIZE,
+                                                   enclosingRegion.getLowerCorner().getY() + cy * POLYVOX_CHUNK_SIZE,
+                                                   enclosingRegion.getLowerCorner().getZ() + cz * POLYVOX_CHUNK_SIZE);
+                PolyVox::Vector3DInt32 upperCorner(
+                    std::min(lowerCorner.getX() + POLYVOX_CHUNK_SIZE - 1, enclosingRegion.getUpperCorner().getX()),
+                    std::min(lowerCorner.getY() + POLYVOX_CHUNK_SIZE - 1, enclosingRegion.getUpperCorner().getY()),
+                    std::min(lowerCorner.getZ() + POLYVOX_CHUNK_SIZE - 1, enclosingRegion.getUpperCorner().getZ()));
+                PolyVox::Region chunkRegion(lowerCorner, upperCorner);
+
+                PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal> polyVoxMesh;
+                switch (voxelSurfaceStyle) {
+                    case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES:
+                    case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
+                        PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
+                            (_volData.get(), chunkRegion, &polyVoxMesh);
+                        surfaceExtractor.execute();
+                        break;
+                    }
+                    case PolyVoxEntityItem::SURFACE_EDGED_CUBIC:
+                    case PolyVoxEntityItem::SURFACE_CUBIC: {
+                        PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
+                            (_volData.get(), chunkRegion, &polyVoxMesh);
+                        surfaceExtractor.execute();
+                        break;
+                    }
+                }
+
+                // chunk vertices come out relative to the chunk region; shift them
+                // into the same space the whole-volume extraction used
+                glm::vec3 chunkOffset(lowerCorner.getX() - enclosingRegion.getLowerCorner().getX(),
+                                      lowerCorner.getY() - enclosingRegion.getLowerCorner().getY(),
+                                      lowerCorner.getZ() - enclosingRegion.getLowerCorner().getZ());
+                const std::vector<PolyVox::PositionMaterialNormal>& chunkVertices = polyVoxMesh.getRawVertexData();
+                chunk.vertices.assign(chunkVertices.begin(), chunkVertices.end());
+                for (auto& vertex : chunk.vertices) {
+                    vertex.position += PolyVox::Vector3DFloat(chunkOffset.x, chunkOffset.y, chunkOffset.z);
+                }
+                chunk.indices = polyVoxMesh.getIndices();
+            }
+        }
+    }
+}
+
+void RenderablePolyVoxEntityItem::appendChunkMeshes(std::vector<PolyVox::PositionMaterialNormal>& vertices,
+                                                    std::vector<uint32_t>& indices) {
+    // caller must hold the entity lock
+    for (const auto& chunk : _chunkMeshes) {
+        uint32_t baseVertex = (uint32_t)vertices.size();
+        vertices.insert(vertices.end(), chunk.vertices.begin(), chunk.vertices.end());
+        for (uint32_t index : chunk.indices) {
+            indices.push_back(index + baseVertex);
+        }
+    }
+}
+
 void RenderablePolyVoxEntityItem::recomputeMesh() {
     // use _volData to make a renderable mesh
     PolyVoxSurfaceStyle voxelSurfaceStyle;
@@ -1335,38 +1439,23 @@ void RenderablePolyVoxEntityItem::recomputeMesh() {
     QtConcurrent::run([entity, voxelSurfaceStyle] {
         graphics::MeshPointer mesh(new graphics::Mesh());
 
-        // A mesh object to hold the result of surface extraction
-        PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal> polyVoxMesh;
-
-        entity->withReadLock([&] {
-            PolyVox::SimpleVolume<uint8_t>* volData = entity->getVolData();
-            switch (voxelSurfaceStyle) {
-                case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES:
-                case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
-                    PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
-                }
-                case PolyVoxEntityItem::SURFACE_EDGED_CUBIC:
-                case PolyVoxEntityItem::SURFACE_CUBIC: {
-                    PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
-                }
-            }
+        // re-extract only the chunks that voxel edits touched, then stitch the
+        // cached chunk meshes into one renderable mesh
+        std::vector<PolyVox::PositionMaterialNormal> vecVertices;
+        std::vector<uint32_t> vecIndices;
+
+        entity->withWriteLock([&] {
+            entity->rebuildDirtyChunks(voxelSurfaceStyle);
+            entity->appendChunkMeshes(vecVertices, vecIndices);
         });
 
         // convert PolyVox mesh to a Sam mesh
-        const std::vector<uint32_t>& vecIndices = polyVoxMesh.getIndices();
         auto indexBuffer = std::make_shared<gpu::Buffer>(vecIndices.size() * sizeof(uint32_t),
                                                          (gpu::Byte*)vecIndices.data());
         auto indexBufferPtr = gpu::BufferPointer(indexBuffer);
         gpu::BufferView indexBufferView(indexBufferPtr, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::INDEX));
         mesh->setIndexBuffer(indexBufferView);
 
-        const std::vector<PolyVox::PositionMaterialNormal>& vecVertices = polyVoxMesh.getRawVertexData();
         auto vertexBuffer = std::make_shared<gpu::Buffer>(vecVertices.size() * sizeof(PolyVox::PositionMaterialNormal),
                                                           (gpu::Byte*)vecVertices.data());
         auto vertexBufferPtr = gpu::BufferPointer(vertexBuffer);
@@ -18,6 +18,7 @@
 
 #include <PolyVoxCore/SimpleVolume.h>
 #include <PolyVoxCore/Raycast.h>
+#include <PolyVoxCore/VertexTypes.h>
 
 #include <gpu/Forward.h>
 #include <gpu/Context.h>
@@ -177,6 +178,23 @@ private:
     ShapeInfo _shapeInfo;
 
     std::shared_ptr<PolyVox::SimpleVolume<uint8_t>> _volData;
+
+    // Chunked incremental extraction: the volume is carved into fixed-size
+    // chunks whose extraction results are cached, so a voxel edit only
+    // re-extracts the chunks it touched. The chunk grid and cache are guarded
+    // by the entity lock, like _volData.
+    struct ChunkMesh {
+        std::vector<PolyVox::PositionMaterialNormal> vertices;
+        std::vector<uint32_t> indices;
+        bool dirty { true };
+    };
+    std::vector<ChunkMesh> _chunkMeshes;
+    glm::ivec3 _chunkCounts { 0, 0, 0 };
+    int _chunkSurfaceStyle { -1 };      // style the cache was extracted with
+
+    void markChunksDirty(const ivec3& voxelCoord);      // volume coordinates
+    void rebuildDirtyChunks(PolyVoxSurfaceStyle voxelSurfaceStyle);
+    void appendChunkMeshes(std::vector<PolyVox::PositionMaterialNormal>& vertices, std::vector<uint32_t>& indices);
     int _onCount; // how many non-zero voxels are in _volData
 
     bool _neighborXNeedsUpdate { false };
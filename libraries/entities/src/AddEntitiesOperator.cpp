@@ -0,0 +1,84 @@
+//
+//  AddEntitiesOperator.cpp
+//  libraries/entities/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AddEntitiesOperator.h"
+
+#include "EntityItem.h"
+#include "EntityTree.h"
+#include "EntityTreeElement.h"
+
+AddEntitiesOperator::AddEntitiesOperator(EntityTreePointer tree, const QVector<EntityItemPointer>& newEntities) :
+    _tree(tree)
+{
+    _pendingAdds.reserve(newEntities.size());
+    for (const auto& entity : newEntities) {
+        assert(entity);
+        PendingAdd pending;
+        pending.entity = entity;
+        bool success;
+        auto queryCube = entity->getQueryAACube(success);
+        pending.box = queryCube.clamp((float)(-HALF_TREE_SCALE), (float)HALF_TREE_SCALE);
+        _pendingAdds.push_back(pending);
+    }
+}
+
+bool AddEntitiesOperator::preRecursion(const OctreeElementPointer& element) {
+    EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+
+    // Recurse this branch while any not-yet-placed entity's bounds are contained
+    // by it; place every entity whose best fit this element is.
+    bool keepSearching = false;
+
+    if (_foundCount < _pendingAdds.size()) {
+        for (auto& pending : _pendingAdds) {
+            if (!pending.found && element->getAACube().contains(pending.box)) {
+                if (entityTreeElement->bestFitBounds(pending.box)) {
+                    _tree->addEntityMapEntry(pending.entity);
+                    entityTreeElement->addEntityItem(pending.entity);
+                    pending.found = true;
+                    ++_foundCount;
+                } else {
+                    keepSearching = true;
+                }
+            }
+        }
+    }
+
+    return keepSearching;
+}
+
+bool AddEntitiesOperator::postRecursion(const OctreeElementPointer& element) {
+    // mark the path dirty for every entity that was placed below this element
+    bool keepSearching = _foundCount < _pendingAdds.size();
+
+    for (const auto& pending : _pendingAdds) {
+        if (pending.found && element->getAACube().contains(pending.box)) {
+            element->markWithChangedTime();
+            break;
+        }
+    }
+    return keepSearching;
+}
+
+OctreeElementPointer AddEntitiesOperator::possiblyCreateChildAt(const OctreeElementPointer& element, int childIndex) {
+    // create the child when any pending entity needs to descend into it
+    if (_foundCount < _pendingAdds.size()) {
+        float childElementScale = element->getAACube().getScale() / 2.0f; // all of our children will be half our scale
+        for (const auto& pending : _pendingAdds) {
+            if (!pending.found && element->getAACube().contains(pending.box) &&
+                pending.box.getLargestDimension() <= childElementScale &&
+                childIndex == element->getMyChildContaining(pending.box)) {
+                return element->addChildAtIndex(childIndex);
+            }
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,48 @@
+//
+//  AddEntitiesOperator.h
+//  libraries/entities/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AddEntitiesOperator_h
+#define hifi_AddEntitiesOperator_h
+
+#include <memory>
+#include <vector>
+
+#include <AABox.h>
+#include <Octree.h>
+
+#include "EntityTypes.h"
+
+class EntityTree;
+using EntityTreePointer = std::shared_ptr<EntityTree>;
+
+// Multi-entity variant of AddEntityOperator: stores a whole batch of new
+// entities in their best-fit elements in a single tree recursion.
+class AddEntitiesOperator : public RecurseOctreeOperator {
+public:
+    AddEntitiesOperator(EntityTreePointer tree, const QVector<EntityItemPointer>& newEntities);
+
+    virtual bool preRecursion(const OctreeElementPointer& element) override;
+    virtual bool postRecursion(const OctreeElementPointer& element) override;
+    virtual OctreeElementPointer possiblyCreateChildAt(const OctreeElementPointer& element, int childIndex) override;
+
+private:
+    struct PendingAdd {
+        EntityItemPointer entity;
+        AABox box;
+        bool found { false };
+    };
+
+    EntityTreePointer _tree;
+    std::vector<PendingAdd> _pendingAdds;
+    size_t _foundCount { 0 };
+};
+
+#endif // hifi_AddEntitiesOperator_h
@@ -73,6 +73,11 @@ public:
 
     void reset() { _path.clear(); _completedView.startTime = 0; } // resets our state to force a new "First" traversal
 
+    // Completes the traversal immediately: the current view becomes the completed
+    // view without walking the tree. Used when an external changed-entity index
+    // has already supplied the scene delta.
+    void completeWithoutTraversal() { _path.clear(); _completedView = _currentView; }
+
 private:
     void getNextVisibleElement(VisibleElement& next);
 
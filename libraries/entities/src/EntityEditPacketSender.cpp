@@ -52,17 +52,17 @@ void EntityEditPacketSender::queueEditAvatarEntityMessage(EntityTreePointer enti
     }
     entity->setLastBroadcast(usecTimestampNow());
 
-    OctreePacketData packetData(false, AvatarTraits::MAXIMUM_TRAIT_SIZE);
+    PooledOctreePacketData packetData(false, AvatarTraits::MAXIMUM_TRAIT_SIZE);
     EncodeBitstreamParams params;
     EntityTreeElementExtraEncodeDataPointer extra { nullptr };
-    OctreeElement::AppendState appendState = entity->appendEntityData(&packetData, params, extra);
+    OctreeElement::AppendState appendState = entity->appendEntityData(packetData.get(), params, extra);
 
     if (appendState != OctreeElement::COMPLETED) {
         // this entity's payload is too big
         return;
     }
 
-    QByteArray tempArray((const char*)packetData.getUncompressedData(), packetData.getUncompressedSize());
+    QByteArray tempArray((const char*)packetData->getUncompressedData(), packetData->getUncompressedSize());
     _myAvatar->storeAvatarEntityDataPayload(entityItemID, tempArray);
 }
 
@@ -70,6 +70,70 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
                                                     EntityTreePointer entityTree,
                                                     EntityItemID entityItemID,
                                                     const EntityItemProperties& properties) {
+    // Coalesce repeated edits to the same entity: when a script updates the same
+    // properties every frame, only the latest values within the window go out.
+    // Adds, avatar/local entities, and edits that change a different property
+    // set (which we cannot merge without building a full union) send immediately.
+    if (_editCoalescingWindow > 0 && type == PacketType::EntityEdit &&
+        properties.getEntityHostType() == entity::HostType::DOMAIN) {
+
+        std::lock_guard<std::mutex> lock(_pendingEditsLock);
+        auto it = _pendingEdits.find(entityItemID);
+        if (it != _pendingEdits.end()) {
+            EntityPropertyFlags pendingChanged = it->properties.getChangedProperties();
+            if ((pendingChanged & properties.getChangedProperties()) == pendingChanged) {
+                // same or wider property set: the newer edit supersedes the pending one
+                it->properties = properties;
+                it->entityTree = entityTree;
+                return;
+            }
+            // different property set: flush the pending edit first, then queue this one
+            PendingEdit pending = *it;
+            _pendingEdits.erase(it);
+            queueEditEntityMessageNow(PacketType::EntityEdit, pending.entityTree, entityItemID, pending.properties);
+        }
+
+        PendingEdit pending;
+        pending.entityTree = entityTree;
+        pending.properties = properties;
+        pending.firstQueuedTime = usecTimestampNow();
+        _pendingEdits.insert(entityItemID, pending);
+        return;
+    }
+
+    queueEditEntityMessageNow(type, entityTree, entityItemID, properties);
+}
+
+void EntityEditPacketSender::flushDueCoalescedEdits(bool flushAll) {
+    std::vector<std::pair<EntityItemID, PendingEdit>> dueEdits;
+    {
+        std::lock_guard<std::mutex> lock(_pendingEditsLock);
+        quint64 now = usecTimestampNow();
+        auto it = _pendingEdits.begin();
+        while (it != _pendingEdits.end()) {
+            if (flushAll || now - it->firstQueuedTime >= _editCoalescingWindow) {
+                dueEdits.emplace_back(it.key(), *it);
+                it = _pendingEdits.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (auto& edit : dueEdits) {
+        queueEditEntityMessageNow(PacketType::EntityEdit, edit.second.entityTree, edit.first, edit.second.properties);
+    }
+}
+
+bool EntityEditPacketSender::process() {
+    flushDueCoalescedEdits();
+    return OctreeEditPacketSender::process();
+}
+
+void EntityEditPacketSender::queueEditEntityMessageNow(PacketType type,
+                                                       EntityTreePointer entityTree,
+                                                       EntityItemID entityItemID,
+                                                       const EntityItemProperties& properties) {
     if (properties.getEntityHostType() == entity::HostType::AVATAR) {
         if (!_myAvatar) {
             qCWarning(entities) << "Suppressing entity edit message: cannot send avatar entity edit with no myAvatar";
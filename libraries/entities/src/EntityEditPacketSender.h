@@ -35,6 +35,14 @@ public:
     void queueEditEntityMessage(PacketType type, EntityTreePointer entityTree,
                                 EntityItemID entityItemID, const EntityItemProperties& properties);
 
+    /// Edit-coalescing window in usecs: successive edits to the same entity whose
+    /// changed-property set repeats (e.g. a script moving an entity every frame)
+    /// are merged and sent once per window. 0 disables coalescing.
+    void setEditCoalescingWindow(quint64 usecs) { _editCoalescingWindow = usecs; }
+    quint64 getEditCoalescingWindow() const { return _editCoalescingWindow; }
+
+    virtual bool process() override;
+
 
     void queueEraseEntityMessage(const EntityItemID& entityItemID);
     void queueCloneEntityMessage(const EntityItemID& entityIDToClone, const EntityItemID& newEntityID);
@@ -50,6 +58,19 @@ public slots:
     void processEntityEditNackPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
 
 private:
+    void queueEditEntityMessageNow(PacketType type, EntityTreePointer entityTree,
+                                   EntityItemID entityItemID, const EntityItemProperties& properties);
+    void flushDueCoalescedEdits(bool flushAll = false);
+
+    struct PendingEdit {
+        EntityTreePointer entityTree;
+        EntityItemProperties properties;
+        quint64 firstQueuedTime { 0 };
+    };
+    std::mutex _pendingEditsLock;
+    QHash<EntityItemID, PendingEdit> _pendingEdits;
+    quint64 _editCoalescingWindow { 0 };    // usecs; 0 = send every edit immediately
+
     friend class MyAvatar;
     void queueEditAvatarEntityMessage(EntityTreePointer entityTree, EntityItemID entityItemID);
 
@@ -2719,6 +2719,15 @@ void EntityItem::markAsChangedOnServer() {
     withWriteLock([&] {
         _changedOnServer = usecTimestampNow();
     });
+
+    // feed the tree's changed-entity log, used for incremental scene deltas
+    EntityTreeElementPointer element = getElement();
+    if (element) {
+        EntityTreePointer tree = element->getTree();
+        if (tree) {
+            tree->trackChangedEntity(std::static_pointer_cast<EntityItem>(getThisPointer()));
+        }
+    }
 }
 
 quint64 EntityItem::getLastChangedOnServer() const {
@@ -12,6 +12,8 @@
 #ifndef hifi_EntityPriorityQueue_h
 #define hifi_EntityPriorityQueue_h
 
+#include <string.h>
+
 #include <queue>
 #include <unordered_set>
 
@@ -43,16 +45,26 @@ private:
     bool _forceRemove;
 };
 
+// Radix-bucketed priority queue: entities land in one of 256 buckets keyed by
+// the top bits of an order-preserving integer encoding of their float priority,
+// so emplace and pop are O(1) instead of O(log n). pop() drains the highest
+// non-empty bucket; ordering within a bucket's narrow priority band is not
+// significant for send scheduling.
 class EntityPriorityQueue {
 public:
     inline bool empty() const {
-        assert(_queue.empty() == _entities.empty());
-        return _queue.empty();
+        assert((_size == 0) == _entities.empty());
+        return _size == 0;
     }
 
     inline const PrioritizedEntity& top() const {
-        assert(!_queue.empty());
-        return _queue.top();
+        assert(!empty());
+        int bucket = _highestBucket;
+        while (_buckets[bucket].empty()) {
+            --bucket;
+        }
+        _highestBucket = bucket;
+        return _buckets[bucket].back();
     }
 
     inline bool contains(const EntityItem* entity) const {
@@ -61,29 +73,48 @@ public:
 
     inline void emplace(const EntityItemPointer& entity, float priority, bool forceRemove = false) {
         assert(entity && !contains(entity.get()));
-        _queue.emplace(entity, priority, forceRemove);
+        int bucket = bucketForPriority(priority);
+        _buckets[bucket].emplace_back(entity, priority, forceRemove);
+        if (bucket > _highestBucket) {
+            _highestBucket = bucket;
+        }
+        ++_size;
         _entities.insert(entity.get());
-        assert(_queue.size() == _entities.size());
+        assert(_size == _entities.size());
     }
 
     inline void pop() {
         assert(!empty());
-        _entities.erase(_queue.top().getRawEntityPointer());
-        _queue.pop();
-        assert(_queue.size() == _entities.size());
+        const PrioritizedEntity& entry = top();     // also refreshes _highestBucket
+        _entities.erase(entry.getRawEntityPointer());
+        _buckets[_highestBucket].pop_back();
+        --_size;
+        assert(_size == _entities.size());
     }
 
     inline void swap(EntityPriorityQueue& other) {
-        std::swap(_queue, other._queue);
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            std::swap(_buckets[i], other._buckets[i]);
+        }
+        std::swap(_highestBucket, other._highestBucket);
+        std::swap(_size, other._size);
         std::swap(_entities, other._entities);
     }
 
 private:
-    using PriorityQueue = std::priority_queue<PrioritizedEntity,
-                                              std::vector<PrioritizedEntity>,
-                                              PrioritizedEntity::Compare>;
+    static const int NUM_BUCKETS = 256;
+
+    // map the float priority onto a monotonic unsigned key and take its top bits
+    static int bucketForPriority(float priority) {
+        uint32_t bits;
+        memcpy(&bits, &priority, sizeof(bits));
+        bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        return (int)(bits >> 24);
+    }
 
-    PriorityQueue _queue;
+    std::vector<PrioritizedEntity> _buckets[NUM_BUCKETS];
+    mutable int _highestBucket { 0 };
+    size_t _size { 0 };
     // Keep dictionary of all the entities in the queue for fast contain checks.
     std::unordered_set<const EntityItem*> _entities;
 
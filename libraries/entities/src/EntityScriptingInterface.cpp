@@ -475,6 +475,67 @@ void synchronizeEditedGrabProperties(EntityItemProperties& properties, const QSt
 }
 
 
+QVector<QUuid> EntityScriptingInterface::addEntityClones(const EntityItemProperties& properties,
+                                                         const QVector<glm::vec3>& positions,
+                                                         const QString& entityHostTypeString) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    QVector<QUuid> ids;
+    if (!_entityTree) {
+        return ids;
+    }
+
+    entity::HostType entityHostType = entity::HostType::DOMAIN;
+    if (entityHostTypeString == "local") {
+        entityHostType = entity::HostType::LOCAL;
+    } else if (entityHostTypeString == "avatar") {
+        entityHostType = entity::HostType::AVATAR;
+    }
+
+    _activityTracking.addedEntityCount += positions.size();
+
+    // shared preparation, mirroring addEntityInternal
+    EntityItemProperties propertiesWithSimID = properties;
+    propertiesWithSimID.setEntityHostType(entityHostType);
+    if (entityHostType == entity::HostType::AVATAR) {
+        propertiesWithSimID.setOwningAvatarID(AVATAR_SELF_ID);
+    } else if (entityHostType == entity::HostType::LOCAL) {
+        // For now, local entities are always collisionless
+        propertiesWithSimID.setCollisionless(true);
+    }
+    auto nodeList = DependencyManager::get<NodeList>();
+    propertiesWithSimID.setLastEditedBy(nodeList->getSessionUUID());
+
+    bool scalesWithParent = propertiesWithSimID.getScalesWithParent();
+    propertiesWithSimID = convertPropertiesFromScriptSemantics(propertiesWithSimID, scalesWithParent);
+    propertiesWithSimID.setDimensionsInitialized(properties.dimensionsChanged());
+    synchronizeEditedGrabProperties(propertiesWithSimID, QString());
+
+    // build the whole batch, then insert it with one tree pass
+    QVector<QPair<EntityItemID, EntityItemProperties>> entitiesToAdd;
+    entitiesToAdd.reserve(positions.size());
+    for (const auto& position : positions) {
+        EntityItemProperties cloneProperties = propertiesWithSimID;
+        cloneProperties.setPosition(position);
+        entitiesToAdd.append({ EntityItemID(QUuid::createUuid()), cloneProperties });
+    }
+
+    QVector<EntityItemPointer> added;
+    _entityTree->withWriteLock([&] {
+        added = _entityTree->addEntities(entitiesToAdd);
+    });
+
+    for (const auto& entity : added) {
+        ids.append(entity->getEntityItemID());
+        if (entityHostType == entity::HostType::DOMAIN) {
+            // domain clones still announce themselves to the entity server individually
+            queueEntityMessage(PacketType::EntityAdd, entity->getEntityItemID(), entity->getProperties());
+        }
+    }
+
+    return ids;
+}
+
 QUuid EntityScriptingInterface::addEntityInternal(const EntityItemProperties& properties, entity::HostType entityHostType) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
@@ -657,6 +718,29 @@ struct EntityPropertiesResult {
 
 // Static method to make sure that we have the right script engine.
 // Using sender() or QtScriptable::engine() does not work for classes used by multiple threads (script-engines)
+QScriptValue EntityScriptingInterface::getEntityProperties(QScriptContext* context, QScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_ID = 0;
+    const int ARGUMENT_EXTENDED_DESIRED_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityID = qscriptvalue_cast<QUuid>(context->argument(ARGUMENT_ENTITY_ID));
+
+    // Route through the desired/pseudo-property aware path, so a script asking
+    // for a couple of fields (including pseudo properties like "boundingBox")
+    // only materializes those instead of building every property.
+    QVector<QUuid> entityIDs;
+    entityIDs.append(entityID);
+    QScriptValue results = entityScriptingInterface->getMultipleEntityPropertiesInternal(
+        engine, entityIDs, context->argument(ARGUMENT_EXTENDED_DESIRED_PROPERTIES));
+
+    if (results.property("length").toInt32() == 1) {
+        return results.property(0);
+    }
+
+    // unknown entity: preserve the legacy empty-properties result
+    return engine->toScriptValue(EntityItemProperties());
+}
+
 QScriptValue EntityScriptingInterface::getMultipleEntityProperties(QScriptContext* context, QScriptEngine* engine) {
     const int ARGUMENT_ENTITY_IDS = 0;
     const int ARGUMENT_EXTENDED_DESIRED_PROPERTIES = 1;
@@ -666,6 +750,126 @@ QScriptValue EntityScriptingInterface::getMultipleEntityProperties(QScriptContex
     return entityScriptingInterface->getMultipleEntityPropertiesInternal(engine, entityIDs, context->argument(ARGUMENT_EXTENDED_DESIRED_PROPERTIES));
 }
 
+QScriptValue EntityScriptingInterface::queryEntities(QScriptContext* context, QScriptEngine* engine) {
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+
+    const int FILTER_ARG_INDEX = 0;
+    const int PROPERTIES_ARG_INDEX = 1;
+    QVariantMap filter = context->argument(FILTER_ARG_INDEX).toVariant().toMap();
+
+    QStringList properties;
+    auto propertiesValue = context->argument(PROPERTIES_ARG_INDEX);
+    if (propertiesValue.isArray()) {
+        int length = propertiesValue.property("length").toInt32();
+        for (int i = 0; i < length; i++) {
+            properties.append(propertiesValue.property(i).toString());
+        }
+    } else if (propertiesValue.isString()) {
+        properties.append(propertiesValue.toString());
+    }
+
+    return entityScriptingInterface->queryEntitiesInternal(engine, filter, properties);
+}
+
+// packs a float buffer into a typed array over an ArrayBuffer; falls back to the raw buffer
+// value if the engine has no typed array classes registered
+static QScriptValue makeFloat32Array(QScriptEngine* engine, const QByteArray& bytes) {
+    QScriptValue buffer = qScriptValueFromValue(engine, bytes);
+    QScriptValue float32ArrayCtor = engine->globalObject().property("Float32Array");
+    if (float32ArrayCtor.isFunction()) {
+        return float32ArrayCtor.construct(QScriptValueList { buffer });
+    }
+    return buffer;
+}
+
+QScriptValue EntityScriptingInterface::queryEntitiesInternal(QScriptEngine* engine, const QVariantMap& filter,
+                                                             const QStringList& properties) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    bool wantPosition = properties.contains("position");
+    bool wantRotation = properties.contains("rotation");
+    bool wantDimensions = properties.contains("dimensions");
+    bool wantVelocity = properties.contains("velocity");
+    bool wantName = properties.contains("name");
+    bool wantType = properties.contains("type");
+
+    glm::vec3 center = qMapToVec3(filter.value("position"));
+    float radius = filter.value("radius").toFloat();
+
+    QVector<QUuid> ids;
+    QByteArray positions, rotations, dimensions, velocities;
+    QStringList names, types;
+
+    if (_entityTree && radius > 0.0f) {
+        unsigned int searchFilter = PickFilter::getBitMask(PickFilter::FlagBit::DOMAIN_ENTITIES) | PickFilter::getBitMask(PickFilter::FlagBit::AVATAR_ENTITIES);
+        _entityTree->withReadLock([&] {
+            if (filter.contains("type")) {
+                EntityTypes::EntityType type = EntityTypes::getEntityTypeFromName(filter.value("type").toString());
+                _entityTree->evalEntitiesInSphereWithType(center, radius, type, PickFilter(searchFilter), ids);
+            } else if (filter.contains("name")) {
+                bool caseSensitive = filter.value("caseSensitive", true).toBool();
+                _entityTree->evalEntitiesInSphereWithName(center, radius, filter.value("name").toString(),
+                                                         caseSensitive, PickFilter(searchFilter), ids);
+            } else {
+                _entityTree->evalEntitiesInSphere(center, radius, PickFilter(searchFilter), ids);
+            }
+
+            // everything is gathered in this same pass under the same read lock, straight off
+            // the entities - no EntityItemProperties objects are ever built
+            int count = ids.size();
+            if (wantPosition) { positions.resize(count * 3 * (int)sizeof(float)); }
+            if (wantRotation) { rotations.resize(count * 4 * (int)sizeof(float)); }
+            if (wantDimensions) { dimensions.resize(count * 3 * (int)sizeof(float)); }
+            if (wantVelocity) { velocities.resize(count * 3 * (int)sizeof(float)); }
+
+            for (int i = 0; i < count; i++) {
+                EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(ids[i]));
+                if (!entity) {
+                    continue;
+                }
+                if (wantPosition) {
+                    glm::vec3 position = entity->getWorldPosition();
+                    memcpy(positions.data() + i * 3 * sizeof(float), &position, 3 * sizeof(float));
+                }
+                if (wantRotation) {
+                    glm::quat rotation = entity->getWorldOrientation();
+                    float packed[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+                    memcpy(rotations.data() + i * 4 * sizeof(float), packed, 4 * sizeof(float));
+                }
+                if (wantDimensions) {
+                    glm::vec3 entityDimensions = entity->getScaledDimensions();
+                    memcpy(dimensions.data() + i * 3 * sizeof(float), &entityDimensions, 3 * sizeof(float));
+                }
+                if (wantVelocity) {
+                    glm::vec3 velocity = entity->getWorldVelocity();
+                    memcpy(velocities.data() + i * 3 * sizeof(float), &velocity, 3 * sizeof(float));
+                }
+                if (wantName) {
+                    names.append(entity->getName());
+                }
+                if (wantType) {
+                    types.append(EntityTypes::getEntityTypeName(entity->getType()));
+                }
+            }
+        });
+    }
+
+    QScriptValue result = engine->newObject();
+    result.setProperty("count", ids.size());
+    QScriptValue idArray = engine->newArray(ids.size());
+    for (int i = 0; i < ids.size(); i++) {
+        idArray.setProperty(i, ids[i].toString());
+    }
+    result.setProperty("ids", idArray);
+    if (wantPosition) { result.setProperty("position", makeFloat32Array(engine, positions)); }
+    if (wantRotation) { result.setProperty("rotation", makeFloat32Array(engine, rotations)); }
+    if (wantDimensions) { result.setProperty("dimensions", makeFloat32Array(engine, dimensions)); }
+    if (wantVelocity) { result.setProperty("velocity", makeFloat32Array(engine, velocities)); }
+    if (wantName) { result.setProperty("name", qScriptValueFromSequence(engine, names)); }
+    if (wantType) { result.setProperty("type", qScriptValueFromSequence(engine, types)); }
+    return result;
+}
+
 QScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(QScriptEngine* engine, QVector<QUuid> entityIDs, const QScriptValue& extendedDesiredProperties) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
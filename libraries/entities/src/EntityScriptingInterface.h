@@ -201,8 +201,33 @@ public:
      * print("Nearby entity names: " + JSON.stringify(propertySets));
     */
     static QScriptValue getMultipleEntityProperties(QScriptContext* context, QScriptEngine* engine);
+
+    // script-facing single-entity getter, routed through the desired/pseudo-property
+    // aware path so partial requests only materialize what was asked for
+    static QScriptValue getEntityProperties(QScriptContext* context, QScriptEngine* engine);
     QScriptValue getMultipleEntityPropertiesInternal(QScriptEngine* engine, QVector<QUuid> entityIDs, const QScriptValue& extendedDesiredProperties);
 
+    /**jsdoc
+     * Finds entities matching a filter and returns the requested properties for all of them in
+     * one packed result, materialized in a single pass over the tree. Vector and quaternion
+     * properties come back as <code>Float32Array</code>s (3 or 4 components per entity, in the
+     * same order as <code>ids</code>), so no per-entity objects are created.
+     * @function Entities.queryEntities
+     * @param {object} filter - <code>{ position, radius }</code> plus optionally
+     *     <code>type</code> (entity type name) or <code>name</code> (exact entity name, with
+     *     optional <code>caseSensitive</code>).
+     * @param {string[]} properties - Any of <code>"position"</code>, <code>"rotation"</code>,
+     *     <code>"dimensions"</code>, <code>"velocity"</code>, <code>"name"</code>,
+     *     <code>"type"</code>.
+     * @returns {object} <code>{ count, ids, ... }</code> with one packed entry per requested
+     *     property.
+     * @example <caption>Positions of all nearby entities, packed.</caption>
+     * var result = Entities.queryEntities({ position: MyAvatar.position, radius: 50 }, ["position"]);
+     * print("Found " + result.count + " entities");
+     */
+    static QScriptValue queryEntities(QScriptContext* context, QScriptEngine* engine);
+    QScriptValue queryEntitiesInternal(QScriptEngine* engine, const QVariantMap& filter, const QStringList& properties);
+
     QUuid addEntityInternal(const EntityItemProperties& properties, entity::HostType entityHostType);
 
 public slots:
@@ -347,6 +372,19 @@ public slots:
         return addEntityInternal(properties, entityHostType);
     }
 
+    /**jsdoc
+     * Adds many copies of one entity in a single batched tree pass - the fast
+     * path for scripted replication (crowd props, tile floors, debris). All
+     * clones share the given properties except position.
+     * @function Entities.addEntityClones
+     * @param {Entities.EntityProperties} properties - The properties shared by every clone.
+     * @param {Vec3[]} positions - One position per clone to create.
+     * @param {Entities.EntityHostType} [entityHostType="domain"] - The type of entities to create.
+     * @returns {Uuid[]} The IDs of the entities that were successfully created.
+     */
+    Q_INVOKABLE QVector<QUuid> addEntityClones(const EntityItemProperties& properties, const QVector<glm::vec3>& positions,
+                                               const QString& entityHostTypeString = QString("domain"));
+
     /// temporary method until addEntity can be used from QJSEngine
     /// Deliberately not adding jsdoc, only used internally.
     // FIXME: Deprecate and remove from the API.
@@ -70,28 +70,32 @@ void EntitySimulation::prepareEntityForDelete(EntityItemPointer entity) {
 void EntitySimulation::expireMortalEntities(uint64_t now) {
     if (now > _nextExpiry) {
         PROFILE_RANGE_EX(simulation_physics, "ExpireMortals", 0xffff00ff, (uint64_t)_mortalEntities.size());
-        // only search for expired entities if we expect to find one
-        _nextExpiry = std::numeric_limits<uint64_t>::max();
         QMutexLocker lock(&_mutex);
-        SetOfEntities::iterator itemItr = _mortalEntities.begin();
-        while (itemItr != _mortalEntities.end()) {
-            EntityItemPointer entity = *itemItr;
+
+        // only entities whose heap key is due are touched; stale keys (lifetime
+        // changed since they were queued) are re-keyed as they surface
+        while (!_mortalExpiryQueue.empty() && _mortalExpiryQueue.top().first < now) {
+            EntityItemPointer entity = _mortalExpiryQueue.top().second.lock();
+            _mortalExpiryQueue.pop();
+
+            if (!entity || !_mortalEntities.contains(entity)) {
+                // removed from the simulation, or no longer mortal
+                continue;
+            }
+
             uint64_t expiry = entity->getExpiry();
             if (expiry < now) {
-                itemItr = _mortalEntities.erase(itemItr);
+                _mortalEntities.remove(entity);
                 entity->die();
                 prepareEntityForDelete(entity);
             } else {
-                if (expiry < _nextExpiry) {
-                    // remember the smallest _nextExpiry so we know when to start the next search
-                    _nextExpiry = expiry;
-                }
-                ++itemItr;
+                // the lifetime was extended since this entry was queued
+                _mortalExpiryQueue.emplace(expiry, entity);
             }
         }
-        if (_mortalEntities.size() < 1) {
-            _nextExpiry = -1;
-        }
+
+        _nextExpiry = _mortalExpiryQueue.empty() ? std::numeric_limits<uint64_t>::max()
+                                                 : _mortalExpiryQueue.top().first;
     }
 }
 
@@ -149,6 +153,7 @@ void EntitySimulation::addEntityToInternalLists(EntityItemPointer entity) {
     if (entity->isMortal()) {
         _mortalEntities.insert(entity);
         uint64_t expiry = entity->getExpiry();
+        _mortalExpiryQueue.emplace(expiry, entity);
         if (expiry < _nextExpiry) {
             _nextExpiry = expiry;
         }
@@ -195,6 +200,7 @@ void EntitySimulation::processChangedEntity(const EntityItemPointer& entity) {
             if (entity->isMortal()) {
                 _mortalEntities.insert(entity);
                 uint64_t expiry = entity->getExpiry();
+                _mortalExpiryQueue.emplace(expiry, entity);
                 if (expiry < _nextExpiry) {
                     _nextExpiry = expiry;
                 }
@@ -222,6 +228,7 @@ void EntitySimulation::clearEntities() {
     _deadEntitiesToRemoveFromTree.clear();
     _entitiesToUpdate.clear();
     _mortalEntities.clear();
+    _mortalExpiryQueue = decltype(_mortalExpiryQueue)();
     _nextExpiry = std::numeric_limits<uint64_t>::max();
 }
 
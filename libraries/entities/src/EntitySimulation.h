@@ -13,6 +13,7 @@
 #define hifi_EntitySimulation_h
 
 #include <limits>
+#include <queue>
 #include <unordered_set>
 
 #include <QtCore/QObject>
@@ -105,6 +106,15 @@ private:
     SetOfEntities _allEntities; // tracks all entities added the simulation
     SetOfEntities _entitiesToUpdate; // entities that need to call EntityItem::update()
     SetOfEntities _mortalEntities; // entities that have an expiry
+
+    // min-heap of (expiry, entity), so expiring mortals only ever touches the
+    // entities that are actually due; entries go stale when an entity's
+    // lifetime changes and are lazily re-keyed as they surface
+    using ExpiryEntry = std::pair<uint64_t, EntityItemWeakPointer>;
+    struct ExpiresLater {
+        bool operator()(const ExpiryEntry& a, const ExpiryEntry& b) const { return a.first > b.first; }
+    };
+    std::priority_queue<ExpiryEntry, std::vector<ExpiryEntry>, ExpiresLater> _mortalExpiryQueue;
     uint64_t _nextExpiry;
 
     // back pointer to EntityTree structure
@@ -10,6 +10,8 @@
 //
 
 #include "EntityTree.h"
+
+#include <unordered_set>
 #include <QtCore/QDateTime>
 #include <QtCore/QQueue>
 #include <openssl/err.h>
@@ -31,6 +33,9 @@
 #include "EntitySimulation.h"
 #include "VariantMapToScriptValue.h"
 
+#include <DirtyOctreeElementOperator.h>
+
+#include "AddEntitiesOperator.h"
 #include "AddEntityOperator.h"
 #include "UpdateEntityOperator.h"
 #include "QVariantGLM.h"
@@ -111,6 +116,7 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
             }
         }
         _entityMap.swap(savedEntities);
+        _entityMapEpoch.fetch_add(1, std::memory_order_release);
     });
 
     resetClientEditStats();
@@ -139,6 +145,7 @@ void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
     }
     QHash<EntityItemID, EntityItemPointer> localMap;
     localMap.swap(_entityMap);
+    _entityMapEpoch.fetch_add(1, std::memory_order_release);
     this->withWriteLock([&] {
         foreach(EntityItemPointer entity, localMap) {
             EntityTreeElementPointer element = entity->getElement();
@@ -287,6 +294,8 @@ bool EntityTree::handlesEditPacketType(PacketType packetType) const {
 
 /// Adds a new entity item to the tree
 void EntityTree::postAddEntity(EntityItemPointer entity) {
+    trackChangedEntity(entity);
+
     assert(entity);
 
     if (getIsServer()) {
@@ -460,8 +469,16 @@ bool EntityTree::updateEntity(EntityItemPointer entity, const EntityItemProperti
         } else {
             newQueryAACube = entity->getQueryAACube();
         }
-        UpdateEntityOperator theOperator(getThisPointer(), containingElement, entity, newQueryAACube);
-        recurseTreeWithOperator(&theOperator);
+        if (containingElement->bestFitBounds(newQueryAACube)) {
+            // the entity stays in its element; just mark the path dirty for scene deltas
+            DirtyOctreeElementOperator dirtyOperator(containingElement);
+            recurseTreeWithOperator(&dirtyOperator);
+        } else {
+            // defer the octree re-insertion: properties apply now, and all entities
+            // that outgrew their element this tick move in one batched pass
+            std::lock_guard<std::mutex> lock(_pendingReinsertionsLock);
+            _pendingReinsertions.emplace_back(entity, newQueryAACube);
+        }
         if (entity->setProperties(properties)) {
             emit editingEntityPointer(entity);
         }
@@ -533,9 +550,310 @@ bool EntityTree::updateEntity(EntityItemPointer entity, const EntityItemProperti
         return false;
     }
 
+    trackChangedEntity(entity);
+
+    return true;
+}
+
+void EntityTree::trackChangedEntity(const EntityItemPointer& entity) {
+    const size_t CHANGED_ENTITY_LOG_CAPACITY = 4096;
+
+    std::lock_guard<std::mutex> lock(_changedEntityLogLock);
+    _changedEntityLog.emplace_back(usecTimestampNow(), entity);
+    while (_changedEntityLog.size() > CHANGED_ENTITY_LOG_CAPACITY) {
+        _changedEntityLogTrimmedTime = _changedEntityLog.front().first;
+        _changedEntityLog.pop_front();
+    }
+}
+
+bool EntityTree::getChangedEntitiesSince(uint64_t sinceTime, std::vector<EntityItemPointer>& changedEntities) {
+    std::lock_guard<std::mutex> lock(_changedEntityLogLock);
+
+    // the log must reach back past the requested window to be authoritative
+    if (sinceTime == 0 || sinceTime < _changedEntityLogTrimmedTime) {
+        return false;
+    }
+
+    for (const auto& entry : _changedEntityLog) {
+        if (entry.first >= sinceTime) {
+            EntityItemPointer entity = entry.second.lock();
+            if (entity) {
+                changedEntities.push_back(entity);
+            }
+        }
+    }
+    return true;
+}
+
+//
+// Binary scene sidecar: a flat, memory-mappable file of full-entity records.
+//
+//      char[4]  magic "HFES"
+//      quint32  version
+//      quint32  entity count
+//      then per entity: quint32 blob size, blob (appendEntityData encoding)
+//
+// Loading maps the file and parses records in place, with no gunzip and no
+// JSON document allocation.
+//
+static const char BINARY_SCENE_MAGIC[4] = { 'H', 'F', 'E', 'S' };
+static const quint32 BINARY_SCENE_VERSION = 1;
+
+bool EntityTree::writeBinaryScene(const QString& filename) {
+    QFile file(filename + ".partial");
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    // snapshot the entity list so serialization runs without the map lock
+    QVector<EntityItemPointer> entities;
+    {
+        QReadLocker locker(&_entityMapLock);
+        entities.reserve(_entityMap.size());
+        for (auto it = _entityMap.constBegin(); it != _entityMap.constEnd(); ++it) {
+            entities.append(it.value());
+        }
+    }
+
+    file.write(BINARY_SCENE_MAGIC, sizeof(BINARY_SCENE_MAGIC));
+    quint32 version = BINARY_SCENE_VERSION;
+    file.write((const char*)&version, sizeof(version));
+    quint32 count = 0;
+    qint64 countPosition = file.pos();
+    file.write((const char*)&count, sizeof(count));
+
+    for (const auto& entity : entities) {
+        PooledOctreePacketData packetData;
+        EncodeBitstreamParams params;
+        EntityTreeElementExtraEncodeDataPointer extra { nullptr };
+        if (entity->appendEntityData(packetData.get(), params, extra) != OctreeElement::COMPLETED) {
+            qCWarning(entities) << "binary scene: entity" << entity->getEntityItemID() << "too large, skipping";
+            continue;
+        }
+        quint32 blobSize = (quint32)packetData->getUncompressedSize();
+        file.write((const char*)&blobSize, sizeof(blobSize));
+        file.write((const char*)packetData->getUncompressedData(), blobSize);
+        ++count;
+    }
+
+    file.seek(countPosition);
+    file.write((const char*)&count, sizeof(count));
+    file.close();
+
+    // atomically replace any previous scene file
+    QFile::remove(filename);
+    return QFile::rename(filename + ".partial", filename);
+}
+
+bool EntityTree::readBinaryScene(const QString& filename) {
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const uchar* mapped = file.map(0, file.size());
+    if (!mapped) {
+        return false;
+    }
+    const uchar* cursor = mapped;
+    const uchar* end = mapped + file.size();
+
+    if (end - cursor < (ptrdiff_t)(sizeof(BINARY_SCENE_MAGIC) + 2 * sizeof(quint32)) ||
+        memcmp(cursor, BINARY_SCENE_MAGIC, sizeof(BINARY_SCENE_MAGIC)) != 0) {
+        return false;
+    }
+    cursor += sizeof(BINARY_SCENE_MAGIC);
+
+    quint32 version;
+    memcpy(&version, cursor, sizeof(version));
+    cursor += sizeof(version);
+    if (version != BINARY_SCENE_VERSION) {
+        return false;
+    }
+
+    quint32 count;
+    memcpy(&count, cursor, sizeof(count));
+    cursor += sizeof(count);
+
+    quint32 numRead = 0;
+    for (; numRead < count; ++numRead) {
+        if (end - cursor < (ptrdiff_t)sizeof(quint32)) {
+            break;
+        }
+        quint32 blobSize;
+        memcpy(&blobSize, cursor, sizeof(blobSize));
+        cursor += sizeof(blobSize);
+        if (end - cursor < (ptrdiff_t)blobSize) {
+            break;
+        }
+
+        EntityTypes::EntityType type;
+        QUuid id;
+        EntityTypes::extractEntityTypeAndID(cursor, blobSize, type, id);
+
+        EntityItemPointer scratchEntity = EntityTypes::constructEntityItem(type, EntityItemID(id), EntityItemProperties());
+        if (scratchEntity) {
+            ReadBitstreamToTreeParams args;
+            scratchEntity->readEntityDataFromBuffer(cursor, blobSize, args);
+            addEntity(EntityItemID(id), scratchEntity->getProperties());
+        }
+        cursor += blobSize;
+    }
+
+    if (numRead != count) {
+        qCWarning(entities) << "binary scene" << filename << "truncated at entity" << numRead << "of" << count;
+    } else {
+        qCDebug(entities) << "loaded" << numRead << "entities from binary scene" << filename;
+    }
+    return numRead == count;
+}
+
+static const quint8 JOURNAL_RECORD_EDIT = 1;
+static const quint8 JOURNAL_RECORD_DELETE = 2;
+
+bool EntityTree::appendJournalDelta(QIODevice& device, quint64 sinceTime) {
+    std::vector<EntityItemPointer> changedEntities;
+    if (!getChangedEntitiesSince(sinceTime, changedEntities)) {
+        // the change log was trimmed past the window; a full snapshot is required
+        return false;
+    }
+
+    QDataStream stream(&device);
+
+    // deletes since the last snapshot
+    {
+        QReadLocker locker(&_recentlyDeletedEntitiesLock);
+        for (auto it = _recentlyDeletedEntityItemIDs.constBegin(); it != _recentlyDeletedEntityItemIDs.constEnd(); ++it) {
+            if (it.key() >= sinceTime) {
+                stream << JOURNAL_RECORD_DELETE << it.value();
+            }
+        }
+    }
+
+    // changed entities, one full-entity record each (the log may repeat an entity)
+    std::unordered_set<const EntityItem*> seenEntities;
+    for (const auto& entity : changedEntities) {
+        if (!seenEntities.insert(entity.get()).second) {
+            continue;
+        }
+
+        PooledOctreePacketData packetData;
+        EncodeBitstreamParams params;
+        EntityTreeElementExtraEncodeDataPointer extra { nullptr };
+        if (entity->appendEntityData(packetData.get(), params, extra) != OctreeElement::COMPLETED) {
+            // this entity's payload doesn't fit a single record; take a full snapshot
+            return false;
+        }
+        stream << JOURNAL_RECORD_EDIT
+               << QByteArray((const char*)packetData->getUncompressedData(), packetData->getUncompressedSize());
+    }
+
+    return stream.status() == QDataStream::Ok;
+}
+
+bool EntityTree::replayJournal(QIODevice& device) {
+    QDataStream stream(&device);
+    int numEdits = 0;
+    int numDeletes = 0;
+
+    while (!stream.atEnd()) {
+        quint8 recordType;
+        stream >> recordType;
+
+        if (recordType == JOURNAL_RECORD_DELETE) {
+            QUuid id;
+            stream >> id;
+            if (stream.status() != QDataStream::Ok) {
+                return false;
+            }
+            if (findEntityByEntityItemID(EntityItemID(id))) {
+                deleteEntity(EntityItemID(id), true, true);
+            }
+            ++numDeletes;
+        } else if (recordType == JOURNAL_RECORD_EDIT) {
+            QByteArray blob;
+            stream >> blob;
+            if (stream.status() != QDataStream::Ok) {
+                return false;
+            }
+
+            EntityTypes::EntityType type;
+            QUuid id;
+            EntityTypes::extractEntityTypeAndID((const unsigned char*)blob.constData(), blob.size(), type, id);
+
+            EntityItemPointer scratchEntity = EntityTypes::constructEntityItem(type, EntityItemID(id), EntityItemProperties());
+            if (!scratchEntity) {
+                return false;
+            }
+            ReadBitstreamToTreeParams args;
+            scratchEntity->readEntityDataFromBuffer((const unsigned char*)blob.constData(), blob.size(), args);
+
+            EntityItemProperties properties = scratchEntity->getProperties();
+            if (findEntityByEntityItemID(EntityItemID(id))) {
+                updateEntity(EntityItemID(id), properties);
+            } else {
+                addEntity(EntityItemID(id), properties);
+            }
+            ++numEdits;
+        } else {
+            qCWarning(entities) << "EntityTree::replayJournal unknown record type" << recordType;
+            return false;
+        }
+    }
+
+    qCDebug(entities) << "replayed entity journal:" << numEdits << "edits," << numDeletes << "deletes";
     return true;
 }
 
+QVector<EntityItemPointer> EntityTree::addEntities(const QVector<QPair<EntityItemID, EntityItemProperties>>& entitiesToAdd) {
+    QVector<EntityItemPointer> newEntities;
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    if (!nodeList) {
+        qCDebug(entities) << "EntityTree::addEntities -- can't get NodeList";
+        return newEntities;
+    }
+
+    bool canRez = !getIsClient() || nodeList->getThisNodeCanRez() || nodeList->getThisNodeCanRezTmp() ||
+        nodeList->getThisNodeCanRezCertified() || nodeList->getThisNodeCanRezTmpCertified() || _serverlessDomain;
+
+    // validate and construct every entity before touching the tree
+    for (const auto& entry : entitiesToAdd) {
+        const EntityItemID& entityID = entry.first;
+        EntityItemProperties props = entry.second;
+
+        if (props.getEntityHostType() == entity::HostType::DOMAIN && !canRez) {
+            continue;
+        }
+
+        if (getContainingElement(entityID)) {
+            qCWarning(entities) << "EntityTree::addEntities() on existing entity item with entityID=" << entityID;
+            continue;
+        }
+
+        bool recordCreationTime = (props.getCreated() == UNKNOWN_CREATED_TIME);
+        EntityItemPointer entity = EntityTypes::constructEntityItem(props.getType(), entityID, props);
+        if (entity) {
+            if (recordCreationTime) {
+                entity->recordCreationTime();
+            }
+            newEntities.append(entity);
+        }
+    }
+
+    if (!newEntities.isEmpty()) {
+        // one recursion stores every entity in its best-fit element
+        AddEntitiesOperator theOperator(getThisPointer(), newEntities);
+        recurseTreeWithOperator(&theOperator);
+
+        for (const auto& entity : newEntities) {
+            postAddEntity(entity);
+        }
+    }
+
+    return newEntities;
+}
+
 EntityItemPointer EntityTree::addEntity(const EntityItemID& entityID, const EntityItemProperties& properties, bool isClone) {
     EntityItemProperties props = properties;
 
@@ -1034,9 +1352,92 @@ bool evalInSphereOperation(const OctreeElementPointer& element, void* extraData)
 }
 
 // NOTE: assumes caller has handled locking
+static const float ENTITY_GRID_CELL_SIZE = 16.0f;
+
+static uint64_t entityGridCellKey(int x, int y, int z) {
+    const uint64_t MASK_21_BITS = (1ull << 21) - 1;
+    return ((uint64_t)((uint64_t)x & MASK_21_BITS) << 42) |
+           ((uint64_t)((uint64_t)y & MASK_21_BITS) << 21) |
+           (uint64_t)((uint64_t)z & MASK_21_BITS);
+}
+
+void EntityTree::rebuildElementGridIfNeeded() const {
+    EntityTreeElementPointer root = std::static_pointer_cast<EntityTreeElement>(getRoot());
+    quint64 stamp = root->getLastChanged();
+    if (stamp == _elementGridStamp) {
+        return;
+    }
+
+    _elementGrid.clear();
+    const_cast<EntityTree*>(this)->recurseTreeWithOperation([](const OctreeElementPointer& element, void* extraData) {
+        auto grid = static_cast<std::unordered_map<uint64_t, std::vector<EntityTreeElementPointer>>*>(extraData);
+        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+        if (entityTreeElement->hasContent()) {
+            AACube cube = entityTreeElement->getAACube();
+            glm::vec3 minimum = cube.getCorner();
+            glm::vec3 maximum = cube.calcTopFarLeft();
+            int minX = (int)floorf(minimum.x / ENTITY_GRID_CELL_SIZE);
+            int minY = (int)floorf(minimum.y / ENTITY_GRID_CELL_SIZE);
+            int minZ = (int)floorf(minimum.z / ENTITY_GRID_CELL_SIZE);
+            int maxX = (int)floorf(maximum.x / ENTITY_GRID_CELL_SIZE);
+            int maxY = (int)floorf(maximum.y / ENTITY_GRID_CELL_SIZE);
+            int maxZ = (int)floorf(maximum.z / ENTITY_GRID_CELL_SIZE);
+            for (int x = minX; x <= maxX; ++x) {
+                for (int y = minY; y <= maxY; ++y) {
+                    for (int z = minZ; z <= maxZ; ++z) {
+                        (*grid)[entityGridCellKey(x, y, z)].push_back(entityTreeElement);
+                    }
+                }
+            }
+        }
+        return true;
+    }, &_elementGrid);
+
+    _elementGridStamp = stamp;
+}
+
+void EntityTree::forEachGridElementIntersecting(const AABox& box,
+        std::function<void(const EntityTreeElementPointer&)> f) const {
+    std::lock_guard<std::mutex> lock(_elementGridLock);
+    rebuildElementGridIfNeeded();
+
+    glm::vec3 minimum = box.getMinimumPoint();
+    glm::vec3 maximum = box.getMaximumPoint();
+    int minX = (int)floorf(minimum.x / ENTITY_GRID_CELL_SIZE);
+    int minY = (int)floorf(minimum.y / ENTITY_GRID_CELL_SIZE);
+    int minZ = (int)floorf(minimum.z / ENTITY_GRID_CELL_SIZE);
+    int maxX = (int)floorf(maximum.x / ENTITY_GRID_CELL_SIZE);
+    int maxY = (int)floorf(maximum.y / ENTITY_GRID_CELL_SIZE);
+    int maxZ = (int)floorf(maximum.z / ENTITY_GRID_CELL_SIZE);
+
+    // an element spanning several cells is visited once
+    std::unordered_set<const EntityTreeElement*> visited;
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            for (int z = minZ; z <= maxZ; ++z) {
+                auto it = _elementGrid.find(entityGridCellKey(x, y, z));
+                if (it == _elementGrid.end()) {
+                    continue;
+                }
+                for (const auto& element : it->second) {
+                    if (visited.insert(element.get()).second) {
+                        f(element);
+                    }
+                }
+            }
+        }
+    }
+}
+
 void EntityTree::evalEntitiesInSphere(const glm::vec3& center, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
     FindEntitiesInSphereArgs args = { center, radius, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereOperation, &args);
+    AABox queryBox(center - glm::vec3(radius), glm::vec3(2.0f * radius));
+    forEachGridElementIntersecting(queryBox, [&](const EntityTreeElementPointer& element) {
+        glm::vec3 penetration;
+        if (element->getAACube().findSpherePenetration(args.position, args.targetRadius, penetration)) {
+            element->evalEntitiesInSphere(args.position, args.targetRadius, args.searchFilter, args.entities);
+        }
+    });
     foundEntities.swap(args.entities);
 }
 
@@ -1134,7 +1535,11 @@ bool findInCubeOperation(const OctreeElementPointer& element, void* extraData) {
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
     FindEntitiesInCubeArgs args { cube, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(findInCubeOperation, &args);
+    forEachGridElementIntersecting(AABox(cube), [&](const EntityTreeElementPointer& element) {
+        if (element->getAACube().touches(args.cube)) {
+            element->evalEntitiesInCube(args.cube, args.searchFilter, args.entities);
+        }
+    });
     foundEntities.swap(args.entities);
 }
 
@@ -1162,7 +1567,11 @@ bool findInBoxOperation(const OctreeElementPointer& element, void* extraData) {
 void EntityTree::evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
     FindEntitiesInBoxArgs args { box, searchFilter, QVector<QUuid>() };
     // NOTE: This should use recursion, since this is a spatial operation
-    recurseTreeWithOperation(findInBoxOperation, &args);
+    forEachGridElementIntersecting(args.box, [&](const EntityTreeElementPointer& element) {
+        if (element->getAACube().touches(args.box)) {
+            element->evalEntitiesInBox(args.box, args.searchFilter, args.entities);
+        }
+    });
     // swap the two lists of entity pointers instead of copy
     foundEntities.swap(args.entities);
 }
@@ -1203,9 +1612,34 @@ EntityItemPointer EntityTree::findEntityByID(const QUuid& id) const {
 
 EntityItemPointer EntityTree::findEntityByEntityItemID(const EntityItemID& entityID) const {
     EntityItemPointer foundEntity = nullptr;
-    {
-        QReadLocker locker(&_entityMapLock);
-        foundEntity = _entityMap.value(entityID);
+
+    // fast path: resolve against the published snapshot when it is current,
+    // with no lock taken
+    quint64 epoch = _entityMapEpoch.load(std::memory_order_acquire);
+    auto snapshot = std::atomic_load(&_entityMapSnapshot);
+    if (snapshot && snapshot->epoch == epoch) {
+        foundEntity = snapshot->entities.value(entityID);
+    } else {
+        {
+            QReadLocker locker(&_entityMapLock);
+            foundEntity = _entityMap.value(entityID);
+        }
+
+        // republish a current snapshot for subsequent readers; skip if another
+        // reader is already doing it. The QHash copy is implicitly shared, so
+        // this is a refcount bump - writers detach under their write lock.
+        std::unique_lock<std::mutex> snapshotLock(_entityMapSnapshotLock, std::try_to_lock);
+        if (snapshotLock.owns_lock()) {
+            auto newSnapshot = std::make_shared<EntityMapSnapshot>();
+            // fetch the epoch before copying: if a change lands in between, the
+            // snapshot is labeled stale and simply goes unused
+            newSnapshot->epoch = _entityMapEpoch.load(std::memory_order_acquire);
+            {
+                QReadLocker locker(&_entityMapLock);
+                newSnapshot->entities = _entityMap;
+            }
+            std::atomic_store(&_entityMapSnapshot, std::shared_ptr<const EntityMapSnapshot>(newSnapshot));
+        }
     }
     if (foundEntity && !foundEntity->getElement()) {
         // special case to maintain legacy behavior:
@@ -2276,9 +2710,42 @@ void EntityTree::preUpdate() {
     });
 }
 
+void EntityTree::processPendingReinsertions() {
+    std::vector<std::pair<EntityItemWeakPointer, AACube>> pending;
+    {
+        std::lock_guard<std::mutex> lock(_pendingReinsertionsLock);
+        pending.swap(_pendingReinsertions);
+    }
+    if (pending.empty()) {
+        return;
+    }
+
+    // all deferred moves share one tree pass
+    MovingEntitiesOperator moveOperator;
+    for (auto& entry : pending) {
+        EntityItemPointer entity = entry.first.lock();
+        if (entity && entity->getElement()) {
+            moveOperator.addEntityToMoveList(entity, entry.second);
+        }
+    }
+    if (moveOperator.hasMovingEntities()) {
+        PerformanceTimer perfTimer("recurseTreeWithOperator");
+        // the operator restructures elements; our callers do not hold the tree lock (the
+        // baseline re-inserted inside the editor's withWriteLock), so take it here or the pass
+        // races the send threads' read-locked traversals
+        withWriteLock([&] {
+            recurseTreeWithOperator(&moveOperator);
+        });
+    }
+}
+
 void EntityTree::update(bool simulate) {
     PROFILE_RANGE(simulation_physics, "UpdateTree");
     PerformanceTimer perfTimer("updateTree");
+
+    // re-insert entities whose edits moved them out of their element
+    processPendingReinsertions();
+
     if (simulate && _simulation) {
         withWriteLock([&] {
             _simulation->updateEntities();
@@ -2508,11 +2975,13 @@ void EntityTree::addEntityMapEntry(EntityItemPointer entity) {
         return;
     }
     _entityMap.insert(id, entity);
+    _entityMapEpoch.fetch_add(1, std::memory_order_release);
 }
 
 void EntityTree::clearEntityMapEntry(const EntityItemID& id) {
     QWriteLocker locker(&_entityMapLock);
     _entityMap.remove(id);
+    _entityMapEpoch.fetch_add(1, std::memory_order_release);
 }
 
 void EntityTree::debugDumpMap() {
@@ -3246,6 +3715,11 @@ void EntityTree::updateEntityQueryAACube(SpatiallyNestablePointer object, Entity
 
     if (moveOperator.hasMovingEntities()) {
         PerformanceTimer perfTimer("recurseTreeWithOperator");
-        recurseTreeWithOperator(&moveOperator);
+        // the operator restructures elements; our callers do not hold the tree lock (the
+        // baseline re-inserted inside the editor's withWriteLock), so take it here or the pass
+        // races the send threads' read-locked traversals
+        withWriteLock([&] {
+            recurseTreeWithOperator(&moveOperator);
+        });
     }
 }
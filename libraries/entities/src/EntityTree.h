@@ -12,6 +12,10 @@
 #ifndef hifi_EntityTree_h
 #define hifi_EntityTree_h
 
+#include <atomic>
+#include <deque>
+#include <mutex>
+
 #include <QSet>
 #include <QVector>
 
@@ -117,6 +121,26 @@ public:
     // The newer API...
     void postAddEntity(EntityItemPointer entityItem);
 
+    // Memory-mapped binary scene sidecar for fast startup
+    virtual bool writeBinaryScene(const QString& filename) override;
+    virtual bool readBinaryScene(const QString& filename) override;
+
+    // Append-only journal: deltas are the changed-entity log plus recent deletes
+    virtual bool supportsJournal() const override { return true; }
+    virtual bool appendJournalDelta(QIODevice& device, quint64 sinceTime) override;
+    virtual bool replayJournal(QIODevice& device) override;
+
+    // Bounded log of recently changed or added entities, feeding incremental
+    // scene deltas: a Repeat traversal whose window is covered by the log can
+    // queue changed entities directly instead of descending the octree.
+    void trackChangedEntity(const EntityItemPointer& entity);
+    bool getChangedEntitiesSince(uint64_t sinceTime, std::vector<EntityItemPointer>& changedEntities);
+
+    /// Batch add: validates and constructs every entity first, then stores the
+    /// whole batch in the tree with a single AddEntitiesOperator pass before
+    /// any per-entity notification runs. Returns the entities actually added.
+    QVector<EntityItemPointer> addEntities(const QVector<QPair<EntityItemID, EntityItemProperties>>& entitiesToAdd);
+
     EntityItemPointer addEntity(const EntityItemID& entityID, const EntityItemProperties& properties, bool isClone = false);
 
     // use this method if you only know the entityID
@@ -326,6 +350,41 @@ protected:
         _deletedEntityItemIDs << id;
     }
 
+    // Uniform-grid fast path for volume queries: a flat index of elements that
+    // carry entities, keyed by 16m grid cell and rebuilt lazily whenever the
+    // root element's change stamp moves (every structural change routes through
+    // an operator that marks the path to the root). Queries run the same
+    // per-element eval methods as the recursive path.
+    void rebuildElementGridIfNeeded() const;
+    void forEachGridElementIntersecting(const AABox& box, std::function<void(const EntityTreeElementPointer&)> f) const;
+
+    mutable std::mutex _elementGridLock;
+    mutable std::unordered_map<uint64_t, std::vector<EntityTreeElementPointer>> _elementGrid;
+    mutable quint64 _elementGridStamp { 0 };
+
+    // Edits whose entity outgrew its element are applied immediately but
+    // re-inserted into the octree in one batched pass per update tick.
+    void processPendingReinsertions();
+    std::mutex _pendingReinsertionsLock;
+    std::vector<std::pair<EntityItemWeakPointer, AACube>> _pendingReinsertions;
+
+    mutable std::mutex _changedEntityLogLock;
+    std::deque<std::pair<uint64_t, EntityItemWeakPointer>> _changedEntityLog;
+    uint64_t _changedEntityLogTrimmedTime { 0 };    // changes before this time have been dropped
+
+    // Change-epoch snapshots for lock-free reads: when the published snapshot's
+    // epoch matches the map epoch, findEntityByEntityItemID resolves against the
+    // immutable snapshot without taking _entityMapLock. Any map mutation bumps
+    // the epoch; readers then fall back to the locked map and one of them
+    // republishes a current snapshot.
+    struct EntityMapSnapshot {
+        quint64 epoch { 0 };
+        QHash<EntityItemID, EntityItemPointer> entities;
+    };
+    std::atomic<quint64> _entityMapEpoch { 1 };
+    mutable std::shared_ptr<const EntityMapSnapshot> _entityMapSnapshot;    // accessed via std::atomic_load/store
+    mutable std::mutex _entityMapSnapshotLock;
+
     mutable QReadWriteLock _entityMapLock;
     QHash<EntityItemID, EntityItemPointer> _entityMap;
 
@@ -54,26 +54,27 @@ QVariant readBinaryArray(QDataStream& in, int& position) {
     QVector<T> values;
     if ((int)QSysInfo::ByteOrder == (int)in.byteOrder()) {
         values.resize(arrayLength);
-        hifi::ByteArray arrayData;
         if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
             // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
+            // (resize leaves the bytes uninitialized; they are all overwritten below)
+            hifi::ByteArray compressed;
+            compressed.resize(sizeof(quint32) + compressedLength);
             *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
             in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
             position += compressedLength;
-            arrayData = qUncompress(compressed);
+            hifi::ByteArray arrayData = qUncompress(compressed);
             if (arrayData.isEmpty() ||
                 (unsigned int)arrayData.size() != (sizeof(T) * arrayLength)) { // answers empty byte array if corrupt
                 throw QString("corrupt fbx file");
             }
+            memcpy(values.data(), arrayData.constData(), arrayData.size());
         } else {
-            arrayData.resize(sizeof(T) * arrayLength);
-            position += sizeof(T) * arrayLength;
-            in.readRawData(arrayData.data(), arrayData.size());
-        }
-
-        if (arrayData.size() > 0) {
-            memcpy(&values[0], arrayData.constData(), arrayData.size());
+            // stream straight into the destination array - no staging byte array
+            int numBytes = (int)(sizeof(T) * arrayLength);
+            position += numBytes;
+            if (numBytes > 0 && in.readRawData(reinterpret_cast<char*>(values.data()), numBytes) != numBytes) {
+                throw QString("corrupt fbx file");
+            }
         }
     } else {
         values.reserve(arrayLength);
@@ -11,6 +11,8 @@
 
 #include "GLTFSerializer.h"
 
+#include <type_traits>
+
 #include <QtCore/QBuffer>
 #include <QtCore/QIODevice>
 #include <QtCore/QEventLoop>
@@ -1775,12 +1777,6 @@ void GLTFSerializer::setHFMMaterial(HFMMaterial& hfmMat, const GLTFMaterial& mat
 
 template <typename T, typename L>
 bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int count, QVector<L>& outarray, int accessorType) {
-    QDataStream blobstream(bin);
-    blobstream.setByteOrder(QDataStream::LittleEndian);
-    blobstream.setVersion(QDataStream::Qt_5_9);
-    blobstream.setFloatingPointPrecision(QDataStream::FloatingPointPrecision::SinglePrecision);
-    blobstream.skipRawData(byteOffset);
-
     int bufferCount = 0;
     switch (accessorType) {
         case GLTFAccessorType::SCALAR:
@@ -1806,23 +1802,34 @@ bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int c
             break;
         default:
             qWarning(modelformat) << "Unknown accessorType: " << accessorType;
-            blobstream.setDevice(nullptr);
             return false;
     }
-    for (int i = 0; i < count; ++i) {
-        for (int j = 0; j < bufferCount; ++j) {
-            if (!blobstream.atEnd()) {
-                T value;
-                blobstream >> value;
-                outarray.push_back(value);
-            } else {
-                blobstream.setDevice(nullptr);
-                return false;
-            }
-        }
+
+    // View the (little-endian) glTF buffer in place: identical component and
+    // destination types copy straight through, and conversions run over the
+    // raw bytes instead of per-element QDataStream reads.
+    int totalElements = count * bufferCount;
+    qint64 numBytes = (qint64)totalElements * (qint64)sizeof(T);
+    if (byteOffset < 0 || numBytes + byteOffset > (qint64)bin.size()) {
+        qWarning(modelformat) << "GLTF accessor overruns its buffer view";
+        return false;
     }
 
-    blobstream.setDevice(nullptr);
+    const char* source = bin.constData() + byteOffset;
+    int baseIndex = outarray.size();
+    outarray.resize(baseIndex + totalElements);
+    L* destination = outarray.data() + baseIndex;
+
+    if (std::is_same<T, L>::value && QSysInfo::ByteOrder == QSysInfo::LittleEndian) {
+        memcpy(destination, source, (size_t)numBytes);
+    } else {
+        // all supported targets are little-endian hosts
+        for (int i = 0; i < totalElements; ++i) {
+            T value;
+            memcpy(&value, source + (size_t)i * sizeof(T), sizeof(T));
+            destination[i] = (L)value;
+        }
+    }
     return true;
 }
 template <typename T>
@@ -436,14 +436,25 @@ const QString& getShaderCacheFile() {
 static const char* SHADER_JSON_TYPE_KEY = "type";
 static const char* SHADER_JSON_SOURCE_KEY = "source";
 static const char* SHADER_JSON_DATA_KEY = "data";
+static const char* SHADER_JSON_DRIVER_KEY = "__driver";
 
-void gl::loadShaderCache(ShaderCache& cache) {
+void gl::loadShaderCache(ShaderCache& cache, const std::string& driverKey) {
 #if !defined(DISABLE_QML)
     QString shaderCacheFile = getShaderCacheFile();
     if (QFileInfo(shaderCacheFile).exists()) {
         QString json = FileUtils::readFile(shaderCacheFile);
         auto root = QJsonDocument::fromJson(json.toUtf8()).object();
+
+        // binaries from another driver (or after a driver update) are useless
+        // and on some drivers actively dangerous to feed back; drop them
+        if (root[SHADER_JSON_DRIVER_KEY].toString().toStdString() != driverKey) {
+            return;
+        }
+
         for (const auto& qhash : root.keys()) {
+            if (qhash == SHADER_JSON_DRIVER_KEY) {
+                continue;
+            }
             auto programObject = root[qhash].toObject();
             QByteArray qbinary = QByteArray::fromBase64(programObject[SHADER_JSON_DATA_KEY].toString().toUtf8());
             std::string hash = qhash.toStdString();
@@ -457,10 +468,11 @@ void gl::loadShaderCache(ShaderCache& cache) {
 #endif
 }
 
-void gl::saveShaderCache(const ShaderCache& cache) {
+void gl::saveShaderCache(const ShaderCache& cache, const std::string& driverKey) {
     QByteArray json;
     {
         QVariantMap variantMap;
+        variantMap[SHADER_JSON_DRIVER_KEY] = QString::fromStdString(driverKey);
         for (const auto& entry : cache) {
             const auto& key = entry.first;
             const auto& type = entry.second.format;
@@ -92,8 +92,11 @@ struct CachedShader {
 using ShaderCache = std::unordered_map<std::string, CachedShader>;
 
 std::string getShaderHash(const std::string& shaderSource);
-void loadShaderCache(ShaderCache& cache);
-void saveShaderCache(const ShaderCache& cache);
+// driverKey identifies the GL vendor/renderer/version the binaries were built
+// for; a cache written by a different driver is ignored wholesale, since
+// program binaries are driver-specific
+void loadShaderCache(ShaderCache& cache, const std::string& driverKey);
+void saveShaderCache(const ShaderCache& cache, const std::string& driverKey);
 
 #ifdef SEPARATE_PROGRAM
 bool compileShader(GLenum shaderDomain,
@@ -63,6 +63,15 @@ class GLBackend : public Backend, public std::enable_shared_from_this<GLBackend>
     static BackendPointer createBackend();
 
 protected:
+
+    // in-flight asynchronous framebuffer downloads (render thread only)
+    struct AsyncFramebufferDownload {
+        GLuint pbo { 0 };
+        GLsync sync { nullptr };
+        Vec4i region;
+    };
+    std::unordered_map<uint32_t, AsyncFramebufferDownload> _asyncFramebufferDownloads;
+    uint32_t _nextAsyncDownloadHandle { 1 };
     explicit GLBackend(bool syncCache);
     GLBackend();
 
@@ -111,6 +120,8 @@ public:
     virtual void downloadFramebuffer(const FramebufferPointer& srcFramebuffer,
                                      const Vec4i& region,
                                      QImage& destImage) final override;
+    uint32_t downloadFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region) override;
+    bool pollFramebufferDownload(uint32_t handle, QImage& destImage) override;
 
     // this is the maximum numeber of available input buffers
     size_t getNumInputBuffers() const { return _input._invalidBuffers.size(); }
@@ -507,6 +518,7 @@ protected:
 
         State::Data _stateCache{ State::DEFAULT };
         State::Signature _stateSignatureCache{ 0 };
+        uint64_t _appliedStateHash { 0 };   // content hash of the currently-applied GLState
 
         GLState* _state{ nullptr };
         bool _invalidState{ false };
@@ -565,6 +577,8 @@ protected:
         std::mutex _mutex;
         std::vector<GLint> _formats;
         std::unordered_map<std::string, ::gl::CachedShader> _binaries;
+        std::string _driverKey;     // vendor/renderer/version the binaries belong to
+        int _unsavedCount { 0 };    // newly-cached binaries since the last flush
     } _shaderBinaryCache;
 
     virtual void initShaderBinaryCache();
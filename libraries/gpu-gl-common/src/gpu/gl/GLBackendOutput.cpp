@@ -204,3 +204,65 @@ void GLBackend::downloadFramebuffer(const FramebufferPointer& srcFramebuffer, co
 
     (void) CHECK_GL_ERROR();
 }
+
+uint32_t GLBackend::downloadFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region) {
+    auto readFBO = getFramebufferID(srcFramebuffer);
+    if (!srcFramebuffer || !readFBO) {
+        return 0;
+    }
+    if ((srcFramebuffer->getWidth() < (region.x + region.z)) || (srcFramebuffer->getHeight() < (region.y + region.w))) {
+        qCWarning(gpugllogging) << "GLBackend::downloadFramebufferAsync : srcFramebuffer is too small to provide the region queried";
+        return 0;
+    }
+
+#if defined(USE_GLES)
+    GLenum format = GL_RGBA;
+#else
+    GLenum format = GL_BGRA;
+#endif
+
+    // the readback lands in a PBO and the GPU signals a fence when it's done - nothing here
+    // waits on the pipeline
+    AsyncFramebufferDownload download;
+    download.region = region;
+    glGenBuffers(1, &download.pbo);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, download.pbo);
+    glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)region.z * region.w * 4, nullptr, GL_STREAM_READ);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFBO);
+    glReadPixels(region.x, region.y, region.z, region.w, format, GL_UNSIGNED_BYTE, nullptr);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    download.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    (void)CHECK_GL_ERROR();
+
+    auto handle = _nextAsyncDownloadHandle++;
+    _asyncFramebufferDownloads[handle] = download;
+    return handle;
+}
+
+bool GLBackend::pollFramebufferDownload(uint32_t handle, QImage& destImage) {
+    auto it = _asyncFramebufferDownloads.find(handle);
+    if (it == _asyncFramebufferDownloads.end()) {
+        return true;
+    }
+    auto& download = it->second;
+
+    auto status = glClientWaitSync(download.sync, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+        return false;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, download.pbo);
+    auto byteCount = (GLsizeiptr)download.region.z * download.region.w * 4;
+    const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, byteCount, GL_MAP_READ_BIT);
+    if (mapped && destImage.width() >= download.region.z && destImage.height() >= download.region.w
+            && destImage.format() == QImage::Format_ARGB32) {
+        memcpy(destImage.bits(), mapped, byteCount);
+    }
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glDeleteSync(download.sync);
+    glDeleteBuffers(1, &download.pbo);
+    _asyncFramebufferDownloads.erase(it);
+    return true;
+}
@@ -9,6 +9,8 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 #include "GLBackend.h"
+
+#include <SharedUtil.h>
 #include <gpu/TextureTable.h>
 #include <gpu/ShaderConstants.h>
 
@@ -104,20 +106,27 @@ void GLBackend::updatePipeline() {
 
     if (_pipeline._invalidState) {
         if (_pipeline._state) {
-            // first reset to default what should be
-            // the fields which were not to default and are default now
-            resetPipelineState(_pipeline._state->_signature);
-
-            // Update the signature cache with what's going to be touched
-            _pipeline._stateSignatureCache |= _pipeline._state->_signature;
-
-            // And perform
-            for (const auto& command : _pipeline._state->_commands) {
-                command->run(this);
+            // distinct State objects with identical precomputed content hashes
+            // produce identical GL state; skip the reset/re-apply entirely
+            if (_pipeline._state->_valuesHash != _pipeline._appliedStateHash ||
+                _pipeline._state->_signature != _pipeline._stateSignatureCache) {
+                // first reset to default what should be
+                // the fields which were not to default and are default now
+                resetPipelineState(_pipeline._state->_signature);
+
+                // Update the signature cache with what's going to be touched
+                _pipeline._stateSignatureCache |= _pipeline._state->_signature;
+
+                // And perform
+                for (const auto& command : _pipeline._state->_commands) {
+                    command->run(this);
+                }
+                _pipeline._appliedStateHash = _pipeline._state->_valuesHash;
             }
         } else {
             // No state ? anyway just reset everything
             resetPipelineState(0);
+            _pipeline._appliedStateHash = 0;
         }
         _pipeline._invalidState = false;
     }
@@ -264,6 +273,8 @@ void GLBackend::bindResourceTexture(uint32_t slot, const TexturePointer& resourc
         releaseResourceTexture(slot);
         return;
     }
+    // stamp for the streaming engine: bound textures are (about to be) on screen
+    resourceTexture->setLastBoundTime(usecTimestampNow());
     setResourceTexture(slot, resourceTexture);
 }
 
@@ -46,6 +46,14 @@ void GLBackend::do_beginQuery(const Batch& batch, size_t paramOffset) {
         ++_queryStage._rangeQueryDepth;
         glquery->_batchElapsedTimeBegin = std::chrono::high_resolution_clock::now();
 
+        if (query->getType() == Query::AnySamplesPassed) {
+            // occlusion-style query: did any fragments survive the depth test?
+#if defined(USE_GLES)
+            glBeginQuery(GL_ANY_SAMPLES_PASSED_CONSERVATIVE, glquery->_endqo);
+#else
+            glBeginQuery(GL_ANY_SAMPLES_PASSED_CONSERVATIVE, glquery->_endqo);
+#endif
+        } else {
 #if defined(USE_GLES)
         if (hasTimerExtension()) {
             glQueryCounterEXT(glquery->_beginqo, GL_TIMESTAMP_EXT);
@@ -59,6 +67,7 @@ void GLBackend::do_beginQuery(const Batch& batch, size_t paramOffset) {
             glQueryCounter(glquery->_beginqo, GL_TIMESTAMP);
         }
 #endif
+        }
 
         glquery->_rangeQueryDepth = _queryStage._rangeQueryDepth;
         (void)CHECK_GL_ERROR();
@@ -69,6 +78,9 @@ void GLBackend::do_endQuery(const Batch& batch, size_t paramOffset) {
     auto query = batch._queries.get(batch._params[paramOffset]._uint);
     GLQuery* glquery = syncGPUObject(*query);
     if (glquery) {
+        if (query->getType() == Query::AnySamplesPassed) {
+            glEndQuery(GL_ANY_SAMPLES_PASSED_CONSERVATIVE);
+        } else {
 #if defined(USE_GLES)
         if (hasTimerExtension()) {
             glQueryCounterEXT(glquery->_endqo, GL_TIMESTAMP_EXT);
@@ -82,6 +94,7 @@ void GLBackend::do_endQuery(const Batch& batch, size_t paramOffset) {
             glQueryCounter(glquery->_endqo, GL_TIMESTAMP);
         }
 #endif
+        }
 
         --_queryStage._rangeQueryDepth;
         auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - glquery->_batchElapsedTimeBegin);
@@ -97,6 +110,20 @@ void GLBackend::do_getQuery(const Batch& batch, size_t paramOffset) {
     auto query = batch._queries.get(batch._params[paramOffset]._uint);
     GLQuery* glquery = syncGPUObject(*query);
     if (glquery) {
+        if (query->getType() == Query::AnySamplesPassed) {
+            // return 1 (visible) until the result lands, so occlusion consumers
+            // never cull on an unresolved query
+            GLuint available = 0;
+            glGetQueryObjectuiv(glquery->_endqo, GL_QUERY_RESULT_AVAILABLE, &available);
+            GLuint anySamplesPassed = 1;
+            if (available) {
+                glGetQueryObjectuiv(glquery->_endqo, GL_QUERY_RESULT, &anySamplesPassed);
+            }
+            glquery->_result = anySamplesPassed;
+            query->triggerReturnHandler(glquery->_result, glquery->_batchElapsedTime);
+            (void)CHECK_GL_ERROR();
+            return;
+        }
         if (glquery->_rangeQueryDepth > MAX_RANGE_QUERY_DEPTH) {
             query->triggerReturnHandler(glquery->_result, glquery->_batchElapsedTime);
         } else {
@@ -159,6 +159,14 @@ GLShader* GLBackend::compileBackendProgram(const Shader& program, const Shader::
                 cachedBinary.source = programSource;
                 std::unique_lock<std::mutex> shaderCacheLock{ _shaderBinaryCache._mutex };
                 _shaderBinaryCache._binaries[hash] = cachedBinary;
+
+                // flush periodically, so a crash during a load spike (exactly when
+                // lots of programs compile) doesn't lose the whole cache
+                const int SHADER_CACHE_FLUSH_INTERVAL = 10;
+                if (++_shaderBinaryCache._unsavedCount >= SHADER_CACHE_FLUSH_INTERVAL) {
+                    _shaderBinaryCache._unsavedCount = 0;
+                    ::gl::saveShaderCache(_shaderBinaryCache._binaries, _shaderBinaryCache._driverKey);
+                }
             }
         }
 
@@ -391,16 +399,34 @@ GLBackend::ElementResource GLBackend::getFormatFromGLUniform(GLenum gltype) {
 };
 
 void GLBackend::initShaderBinaryCache() {
+    // Parallel pipeline warm-up: with KHR_parallel_shader_compile the driver
+    // compiles and links on its own worker threads, so the burst of pipeline
+    // builds at startup (and any deferred loads later) doesn't serialize on
+    // the context thread.
+#if defined(GLAD_GL_KHR_parallel_shader_compile)
+    if (GLAD_GL_KHR_parallel_shader_compile && glMaxShaderCompilerThreadsKHR) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
+#endif
+
     GLint numBinFormats = 0;
     glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numBinFormats);
     if (numBinFormats > 0) {
         _shaderBinaryCache._formats.resize(numBinFormats);
         glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, _shaderBinaryCache._formats.data());
     }
-    ::gl::loadShaderCache(_shaderBinaryCache._binaries);
+
+    // program binaries are only valid for the driver that produced them
+    auto glString = [](GLenum name) {
+        const char* value = reinterpret_cast<const char*>(glGetString(name));
+        return value ? std::string(value) : std::string();
+    };
+    _shaderBinaryCache._driverKey = glString(GL_VENDOR) + "/" + glString(GL_RENDERER) + "/" + glString(GL_VERSION);
+
+    ::gl::loadShaderCache(_shaderBinaryCache._binaries, _shaderBinaryCache._driverKey);
 }
 
 void GLBackend::killShaderBinaryCache() {
-    ::gl::saveShaderCache(_shaderBinaryCache._binaries);
+    ::gl::saveShaderCache(_shaderBinaryCache._binaries, _shaderBinaryCache._driverKey);
 }
 
@@ -161,6 +161,18 @@ GLState* GLState::sync(const State& state) {
     object->_stamp = state.getStamp();
     object->_signature = state.getSignature();
 
+    // precompute the content hash (FNV-1a over the packed value struct)
+    {
+        const auto& values = state.getValues();
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&values);
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < sizeof(values); ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        object->_valuesHash = hash;
+    }
+
     bool depthBias = false;
     bool stencilState = false;
 
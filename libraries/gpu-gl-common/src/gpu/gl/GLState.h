@@ -19,6 +19,11 @@ class GLState : public GPUObject {
 public:
     static GLState* sync(const State& state);
 
+    // content hash over the state values, precomputed at sync time: two
+    // distinct State objects with identical values apply identically, so the
+    // backend can skip re-running their commands
+    uint64_t _valuesHash { 0 };
+
     class Command {
     public:
         virtual void run(GLBackend* backend) = 0;
@@ -8,6 +8,8 @@
 
 #include "GLTexture.h"
 
+#include <SharedUtil.h>
+
 #include <QtCore/QThread>
 #include <NumericalConstants.h>
 
@@ -255,8 +257,15 @@ void GLTextureTransferEngineDefault::updateMemoryPressure() {
             GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
             GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
             if (MemoryPressureState::Undersubscribed == _memoryPressureState && vargltexture->canPromote()) {
-                // Promote smallest first
-                _promoteQueue.push({ texture, 1.0f / (float)gltexture->size() });
+                // Visibility-driven prioritization: textures bound recently (and so
+                // actually sampled on screen) promote before unseen ones; within a
+                // recency class, smallest first.
+                const uint64_t RECENTLY_BOUND_WINDOW_USECS = 2000000;
+                float priority = 1.0f / (float)gltexture->size();
+                if (usecTimestampNow() - texture->getLastBoundTime() < RECENTLY_BOUND_WINDOW_USECS) {
+                    priority += 1.0f;
+                }
+                _promoteQueue.push({ texture, priority });
             } else if (MemoryPressureState::Transfer == _memoryPressureState && vargltexture->hasPendingTransfers()) {
                 populateTransferQueue(texture);
             }
@@ -465,13 +474,28 @@ void GLTextureTransferEngineDefault::processPromotes() {
 }
 
 void GLTextureTransferEngineDefault::processDemotes(size_t reliefRequired, const std::vector<TexturePointer>& strongTextures) {
-    // Demote largest first
+    // Demote by score: resident mip cost weighted by how stale the texture is. Binds happen
+    // only for items that survived culling, so the last-bound stamp is a per-frame visibility
+    // signal - an off-screen 4K texture scores far above an on-screen one of the same size and
+    // gives its memory back first. Recently-sampled textures are strongly protected but not
+    // exempt, so extreme pressure can still be relieved.
     ImmediateWorkQueue demoteQueue;
+    auto now = usecTimestampNow();
     for (const auto& texture : strongTextures) {
         GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
         GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
         if (vargltexture->canDemote()) {
-            demoteQueue.push({ texture, (float)gltexture->size() });
+            const float MAX_STALENESS_SECS = 60.0f;
+            const float VISIBLE_WINDOW_SECS = 2.0f;
+            const float VISIBLE_PROTECTION_FACTOR = 0.01f;
+
+            auto lastBound = texture->getLastBoundTime();
+            float staleSecs = lastBound == 0
+                ? MAX_STALENESS_SECS
+                : std::min(MAX_STALENESS_SECS, (float)(now - lastBound) / (float)USECS_PER_SECOND);
+            float staleness = staleSecs < VISIBLE_WINDOW_SECS ? VISIBLE_PROTECTION_FACTOR : staleSecs;
+
+            demoteQueue.push({ texture, (float)gltexture->size() * staleness });
         }
     }
 
@@ -51,7 +51,9 @@ namespace gpu {
                 Size size;
                 Size currentPage { 0 };
                 auto data = _gpuObject._renderSysmem.readData();
-                while (_gpuObject._renderPages.getNextTransferBlock(offset, size, currentPage)) {
+                // bridge small clean gaps between dirty runs into one upload each
+                const Size MAX_COALESCE_GAP_BYTES = 8192;
+                while (_gpuObject._renderPages.getNextCoalescedTransferBlock(offset, size, currentPage, MAX_COALESCE_GAP_BYTES)) {
                     glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size, data + offset);
                     (void)CHECK_GL_ERROR();
                 }
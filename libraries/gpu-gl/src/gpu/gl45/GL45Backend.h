@@ -20,7 +20,12 @@
 
 #define INCREMENTAL_TRANSFER 0
 #define GPU_SSBO_TRANSFORM_OBJECT 1
+// Bindless texture-table path: opt in with -DGPU_BINDLESS_TEXTURES=1 at build
+// time; at runtime it additionally requires ARB_bindless_texture (see
+// supportsBindless()).
+#ifndef GPU_BINDLESS_TEXTURES
 #define GPU_BINDLESS_TEXTURES 0
+#endif
 
 namespace gpu { namespace gl45 {
 
@@ -37,7 +42,8 @@ public:
     static GLint MAX_COMBINED_SHADER_STORAGE_BLOCKS;
     static GLint MAX_UNIFORM_LOCATIONS;
 #if GPU_BINDLESS_TEXTURES
-    virtual bool supportsBindless() const override { return true; }
+    // compiled in, but only active on hardware that exposes ARB_bindless_texture
+    virtual bool supportsBindless() const override { return GLAD_GL_ARB_bindless_texture != 0; }
 #endif
 
     explicit GL45Backend(bool syncCache);
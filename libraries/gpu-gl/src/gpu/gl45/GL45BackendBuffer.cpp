@@ -33,7 +33,9 @@ namespace gpu { namespace gl45 {
             Size size;
             Size currentPage { 0 };
             auto data = _gpuObject._renderSysmem.readData();
-            while (_gpuObject._renderPages.getNextTransferBlock(offset, size, currentPage)) {
+            // bridge small clean gaps between dirty runs into one upload each
+            const Size MAX_COALESCE_GAP_BYTES = 8192;
+            while (_gpuObject._renderPages.getNextCoalescedTransferBlock(offset, size, currentPage, MAX_COALESCE_GAP_BYTES)) {
                 glNamedBufferSubData(_buffer, (GLintptr)offset, (GLsizeiptr)size, data + offset);
             }
             (void)CHECK_GL_ERROR();
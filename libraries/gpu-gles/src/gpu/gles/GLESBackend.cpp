@@ -175,23 +175,58 @@ void GLESBackend::do_multiDrawIndirect(const Batch& batch, size_t paramOffset) {
     _stats._DSNumAPIDrawcalls++;
 
 #else
-    // FIXME implement the slow path
+    // Slow path: no GPU-side multi-draw-indirect on this profile, so walk the
+    // indirect commands from the buffer's CPU copy and issue instanced draws.
+    uint commandCount = batch._params[paramOffset + 0]._uint;
+    GLenum mode = gl::PRIMITIVE_TO_GL[(Primitive)batch._params[paramOffset + 1]._uint];
+    const Buffer* indirectBuffer = acquire(_input._indirectBuffer);
+    if (indirectBuffer) {
+        struct DrawArraysIndirectCommand {
+            uint count;
+            uint instanceCount;
+            uint first;
+            uint baseInstance;
+        };
+        auto stride = _input._indirectBufferStride ? _input._indirectBufferStride : sizeof(DrawArraysIndirectCommand);
+        const uint8_t* commandData = indirectBuffer->getData() + _input._indirectBufferOffset;
+        for (uint i = 0; i < commandCount; ++i) {
+            const auto& command = *reinterpret_cast<const DrawArraysIndirectCommand*>(commandData + i * stride);
+            glDrawArraysInstanced(mode, command.first, command.count, command.instanceCount);
+        }
+        _stats._DSNumDrawcalls += commandCount;
+        _stats._DSNumAPIDrawcalls += commandCount;
+    }
 #endif
     (void)CHECK_GL_ERROR();
 
 }
 
 void GLESBackend::do_multiDrawIndexedIndirect(const Batch& batch, size_t paramOffset) {
-//#if (GPU_INPUT_PROFILE == GPU_CORE_43)
+    // No GPU-side multi-draw-indirect on this profile: walk the indirect
+    // commands from the buffer's CPU copy and issue instanced indexed draws.
     uint commandCount = batch._params[paramOffset + 0]._uint;
-    //GLenum mode = gl::PRIMITIVE_TO_GL[(Primitive)batch._params[paramOffset + 1]._uint];
-    //GLenum indexType = gl::ELEMENT_TYPE_TO_GL[_input._indexBufferType];
-    //glMultiDrawElementsIndirect(mode, indexType, reinterpret_cast<GLvoid*>(_input._indirectBufferOffset), commandCount, (GLsizei)_input._indirectBufferStride);
-    qDebug() << "TODO: GLESBackend.cpp:do_multiDrawIndexedIndirect glMultiDrawElementsIndirect";
-    _stats._DSNumDrawcalls += commandCount;
-    _stats._DSNumAPIDrawcalls++;
-//#else
-    // FIXME implement the slow path
-//#endif
+    GLenum mode = gl::PRIMITIVE_TO_GL[(Primitive)batch._params[paramOffset + 1]._uint];
+    GLenum indexType = gl::ELEMENT_TYPE_TO_GL[_input._indexBufferType];
+    const Buffer* indirectBuffer = acquire(_input._indirectBuffer);
+    if (indirectBuffer) {
+        struct DrawElementsIndirectCommand {
+            uint count;
+            uint instanceCount;
+            uint firstIndex;
+            uint baseVertex;
+            uint baseInstance;
+        };
+        auto stride = _input._indirectBufferStride ? _input._indirectBufferStride : sizeof(DrawElementsIndirectCommand);
+        const uint8_t* commandData = indirectBuffer->getData() + _input._indirectBufferOffset;
+        uint32_t indexSize = (indexType == GL_UNSIGNED_INT ? 4 : (indexType == GL_UNSIGNED_SHORT ? 2 : 1));
+        for (uint i = 0; i < commandCount; ++i) {
+            const auto& command = *reinterpret_cast<const DrawElementsIndirectCommand*>(commandData + i * stride);
+            glDrawElementsInstanced(mode, command.count, indexType,
+                                    reinterpret_cast<GLvoid*>((size_t)command.firstIndex * indexSize),
+                                    command.instanceCount);
+        }
+        _stats._DSNumDrawcalls += commandCount;
+        _stats._DSNumAPIDrawcalls += commandCount;
+    }
     (void)CHECK_GL_ERROR();
 }
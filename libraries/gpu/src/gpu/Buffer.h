@@ -37,6 +37,9 @@ public:
         Update(Update&& other);
         void apply() const;
 
+        // identity of the target buffer, for callers scheduling updates
+        const Buffer* getBuffer() const { return &buffer; }
+
     private:
         const Buffer& buffer;
         size_t updateNumber;
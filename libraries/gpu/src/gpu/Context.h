@@ -66,6 +66,12 @@ public:
     virtual void syncProgram(const gpu::ShaderPointer& program) = 0;
     virtual void recycle() const = 0;
     virtual void downloadFramebuffer(const FramebufferPointer& srcFramebuffer, const Vec4i& region, QImage& destImage) = 0;
+    // Asynchronous variant: kicks the readback into backend-owned staging and returns a handle
+    // (0 when the backend has no async path - callers fall back to the synchronous download).
+    // Poll with pollFramebufferDownload, which fills destImage and releases the handle once the
+    // GPU has finished.
+    virtual uint32_t downloadFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region) { return 0; }
+    virtual bool pollFramebufferDownload(uint32_t handle, QImage& destImage) { return true; }
     virtual void setCameraCorrection(const Mat4& correction, const Mat4& prevRenderView, bool reset = false) {}
 
     virtual bool supportedTextureFormat(const gpu::Element& format) = 0;
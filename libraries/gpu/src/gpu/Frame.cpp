@@ -7,6 +7,10 @@
 //
 
 #include "Frame.h"
+
+#include <unordered_set>
+
+#include <TBBHelpers.h>
 #include <unordered_set>
 
 using namespace gpu;
@@ -33,8 +37,34 @@ void Frame::finish() {
 
 void Frame::preRender() {
     PROFILE_RANGE(render_gpu, __FUNCTION__);
-    for (auto& update : bufferUpdates) {
-        update.apply();
+
+    // Updates to distinct buffers are independent, so large frames apply them
+    // across worker threads. Ordered updates to the same buffer (it appeared in
+    // several batches) must stay sequential, so those frames take the serial path.
+    const size_t PARALLEL_UPDATE_THRESHOLD = 16;
+    bool parallelize = bufferUpdates.size() >= PARALLEL_UPDATE_THRESHOLD;
+    if (parallelize) {
+        std::unordered_set<const Buffer*> seenBuffers;
+        seenBuffers.reserve(bufferUpdates.size());
+        for (const auto& update : bufferUpdates) {
+            if (!seenBuffers.insert(update.getBuffer()).second) {
+                parallelize = false;
+                break;
+            }
+        }
+    }
+
+    if (parallelize) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, bufferUpdates.size()),
+                          [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                bufferUpdates[i].apply();
+            }
+        });
+    } else {
+        for (auto& update : bufferUpdates) {
+            update.apply();
+        }
     }
     bufferUpdates.clear();
 }
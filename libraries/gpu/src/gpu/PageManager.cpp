@@ -116,6 +116,45 @@ PageManager::Pages PageManager::getMarkedPages(uint8_t desiredFlags, bool clear)
     return result;
 }
 
+bool PageManager::getNextCoalescedTransferBlock(Size& outOffset, Size& outSize, Size& currentPage, Size maxGapBytes) {
+    Size pageCount = _pages.size();
+    Size maxGapPages = maxGapBytes / _pageSize;
+
+    // Advance to the first dirty page
+    while (currentPage < pageCount && (0 == (DIRTY & _pages[currentPage]))) {
+        ++currentPage;
+    }
+    if (currentPage >= pageCount) {
+        return false;
+    }
+
+    outOffset = static_cast<Size>(currentPage * _pageSize);
+    Size endPage = currentPage;
+    while (true) {
+        // consume the dirty run
+        while (currentPage < pageCount && (0 != (DIRTY & _pages[currentPage]))) {
+            _pages[currentPage] &= ~DIRTY;
+            ++currentPage;
+        }
+        endPage = currentPage;
+
+        // bridge a small clean gap when more dirty pages follow it
+        Size lookahead = currentPage;
+        while (lookahead < pageCount && (0 == (DIRTY & _pages[lookahead])) &&
+               (lookahead - currentPage) <= maxGapPages) {
+            ++lookahead;
+        }
+        if (lookahead < pageCount && (0 != (DIRTY & _pages[lookahead])) &&
+            (lookahead - currentPage) <= maxGapPages) {
+            currentPage = lookahead;
+            continue;
+        }
+        break;
+    }
+    outSize = static_cast<Size>((endPage * _pageSize) - outOffset);
+    return true;
+}
+
 bool PageManager::getNextTransferBlock(Size& outOffset, Size& outSize, Size& currentPage) {
     Size pageCount = _pages.size();
     // Advance to the first dirty page
@@ -50,6 +50,10 @@ struct PageManager {
     // Get pages with the specified flags, optionally clearing the flags as we go
     Pages getMarkedPages(uint8_t desiredFlags = DIRTY, bool clear = true);
     bool getNextTransferBlock(Size& outOffset, Size& outSize, Size& currentPage);
+    // Like getNextTransferBlock, but bridges clean gaps of up to maxGapBytes
+    // between dirty runs, so scattered small updates merge into fewer, larger
+    // uploads (re-uploading the small clean gap is cheaper than another call).
+    bool getNextCoalescedTransferBlock(Size& outOffset, Size& outSize, Size& currentPage, Size maxGapBytes);
 };
 
 };
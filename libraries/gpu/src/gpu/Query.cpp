@@ -10,14 +10,19 @@
 //
 #include "Query.h"
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 #include "GPULogging.h"
 #include "Batch.h"
 
 using namespace gpu;
 
-Query::Query(const Handler& returnHandler, const std::string& name) :
+Query::Query(const Handler& returnHandler, const std::string& name, Type type) :
     _returnHandler(returnHandler),
-    _name(name)
+    _name(name),
+    _type(type)
 {
 }
 
@@ -42,8 +47,35 @@ void Query::triggerReturnHandler(uint64_t queryResult, uint64_t batchElapsedTime
 }
 
 
+namespace {
+    std::mutex rangeTimerRegistryMutex;
+    std::vector<gpu::RangeTimer*>& rangeTimerRegistry() {
+        static std::vector<gpu::RangeTimer*> registry;
+        return registry;
+    }
+}
+
+std::map<std::string, double> RangeTimer::getAllGPUAverages() {
+    std::map<std::string, double> averages;
+    std::lock_guard<std::mutex> lock(rangeTimerRegistryMutex);
+    for (const auto* timer : rangeTimerRegistry()) {
+        averages[timer->_name] = timer->getGPUAverage();
+    }
+    return averages;
+}
+
+RangeTimer::~RangeTimer() {
+    std::lock_guard<std::mutex> lock(rangeTimerRegistryMutex);
+    auto& registry = rangeTimerRegistry();
+    registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+}
+
 RangeTimer::RangeTimer(const std::string& name) :
     _name(name) {
+    {
+        std::lock_guard<std::mutex> lock(rangeTimerRegistryMutex);
+        rangeTimerRegistry().push_back(this);
+    }
     for (int i = 0; i < QUERY_QUEUE_SIZE; i++) {
         _timerQueries.push_back(std::make_shared<gpu::Query>([this] (const Query& query) {
             _tailIndex++;
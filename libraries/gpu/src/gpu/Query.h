@@ -18,6 +18,9 @@
 #include <string>
 #include <SimpleMovingAverage.h>
 
+#include <map>
+#include <mutex>
+
 #include "Format.h"
 
 namespace gpu {
@@ -28,12 +31,25 @@ namespace gpu {
     public:
         using Handler = std::function<void(const Query&)>;
 
-        Query(const Handler& returnHandler, const std::string& name = "gpu::query");
+        // Timer queries measure GPU time between begin and end; AnySamplesPassed
+        // queries report (conservatively) whether any fragments survived the
+        // depth test, for occlusion-driven culling stages.
+        enum Type : uint8_t {
+            Timer = 0,
+            AnySamplesPassed,
+        };
+
+        Query(const Handler& returnHandler, const std::string& name = "gpu::query", Type type = Timer);
         ~Query();
 
+        Type getType() const { return _type; }
+
         double getGPUElapsedTime() const;
         double getBatchElapsedTime() const;
 
+        // for AnySamplesPassed queries: nonzero when any samples passed
+        uint64_t getResult() const { return _queryResult; }
+
         const std::string& getName() const { return _name; }
 
         // Only for gpu::Context
@@ -43,6 +59,7 @@ namespace gpu {
         Handler _returnHandler;
 
         const std::string _name;
+        const Type _type { Timer };
         uint64_t _queryResult { 0 };
         uint64_t _usecBatchElapsedTime { 0 };
 
@@ -60,12 +77,18 @@ namespace gpu {
     class RangeTimer {
     public:
         RangeTimer(const std::string& name);
+        ~RangeTimer();
         void begin(gpu::Batch& batch);
         void end(gpu::Batch& batch);
         
         double getGPUAverage() const;
         double getBatchAverage() const;
 
+        // Always-on span surface: every live RangeTimer registers itself, so
+        // consumers (engine stats, scripts) can read all GPU span averages by
+        // name without wiring each timer individually.
+        static std::map<std::string, double> getAllGPUAverages();
+
     protected:
         
         static const int QUERY_QUEUE_SIZE { 4 };
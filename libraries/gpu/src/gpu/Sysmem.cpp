@@ -8,10 +8,46 @@
 //
 #include "Sysmem.h"
 
+#include <mutex>
+#include <vector>
+
 #include <QtCore/QDebug>
 
 using namespace gpu;
 
+// Size-class pooling: Sysmem blocks churn at frame rate (buffer backing and
+// staging copies resize constantly), so small-to-medium allocations round up
+// to a power-of-two class internally and recycle through per-class free lists.
+// The reported size stays the requested size - only the backing block is
+// class-sized - and the class is recomputed from the size on release, so both
+// sides of the contract agree.
+namespace {
+    const Size MIN_POOLED_BLOCK = 256;
+    const Size MAX_POOLED_BLOCK = 1 << 20;      // 1MB
+    const int NUM_SIZE_CLASSES = 13;            // 256B .. 1MB
+    const size_t MAX_BLOCKS_PER_CLASS = 32;
+
+    std::mutex sysmemPoolMutex;
+    std::vector<Byte*> sysmemPools[NUM_SIZE_CLASSES];
+
+    int sizeClassFor(Size size) {
+        if (size == 0 || size > MAX_POOLED_BLOCK) {
+            return -1;
+        }
+        Size blockSize = MIN_POOLED_BLOCK;
+        int sizeClass = 0;
+        while (blockSize < size) {
+            blockSize <<= 1;
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    Size blockSizeForClass(int sizeClass) {
+        return MIN_POOLED_BLOCK << sizeClass;
+    }
+}
+
 Size Sysmem::allocateMemory(Byte** dataAllocated, Size size) {
     if ( !dataAllocated ) { 
         qWarning() << "Buffer::Sysmem::allocateMemory() : Must have a valid dataAllocated pointer.";
@@ -21,9 +57,23 @@ Size Sysmem::allocateMemory(Byte** dataAllocated, Size size) {
     // Try to allocate if needed
     Size newSize = 0;
     if (size > 0) {
-        // Try allocating as much as the required size + one block of memory
         newSize = size;
-        (*dataAllocated) = new (std::nothrow) Byte[newSize];
+
+        int sizeClass = sizeClassFor(size);
+        if (sizeClass >= 0) {
+            {
+                std::lock_guard<std::mutex> lock(sysmemPoolMutex);
+                if (!sysmemPools[sizeClass].empty()) {
+                    *dataAllocated = sysmemPools[sizeClass].back();
+                    sysmemPools[sizeClass].pop_back();
+                    return newSize;
+                }
+            }
+            (*dataAllocated) = new (std::nothrow) Byte[blockSizeForClass(sizeClass)];
+        } else {
+            (*dataAllocated) = new (std::nothrow) Byte[newSize];
+        }
+
         // Failed?
         if (!(*dataAllocated)) {
             qWarning() << "Buffer::Sysmem::allocate() : Can't allocate a system memory buffer of " << newSize << "bytes. Fails to create the buffer Sysmem.";
@@ -37,6 +87,14 @@ Size Sysmem::allocateMemory(Byte** dataAllocated, Size size) {
 
 void Sysmem::deallocateMemory(Byte* dataAllocated, Size size) {
     if (dataAllocated) {
+        int sizeClass = sizeClassFor(size);
+        if (sizeClass >= 0) {
+            std::lock_guard<std::mutex> lock(sysmemPoolMutex);
+            if (sysmemPools[sizeClass].size() < MAX_BLOCKS_PER_CLASS) {
+                sysmemPools[sizeClass].push_back(dataAllocated);
+                return;
+            }
+        }
         delete[] dataAllocated;
     }
 }
@@ -12,6 +12,7 @@
 #define hifi_gpu_Texture_h
 
 #include <algorithm> //min max and more
+#include <atomic>
 #include <bitset>
 
 #include <QMetaType>
@@ -209,6 +210,11 @@ class Texture : public Resource {
     static void updateTextureCPUMemoryUsage(Size prevObjectSize, Size newObjectSize);
 
 public:
+    // Stamp of the most recent bind, maintained by the backend and read by the
+    // texture streaming engine to promote on-screen textures first.
+    void setLastBoundTime(uint64_t usecs) const { _lastBoundTime.store(usecs, std::memory_order_relaxed); }
+    uint64_t getLastBoundTime() const { return _lastBoundTime.load(std::memory_order_relaxed); }
+
     static const uint32_t CUBE_FACE_COUNT { 6 };
     static uint32_t getTextureCPUCount();
     static Size getTextureCPUMemSize();
@@ -577,6 +583,10 @@ public:
 
     // Serialize a texture into a KTX file
     static ktx::KTXUniquePointer serialize(const Texture& texture);
+    // Streams the serialized KTX through the callback one section at a time instead of staging the
+    // whole blob in memory; fills outHeader (when non-null) with the header that was written
+    static bool serializeToWriter(const Texture& texture, const ktx::KTX::WriteCallback& write,
+                                  ktx::Header* outHeader = nullptr);
 
     static TexturePointer build(const ktx::KTXDescriptor& descriptor);
     static TexturePointer unserialize(const std::string& ktxFile);
@@ -599,6 +609,9 @@ protected:
     // Not strictly necessary, but incredibly useful for debugging
     std::string _source;
     std::string _sourceHash;
+
+    // stamp of the most recent bind; see setLastBoundTime/getLastBoundTime
+    mutable std::atomic<uint64_t> _lastBoundTime { 0 };
     std::unique_ptr< Storage > _storage;
 
     Stamp _stamp { 0 };
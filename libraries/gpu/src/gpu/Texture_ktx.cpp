@@ -382,19 +382,16 @@ void Texture::setKtxBacking(const cache::FilePointer& cacheEntry) {
 }
 
 
-ktx::KTXUniquePointer Texture::serialize(const Texture& texture) {
-    ktx::Header header;
-
+static bool evalKTXSerializationHeader(const Texture& texture, ktx::Header& header) {
     // From texture format to ktx format description
     auto texelFormat = texture.getTexelFormat();
     auto mipFormat = texture.getStoredMipFormat();
 
     if (!Texture::evalKTXFormat(mipFormat, texelFormat, header)) {
-        return nullptr;
+        return false;
     }
 
     // Set Dimensions
-    uint32_t numFaces = 1;
     switch (texture.getType()) {
         case TEX_1D: {
             if (texture.isArray()) {
@@ -426,17 +423,25 @@ ktx::KTXUniquePointer Texture::serialize(const Texture& texture) {
             } else {
                 header.setCube(texture.getWidth(), texture.getHeight());
             }
-            numFaces = Texture::CUBE_FACE_COUNT;
             break;
         }
         default:
-            return nullptr;
+            return false;
     }
 
     // Number level of mips coming
     header.numberOfMipmapLevels = texture.getNumMips();
 
-    ktx::Images images;
+    return true;
+}
+
+static bool evalKTXSerializationData(const Texture& texture, ktx::Header& header, ktx::Images& images,
+                                     ktx::KeyValues& keyValues) {
+    if (!evalKTXSerializationHeader(texture, header)) {
+        return false;
+    }
+    uint32_t numFaces = header.numberOfFaces;
+
     uint32_t imageOffset = 0;
     for (uint32_t level = 0; level < header.numberOfMipmapLevels; level++) {
         auto mip = texture.accessStoredMipFace(level);
@@ -463,7 +468,6 @@ ktx::KTXUniquePointer Texture::serialize(const Texture& texture) {
     Byte keyvalPayload[GPUKTXPayload::SIZE];
     gpuKeyval.serialize(keyvalPayload);
 
-    ktx::KeyValues keyValues;
     keyValues.emplace_back(GPUKTXPayload::KEY, (uint32)GPUKTXPayload::SIZE, (ktx::Byte*) &keyvalPayload);
 
     if (texture.getIrradiance()) {
@@ -484,6 +488,17 @@ ktx::KTXUniquePointer Texture::serialize(const Texture& texture) {
         keyValues.emplace_back(SOURCE_HASH_KEY, static_cast<uint32>(binaryHash.size()), (ktx::Byte*) binaryHash.data());
     }
 
+    return true;
+}
+
+ktx::KTXUniquePointer Texture::serialize(const Texture& texture) {
+    ktx::Header header;
+    ktx::Images images;
+    ktx::KeyValues keyValues;
+    if (!evalKTXSerializationData(texture, header, images, keyValues)) {
+        return nullptr;
+    }
+
     auto ktxBuffer = ktx::KTX::create(header, images, keyValues);
 #if 0
     auto expectedMipCount = texture.evalNumMips();
@@ -514,6 +529,22 @@ ktx::KTXUniquePointer Texture::serialize(const Texture& texture) {
     return ktxBuffer;
 }
 
+bool Texture::serializeToWriter(const Texture& texture, const ktx::KTX::WriteCallback& write, ktx::Header* outHeader) {
+    ktx::Header header;
+    ktx::Images images;
+    ktx::KeyValues keyValues;
+    if (!evalKTXSerializationData(texture, header, images, keyValues)) {
+        return false;
+    }
+    if (outHeader) {
+        *outHeader = header;
+    }
+
+    // the mips stream straight from the texture's stored-mip storage, so the
+    // serialized KTX is never staged as one whole allocation
+    return ktx::KTX::writeToCallback(write, header, images, keyValues);
+}
+
 TexturePointer Texture::build(const ktx::KTXDescriptor& descriptor) {
     Format mipFormat = Format::COLOR_BGRA_32;
     Format texelFormat = Format::COLOR_SRGBA_32;
@@ -35,6 +35,10 @@ using namespace gpu;
 
 #include <nvtt/nvtt.h>
 
+#include <thread>
+
+#include <TBBHelpers.h>
+
 #undef _CRT_SECURE_NO_WARNINGS
 #include <Etc2/Etc.h>
 #include <Etc2/EtcFilter.h>
@@ -501,21 +505,32 @@ struct MyErrorHandler : public nvtt::ErrorHandler {
 };
 
 #if defined(NVTT_API)
-class SequentialTaskDispatcher : public nvtt::TaskDispatcher {
+// Runs NVTT's compression tasks - one per block row of the mip being
+// compressed - across the TBB worker pool so a single large mip is tiled over
+// every core. Work stealing keeps this well-behaved when several textures are
+// already being processed concurrently on different threads.
+class TiledTaskDispatcher : public nvtt::TaskDispatcher {
 public:
-    SequentialTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
+    TiledTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
     }
 
     const std::atomic<bool>& _abortProcessing;
 
     void dispatch(nvtt::Task* task, void* context, int count) override {
-        for (int i = 0; i < count; i++) {
+        if (count == 1) {
             if (!_abortProcessing.load()) {
-                task(context, i);
-            } else {
-                break;
+                task(context, 0);
             }
+            return;
         }
+        tbb::parallel_for(tbb::blocked_range<int>(0, count), [&](const tbb::blocked_range<int>& range) {
+            if (_abortProcessing.load()) {
+                return;
+            }
+            for (int i = range.begin(); i < range.end(); i++) {
+                task(context, i);
+            }
+        });
     }
 };
 #endif
@@ -622,7 +637,7 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
     surface.setAlphaMode(nvtt::AlphaMode_None);
     surface.setWrapMode(nvtt::WrapMode_Mirror);
 
-    SequentialTaskDispatcher dispatcher(abortProcessing);
+    TiledTaskDispatcher dispatcher(abortProcessing);
     nvtt::Compressor compressor;
     context.setTaskDispatcher(&dispatcher);
 
@@ -759,8 +774,9 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
         MyErrorHandler errorHandler;
         outputOptions.setErrorHandler(&errorHandler);
 
-        SequentialTaskDispatcher dispatcher(abortProcessing);
+        TiledTaskDispatcher dispatcher(abortProcessing);
         nvtt::Compressor context;
+        context.setTaskDispatcher(&dispatcher);
 
         context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
         if (buildMips) {
@@ -807,7 +823,7 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
 
         const Etc::ErrorMetric errorMetric = Etc::ErrorMetric::RGBA;
         const float effort = 1.0f;
-        const int numEncodeThreads = 4;
+        const int numEncodeThreads = std::max(4, (int)std::thread::hardware_concurrency());
         int encodingTime;
 
         if (localCopy.getFormat() != Image::Format_RGBAF) {
@@ -13,6 +13,7 @@
 #define hifi_ktx_KTX_h
 
 #include <array>
+#include <functional>
 #include <list>
 #include <vector>
 #include <cstdint>
@@ -356,6 +357,13 @@ namespace ktx {
         static size_t writeKeyValues(Byte* destBytes, size_t destByteSize, const KeyValues& keyValues);
         static Images writeImages(Byte* destBytes, size_t destByteSize, const Images& images);
 
+        // Streaming alternative to write(): emits the header, the key-values and then each mip in
+        // order through the callback, so the serialized KTX never has to be staged in one
+        // contiguous allocation. The callback returns false to abort (e.g. on a failed file write).
+        using WriteCallback = std::function<bool(const Byte* data, size_t byteSize)>;
+        static bool writeToCallback(const WriteCallback& write, const Header& header, const Images& srcImages,
+                                    const KeyValues& keyValues = KeyValues());
+
         void writeMipData(uint16_t level, const Byte* sourceBytes, size_t source_size);
 
         // Parse a block of memory and create a KTX object from it
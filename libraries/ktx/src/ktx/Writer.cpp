@@ -163,6 +163,47 @@ namespace ktx {
         return destByteSize;
     }
 
+    bool KTX::writeToCallback(const WriteCallback& write, const Header& header, const Images& srcImages,
+                              const KeyValues& keyValues) {
+        // Header, with the key-value byte count patched in
+        Header destHeader = header;
+        destHeader.bytesOfKeyValueData = keyValues.empty() ? 0 : (uint32_t)KeyValue::serializedKeyValuesByteSize(keyValues);
+        if (!write(reinterpret_cast<const Byte*>(&destHeader), sizeof(Header))) {
+            return false;
+        }
+
+        // KeyValues are small, stage just them
+        if (!keyValues.empty()) {
+            std::vector<Byte> keyValueData(destHeader.bytesOfKeyValueData, 0);
+            if (writeKeyValues(keyValueData.data(), keyValueData.size(), keyValues) != keyValueData.size()) {
+                return false;
+            }
+            if (!write(keyValueData.data(), keyValueData.size())) {
+                return false;
+            }
+        }
+
+        // Images stream through one face at a time, mirroring the layout produced by writeImages
+        static const Byte PAD_BYTES[ALIGNMENT] = { 0 };
+        for (const auto& image : srcImages) {
+            uint32_t imageFaceSize = image._faceSize; // the imageSize written in the ktx is the FACE size
+            if (!write(reinterpret_cast<const Byte*>(&imageFaceSize), sizeof(imageFaceSize))) {
+                return false;
+            }
+            for (uint32_t face = 0; face < image._numFaces; face++) {
+                if (!write(image._faceBytes[face], image._faceSize)) {
+                    return false;
+                }
+            }
+            auto padding = evalPadding(image._imageSize);
+            if (padding != 0 && !write(PAD_BYTES, padding)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     uint32_t KeyValue::writeSerializedKeyAndValue(Byte* destBytes, uint32_t destByteSize, const KeyValue& keyval) {
         uint32_t keyvalSize = keyval.serializedByteSize();
         if (keyvalSize > destByteSize) {
@@ -1152,13 +1152,15 @@ void NetworkTexture::refresh() {
     Resource::refresh();
 }
 
-ImageReader::ImageReader(const QWeakPointer<Resource>& resource, const QUrl& url, const QByteArray& data, size_t extraHash, int maxNumPixels, image::ColorChannel sourceChannel) :
+ImageReader::ImageReader(const QWeakPointer<Resource>& resource, const QUrl& url, const QByteArray& data, size_t extraHash, int maxNumPixels, image::ColorChannel sourceChannel,
+                         std::shared_ptr<std::atomic<bool>> abortProcessing) :
     _resource(resource),
     _url(url),
     _content(data),
     _extraHash(extraHash),
     _maxNumPixels(maxNumPixels),
-    _sourceChannel(sourceChannel)
+    _sourceChannel(sourceChannel),
+    _abortProcessing(abortProcessing)
 {
     DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
     listSupportedImageFormats();
@@ -1208,7 +1210,7 @@ void ImageReader::run() {
 
 void ImageReader::read() {
     auto resource = _resource.lock(); // to ensure the resource is still needed
-    if (!resource) {
+    if (!resource || _abortProcessing->load()) {
         return;
     }
     auto networkTexture = resource.staticCast<NetworkTexture>();
@@ -1266,7 +1268,21 @@ void ImageReader::read() {
         constexpr bool shouldCompress = false;
 #endif
         auto target = getBackendTarget();
-        texture = image::processImage(std::move(buffer), _url.toString().toStdString(), _sourceChannel, _maxNumPixels, networkTexture->getTextureType(), shouldCompress, target);
+
+        // drop our reference for the duration of the transcode, so that if everything else lets
+        // go of this texture mid-work its destructor flips the abort flag and processImage bails
+        // between mips instead of running to completion
+        auto textureType = networkTexture->getTextureType();
+        auto fallbackTexture = networkTexture->getFallbackTexture();
+        networkTexture.reset();
+        resource.reset();
+
+        texture = image::processImage(std::move(buffer), _url.toString().toStdString(), _sourceChannel, _maxNumPixels, textureType, shouldCompress, target, *_abortProcessing);
+
+        resource = _resource.lock();
+        if (!resource || _abortProcessing->load()) {
+            return;
+        }
 
         if (!texture) {
             QMetaObject::invokeMethod(resource.data(), "setImage",
@@ -1277,7 +1293,7 @@ void ImageReader::read() {
         }
 
         texture->setSourceHash(hash);
-        texture->setFallbackTexture(networkTexture->getFallbackTexture());
+        texture->setFallbackTexture(fallbackTexture);
     }
 
     // Save the image into a KTXFile
@@ -12,6 +12,8 @@
 #ifndef hifi_TextureCache_h
 #define hifi_TextureCache_h
 
+#include <atomic>
+#include <memory>
 #include <gpu/Texture.h>
 
 #include <QImage>
@@ -50,6 +52,10 @@ public:
     NetworkTexture(const NetworkTexture& other);
     ~NetworkTexture() override;
 
+    // flipped when the texture's last referent disappears, so queued or in-progress transcode
+    // work for it bails out instead of running to completion
+    std::shared_ptr<std::atomic<bool>> getTranscodeAbortFlag() const { return _transcodeAborted; }
+
     QString getType() const override { return "NetworkTexture"; }
 
     int getOriginalWidth() const { return _originalWidth; }
@@ -140,6 +146,7 @@ private:
     int _originalHeight { 0 };
     int _width { 0 };
     int _height { 0 };
+    std::shared_ptr<std::atomic<bool>> _transcodeAborted { std::make_shared<std::atomic<bool>>(false) };
     int _maxNumPixels { ABSOLUTE_MAX_TEXTURE_NUM_PIXELS };
     QByteArray _content;
 
@@ -11,6 +11,8 @@
 
 #include "ModelMath.h"
 
+#include <TBBHelpers.h>
+
 #include <LogHandler.h>
 #include "ModelBakerLogging.h"
 
@@ -39,25 +41,49 @@ namespace baker {
         return vector[i];
     }
 
-    void setTangent(const HFMMesh& mesh, const IndexAccessor& vertexAccessor, int firstIndex, int secondIndex) {
+    // Computes one edge's tangent contribution without accumulating it. This is a pure function of
+    // the accessor's outputs, so it is safe to evaluate on any thread; returns nullptr when the
+    // edge does not contribute.
+    static glm::vec3* evalTangentContribution(const IndexAccessor& vertexAccessor, int firstIndex, int secondIndex,
+                                              glm::vec3& contributionOut) {
         glm::vec3 vertex[2];
         glm::vec2 texCoords[2];
         glm::vec3 normal;
         glm::vec3* tangent = vertexAccessor(firstIndex, secondIndex, vertex, texCoords, normal);
+        if (!tangent) {
+            return nullptr;
+        }
+        glm::vec3 bitangent = glm::cross(normal, vertex[1] - vertex[0]);
+        if (glm::length(bitangent) < EPSILON) {
+            return nullptr;
+        }
+        glm::vec2 texCoordDelta = texCoords[1] - texCoords[0];
+        glm::vec3 normalizedNormal = glm::normalize(normal);
+        contributionOut = glm::cross(glm::angleAxis(-atan2f(-texCoordDelta.t, texCoordDelta.s), normalizedNormal) *
+            glm::normalize(bitangent), normalizedNormal);
+        return tangent;
+    }
+
+    void setTangent(const HFMMesh& mesh, const IndexAccessor& vertexAccessor, int firstIndex, int secondIndex) {
+        glm::vec3 contribution;
+        glm::vec3* tangent = evalTangentContribution(vertexAccessor, firstIndex, secondIndex, contribution);
         if (tangent) {
-            glm::vec3 bitangent = glm::cross(normal, vertex[1] - vertex[0]);
-            if (glm::length(bitangent) < EPSILON) {
-                return;
-            }
-            glm::vec2 texCoordDelta = texCoords[1] - texCoords[0];
-            glm::vec3 normalizedNormal = glm::normalize(normal);
-            *tangent += glm::cross(glm::angleAxis(-atan2f(-texCoordDelta.t, texCoordDelta.s), normalizedNormal) *
-                glm::normalize(bitangent), normalizedNormal);
+            *tangent += contribution;
         }
     }
 
     void calculateNormals(const hfm::Mesh& mesh, NormalAccessor normalAccessor, VertexSetter vertexSetter) {
         static int repeatMessageID = LogHandler::getInstance().newRepeatedMessageID();
+
+        // One entry per quad or triangle whose normals are all present in the mesh, gathered in the
+        // order the serial loop would visit them
+        struct FaceJob {
+            glm::vec3* normals[4];
+            int indices[3];
+            int numNormals;
+            glm::vec3 faceNormal;
+        };
+        std::vector<FaceJob> faces;
         for (const HFMMeshPart& part : mesh.parts) {
             for (int i = 0; i < part.quadIndices.size(); i += 4) {
                 glm::vec3* n0 = normalAccessor(part.quadIndices[i]);
@@ -68,11 +94,10 @@ namespace baker {
                     // Quad is not in the mesh (can occur with blendshape meshes, which are a subset of the hfm Mesh vertices)
                     continue;
                 }
-                glm::vec3 vertices[3]; // Assume all vertices in this quad are in the same plane, so only the first three are needed to calculate the normal
-                vertexSetter(part.quadIndices[i], vertices[0]);
-                vertexSetter(part.quadIndices[i + 1], vertices[1]);
-                vertexSetter(part.quadIndices[i + 2], vertices[2]);
-                *n0 = *n1 = *n2 = *n3 = glm::cross(vertices[1] - vertices[0], vertices[2] - vertices[0]);
+                // Assume all vertices in this quad are in the same plane, so only the first three are needed to calculate the normal
+                faces.push_back({ { n0, n1, n2, n3 },
+                                  { part.quadIndices[i], part.quadIndices[i + 1], part.quadIndices[i + 2] },
+                                  4, glm::vec3() });
             }
             // <= size - 3 in order to prevent overflowing triangleIndices when (i % 3) != 0
             // This is most likely evidence of a further problem in extractMesh()
@@ -84,38 +109,95 @@ namespace baker {
                     // Tri is not in the mesh (can occur with blendshape meshes, which are a subset of the hfm Mesh vertices)
                     continue;
                 }
-                glm::vec3 vertices[3];
-                vertexSetter(part.triangleIndices[i], vertices[0]);
-                vertexSetter(part.triangleIndices[i + 1], vertices[1]);
-                vertexSetter(part.triangleIndices[i + 2], vertices[2]);
-                *n0 = *n1 = *n2 = glm::cross(vertices[1] - vertices[0], vertices[2] - vertices[0]);
+                faces.push_back({ { n0, n1, n2, nullptr },
+                                  { part.triangleIndices[i], part.triangleIndices[i + 1], part.triangleIndices[i + 2] },
+                                  3, glm::vec3() });
             }
             if ((part.triangleIndices.size() % 3) != 0) {
                 HIFI_FCDEBUG_ID(model_baker(), repeatMessageID, "Error in baker::calculateNormals: part.triangleIndices.size() is not divisible by three");
             }
         }
+
+        // The face normals are pure functions of the vertex data, so they compute across worker
+        // threads; the assignments then happen serially in face order, so vertices shared between
+        // faces end up with the same (last-writer) normal as the serial loop
+        auto computeFaceNormal = [&vertexSetter](FaceJob& face) {
+            glm::vec3 vertices[3];
+            vertexSetter(face.indices[0], vertices[0]);
+            vertexSetter(face.indices[1], vertices[1]);
+            vertexSetter(face.indices[2], vertices[2]);
+            face.faceNormal = glm::cross(vertices[1] - vertices[0], vertices[2] - vertices[0]);
+        };
+
+        const size_t MIN_PARALLEL_FACES = 4096;
+        if (faces.size() < MIN_PARALLEL_FACES) {
+            for (auto& face : faces) {
+                computeFaceNormal(face);
+            }
+        } else {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, faces.size()), [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i < range.end(); i++) {
+                    computeFaceNormal(faces[i]);
+                }
+            });
+        }
+
+        for (const auto& face : faces) {
+            for (int i = 0; i < face.numNormals; i++) {
+                *face.normals[i] = face.faceNormal;
+            }
+        }
     }
 
     void calculateTangents(const hfm::Mesh& mesh, IndexAccessor accessor) {
         static int repeatMessageID = LogHandler::getInstance().newRepeatedMessageID();
+
+        // Gather every contributing edge across all parts in the order the serial accumulation
+        // would visit them
+        std::vector<std::pair<int, int>> edges;
         for (const HFMMeshPart& part : mesh.parts) {
             for (int i = 0; i < part.quadIndices.size(); i += 4) {
-                setTangent(mesh, accessor, part.quadIndices.at(i), part.quadIndices.at(i + 1));
-                setTangent(mesh, accessor, part.quadIndices.at(i + 1), part.quadIndices.at(i + 2));
-                setTangent(mesh, accessor, part.quadIndices.at(i + 2), part.quadIndices.at(i + 3));
-                setTangent(mesh, accessor, part.quadIndices.at(i + 3), part.quadIndices.at(i));
+                edges.emplace_back(part.quadIndices.at(i), part.quadIndices.at(i + 1));
+                edges.emplace_back(part.quadIndices.at(i + 1), part.quadIndices.at(i + 2));
+                edges.emplace_back(part.quadIndices.at(i + 2), part.quadIndices.at(i + 3));
+                edges.emplace_back(part.quadIndices.at(i + 3), part.quadIndices.at(i));
             }
             // <= size - 3 in order to prevent overflowing triangleIndices when (i % 3) != 0
             // This is most likely evidence of a further problem in extractMesh()
             for (int i = 0; i <= part.triangleIndices.size() - 3; i += 3) {
-                setTangent(mesh, accessor, part.triangleIndices.at(i), part.triangleIndices.at(i + 1));
-                setTangent(mesh, accessor, part.triangleIndices.at(i + 1), part.triangleIndices.at(i + 2));
-                setTangent(mesh, accessor, part.triangleIndices.at(i + 2), part.triangleIndices.at(i));
+                edges.emplace_back(part.triangleIndices.at(i), part.triangleIndices.at(i + 1));
+                edges.emplace_back(part.triangleIndices.at(i + 1), part.triangleIndices.at(i + 2));
+                edges.emplace_back(part.triangleIndices.at(i + 2), part.triangleIndices.at(i));
             }
             if ((part.triangleIndices.size() % 3) != 0) {
                 HIFI_FCDEBUG_ID(model_baker(), repeatMessageID, "Error in baker::calculateTangents: part.triangleIndices.size() is not divisible by three");
             }
         }
+
+        const size_t MIN_PARALLEL_EDGES = 4096;
+        if (edges.size() < MIN_PARALLEL_EDGES) {
+            for (const auto& edge : edges) {
+                setTangent(mesh, accessor, edge.first, edge.second);
+            }
+            return;
+        }
+
+        // The expensive per-edge math (cross products, atan2, normalizations) is a pure function of
+        // the mesh data, so it runs across worker threads; the float accumulation then happens
+        // serially in the original edge order, which keeps the result bit-identical to the serial
+        // path regardless of thread count
+        std::vector<std::pair<glm::vec3*, glm::vec3>> contributions(edges.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, edges.size()), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); i++) {
+                contributions[i].first = evalTangentContribution(accessor, edges[i].first, edges[i].second,
+                                                                 contributions[i].second);
+            }
+        });
+        for (const auto& contribution : contributions) {
+            if (contribution.first) {
+                *contribution.first += contribution.second;
+            }
+        }
     }
 }
 
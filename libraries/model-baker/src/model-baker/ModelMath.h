@@ -36,6 +36,11 @@ namespace baker {
         }
     }
 
+    // Note: both passes below fan their per-face/per-edge math across worker threads for large
+    // meshes, so the accessors must be safe to invoke concurrently (in practice they only read
+    // mesh data and return pointers into preallocated output arrays). Accumulation into the
+    // outputs always happens on the calling thread, in the original index order.
+
     // Returns a reference to the normal at the specified index, or nullptr if it cannot be accessed
     using NormalAccessor = std::function<glm::vec3*(int index)>;
 
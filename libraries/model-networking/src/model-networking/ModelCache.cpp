@@ -16,7 +16,11 @@
 #include <gpu/Batch.h>
 #include <gpu/Stream.h>
 
+#include <map>
+#include <mutex>
+
 #include <QThreadPool>
+#include <QtCore/QCryptographicHash>
 
 #include <Gzip.h>
 
@@ -85,6 +89,63 @@ namespace std {
     };
 }
 
+// Shares processed model data between resources whose raw payload and processing mapping are
+// identical, even when they arrive under different URLs or query strings. Entries hold weak
+// references to the model, so shared data is released once the last resource using it goes away.
+class GeometryContentCache {
+public:
+    static GeometryContentCache& instance() {
+        static GeometryContentCache cache;
+        return cache;
+    }
+
+    static QByteArray computeKey(const QByteArray& data, const GeometryMappingPair& mapping, bool combineParts) {
+        QCryptographicHash hasher(QCryptographicHash::Sha256);
+        hasher.addData(data);
+        size_t mappingHash = 0;
+        hash_combine(mappingHash, mapping.first, mapping.second, combineParts);
+        hasher.addData(reinterpret_cast<const char*>(&mappingHash), sizeof(mappingHash));
+        return hasher.result();
+    }
+
+    bool lookup(const QByteArray& contentKey, HFMModel::Pointer& hfmModelOut, MaterialMapping& materialMappingOut) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _entries.find(contentKey);
+        if (it == _entries.end()) {
+            return false;
+        }
+        auto hfmModel = it->second.hfmModel.lock();
+        if (!hfmModel) {
+            _entries.erase(it);
+            return false;
+        }
+        hfmModelOut = hfmModel;
+        materialMappingOut = it->second.materialMapping;
+        return true;
+    }
+
+    void store(const QByteArray& contentKey, const HFMModel::Pointer& hfmModel, const MaterialMapping& materialMapping) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // drop entries whose models have been released
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            if (it->second.hfmModel.expired()) {
+                it = _entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        _entries[contentKey] = { hfmModel, materialMapping };
+    }
+
+private:
+    struct Entry {
+        std::weak_ptr<HFMModel> hfmModel;
+        MaterialMapping materialMapping;
+    };
+    std::mutex _mutex;
+    std::map<QByteArray, Entry> _entries;
+};
+
 class GeometryReader : public QRunnable {
 public:
     GeometryReader(const ModelLoader& modelLoader, QWeakPointer<Resource>& resource, const QUrl& url, const GeometryMappingPair& mapping,
@@ -139,6 +200,20 @@ void GeometryReader::run() {
             throw QString("url is invalid");
         }
 
+        // Content-hash layer beneath the URL keying: an identical payload processed with an
+        // identical mapping yields an identical processed model, so reuse it instead of
+        // parsing, baking and uploading a duplicate
+        auto contentKey = GeometryContentCache::computeKey(_data, _mapping, _combineParts);
+        {
+            HFMModel::Pointer sharedModel;
+            MaterialMapping sharedMaterialMapping;
+            if (GeometryContentCache::instance().lookup(contentKey, sharedModel, sharedMaterialMapping)) {
+                QMetaObject::invokeMethod(resource.data(), "setGeometryDefinition",
+                        Q_ARG(HFMModel::Pointer, sharedModel), Q_ARG(MaterialMapping, sharedMaterialMapping));
+                return;
+            }
+        }
+
         HFMModel::Pointer hfmModel;
         QVariantHash serializerMapping = _mapping.second;
         serializerMapping["combineParts"] = _combineParts;
@@ -181,6 +256,8 @@ void GeometryReader::run() {
         auto processedHFMModel = modelBaker.getHFMModel();
         auto materialMapping = modelBaker.getMaterialMapping();
 
+        GeometryContentCache::instance().store(contentKey, processedHFMModel, materialMapping);
+
         QMetaObject::invokeMethod(resource.data(), "setGeometryDefinition",
                 Q_ARG(HFMModel::Pointer, processedHFMModel), Q_ARG(MaterialMapping, materialMapping));
     } catch (const std::exception&) {
@@ -12,6 +12,7 @@
 #include "AddressManager.h"
 
 #include <QGuiApplication>
+#include <QtNetwork/QHostInfo>
 #include <QClipboard>
 #include <QDebug>
 #include <QJsonDocument>
@@ -485,6 +486,11 @@ void AddressManager::goToAddressFromObject(const QVariantMap& dataObject, const
 
                     qCDebug(networking) << "Possible domain change required to connect to" << domainHostname
                         << "on" << domainPort;
+
+                    // warm the resolver for the next domain immediately, concurrent with the
+                    // teardown of the current one - the handler's own lookup then hits the cache
+                    QHostInfo::lookupHost(domainHostname, this, [](const QHostInfo&) {});
+
                     QUrl domainURL;
                     domainURL.setScheme(URL_SCHEME_HIFI);
                     domainURL.setHost(domainHostname);
@@ -498,6 +504,9 @@ void AddressManager::goToAddressFromObject(const QVariantMap& dataObject, const
                     qCDebug(networking_ice) << "Possible domain change required to connect to domain with ID" << domainID
                         << "via ice-server at" << iceServerAddress;
 
+                    // same resolver pre-warm for the ICE path
+                    QHostInfo::lookupHost(iceServerAddress, this, [](const QHostInfo&) {});
+
                     emit possibleDomainChangeRequiredViaICEForID(iceServerAddress, domainID);
                 }
 
@@ -17,7 +17,7 @@
 #include <QtCore/QStandardPaths>
 #include <QtCore/QThread>
 #include <QtScript/QScriptEngine>
-#include <QtNetwork/QNetworkDiskCache>
+#include "SegmentedDiskCache.h"
 
 #include <shared/GlobalAppProperties.h>
 #include <shared/MiniPromises.h>
@@ -67,16 +67,16 @@ void AssetClient::initCaching() {
 #endif
             _cacheDir = !cachePath.isEmpty() ? cachePath : "interfaceCache";
         }
-        QNetworkDiskCache* cache = new QNetworkDiskCache();
-        cache->setMaximumCacheSize(MAXIMUM_CACHE_SIZE);
-        cache->setCacheDirectory(_cacheDir);
+        auto cache = new SegmentedDiskCache(_cacheDir + "/segmented-cache", MAXIMUM_CACHE_SIZE);
         networkAccessManager.setCache(cache);
-        qInfo() << "ResourceManager disk cache setup at" << _cacheDir
+        qInfo() << "ResourceManager disk cache setup at" << cache->cacheDirectory()
                  << "(size:" << MAXIMUM_CACHE_SIZE / BYTES_PER_GIGABYTES << "GB)";
     } else {
-        auto cache = qobject_cast<QNetworkDiskCache*>(networkAccessManager.cache());
-        qInfo() << "ResourceManager disk cache already setup at" << cache->cacheDirectory()
-                << "(size:" << cache->maximumCacheSize() / BYTES_PER_GIGABYTES << "GB)";
+        auto cache = qobject_cast<SegmentedDiskCache*>(networkAccessManager.cache());
+        if (cache) {
+            qInfo() << "ResourceManager disk cache already setup at" << cache->cacheDirectory()
+                    << "(size:" << cache->maximumCacheSize() / BYTES_PER_GIGABYTES << "GB)";
+        }
     }
 
 }
@@ -99,7 +99,7 @@ MiniPromise::Promise AssetClient::cacheInfoRequestAsync(MiniPromise::Promise def
     if (QThread::currentThread() != thread()) {
         QMetaObject::invokeMethod(this, "cacheInfoRequestAsync", Q_ARG(MiniPromise::Promise, deferred));
     } else {
-        auto cache = qobject_cast<QNetworkDiskCache*>(NetworkAccessManager::getInstance().cache());
+        auto cache = qobject_cast<SegmentedDiskCache*>(NetworkAccessManager::getInstance().cache());
         if (cache) {
             deferred->resolve({
                 { "cacheDirectory", cache->cacheDirectory() },
@@ -292,7 +292,7 @@ void AssetClient::cacheInfoRequest(QObject* reciever, QString slot) {
     }
 
 
-    if (auto* cache = qobject_cast<QNetworkDiskCache*>(NetworkAccessManager::getInstance().cache())) {
+    if (auto* cache = qobject_cast<SegmentedDiskCache*>(NetworkAccessManager::getInstance().cache())) {
         QMetaObject::invokeMethod(reciever, slot.toStdString().data(), Qt::QueuedConnection,
                                   Q_ARG(QString, cache->cacheDirectory()),
                                   Q_ARG(qint64, cache->cacheSize()),
@@ -25,6 +25,23 @@
 
 static int requestID = 0;
 
+// whole-asset requests at or above this size are fetched as concurrent ranged
+// chunks so that a single sequential stream does not bound throughput on
+// high-RTT links
+const int64_t MIN_CHUNKED_DOWNLOAD_SIZE = 4 * 1024 * 1024;
+const int64_t ASSET_CHUNK_SIZE = 1024 * 1024;
+
+static int maxConcurrentChunks() {
+    static int concurrency = [] {
+        const int DEFAULT_CONCURRENCY = 4;
+        const int MAX_CONCURRENCY = 16;
+        bool ok = false;
+        int value = qEnvironmentVariableIntValue("HIFI_ASSET_CHUNK_CONCURRENCY", &ok);
+        return (ok && value > 0) ? std::min(value, MAX_CONCURRENCY) : DEFAULT_CONCURRENCY;
+    }();
+    return concurrency;
+}
+
 AssetRequest::AssetRequest(const QString& hash, const ByteRange& byteRange) :
     _requestID(++requestID),
     _hash(hash),
@@ -38,6 +55,14 @@ AssetRequest::~AssetRequest() {
     if (_assetRequestID) {
         assetClient->cancelGetAssetRequest(_assetRequestID);
     }
+    if (_infoRequestID != INVALID_MESSAGE_ID) {
+        assetClient->cancelGetAssetInfoRequest(_infoRequestID);
+    }
+    for (auto chunkRequestID : _chunkRequestIDs) {
+        if (chunkRequestID != INVALID_MESSAGE_ID) {
+            assetClient->cancelGetAssetRequest(chunkRequestID);
+        }
+    }
 }
 
 void AssetRequest::start() {
@@ -75,6 +100,35 @@ void AssetRequest::start() {
 
     _state = WaitingForData;
 
+    if (!_byteRange.isSet()) {
+        // ask the server for the asset's size first; large assets are pulled as a
+        // window of concurrent ranged chunks, everything else through the
+        // single-request path
+        auto assetClient = DependencyManager::get<AssetClient>();
+        auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
+        _infoRequestID = assetClient->getAssetInfo(_hash,
+            [this, that](bool responseReceived, AssetUtils::AssetServerError serverError, AssetInfo info) {
+
+            if (!that) {
+                return;
+            }
+            _infoRequestID = INVALID_MESSAGE_ID;
+
+            if (responseReceived && serverError == AssetUtils::AssetServerError::NoError
+                    && info.size >= MIN_CHUNKED_DOWNLOAD_SIZE) {
+                startChunkedDownload(info.size);
+            } else {
+                // missing or small info response - let the whole-asset request
+                // surface any real error
+                requestWholeAsset();
+            }
+        });
+    } else {
+        requestWholeAsset();
+    }
+}
+
+void AssetRequest::requestWholeAsset() {
     auto assetClient = DependencyManager::get<AssetClient>();
     auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
     auto hash = _hash;
@@ -136,6 +190,101 @@ void AssetRequest::start() {
 }
 
 
+void AssetRequest::startChunkedDownload(int64_t totalSize) {
+    _totalSize = totalSize;
+    _numChunks = (int)((totalSize + ASSET_CHUNK_SIZE - 1) / ASSET_CHUNK_SIZE);
+    _receivedChunks.resize(_numChunks);
+    _chunkRequestIDs.assign(_numChunks, INVALID_MESSAGE_ID);
+
+    int windowSize = std::min(maxConcurrentChunks(), _numChunks);
+    for (int i = 0; i < windowSize; ++i) {
+        requestNextChunk();
+    }
+}
+
+void AssetRequest::requestNextChunk() {
+    if (_nextChunkIndex >= _numChunks || _state == Finished) {
+        return;
+    }
+
+    int chunkIndex = _nextChunkIndex++;
+    int64_t start = (int64_t)chunkIndex * ASSET_CHUNK_SIZE;
+    int64_t end = std::min(start + ASSET_CHUNK_SIZE, _totalSize);
+
+    auto assetClient = DependencyManager::get<AssetClient>();
+    auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
+    _chunkRequestIDs[chunkIndex] = assetClient->getAsset(_hash, start, end,
+        [this, that, chunkIndex, start, end](bool responseReceived, AssetUtils::AssetServerError serverError,
+                                             const QByteArray& data) {
+
+        if (!that || _state == Finished) {
+            // the request is dead or another chunk already failed it
+            return;
+        }
+        _chunkRequestIDs[chunkIndex] = INVALID_MESSAGE_ID;
+
+        if (!responseReceived) {
+            failChunkedDownload(NetworkError);
+        } else if (serverError != AssetUtils::AssetServerError::NoError) {
+            failChunkedDownload(serverError == AssetUtils::AssetServerError::AssetNotFound ? NotFound : UnknownError);
+        } else if (data.size() != end - start) {
+            failChunkedDownload(SizeVerificationFailed);
+        } else {
+            _receivedChunks[chunkIndex] = data;
+            ++_numChunksReceived;
+            _totalReceived += data.size();
+            emit progress(_totalReceived, _totalSize);
+
+            if (_numChunksReceived == _numChunks) {
+                completeChunkedDownload();
+            } else {
+                requestNextChunk();
+            }
+        }
+    }, [](qint64, qint64) {
+        // per-chunk byte progress is folded into whole-chunk progress above
+    });
+}
+
+void AssetRequest::completeChunkedDownload() {
+    _data.clear();
+    _data.reserve((int)_totalSize);
+    for (auto& chunk : _receivedChunks) {
+        _data.append(chunk);
+        chunk = QByteArray();
+    }
+    _receivedChunks.clear();
+
+    // ranged replies cannot be verified individually, so the reassembled asset
+    // is checked against the content hash before anyone sees the data
+    if (AssetUtils::hashData(_data).toHex() != _hash) {
+        _data.clear();
+        failChunkedDownload(HashVerificationFailed);
+        return;
+    }
+
+    AssetUtils::saveToCache(getUrl(), _data);
+
+    _state = Finished;
+    emit finished(this);
+}
+
+void AssetRequest::failChunkedDownload(Error error) {
+    _error = error;
+    qCWarning(asset_client) << "Got error retrieving asset" << _hash << "- error code" << _error;
+
+    auto assetClient = DependencyManager::get<AssetClient>();
+    for (auto& chunkRequestID : _chunkRequestIDs) {
+        if (chunkRequestID != INVALID_MESSAGE_ID) {
+            assetClient->cancelGetAssetRequest(chunkRequestID);
+            chunkRequestID = INVALID_MESSAGE_ID;
+        }
+    }
+
+    _state = Finished;
+    emit finished(this);
+}
+
 const QString AssetRequest::getErrorString() const {
     QString result;
     if (_error != Error::NoError) {
@@ -12,6 +12,8 @@
 #ifndef hifi_AssetRequest_h
 #define hifi_AssetRequest_h
 
+#include <vector>
+
 #include <QByteArray>
 #include <QObject>
 #include <QString>
@@ -62,6 +64,12 @@ signals:
     void progress(qint64 totalReceived, qint64 total);
 
 private:
+    void requestWholeAsset();
+    void startChunkedDownload(int64_t totalSize);
+    void requestNextChunk();
+    void completeChunkedDownload();
+    void failChunkedDownload(Error error);
+
     int _requestID;
     State _state = NotStarted;
     Error _error = NoError;
@@ -70,8 +78,18 @@ private:
     QByteArray _data;
     int _numPendingRequests { 0 };
     MessageID _assetRequestID { INVALID_MESSAGE_ID };
+    MessageID _infoRequestID { INVALID_MESSAGE_ID };
     const ByteRange _byteRange;
     bool _loadedFromCache { false };
+
+    // chunked download state, only used for whole-asset requests large
+    // enough to be split into concurrent ranged requests
+    int64_t _totalSize { 0 };
+    int _numChunks { 0 };
+    int _nextChunkIndex { 0 };
+    int _numChunksReceived { 0 };
+    std::vector<QByteArray> _receivedChunks;
+    std::vector<MessageID> _chunkRequestIDs;
 };
 
 #endif
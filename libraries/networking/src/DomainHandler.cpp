@@ -100,6 +100,7 @@ void DomainHandler::sendDisconnectPacket() {
 
 void DomainHandler::clearSettings() {
     _settingsObject = QJsonObject();
+    _settingsEpoch = 0;
 }
 
 void DomainHandler::softReset(QString reason) {
@@ -408,14 +409,54 @@ void DomainHandler::requestDomainSettings() {
     _settingsTimer.start();
 }
 
+// applies a settings delta in place: null removes a key, nested objects merge recursively,
+// anything else replaces
+static void mergeSettingsDelta(QJsonObject& base, const QJsonObject& delta) {
+    for (auto it = delta.constBegin(); it != delta.constEnd(); ++it) {
+        if (it.value().isNull()) {
+            base.remove(it.key());
+        } else if (it.value().isObject() && base.value(it.key()).isObject()) {
+            QJsonObject merged = base.value(it.key()).toObject();
+            mergeSettingsDelta(merged, it.value().toObject());
+            base[it.key()] = merged;
+        } else {
+            base[it.key()] = it.value();
+        }
+    }
+}
+
 void DomainHandler::processSettingsPacketList(QSharedPointer<ReceivedMessage> packetList) {
     // stop our settings timer since we successfully requested the settings we need
     _settingsTimer.stop();
     
     auto data = packetList->getMessage();
 
-    _settingsObject = QJsonDocument::fromJson(data).object();
-    
+    auto receivedObject = QJsonDocument::fromJson(data).object();
+
+    static const QString SETTINGS_EPOCH_KEY = "_epoch";
+    static const QString SETTINGS_DELTA_KEY = "_delta";
+    quint64 receivedEpoch = (quint64)receivedObject.take(SETTINGS_EPOCH_KEY).toDouble();
+
+    if (receivedObject.take(SETTINGS_DELTA_KEY).toBool()) {
+        // a delta is only applicable on top of the epoch right before it; anything else means
+        // we missed an update and need the full document again
+        if (_settingsObject.isEmpty() || receivedEpoch != _settingsEpoch + 1) {
+            qCDebug(networking) << "Received settings delta for epoch" << receivedEpoch
+                << "but have epoch" << _settingsEpoch << "- requesting full settings";
+            requestDomainSettings();
+            return;
+        }
+        mergeSettingsDelta(_settingsObject, receivedObject);
+        _settingsEpoch = receivedEpoch;
+        qCDebug(networking) << "Applied domain settings delta for epoch" << receivedEpoch;
+
+        emit settingsReceived(_settingsObject);
+        return;
+    }
+
+    _settingsObject = receivedObject;
+    _settingsEpoch = receivedEpoch;
+
     if (!_settingsObject.isEmpty()) {
         qCDebug(networking) << "Received domain settings: \n" << _settingsObject;
     }
@@ -257,6 +257,7 @@ private:
     bool _isConnected { false };
     bool _isInErrorState { false };
     QJsonObject _settingsObject;
+    quint64 _settingsEpoch { 0 };
     QString _pendingPath;
     QTimer _settingsTimer;
     mutable ReadWriteLockable _interstitialModeSettingLock;
@@ -251,7 +251,7 @@ bool LimitedNodeList::packetVersionMatch(const udt::Packet& packet) {
         const HifiSockAddr& senderSockAddr = packet.getSenderSockAddr();
         QUuid sourceID;
 
-        if (PacketTypeEnum::getNonSourcedPackets().contains(headerType)) {
+        if (PacketTypeEnum::isNonSourcedPacket(headerType)) {
             hasBeenOutput = versionDebugSuppressMap.contains(senderSockAddr, headerType);
 
             if (!hasBeenOutput) {
@@ -290,7 +290,7 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
 
     PacketType headerType = NLPacket::typeInHeader(packet);
 
-    if (PacketTypeEnum::getNonSourcedPackets().contains(headerType)) {
+    if (PacketTypeEnum::isNonSourcedPacket(headerType)) {
         if (PacketTypeEnum::getReplicatedPacketMapping().key(headerType) != PacketType::Unknown) {
             // this is a replicated packet type - make sure the socket that sent it to us matches
             // one from one of our current upstream nodes
@@ -335,14 +335,14 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
             !isDomainServer() &&
             sourceLocalID == getDomainLocalID() &&
             packet.getSenderSockAddr() == getDomainSockAddr() &&
-            PacketTypeEnum::getDomainSourcedPackets().contains(headerType)) {
+            PacketTypeEnum::isDomainSourcedPacket(headerType)) {
             // This is a packet sourced by the domain server
             return true;
         }
 
         if (sourceNode) {
-            bool verifiedPacket = !PacketTypeEnum::getNonVerifiedPackets().contains(headerType);
-            bool verificationEnabled = !(isDomainServer() && PacketTypeEnum::getDomainIgnoredVerificationPackets().contains(headerType))
+            bool verifiedPacket = !PacketTypeEnum::isNonVerifiedPacket(headerType);
+            bool verificationEnabled = !(isDomainServer() && PacketTypeEnum::isDomainIgnoredVerificationPacket(headerType))
                 && _useAuthentication;
 
             if (verifiedPacket && verificationEnabled) {
@@ -386,13 +386,13 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
 }
 
 void LimitedNodeList::fillPacketHeader(const NLPacket& packet, HMACAuth* hmacAuth) {
-    if (!PacketTypeEnum::getNonSourcedPackets().contains(packet.getType())) {
+    if (!PacketTypeEnum::isNonSourcedPacket(packet.getType())) {
         packet.writeSourceID(getSessionLocalID());
     }
 
     if (_useAuthentication && hmacAuth
-        && !PacketTypeEnum::getNonSourcedPackets().contains(packet.getType())
-        && !PacketTypeEnum::getNonVerifiedPackets().contains(packet.getType())) {
+        && !PacketTypeEnum::isNonSourcedPacket(packet.getType())
+        && !PacketTypeEnum::isNonVerifiedPacket(packet.getType())) {
         packet.writeVerificationHash(*hmacAuth);
     }
 }
@@ -576,18 +576,57 @@ NodeData* LimitedNodeList::getOrCreateLinkedData(SharedNodePointer node) {
     return node->getLinkedData();
 }
 
+void LimitedNodeList::shardInsertNode(const SharedNodePointer& node) {
+    {
+        auto& shard = uuidShard(node->getUUID());
+        QWriteLocker locker(&shard.lock);
+        shard.nodes[node->getUUID()] = node;
+    }
+    {
+        auto& shard = localIDShard(node->getLocalID());
+        QWriteLocker locker(&shard.lock);
+        shard.nodes[node->getLocalID()] = node;
+    }
+}
+
+void LimitedNodeList::shardRemoveNode(const QUuid& uuid, Node::LocalID localID) {
+    {
+        auto& shard = uuidShard(uuid);
+        QWriteLocker locker(&shard.lock);
+        shard.nodes.erase(uuid);
+    }
+    {
+        auto& shard = localIDShard(localID);
+        QWriteLocker locker(&shard.lock);
+        shard.nodes.erase(localID);
+    }
+}
+
+void LimitedNodeList::shardClearNodes() {
+    for (auto& shard : _uuidShards) {
+        QWriteLocker locker(&shard.lock);
+        shard.nodes.clear();
+    }
+    for (auto& shard : _localIDShards) {
+        QWriteLocker locker(&shard.lock);
+        shard.nodes.clear();
+    }
+}
+
 SharedNodePointer LimitedNodeList::nodeWithUUID(const QUuid& nodeUUID) {
-    QReadLocker readLocker(&_nodeMutex);
+    auto& shard = uuidShard(nodeUUID);
+    QReadLocker readLocker(&shard.lock);
 
-    NodeHash::const_iterator it = _nodeHash.find(nodeUUID);
-    return it == _nodeHash.cend() ? SharedNodePointer() : it->second;
+    auto it = shard.nodes.find(nodeUUID);
+    return it == shard.nodes.end() ? SharedNodePointer() : it->second;
  }
 
 SharedNodePointer LimitedNodeList::nodeWithLocalID(Node::LocalID localID) const {
-    QReadLocker readLocker(&_nodeMutex);
+    auto& shard = localIDShard(localID);
+    QReadLocker readLocker(&shard.lock);
 
-    LocalIDMapping::const_iterator idIter = _localIDMap.find(localID);
-    return idIter == _localIDMap.cend() ? nullptr : idIter->second;
+    auto it = shard.nodes.find(localID);
+    return it == shard.nodes.end() ? nullptr : it->second;
 }
 
 void LimitedNodeList::eraseAllNodes(QString reason) {
@@ -608,6 +647,7 @@ void LimitedNodeList::eraseAllNodes(QString reason) {
         }
         _localIDMap.clear();
         _nodeHash.clear();
+        shardClearNodes();
     }
 
     foreach(const SharedNodePointer& killedNode, killedNodes) {
@@ -633,6 +673,7 @@ bool LimitedNodeList::killNodeWithUUID(const QUuid& nodeUUID, ConnectionID newCo
             QWriteLocker writeLocker(&_nodeMutex);
             _localIDMap.unsafe_erase(matchingNode->getLocalID());
             _nodeHash.unsafe_erase(matchingNode->getUUID());
+            shardRemoveNode(matchingNode->getUUID(), matchingNode->getLocalID());
         }
 
         handleNodeKill(matchingNode, newConnectionID);
@@ -693,6 +734,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
                 QWriteLocker writeLocker(&_nodeMutex);
                 _localIDMap.unsafe_erase(node->getLocalID());
                 _nodeHash.unsafe_erase(node->getUUID());
+                shardRemoveNode(node->getUUID(), node->getLocalID());
             }
             handleNodeKill(node);
         }
@@ -737,6 +779,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
         // insert the new node and release our read lock
         _nodeHash.insert({ newNode->getUUID(), newNodePointer });
         _localIDMap.insert({ localID, newNodePointer });
+        shardInsertNode(newNodePointer);
     }
 
     qCDebug(networking) << "Added" << *newNode;
@@ -902,6 +945,7 @@ void LimitedNodeList::removeSilentNodes() {
             && (usecTimestampNow() - node->getLastHeardMicrostamp()) > (NODE_SILENCE_THRESHOLD_MSECS * USECS_PER_MSEC)) {
             // call the NodeHash erase to get rid of this node
             _localIDMap.unsafe_erase(node->getLocalID());
+            shardRemoveNode(node->getUUID(), node->getLocalID());
             it = _nodeHash.unsafe_erase(it);
 
             killedNodes.insert(node);
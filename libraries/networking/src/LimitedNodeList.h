@@ -486,6 +486,30 @@ private:
     QUuid _sessionUUID;
     using LocalIDMapping = tbb::concurrent_unordered_map<Node::LocalID, SharedNodePointer>;
     LocalIDMapping _localIDMap;
+
+    // Sharded lookup indexes over _nodeHash/_localIDMap: per-packet
+    // nodeWithUUID/nodeWithLocalID lookups take only their shard's lock, so
+    // they contend neither on the global _nodeMutex nor on each other across
+    // shards. The canonical containers (guarded by _nodeMutex) remain the
+    // source of truth for iteration, and every mutation mirrors into the shards.
+    static const int NUM_NODE_SHARDS = 8;
+    struct UUIDShard {
+        mutable QReadWriteLock lock;
+        std::unordered_map<QUuid, SharedNodePointer, UUIDHasher> nodes;
+    };
+    struct LocalIDShard {
+        mutable QReadWriteLock lock;
+        std::unordered_map<Node::LocalID, SharedNodePointer> nodes;
+    };
+    mutable UUIDShard _uuidShards[NUM_NODE_SHARDS];
+    mutable LocalIDShard _localIDShards[NUM_NODE_SHARDS];
+
+    UUIDShard& uuidShard(const QUuid& uuid) const { return _uuidShards[qHash(uuid) & (NUM_NODE_SHARDS - 1)]; }
+    LocalIDShard& localIDShard(Node::LocalID localID) const { return _localIDShards[localID & (NUM_NODE_SHARDS - 1)]; }
+
+    void shardInsertNode(const SharedNodePointer& node);
+    void shardRemoveNode(const QUuid& uuid, Node::LocalID localID);
+    void shardClearNodes();
     Node::LocalID _sessionLocalID { 0 };
     bool _flagTimeForConnectionStep { false }; // only keep track in interface
 
@@ -14,8 +14,8 @@
 #include "HMACAuth.h"
 
 int NLPacket::localHeaderSize(PacketType type) {
-    bool nonSourced = PacketTypeEnum::getNonSourcedPackets().contains(type);
-    bool nonVerified = PacketTypeEnum::getNonVerifiedPackets().contains(type);
+    bool nonSourced = PacketTypeEnum::isNonSourcedPacket(type);
+    bool nonVerified = PacketTypeEnum::isNonVerifiedPacket(type);
     qint64 optionalSize = (nonSourced ? 0 : NUM_BYTES_LOCALID) + ((nonSourced || nonVerified) ? 0 : NUM_BYTES_MD5_HASH);
     return sizeof(PacketType) + sizeof(PacketVersion) + optionalSize;
 }
@@ -199,7 +199,7 @@ void NLPacket::readVersion() {
 }
 
 void NLPacket::readSourceID() {
-    if (PacketTypeEnum::getNonSourcedPackets().contains(_type)) {
+    if (PacketTypeEnum::isNonSourcedPacket(_type)) {
         _sourceID = NULL_LOCAL_ID;
     } else {
         _sourceID = sourceIDInHeader(*this);
@@ -207,7 +207,7 @@ void NLPacket::readSourceID() {
 }
 
 void NLPacket::writeSourceID(LocalID sourceID) const {
-    Q_ASSERT(!PacketTypeEnum::getNonSourcedPackets().contains(_type));
+    Q_ASSERT(!PacketTypeEnum::isNonSourcedPacket(_type));
     
     auto offset = Packet::totalHeaderSize(isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion);
 
@@ -217,8 +217,8 @@ void NLPacket::writeSourceID(LocalID sourceID) const {
 }
 
 void NLPacket::writeVerificationHash(HMACAuth& hmacAuth) const {
-    Q_ASSERT(!PacketTypeEnum::getNonSourcedPackets().contains(_type) &&
-             !PacketTypeEnum::getNonVerifiedPackets().contains(_type));
+    Q_ASSERT(!PacketTypeEnum::isNonSourcedPacket(_type) &&
+             !PacketTypeEnum::isNonVerifiedPacket(_type));
     
     auto offset = Packet::totalHeaderSize(isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion)
                 + NUM_BYTES_LOCALID;
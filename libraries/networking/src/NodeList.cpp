@@ -938,12 +938,18 @@ void NodeList::stopKeepalivePingTimer() {
 void NodeList::sendKeepAlivePings() {
     // send keep-alive ping packets to nodes of types we care about that are not relayed to us from an upstream node
 
+    // all of the due pings are produced in one pass and flushed as a single batched socket
+    // write, instead of a scatter of tiny sends
+    _nodeSocket.beginDatagramBatch();
+
     eachMatchingNode([this](const SharedNodePointer& node)->bool {
         auto type = node->getType();
         return !node->isUpstream() && _nodeTypesOfInterest.contains(type) && !NodeType::isDownstream(type);
     }, [&](const SharedNodePointer& node) {
         sendPacket(constructPingPacket(node->getUUID()), *node);
     });
+
+    _nodeSocket.endDatagramBatch();
 }
 
 bool NodeList::sockAddrBelongsToDomainOrNode(const HifiSockAddr& sockAddr) {
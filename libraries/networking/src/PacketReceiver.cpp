@@ -123,7 +123,7 @@ QMetaMethod PacketReceiver::matchingMethodForListener(PacketType type, QObject*
         SIGNATURE_TEMPLATE.arg(slot, NON_SOURCED_MESSAGE_LISTENER_PARAMETERS)
     };
 
-    if (!PacketTypeEnum::getNonSourcedPackets().contains(type)) {
+    if (!PacketTypeEnum::isNonSourcedPacket(type)) {
         static const QString SOURCED_MESSAGE_LISTENER_PARAMETERS = "QSharedPointer<ReceivedMessage>,QSharedPointer<Node>";
         static const QString TYPEDEF_SOURCED_MESSAGE_LISTENER_PARAMETERS = "QSharedPointer<ReceivedMessage>,SharedNodePointer";
 
@@ -165,6 +165,18 @@ QMetaMethod PacketReceiver::matchingMethodForListener(PacketType type, QObject*
     }
 }
 
+PacketReceiver::Listener::InvokeStyle PacketReceiver::invokeStyleForMethod(const QMetaMethod& method) {
+    static const QByteArray QSHAREDPOINTER_NODE_NORMALIZED = QMetaObject::normalizedType("QSharedPointer<Node>");
+    static const QByteArray SHARED_NODE_NORMALIZED = QMetaObject::normalizedType("SharedNodePointer");
+
+    if (method.parameterTypes().contains(SHARED_NODE_NORMALIZED)) {
+        return Listener::WithSharedNodePointer;
+    } else if (method.parameterTypes().contains(QSHAREDPOINTER_NODE_NORMALIZED)) {
+        return Listener::WithQSharedPointerNode;
+    }
+    return Listener::MessageOnly;
+}
+
 void PacketReceiver::registerVerifiedListener(PacketType type, QObject* object, const QMetaMethod& slot, bool deliverPending) {
     Q_ASSERT_X(object, "PacketReceiver::registerVerifiedListener", "No object to register");
     QMutexLocker locker(&_packetListenerLock);
@@ -175,7 +187,7 @@ void PacketReceiver::registerVerifiedListener(PacketType type, QObject* object,
     }
     
     // add the mapping
-    _messageListenerMap[type] = { QPointer<QObject>(object), slot, deliverPending };
+    _messageListenerMap[type] = { QPointer<QObject>(object), slot, deliverPending, invokeStyleForMethod(slot) };
 }
 
 void PacketReceiver::unregisterListener(QObject* listener) {
@@ -208,9 +220,10 @@ void PacketReceiver::handleVerifiedPacket(std::unique_ptr<udt::Packet> packet) {
     
     auto nodeList = DependencyManager::get<LimitedNodeList>();
     
-    // setup an NLPacket from the packet we were passed
+    // setup an NLPacket from the packet we were passed, handing it to the
+    // message so the payload is viewed in place instead of copied
     auto nlPacket = NLPacket::fromBase(std::move(packet));
-    auto receivedMessage = QSharedPointer<ReceivedMessage>::create(*nlPacket);
+    auto receivedMessage = QSharedPointer<ReceivedMessage>::create(std::move(nlPacket));
 
     handleVerifiedMessage(receivedMessage, true);
 }
@@ -224,7 +237,9 @@ void PacketReceiver::handleVerifiedMessagePacket(std::unique_ptr<udt::Packet> pa
 
     if (it == _pendingMessages.end()) {
         // Create message
-        message = QSharedPointer<ReceivedMessage>::create(*nlPacket);
+        bool complete = nlPacket->getPacketPosition() == NLPacket::ONLY;
+        message = complete ? QSharedPointer<ReceivedMessage>::create(std::move(nlPacket))
+                           : QSharedPointer<ReceivedMessage>::create(*nlPacket);
         if (!message->isComplete()) {
             _pendingMessages[key] = message;
         }
@@ -258,17 +273,35 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
     if (receivedMessage->getSourceID() != Node::NULL_LOCAL_ID) {
         matchingNode = nodeList->nodeWithLocalID(receivedMessage->getSourceID());
     }
-    QMutexLocker packetListenerLocker(&_packetListenerLock);
-    
-    auto it = _messageListenerMap.find(receivedMessage->getType());
-    if (it != _messageListenerMap.end() && it->method.isValid()) {
-         
-        auto listener = it.value();
+    // copy the listener entry under the lock, then invoke with the lock
+    // released - so a direct-connection handler (which runs inline here) no
+    // longer serializes every other sender's dispatch behind the listener lock
+    Listener listener;
+    bool foundListener = false;
+    {
+        QMutexLocker packetListenerLocker(&_packetListenerLock);
+
+        auto it = _messageListenerMap.find(receivedMessage->getType());
+        if (it == _messageListenerMap.end()) {
+            qCWarning(networking) << "No listener found for packet type" << receivedMessage->getType();
 
+            // insert a dummy listener so we don't print this again
+            _messageListenerMap.insert(receivedMessage->getType(), { nullptr, QMetaMethod(), false });
+            return;
+        }
+        if (!it->method.isValid()) {
+            return;
+        }
+
+        listener = it.value();
+        foundListener = true;
+    }
+
+    if (foundListener) {
         if ((listener.deliverPending && !justReceived) || (!listener.deliverPending && !receivedMessage->isComplete())) {
             return;
         }
-            
+
         bool success = false;
 
         Qt::ConnectionType connectionType;
@@ -280,32 +313,35 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
 
         QMetaMethod metaMethod = listener.method;
 
-        static const QByteArray QSHAREDPOINTER_NODE_NORMALIZED = QMetaObject::normalizedType("QSharedPointer<Node>");
-        static const QByteArray SHARED_NODE_NORMALIZED = QMetaObject::normalizedType("SharedNodePointer");
-
         // one final check on the QPointer before we go to invoke
         if (listener.object) {
-            if (metaMethod.parameterTypes().contains(SHARED_NODE_NORMALIZED)) {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
-                                            Q_ARG(SharedNodePointer, matchingNode));
-
-            } else if (metaMethod.parameterTypes().contains(QSHAREDPOINTER_NODE_NORMALIZED)) {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
-                                            Q_ARG(QSharedPointer<Node>, matchingNode));
-
-            } else {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage));
+            // the invocation signature was resolved at registration
+            switch (listener.invokeStyle) {
+                case Listener::WithSharedNodePointer:
+                    success = metaMethod.invoke(listener.object,
+                                                connectionType,
+                                                Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
+                                                Q_ARG(SharedNodePointer, matchingNode));
+                    break;
+                case Listener::WithQSharedPointerNode:
+                    success = metaMethod.invoke(listener.object,
+                                                connectionType,
+                                                Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
+                                                Q_ARG(QSharedPointer<Node>, matchingNode));
+                    break;
+                case Listener::MessageOnly:
+                    success = metaMethod.invoke(listener.object,
+                                                connectionType,
+                                                Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage));
+                    break;
             }
         } else {
             qCDebug(networking).nospace() << "Listener for packet " << receivedMessage->getType()
                 << " has been destroyed. Removing from listener map.";
-            it = _messageListenerMap.erase(it);
+            {
+                QMutexLocker packetListenerLocker(&_packetListenerLock);
+                _messageListenerMap.remove(receivedMessage->getType());
+            }
 
             // if it exists, remove the listener from _directlyConnectedObjects
             {
@@ -318,11 +354,5 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
             qCDebug(networking).nospace() << "Error delivering packet " << receivedMessage->getType() << " to listener "
                 << listener.object << "::" << qPrintable(listener.method.methodSignature());
         }
-
-    } else if (it == _messageListenerMap.end()) {
-        qCWarning(networking) << "No listener found for packet type" << receivedMessage->getType();
-        
-        // insert a dummy listener so we don't print this again
-        _messageListenerMap.insert(receivedMessage->getType(), { nullptr, QMetaMethod(), false });
     }
 }
@@ -68,8 +68,15 @@ private:
         QPointer<QObject> object;
         QMetaMethod method;
         bool deliverPending;
+
+        // invocation signature, resolved once at registration instead of
+        // re-inspecting parameter types for every packet
+        enum InvokeStyle : uint8_t { MessageOnly, WithSharedNodePointer, WithQSharedPointerNode };
+        InvokeStyle invokeStyle { MessageOnly };
     };
 
+    static Listener::InvokeStyle invokeStyleForMethod(const QMetaMethod& method);
+
     void handleVerifiedMessage(QSharedPointer<ReceivedMessage> message, bool justReceived);
 
     // these are brutal hacks for now - ideally GenericThread / ReceivedPacketProcessor
@@ -48,6 +48,23 @@ ReceivedMessage::ReceivedMessage(NLPacket& packet)
     _firstPacketReceiveTime = duration_cast<microseconds>(packet.getReceiveTime().time_since_epoch()).count();
 }
 
+ReceivedMessage::ReceivedMessage(std::unique_ptr<NLPacket> packet)
+    : _data(QByteArray::fromRawData(packet->getPayload(), packet->getPayloadSize())),
+      _headData(_data.mid(0, HEAD_DATA_SIZE)),
+      _numPackets(1),
+      _sourceID(packet->getSourceID()),
+      _packetType(packet->getType()),
+      _packetVersion(packet->getVersion()),
+      _senderSockAddr(packet->getSenderSockAddr()),
+      _isComplete(packet->getPacketPosition() == NLPacket::ONLY)
+{
+    _firstPacketReceiveTime = duration_cast<microseconds>(packet->getReceiveTime().time_since_epoch()).count();
+
+    // the message views the packet's payload in place, so the packet must live
+    // at least as long as the message
+    _ownedPacket = std::move(packet);
+}
+
 ReceivedMessage::ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                 const HifiSockAddr& senderSockAddr, NLPacket::LocalID sourceID) :
     _data(byteArray),
@@ -77,6 +94,12 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
 
     ++_numPackets;
 
+    if (_ownedPacket) {
+        // materialize the zero-copy view before growing the message
+        _data = QByteArray(_data.constData(), _data.size());
+        _ownedPacket.reset();
+    }
+
     _data.append(packet.getPayload(), packet.getPayloadSize());
 
     if (_numPackets % EMIT_PROGRESS_EVERY_X_PACKETS == 0) {
@@ -123,7 +146,10 @@ QByteArray ReceivedMessage::peek(qint64 size) {
 }
 
 QByteArray ReceivedMessage::read(qint64 size) {
-    auto data = _data.mid(_position, size);
+    // when the message is a zero-copy view over an owned packet, hand out a
+    // self-contained copy so the result can outlive the message
+    auto data = _ownedPacket ? QByteArray(_data.constData() + _position, (int)size)
+                             : _data.mid(_position, size);
     _position += size;
     return data;
 }
@@ -16,6 +16,7 @@
 #include <QObject>
 
 #include <atomic>
+#include <memory>
 
 #include "NLPacketList.h"
 
@@ -24,10 +25,13 @@ class ReceivedMessage : public QObject {
 public:
     ReceivedMessage(const NLPacketList& packetList);
     ReceivedMessage(NLPacket& packet);
+    // zero-copy: takes ownership of the packet and views its payload in place,
+    // instead of copying the payload into a fresh buffer
+    ReceivedMessage(std::unique_ptr<NLPacket> packet);
     ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                     const HifiSockAddr& senderSockAddr, NLPacket::LocalID sourceID = NLPacket::NULL_LOCAL_ID);
 
-    QByteArray getMessage() const { return _data; }
+    QByteArray getMessage() const { return _ownedPacket ? QByteArray(_data.constData(), _data.size()) : _data; }
     const char* getRawMessage() const { return _data.constData(); }
 
     PacketType getType() const { return _packetType; }
@@ -90,6 +94,7 @@ private slots:
 
 private:
     QByteArray _data;
+    std::unique_ptr<NLPacket> _ownedPacket;     // keeps a zero-copy _data view alive
     QByteArray _headData;
 
     std::atomic<qint64> _position { 0 };
@@ -28,15 +28,52 @@
 #include "NetworkLogging.h"
 #include "NodeList.h"
 
-bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource) {
+uint32_t ResourceCacheSharedItems::countLoadingOfClass(BandwidthClass bandwidthClass) const {
+    uint32_t count = 0;
+    for (const auto& loading : _loadingRequests) {
+        auto locked = loading.lock();
+        if (locked && locked->getBandwidthClass() == bandwidthClass) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource, QSharedPointer<Resource>& preemptedRequest) {
     Lock lock(_mutex);
-    if ((uint32_t)_loadingRequests.size() < _requestLimit) {
+
+    auto newRequest = resource.lock();
+    auto bandwidthClass = newRequest ? newRequest->getBandwidthClass() : BandwidthClass::Bulk;
+
+    // per-class concurrency: bulk may use at most half the slots, interactive leaves one slot
+    // in reserve for critical arrivals, critical may use them all
+    uint32_t classLimit = _requestLimit;
+    if (bandwidthClass == BandwidthClass::Bulk) {
+        classLimit = std::max(1u, _requestLimit / 2);
+    } else if (bandwidthClass == BandwidthClass::Interactive) {
+        classLimit = std::max(1u, _requestLimit - 1);
+    }
+
+    if ((uint32_t)_loadingRequests.size() < _requestLimit && countLoadingOfClass(bandwidthClass) < classLimit) {
         _loadingRequests.append(resource);
         return true;
-    } else {
-        _pendingRequests.append(resource);
-        return false;
     }
+
+    if (bandwidthClass == BandwidthClass::Critical && (uint32_t)_loadingRequests.size() >= _requestLimit) {
+        // all slots busy - bump a bulk transfer to make room right now
+        for (int i = 0; i < _loadingRequests.size(); i++) {
+            auto locked = _loadingRequests.at(i).lock();
+            if (locked && locked->getBandwidthClass() == BandwidthClass::Bulk) {
+                preemptedRequest = locked;
+                _loadingRequests.removeAt(i);
+                _loadingRequests.append(resource);
+                return true;
+            }
+        }
+    }
+
+    _pendingRequests.append(resource);
+    return false;
 }
 
 void ResourceCacheSharedItems::setRequestLimit(uint32_t limit) {
@@ -121,8 +158,8 @@ QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
             continue;
         }
 
-        // Check load priority
-        float priority = resource->getLoadPriority();
+        // Check bandwidth class first, then load priority within the class
+        float priority = resource->getLoadPriority() - 1000.0f * (float)resource->getBandwidthClass();
         bool isFile = resource->getURL().scheme() == HIFI_URL_SCHEME_FILE;
         if (priority >= highestPriority && (isFile || !currentHighestIsFile)) {
             highestPriority = priority;
@@ -533,7 +570,13 @@ bool ResourceCache::attemptRequest(QSharedPointer<Resource> resource) {
     Q_ASSERT(!resource.isNull());
 
     auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
-    if (sharedItems->appendRequest(resource)) {
+    QSharedPointer<Resource> preemptedRequest;
+    if (sharedItems->appendRequest(resource, preemptedRequest)) {
+        if (preemptedRequest) {
+            // a critical request took this bulk transfer's slot; it aborts and re-queues on its
+            // own thread
+            QMetaObject::invokeMethod(preemptedRequest.data(), "preempt");
+        }
         resource->makeRequest();
         return true;
     }
@@ -642,6 +685,39 @@ float Resource::getLoadPriority() {
     return highestPriority;
 }
 
+BandwidthClass Resource::getBandwidthClass() {
+    // avatar models and attachments carry priorities above the entity range (see
+    // Avatar::MYAVATAR_LOADING_PRIORITY); entities get a positive, visibility-derived priority
+    // from the renderer; everything unprioritized is bulk
+    const float CRITICAL_PRIORITY_THRESHOLD = (float)M_PI_2;
+    float priority = getLoadPriority();
+    if (priority > CRITICAL_PRIORITY_THRESHOLD) {
+        return BandwidthClass::Critical;
+    } else if (priority > 0.0f) {
+        return BandwidthClass::Interactive;
+    }
+    return BandwidthClass::Bulk;
+}
+
+void Resource::preempt() {
+    if (!_request || _loaded || _failedToLoad) {
+        // finished (or failed) before the preemption arrived; nothing to give back
+        return;
+    }
+
+    PROFILE_ASYNC_END(resource, "Resource:" + getType(), QString::number(_requestID));
+    _request->disconnect(this);
+    _request->deleteLater();
+    _request = nullptr;
+    _startedLoading = false;
+
+    // back into the pending queue; the slot we vacated is already taken by the critical request
+    auto self = _self.lock();
+    if (self) {
+        ResourceCache::attemptRequest(self);
+    }
+}
+
 void Resource::refresh() {
     if (_request && !(_loaded || _failedToLoad)) {
         return;
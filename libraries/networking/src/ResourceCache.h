@@ -59,6 +59,17 @@ static const qint64 MAX_UNUSED_MAX_SIZE = MAXIMUM_CACHE_SIZE;
 // ResourceCache derived classes. Since we can't count on the ordering of
 // static members destruction, we need to use this Dependency manager implemented
 // object instead
+// Bandwidth classes for the request scheduler: critical resources (avatar models and their
+// attachments, whose load priorities sit above the entity range) always find a slot, preempting
+// a bulk transfer if they must; interactive resources (anything with a visibility-fed positive
+// priority, which the entity renderer computes from apparent size) leave one slot in reserve;
+// bulk transfers are capped at half the limit so they can never starve the rest.
+enum class BandwidthClass : uint8_t {
+    Critical = 0,
+    Interactive = 1,
+    Bulk = 2
+};
+
 class ResourceCacheSharedItems : public Dependency  {
     SINGLETON_DEPENDENCY
 
@@ -66,7 +77,7 @@ class ResourceCacheSharedItems : public Dependency  {
     using Lock = std::unique_lock<Mutex>;
 
 public:
-    bool appendRequest(QWeakPointer<Resource> newRequest);
+    bool appendRequest(QWeakPointer<Resource> newRequest, QSharedPointer<Resource>& preemptedRequest);
     void removeRequest(QWeakPointer<Resource> doneRequest);
     void setRequestLimit(uint32_t limit);
     uint32_t getRequestLimit() const;
@@ -80,6 +91,8 @@ public:
 private:
     ResourceCacheSharedItems() = default;
 
+    uint32_t countLoadingOfClass(BandwidthClass bandwidthClass) const;
+
     mutable Mutex _mutex;
     QList<QWeakPointer<Resource>> _pendingRequests;
     QList<QWeakPointer<Resource>> _loadingRequests;
@@ -434,6 +447,9 @@ public:
     /// Returns the highest load priority across all owners.
     float getLoadPriority();
 
+    /// The scheduler bandwidth class derived from the current load priority.
+    BandwidthClass getBandwidthClass();
+
     /// Checks whether the resource has loaded.
     virtual bool isLoaded() const { return _loaded; }
 
@@ -553,6 +569,10 @@ public slots:
     void handleDownloadProgress(uint64_t bytesReceived, uint64_t bytesTotal);
     void handleReplyFinished();
 
+    /// Aborts an in-flight bulk transfer so a critical request can take its slot; the resource
+    /// re-queues itself and restarts (from cache where possible) when capacity frees up.
+    void preempt();
+
 private:
     friend class ResourceCache;
     friend class ScriptableResource;
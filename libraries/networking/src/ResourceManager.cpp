@@ -13,7 +13,6 @@
 
 #include <mutex>
 
-#include <QNetworkDiskCache>
 #include <QStandardPaths>
 #include <QThread>
 #include <QFileInfo>
@@ -0,0 +1,395 @@
+//
+//  SegmentedDiskCache.cpp
+//  libraries/networking/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SegmentedDiskCache.h"
+
+#include <QtCore/QBuffer>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QSaveFile>
+#include <QtCore/QSet>
+
+#include "NetworkLogging.h"
+
+static const qint64 SEGMENT_SIZE_LIMIT = 256 * 1024 * 1024;
+static const QString JOURNAL_FILENAME = "cache.journal";
+static const quint32 JOURNAL_MAGIC = 0x48464343; // 'HFCC'
+static const quint32 JOURNAL_VERSION = 1;
+
+enum JournalOp : quint8 {
+    OP_INSERT = 1,
+    OP_TOUCH = 2,
+    OP_REMOVE = 3
+};
+
+// streams over a view of mapped segment memory; holds a reference to the mapping so an evicted
+// segment stays mapped until the last reader is done with it
+class MappedCacheDevice : public QBuffer {
+public:
+    MappedCacheDevice(QByteArray view, std::shared_ptr<void> mappingKeepAlive) :
+        _view(std::move(view)),
+        _mappingKeepAlive(std::move(mappingKeepAlive)) {
+        setBuffer(&_view);
+        open(QIODevice::ReadOnly);
+    }
+
+private:
+    QByteArray _view;
+    std::shared_ptr<void> _mappingKeepAlive;
+};
+
+SegmentedDiskCache::SegmentedDiskCache(const QString& directory, qint64 maximumSize, QObject* parent) :
+    QAbstractNetworkCache(parent),
+    _directory(directory),
+    _maximumSize(maximumSize)
+{
+    QDir().mkpath(_directory);
+    loadJournal();
+    removeStraySegments();
+    openCurrentSegment();
+}
+
+SegmentedDiskCache::~SegmentedDiskCache() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    compactJournal();
+}
+
+QString SegmentedDiskCache::segmentPath(int segmentId) const {
+    return _directory + QString("/%1.seg").arg(segmentId, 6, 10, QChar('0'));
+}
+
+QString SegmentedDiskCache::journalPath() const {
+    return _directory + "/" + JOURNAL_FILENAME;
+}
+
+void SegmentedDiskCache::loadJournal() {
+    QFile journalFile { journalPath() };
+    if (journalFile.open(QIODevice::ReadOnly)) {
+        QDataStream stream { &journalFile };
+        quint32 magic = 0, version = 0;
+        stream >> magic >> version;
+        if (magic == JOURNAL_MAGIC && version == JOURNAL_VERSION) {
+            // one sequential pass over the whole index; a truncated tail (crash mid-append)
+            // simply ends the replay early
+            while (!stream.atEnd() && stream.status() == QDataStream::Ok) {
+                quint8 op = 0;
+                QUrl url;
+                stream >> op >> url;
+                if (stream.status() != QDataStream::Ok) {
+                    break;
+                }
+                if (op == OP_INSERT) {
+                    Entry entry;
+                    qint32 segmentId;
+                    stream >> entry.metaData >> segmentId >> entry.offset >> entry.size >> entry.lastUse;
+                    if (stream.status() != QDataStream::Ok) {
+                        break;
+                    }
+                    entry.segmentId = segmentId;
+                    removeInternal(url, false);
+                    _entries.insert(url, entry);
+                    _segmentLiveBytes[entry.segmentId] += entry.size;
+                    _totalSize += entry.size;
+                    _useCounter = std::max(_useCounter, entry.lastUse);
+                    _currentSegmentId = std::max(_currentSegmentId, entry.segmentId);
+                } else if (op == OP_TOUCH) {
+                    quint64 lastUse = 0;
+                    stream >> lastUse;
+                    auto it = _entries.find(url);
+                    if (it != _entries.end()) {
+                        it->lastUse = lastUse;
+                        _useCounter = std::max(_useCounter, lastUse);
+                    }
+                } else if (op == OP_REMOVE) {
+                    removeInternal(url, false);
+                } else {
+                    break;
+                }
+            }
+        }
+        journalFile.close();
+    }
+
+    // entries that point past the end of their segment (crash before the segment flush) are bad
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        QFileInfo segmentInfo { segmentPath(it->segmentId) };
+        if (it->offset + it->size > segmentInfo.size()) {
+            _segmentLiveBytes[it->segmentId] -= it->size;
+            _totalSize -= it->size;
+            it = _entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    _journal.reset(new QFile(journalPath()));
+    if (!_journal->open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(networking) << "SegmentedDiskCache: could not open journal for appending";
+        _journal.reset();
+    } else if (_journal->size() == 0) {
+        QDataStream stream { _journal.get() };
+        stream << JOURNAL_MAGIC << JOURNAL_VERSION;
+    }
+}
+
+void SegmentedDiskCache::removeStraySegments() {
+    // segments no live entry references (evicted while readers kept them open, or orphaned by a
+    // crash) are dead weight by now
+    QSet<int> referencedSegments { _currentSegmentId };
+    for (const auto& entry : _entries) {
+        referencedSegments.insert(entry.segmentId);
+    }
+
+    QDir cacheDir { _directory };
+    for (const auto& segmentFile : cacheDir.entryList({ "*.seg" }, QDir::Files)) {
+        bool parsed = false;
+        int segmentId = segmentFile.section('.', 0, 0).toInt(&parsed);
+        if (parsed && !referencedSegments.contains(segmentId)) {
+            cacheDir.remove(segmentFile);
+        }
+    }
+}
+
+void SegmentedDiskCache::appendJournalRecord(quint8 op, const QUrl& url, const Entry* entry) {
+    if (!_journal) {
+        return;
+    }
+    QDataStream stream { _journal.get() };
+    stream << op << url;
+    if (op == OP_INSERT && entry) {
+        stream << entry->metaData << (qint32)entry->segmentId << entry->offset << entry->size << entry->lastUse;
+    } else if (op == OP_TOUCH && entry) {
+        stream << entry->lastUse;
+    }
+}
+
+void SegmentedDiskCache::compactJournal() {
+    // rewrite the journal as one INSERT per live entry; anything else is history
+    QSaveFile compacted { journalPath() };
+    if (!compacted.open(QIODevice::WriteOnly)) {
+        return;
+    }
+    {
+        QDataStream stream { &compacted };
+        stream << JOURNAL_MAGIC << JOURNAL_VERSION;
+        for (auto it = _entries.constBegin(); it != _entries.constEnd(); ++it) {
+            stream << (quint8)OP_INSERT << it.key() << it.value().metaData << (qint32)it.value().segmentId
+                   << it.value().offset << it.value().size << it.value().lastUse;
+        }
+    }
+    _journal.reset();
+    compacted.commit();
+}
+
+void SegmentedDiskCache::openCurrentSegment() {
+    _currentSegment.reset(new QFile(segmentPath(_currentSegmentId)));
+    if (!_currentSegment->open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(networking) << "SegmentedDiskCache: could not open segment" << _currentSegmentId;
+        _currentSegment.reset();
+    }
+}
+
+std::shared_ptr<SegmentedDiskCache::MappedSegment> SegmentedDiskCache::mappedSegment(int segmentId, qint64 neededBytes) {
+    auto& mapped = _mappedSegments[segmentId];
+    if (mapped && mapped->base && mapped->mappedSize >= neededBytes) {
+        return mapped;
+    }
+
+    // (re)map to the segment's current size; the current segment grows, so its mapping is
+    // refreshed (as a fresh MappedSegment, leaving any readers of the old one undisturbed)
+    // when an entry extends past what we previously mapped
+    auto fresh = std::make_shared<MappedSegment>();
+    fresh->file.reset(new QFile(segmentPath(segmentId)));
+    if (!fresh->file->open(QIODevice::ReadOnly)) {
+        return std::shared_ptr<MappedSegment>();
+    }
+    auto size = fresh->file->size();
+    if (size < neededBytes) {
+        return std::shared_ptr<MappedSegment>();
+    }
+    fresh->base = fresh->file->map(0, size);
+    if (!fresh->base) {
+        return std::shared_ptr<MappedSegment>();
+    }
+    fresh->mappedSize = size;
+    mapped = fresh;
+    return mapped;
+}
+
+void SegmentedDiskCache::removeInternal(const QUrl& url, bool journal) {
+    auto it = _entries.find(url);
+    if (it == _entries.end()) {
+        return;
+    }
+    _segmentLiveBytes[it->segmentId] -= it->size;
+    _totalSize -= it->size;
+    _entries.erase(it);
+    if (journal) {
+        appendJournalRecord(OP_REMOVE, url, nullptr);
+    }
+}
+
+void SegmentedDiskCache::evictIfNeeded() {
+    while (_totalSize > _maximumSize) {
+        // drop the coldest whole segment (excluding the one being written); segments are
+        // append-ordered, so the lowest id holds the oldest content
+        int victim = -1;
+        for (auto it = _segmentLiveBytes.constBegin(); it != _segmentLiveBytes.constEnd(); ++it) {
+            if (it.key() != _currentSegmentId && (victim == -1 || it.key() < victim)) {
+                victim = it.key();
+            }
+        }
+        if (victim == -1) {
+            break;
+        }
+
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            if (it->segmentId == victim) {
+                _totalSize -= it->size;
+                appendJournalRecord(OP_REMOVE, it.key(), nullptr);
+                it = _entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        _segmentLiveBytes.remove(victim);
+        // outstanding readers hold their own reference to the mapping; dropping ours defers the
+        // unmap to the last of them. The on-disk removal can fail while such readers exist (the
+        // file is still open); stray segment files are swept at the next startup.
+        _mappedSegments.remove(victim);
+        QFile::remove(segmentPath(victim));
+    }
+}
+
+QNetworkCacheMetaData SegmentedDiskCache::metaData(const QUrl& url) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(url);
+    return it != _entries.end() ? it->metaData : QNetworkCacheMetaData();
+}
+
+void SegmentedDiskCache::updateMetaData(const QNetworkCacheMetaData& metaData) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(metaData.url());
+    if (it != _entries.end()) {
+        it->metaData = metaData;
+        appendJournalRecord(OP_INSERT, metaData.url(), &it.value());
+    }
+}
+
+QIODevice* SegmentedDiskCache::data(const QUrl& url) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(url);
+    if (it == _entries.end()) {
+        return nullptr;
+    }
+
+    auto mapped = mappedSegment(it->segmentId, it->offset + it->size);
+    if (!mapped) {
+        return nullptr;
+    }
+
+    it->lastUse = ++_useCounter;
+    appendJournalRecord(OP_TOUCH, url, &it.value());
+
+    // a view over the mapping - the content is never copied into the device, and the device
+    // keeps the mapping alive even if the segment is evicted while it streams
+    return new MappedCacheDevice(QByteArray::fromRawData(
+        reinterpret_cast<const char*>(mapped->base) + it->offset, (int)it->size), mapped);
+}
+
+bool SegmentedDiskCache::remove(const QUrl& url) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    bool existed = _entries.contains(url);
+    removeInternal(url, true);
+    return existed;
+}
+
+qint64 SegmentedDiskCache::cacheSize() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _totalSize;
+}
+
+QIODevice* SegmentedDiskCache::prepare(const QNetworkCacheMetaData& metaData) {
+    if (!metaData.isValid() || !metaData.url().isValid() || !metaData.saveToDisk()) {
+        return nullptr;
+    }
+    auto device = new QBuffer();
+    device->open(QIODevice::ReadWrite);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _preparedDevices.insert(device, metaData);
+    return device;
+}
+
+void SegmentedDiskCache::insert(QIODevice* device) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto prepared = _preparedDevices.take(device);
+    auto buffer = qobject_cast<QBuffer*>(device);
+    if (!buffer || !prepared.isValid() || !_currentSegment) {
+        delete device;
+        return;
+    }
+
+    const auto& content = buffer->data();
+
+    Entry entry;
+    entry.metaData = prepared;
+    entry.segmentId = _currentSegmentId;
+    entry.offset = _currentSegment->size();
+    entry.size = content.size();
+    entry.lastUse = ++_useCounter;
+
+    if (_currentSegment->write(content) != content.size()) {
+        qCWarning(networking) << "SegmentedDiskCache: failed to append to segment" << _currentSegmentId;
+        delete device;
+        return;
+    }
+    _currentSegment->flush();
+
+    removeInternal(prepared.url(), true);
+    _entries.insert(prepared.url(), entry);
+    _segmentLiveBytes[entry.segmentId] += entry.size;
+    _totalSize += entry.size;
+    appendJournalRecord(OP_INSERT, prepared.url(), &entry);
+
+    // roll to a fresh segment once this one is full
+    if (_currentSegment->size() >= SEGMENT_SIZE_LIMIT) {
+        _currentSegmentId++;
+        openCurrentSegment();
+    }
+
+    evictIfNeeded();
+    delete device;
+}
+
+void SegmentedDiskCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _segmentLiveBytes.clear();
+    _mappedSegments.clear();
+    _totalSize = 0;
+    _currentSegment.reset();
+    _journal.reset();
+
+    QDir cacheDir { _directory };
+    for (const auto& entry : cacheDir.entryList({ "*.seg", JOURNAL_FILENAME }, QDir::Files)) {
+        cacheDir.remove(entry);
+    }
+
+    _currentSegmentId = 0;
+    _journal.reset(new QFile(journalPath()));
+    if (_journal->open(QIODevice::WriteOnly | QIODevice::Append)) {
+        QDataStream stream { _journal.get() };
+        stream << JOURNAL_MAGIC << JOURNAL_VERSION;
+    } else {
+        _journal.reset();
+    }
+    openCurrentSegment();
+}
@@ -0,0 +1,92 @@
+//
+//  SegmentedDiskCache.h
+//  libraries/networking/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SegmentedDiskCache_h
+#define hifi_SegmentedDiskCache_h
+
+#include <memory>
+#include <mutex>
+
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtNetwork/QAbstractNetworkCache>
+
+// A purpose-built replacement for QNetworkDiskCache. Content lives in large append-only segment
+// files that are memory-mapped for reads (entries are handed out as views over the mapping, not
+// copies), and the entire index - URL, metadata, segment/offset/size, LRU stamp - is a single
+// journal file replayed in one sequential read at startup, so a cold start costs one file scan
+// instead of a metadata open per entry. Eviction drops whole cold segments, which keeps the LRU
+// bookkeeping to an in-memory stamp update per hit.
+class SegmentedDiskCache : public QAbstractNetworkCache {
+    Q_OBJECT
+public:
+    SegmentedDiskCache(const QString& directory, qint64 maximumSize, QObject* parent = nullptr);
+    ~SegmentedDiskCache();
+
+    QNetworkCacheMetaData metaData(const QUrl& url) override;
+    void updateMetaData(const QNetworkCacheMetaData& metaData) override;
+    QIODevice* data(const QUrl& url) override;
+    bool remove(const QUrl& url) override;
+    qint64 cacheSize() const override;
+    QIODevice* prepare(const QNetworkCacheMetaData& metaData) override;
+    void insert(QIODevice* device) override;
+    void clear() override;
+
+    QString cacheDirectory() const { return _directory; }
+    qint64 maximumCacheSize() const { return _maximumSize; }
+
+private:
+    struct Entry {
+        QNetworkCacheMetaData metaData;
+        int segmentId { -1 };
+        qint64 offset { 0 };
+        qint64 size { 0 };
+        quint64 lastUse { 0 };
+    };
+
+    struct MappedSegment {
+        std::unique_ptr<QFile> file;
+        const uchar* base { nullptr };
+        qint64 mappedSize { 0 };
+    };
+
+    QString segmentPath(int segmentId) const;
+    QString journalPath() const;
+    void loadJournal();
+    void removeStraySegments();
+    void appendJournalRecord(quint8 op, const QUrl& url, const Entry* entry);
+    void compactJournal();
+    void openCurrentSegment();
+    std::shared_ptr<MappedSegment> mappedSegment(int segmentId, qint64 neededBytes);
+    void evictIfNeeded();
+    void removeInternal(const QUrl& url, bool journal);
+
+    mutable std::mutex _mutex;
+    QString _directory;
+    qint64 _maximumSize;
+    qint64 _totalSize { 0 };
+    quint64 _useCounter { 0 };
+
+    QHash<QUrl, Entry> _entries;
+    QHash<int, qint64> _segmentLiveBytes;
+
+    int _currentSegmentId { 0 };
+    std::unique_ptr<QFile> _currentSegment;
+    std::unique_ptr<QFile> _journal;
+
+    // shared with every outstanding MappedCacheDevice, so eviction can drop a segment from the
+    // cache while readers still streaming from it keep the mapping alive until they finish
+    QHash<int, std::shared_ptr<MappedSegment>> _mappedSegments;
+
+    QHash<QIODevice*, QNetworkCacheMetaData> _preparedDevices;
+};
+
+#endif // hifi_SegmentedDiskCache_h
@@ -0,0 +1,178 @@
+//
+//  BBRCC.cpp
+//  libraries/networking/src/udt
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BBRCC.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace udt;
+using namespace std::chrono;
+
+// the windowed filters forget samples older than these horizons
+static const int64_t MIN_RTT_WINDOW_USECS = 10 * 1000 * 1000;       // 10s, as in BBR
+static const int64_t MAX_BANDWIDTH_WINDOW_USECS = 2 * 1000 * 1000;  // ~10 RTTs at typical latencies
+
+// 8-phase pacing-gain cycle: one probe phase, one drain phase, six cruise phases
+static const int NUM_PACING_PHASES = 8;
+static const double PACING_GAIN_CYCLE[NUM_PACING_PHASES] = { 1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+// during startup, grow aggressively like slow start
+static const double STARTUP_PACING_GAIN = 2.885;    // 2/ln(2)
+
+// congestion window allowance over the bandwidth-delay product
+static const double CWND_GAIN = 2.0;
+
+BBRCC::BBRCC() {
+    _ewmaRTT = -1;
+    _rttVariance = 0;
+
+    // start pacing conservatively until the model has samples
+    _packetSendPeriod = 1.0;
+    _congestionWindowSize = 16;
+}
+
+void BBRCC::onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    _sentPackets.emplace_back(seqNum, timePoint, wireSize);
+}
+
+void BBRCC::onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    // a re-sent packet invalidates the original send time for rate sampling;
+    // drop the stale record so its RTT sample is not used
+    for (auto& sentPacket : _sentPackets) {
+        if (sentPacket.sequenceNumber == seqNum) {
+            sentPacket.timePoint = timePoint;
+            sentPacket.wireSize = 0;    // do not double-count the bytes
+            break;
+        }
+    }
+}
+
+bool BBRCC::onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) {
+    // collect the bytes this ACK covers and the send time of the newest covered packet
+    int64_t ackedBytes = 0;
+    p_high_resolution_clock::time_point newestSendTime;
+    bool haveSendTime = false;
+
+    while (!_sentPackets.empty() && _sentPackets.front().sequenceNumber <= ackNum) {
+        ackedBytes += _sentPackets.front().wireSize;
+        newestSendTime = _sentPackets.front().timePoint;
+        haveSendTime = _sentPackets.front().wireSize > 0;
+        _sentPackets.pop_front();
+    }
+
+    if (ackNum <= _lastACK) {
+        return false;   // duplicate or out-of-order ACK; BBR does not fast-retransmit
+    }
+    _lastACK = ackNum;
+
+    if (haveSendTime) {
+        int64_t rtt = duration_cast<microseconds>(receiveTime - newestSendTime).count();
+        if (rtt > 0) {
+            // smoothed RTT for the timeout estimate, as in the Vegas implementation
+            if (_ewmaRTT == -1) {
+                _ewmaRTT = (int)rtt;
+                _rttVariance = (int)rtt / 2;
+            } else {
+                static const int RTT_ESTIMATION_ALPHA_NUMERATOR = 8;
+                static const int RTT_ESTIMATION_VARIANCE_ALPHA_NUMERATOR = 4;
+                _ewmaRTT = (_ewmaRTT * (RTT_ESTIMATION_ALPHA_NUMERATOR - 1) + (int)rtt) / RTT_ESTIMATION_ALPHA_NUMERATOR;
+                _rttVariance = (_rttVariance * (RTT_ESTIMATION_VARIANCE_ALPHA_NUMERATOR - 1)
+                                + abs((int)rtt - _ewmaRTT)) / RTT_ESTIMATION_VARIANCE_ALPHA_NUMERATOR;
+            }
+
+            // delivery rate sample: bytes covered by this ACK over the inter-ACK gap
+            double deliveryRate = 0.0;
+            if (_lastACKTime.time_since_epoch().count() != 0) {
+                int64_t interval = duration_cast<microseconds>(receiveTime - _lastACKTime).count();
+                if (interval > 0) {
+                    deliveryRate = (double)(ackedBytes + _bytesAckedSinceLastACK) / (double)interval;
+                    _bytesAckedSinceLastACK = 0;
+                }
+            }
+            updateModel(rtt, deliveryRate, receiveTime);
+        }
+    } else {
+        _bytesAckedSinceLastACK += ackedBytes;
+    }
+    _lastACKTime = receiveTime;
+
+    return false;
+}
+
+void BBRCC::updateModel(int64_t rttUsecs, double deliveryRateBytesPerUsec, p_high_resolution_clock::time_point now) {
+    // windowed min RTT
+    int64_t sinceMinRTT = duration_cast<microseconds>(now - _minRTTTimestamp).count();
+    if (_minRTT < 0 || rttUsecs < _minRTT || sinceMinRTT > MIN_RTT_WINDOW_USECS) {
+        _minRTT = rttUsecs;
+        _minRTTTimestamp = now;
+    }
+
+    // windowed max bandwidth
+    int64_t sinceMaxBandwidth = duration_cast<microseconds>(now - _maxBandwidthTimestamp).count();
+    if (deliveryRateBytesPerUsec > _maxBandwidth || sinceMaxBandwidth > MAX_BANDWIDTH_WINDOW_USECS) {
+        if (deliveryRateBytesPerUsec > 0.0) {
+            // startup ends once bandwidth stops growing meaningfully
+            if (_startupPhase && _maxBandwidth > 0.0 && deliveryRateBytesPerUsec < 1.25 * _maxBandwidth) {
+                _startupPhase = false;
+                _pacingCycleStart = now;
+            }
+            _maxBandwidth = deliveryRateBytesPerUsec;
+            _maxBandwidthTimestamp = now;
+        }
+    }
+
+    advancePacingCycle(now);
+    applyModel();
+}
+
+void BBRCC::advancePacingCycle(p_high_resolution_clock::time_point now) {
+    if (_startupPhase || _minRTT <= 0) {
+        return;
+    }
+
+    // each pacing phase lasts one min-RTT
+    int64_t sinceCycleStart = duration_cast<microseconds>(now - _pacingCycleStart).count();
+    if (sinceCycleStart > _minRTT) {
+        _pacingCycleIndex = (_pacingCycleIndex + 1) % NUM_PACING_PHASES;
+        _pacingCycleStart = now;
+    }
+}
+
+void BBRCC::applyModel() {
+    if (_maxBandwidth <= 0.0 || _minRTT <= 0 || _mss <= 0) {
+        return;
+    }
+
+    double pacingGain = _startupPhase ? STARTUP_PACING_GAIN : PACING_GAIN_CYCLE[_pacingCycleIndex];
+    double pacedBandwidth = _maxBandwidth * pacingGain;     // bytes per usec
+
+    // pace one full packet every mss / bandwidth usecs
+    setPacketSendPeriod((double)_mss / pacedBandwidth);
+
+    // window the inflight data to a small multiple of the BDP
+    double bdpBytes = _maxBandwidth * (double)_minRTT;
+    int window = (int)((CWND_GAIN * bdpBytes) / (double)_mss);
+    static const int MIN_CONGESTION_WINDOW = 4;
+    _congestionWindowSize = std::max(window, MIN_CONGESTION_WINDOW);
+}
+
+void BBRCC::onTimeout() {
+    // a full timeout means the model is stale; restart discovery
+    _maxBandwidth = 0.0;
+    _startupPhase = true;
+    _packetSendPeriod = 1.0;
+    _congestionWindowSize = 16;
+}
+
+int BBRCC::estimatedTimeout() const {
+    return _ewmaRTT == -1 ? DEFAULT_SYN_INTERVAL : _ewmaRTT + _rttVariance * 4;
+}
@@ -0,0 +1,86 @@
+//
+//  BBRCC.h
+//  libraries/networking/src/udt
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BBRCC_h
+#define hifi_BBRCC_h
+
+#include <deque>
+
+#include "CongestionControl.h"
+
+namespace udt {
+
+//
+// A BBR-style, model-based congestion control, selectable alongside TCPVegasCC
+// (see Socket::_ccFactory). Instead of reacting to loss or delay thresholds, it
+// maintains a model of the path - the bottleneck bandwidth (windowed max of
+// delivery-rate samples) and the round-trip propagation delay (windowed min of
+// RTT samples) - and paces sends at the modeled bandwidth, cycling the pacing
+// gain to periodically probe for more bandwidth and drain any queue the probe
+// built. The congestion window is capped at a small multiple of the BDP.
+//
+class BBRCC : public CongestionControl {
+public:
+    BBRCC();
+
+    virtual bool onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) override;
+    virtual void onTimeout() override;
+
+    virtual void onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+    virtual void onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+
+    virtual int estimatedTimeout() const override;
+
+protected:
+    virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) override { _lastACK = seqNum - 1; }
+
+private:
+    struct SentPacketData {
+        SentPacketData(SequenceNumber seqNum, p_high_resolution_clock::time_point tPoint, int size) :
+            sequenceNumber(seqNum), timePoint(tPoint), wireSize(size) {}
+
+        SequenceNumber sequenceNumber;
+        p_high_resolution_clock::time_point timePoint;
+        int wireSize;
+    };
+
+    void updateModel(int64_t rttUsecs, double deliveryRateBytesPerUsec, p_high_resolution_clock::time_point now);
+    void advancePacingCycle(p_high_resolution_clock::time_point now);
+    void applyModel();
+
+    std::deque<SentPacketData> _sentPackets;
+
+    SequenceNumber _lastACK;
+    p_high_resolution_clock::time_point _lastACKTime;
+    int64_t _bytesAckedSinceLastACK { 0 };
+
+    // windowed-min RTT model (round-trip propagation delay)
+    int64_t _minRTT { -1 };                 // usecs
+    p_high_resolution_clock::time_point _minRTTTimestamp;
+
+    // windowed-max delivery rate model (bottleneck bandwidth)
+    double _maxBandwidth { 0.0 };           // bytes per usec
+    p_high_resolution_clock::time_point _maxBandwidthTimestamp;
+
+    // smoothed RTT, for the timeout estimate only
+    int _ewmaRTT { -1 };
+    int _rttVariance { 0 };
+
+    // pacing-gain cycle
+    int _pacingCycleIndex { 0 };
+    p_high_resolution_clock::time_point _pacingCycleStart;
+
+    bool _startupPhase { true };
+};
+
+}  // namespace udt
+
+#endif // hifi_BBRCC_h
@@ -11,6 +11,10 @@
 
 #include "BasePacket.h"
 
+#include <mutex>
+#include <vector>
+
+#include "Constants.h"
 #include "../NetworkLogging.h"
 
 using namespace udt;
@@ -77,9 +81,42 @@ BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const HifiSock
     
 }
 
+namespace {
+    std::mutex receiveBufferPoolMutex;
+    std::vector<std::unique_ptr<char[]>> receiveBufferPool;
+    const size_t MAX_POOLED_RECEIVE_BUFFERS = 256;
+}
+
+std::unique_ptr<char[]> BasePacket::obtainReceiveBuffer() {
+    {
+        std::lock_guard<std::mutex> lock(receiveBufferPoolMutex);
+        if (!receiveBufferPool.empty()) {
+            auto buffer = std::move(receiveBufferPool.back());
+            receiveBufferPool.pop_back();
+            return buffer;
+        }
+    }
+    return std::unique_ptr<char[]>(new char[udt::MAX_PACKET_SIZE_WITH_UDP_HEADER]);
+}
+
+void BasePacket::releaseReceiveBuffer(std::unique_ptr<char[]> buffer) {
+    std::lock_guard<std::mutex> lock(receiveBufferPoolMutex);
+    if (receiveBufferPool.size() < MAX_POOLED_RECEIVE_BUFFERS) {
+        receiveBufferPool.push_back(std::move(buffer));
+    }
+    // otherwise let it free
+}
+
+BasePacket::~BasePacket() {
+    if (_receiveBufferPooled && _packet) {
+        releaseReceiveBuffer(std::move(_packet));
+    }
+}
+
 BasePacket& BasePacket::operator=(const BasePacket& other) {
     _packetSize = other._packetSize;
     _packet = std::unique_ptr<char[]>(new char[_packetSize]);
+    _receiveBufferPooled = false;   // the copy owns a plain allocation
     memcpy(_packet.get(), other._packet.get(), _packetSize);
     
     _payloadStart = _packet.get() + (other._payloadStart - other._packet.get());
@@ -105,6 +142,8 @@ BasePacket::BasePacket(BasePacket&& other) {
 BasePacket& BasePacket::operator=(BasePacket&& other) {
     _packetSize = other._packetSize;
     _packet = std::move(other._packet);
+    _receiveBufferPooled = other._receiveBufferPooled;
+    other._receiveBufferPooled = false;
     
     _payloadStart = other._payloadStart;
     _payloadCapacity = other._payloadCapacity;
@@ -30,6 +30,13 @@ public:
     static const qint64 PACKET_WRITE_ERROR;
     
     static std::unique_ptr<BasePacket> create(qint64 size = -1);
+    // Pool of standard-capacity (MAX_PACKET_SIZE_WITH_UDP_HEADER) receive buffers.
+    // The receive path obtains buffers here and marks the resulting packet with
+    // markReceiveBufferPooled(), so the buffer is recycled when the packet dies
+    // instead of being freed. Thread-safe.
+    static std::unique_ptr<char[]> obtainReceiveBuffer();
+    static void releaseReceiveBuffer(std::unique_ptr<char[]> buffer);
+
     static std::unique_ptr<BasePacket> fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
                                                           const HifiSockAddr& senderSockAddr);
     
@@ -92,6 +99,14 @@ protected:
     BasePacket& operator=(const BasePacket& other);
     BasePacket(BasePacket&& other);
     BasePacket& operator=(BasePacket&& other);
+
+public:
+    virtual ~BasePacket();
+
+    // the buffer came from the receive-buffer pool; recycle it on destruction
+    void markReceiveBufferPooled() { _receiveBufferPooled = true; }
+
+protected:
     
     // QIODevice virtual functions
     virtual qint64 writeData(const char* data, qint64 maxSize) override;
@@ -101,6 +116,7 @@ protected:
     
     qint64 _packetSize = 0;        // Total size of the allocated memory
     std::unique_ptr<char[]> _packet; // Allocated memory
+    bool _receiveBufferPooled { false }; // recycle _packet into the receive-buffer pool on destruction
     
     char* _payloadStart = nullptr; // Start of the payload
     qint64 _payloadCapacity = 0;          // Total capacity of the payload
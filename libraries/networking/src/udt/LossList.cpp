@@ -11,6 +11,8 @@
 
 #include "LossList.h"
 
+#include <algorithm>
+
 #include "ControlPacket.h"
 
 using namespace udt;
@@ -47,9 +49,11 @@ void LossList::insert(SequenceNumber start, SequenceNumber end) {
     Q_ASSERT_X(start <= end,
                "LossList::insert(SequenceNumber, SequenceNumber)", "Range start greater than range end");
     
-    auto it = find_if_not(_lossList.begin(), _lossList.end(), [&start](pair<SequenceNumber, SequenceNumber> pair){
-        return pair.second < start;
-    });
+    // ranges are sorted by their end, so the insertion point can be found by binary search
+    auto it = lower_bound(_lossList.begin(), _lossList.end(), start,
+                          [](const pair<SequenceNumber, SequenceNumber>& pair, SequenceNumber start) {
+                              return pair.second < start;
+                          });
     
     if (it == _lossList.end() || end < it->first) {
         // No overlap, simply insert
@@ -68,27 +72,33 @@ void LossList::insert(SequenceNumber start, SequenceNumber end) {
             it->second = end;
         }
         
-        auto it2 = it;
-        ++it2;
-        // For all ranges touching the current range
-        while (it2 != _lossList.end() && it->second >= it2->first - 1) {
+        // For all ranges touching the current range (indices, not iterators:
+        // deque::erase invalidates iterators to the merged range)
+        auto index = distance(_lossList.begin(), it);
+        while (index + 1 < (decltype(index))_lossList.size() &&
+               _lossList[index].second >= _lossList[index + 1].first - 1) {
             // extend current range if necessary
-            if (it->second < it2->second) {
-                _length += seqlen(it->second + 1, it2->second);
-                it->second = it2->second;
+            if (_lossList[index].second < _lossList[index + 1].second) {
+                _length += seqlen(_lossList[index].second + 1, _lossList[index + 1].second);
+                _lossList[index].second = _lossList[index + 1].second;
             }
             
             // Remove overlapping range
-            _length -= seqlen(it2->first, it2->second);
-            it2 = _lossList.erase(it2);
+            _length -= seqlen(_lossList[index + 1].first, _lossList[index + 1].second);
+            _lossList.erase(_lossList.begin() + index + 1);
         }
     }
 }
 
 bool LossList::remove(SequenceNumber seq) {
-    auto it = find_if(_lossList.begin(), _lossList.end(), [&seq](pair<SequenceNumber, SequenceNumber> pair) {
-        return pair.first <= seq && seq <= pair.second;
-    });
+    // binary search for the first range that could contain seq
+    auto it = lower_bound(_lossList.begin(), _lossList.end(), seq,
+                          [](const pair<SequenceNumber, SequenceNumber>& pair, SequenceNumber seq) {
+                              return pair.second < seq;
+                          });
+    if (it != _lossList.end() && !(it->first <= seq && seq <= it->second)) {
+        it = _lossList.end();
+    }
     
     if (it != end(_lossList)) {
         if (it->first == it->second) {
@@ -115,10 +125,14 @@ bool LossList::remove(SequenceNumber seq) {
 void LossList::remove(SequenceNumber start, SequenceNumber end) {
     Q_ASSERT_X(start <= end,
                "LossList::remove(SequenceNumber, SequenceNumber)", "Range start greater than range end");
-    // Find the first segment sharing sequence numbers
-    auto it = find_if(_lossList.begin(), _lossList.end(), [&start, &end](pair<SequenceNumber, SequenceNumber> pair) {
-        return (pair.first <= start && start <= pair.second) || (start <= pair.first && pair.first <= end);
-    });
+    // Find the first segment sharing sequence numbers, by binary search over the sorted ranges
+    auto it = lower_bound(_lossList.begin(), _lossList.end(), start,
+                          [](const pair<SequenceNumber, SequenceNumber>& pair, SequenceNumber start) {
+                              return pair.second < start;
+                          });
+    if (it != _lossList.end() && it->first > end) {
+        it = _lossList.end();
+    }
     
     // If we found one
     if (it != _lossList.end()) {
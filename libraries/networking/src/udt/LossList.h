@@ -12,7 +12,7 @@
 #ifndef hifi_LossList_h
 #define hifi_LossList_h
 
-#include <list>
+#include <deque>
 
 #include "SequenceNumber.h"
 
@@ -30,7 +30,7 @@ public:
     void append(SequenceNumber seq);
     void append(SequenceNumber start, SequenceNumber end);
     
-    // inserts anywhere - MUCH slower
+    // inserts anywhere - slower than append, but finds the spot by binary search
     void insert(SequenceNumber start, SequenceNumber end);
     
     bool remove(SequenceNumber seq);
@@ -44,7 +44,10 @@ public:
     void write(ControlPacket& packet, int maxPairs = -1);
     
 private:
-    std::list<std::pair<SequenceNumber, SequenceNumber>> _lossList;
+    // ranges are kept sorted and disjoint in contiguous storage, so the
+    // searches in insert/remove are binary instead of linked-list walks and
+    // ACK-driven removals from the front are cheap
+    std::deque<std::pair<SequenceNumber, SequenceNumber>> _lossList;
     int _length { 0 };
 };
     
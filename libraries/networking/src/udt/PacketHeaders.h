@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <bitset>
 #include <map>
 
 #include <QtCore/QCryptographicHash>
@@ -206,6 +207,33 @@ public:
             << PacketTypeEnum::Value::AssetUploadReply;
         return DOMAIN_IGNORED_VERIFICATION_PACKETS;
     }
+
+    // O(1) per-packet classification. The QSet getters above remain for callers
+    // that enumerate types; per-packet header processing uses these bitmask
+    // predicates instead of hashed set lookups.
+    static std::bitset<256> makePacketTypeBitset(const QSet<PacketTypeEnum::Value>& types) {
+        std::bitset<256> bits;
+        for (auto type : types) {
+            bits.set((size_t)type);
+        }
+        return bits;
+    }
+    static bool isNonSourcedPacket(PacketTypeEnum::Value type) {
+        const static auto NON_SOURCED_BITS = makePacketTypeBitset(getNonSourcedPackets());
+        return NON_SOURCED_BITS.test((size_t)type);
+    }
+    static bool isNonVerifiedPacket(PacketTypeEnum::Value type) {
+        const static auto NON_VERIFIED_BITS = makePacketTypeBitset(getNonVerifiedPackets());
+        return NON_VERIFIED_BITS.test((size_t)type);
+    }
+    static bool isDomainSourcedPacket(PacketTypeEnum::Value type) {
+        const static auto DOMAIN_SOURCED_BITS = makePacketTypeBitset(getDomainSourcedPackets());
+        return DOMAIN_SOURCED_BITS.test((size_t)type);
+    }
+    static bool isDomainIgnoredVerificationPacket(PacketTypeEnum::Value type) {
+        const static auto DOMAIN_IGNORED_BITS = makePacketTypeBitset(getDomainIgnoredVerificationPackets());
+        return DOMAIN_IGNORED_BITS.test((size_t)type);
+    }
 };
 
 using PacketType = PacketTypeEnum::Value;
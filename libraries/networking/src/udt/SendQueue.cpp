@@ -277,17 +277,43 @@ void SendQueue::run() {
     // Keep an HRC to know when the next packet should have been
     auto nextPacketTimestamp = p_high_resolution_clock::now();
 
+    // Pacing runs on a coarse timer wheel: rather than one sleep per packet
+    // (whose wakeup quantum both limits throughput and burns CPU at high send
+    // rates), each wheel slot sends every packet that is due within it back to
+    // back and then sleeps once, to the wheel cursor.
+    const std::chrono::microseconds PACING_WHEEL_SLOT { 1000 };
+
     while (_state == State::Running) {
-        bool attemptedToSendPacket = maybeResendPacket();
-        
-        // if we didn't find a packet to re-send AND we think we can fit a new packet on the wire
-        // (this is according to the current flow window size) then we send out a new packet
-        auto newPacketCount = 0;
-        if (!attemptedToSendPacket) {
-            newPacketCount = maybeSendNewPacket();
-            attemptedToSendPacket = (newPacketCount > 0);
+        auto slotEnd = p_high_resolution_clock::now() + PACING_WHEEL_SLOT;
+
+        bool attemptedToSendPacket = false;
+        std::chrono::microseconds lastPacketDelta { 0 };
+
+        while (true) {
+            bool sentPacket = maybeResendPacket();
+
+            // if we didn't find a packet to re-send AND we think we can fit a new packet on the wire
+            // (this is according to the current flow window size) then we send out a new packet
+            auto newPacketCount = 0;
+            if (!sentPacket) {
+                newPacketCount = maybeSendNewPacket();
+                sentPacket = (newPacketCount > 0);
+            }
+            attemptedToSendPacket = attemptedToSendPacket || sentPacket;
+
+            if (!sentPacket || _packetSendPeriod <= 0) {
+                break;
+            }
+
+            // advance the wheel cursor by this packet's pacing delta, and keep
+            // sending while the cursor stays inside the current slot
+            lastPacketDelta = std::chrono::microseconds((newPacketCount == 2 ? 2 : 1) * _packetSendPeriod);
+            nextPacketTimestamp += lastPacketDelta;
+            if (nextPacketTimestamp >= slotEnd) {
+                break;
+            }
         }
-        
+
         // since we're a while loop, give the thread a chance to process events
         QCoreApplication::sendPostedEvents(this);
         
@@ -300,9 +326,9 @@ void SendQueue::run() {
         }
 
         if (_packetSendPeriod > 0) {
-            // push the next packet timestamp forwards by the current packet send period
-            auto nextPacketDelta = (newPacketCount == 2 ? 2 : 1) * _packetSendPeriod;
-            nextPacketTimestamp += std::chrono::microseconds(nextPacketDelta);
+            // the pacing budget for the sleep is at least one slot, and at least
+            // the last packet's delta when packets are spaced wider than a slot
+            auto nextPacketDelta = std::max(lastPacketDelta, PACING_WHEEL_SLOT);
 
             // sleep as long as we need for next packet send, if we can
             auto now = p_high_resolution_clock::now();
@@ -312,11 +338,11 @@ void SendQueue::run() {
             // we use nextPacketTimestamp so that we don't fall behind, not to force long sleeps
             // we'll never allow nextPacketTimestamp to force us to sleep for more than nextPacketDelta
             // so cap it to that value
-            if (timeToSleep > std::chrono::microseconds(nextPacketDelta)) {
+            if (timeToSleep > nextPacketDelta) {
                 // reset the nextPacketTimestamp so that it is correct next time we come around
-                nextPacketTimestamp = now + std::chrono::microseconds(nextPacketDelta);
+                nextPacketTimestamp = now + nextPacketDelta;
 
-                timeToSleep = std::chrono::microseconds(nextPacketDelta);
+                timeToSleep = nextPacketDelta;
             }
 
             // we're seeing SendQueues sleep for a long period of time here,
@@ -327,7 +353,7 @@ void SendQueue::run() {
             if (timeToSleep > MAX_SEND_QUEUE_SLEEP_USECS) {
                 qWarning() << "udt::SendQueue wanted to sleep for" << timeToSleep.count() << "microseconds";
                 qWarning() << "Capping sleep to" << MAX_SEND_QUEUE_SLEEP_USECS.count();
-                qWarning() << "PSP:" << _packetSendPeriod << "NPD:" << nextPacketDelta
+                qWarning() << "PSP:" << _packetSendPeriod << "NPD:" << nextPacketDelta.count()
                 << "NPT:" << nextPacketTimestamp.time_since_epoch().count()
                 << "NOW:" << now.time_since_epoch().count();
 
@@ -340,7 +366,7 @@ void SendQueue::run() {
                 QJsonObject longSleepObject;
                 longSleepObject["timeToSleep"] = qint64(timeToSleep.count());
                 longSleepObject["packetSendPeriod"] = _packetSendPeriod.load();
-                longSleepObject["nextPacketDelta"] = nextPacketDelta;
+                longSleepObject["nextPacketDelta"] = qint64(nextPacketDelta.count());
                 longSleepObject["nextPacketTimestamp"] = qint64(nextPacketTimestamp.time_since_epoch().count());
                 longSleepObject["then"] = qint64(now.time_since_epoch().count());
 
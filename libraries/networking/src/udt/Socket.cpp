@@ -11,7 +11,8 @@
 
 #include "Socket.h"
 
-#ifdef Q_OS_ANDROID
+#if defined(Q_OS_ANDROID) || defined(Q_OS_LINUX)
+#include <netinet/in.h>
 #include <sys/socket.h>
 #endif
 
@@ -21,6 +22,7 @@
 #include <LogHandler.h>
 
 #include "../NetworkLogging.h"
+#include "BBRCC.h"
 #include "Connection.h"
 #include "ControlPacket.h"
 #include "Packet.h"
@@ -45,6 +47,13 @@ Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
     _readyReadBackupTimer(new QTimer(this)),
     _shouldChangeSocketOptions(shouldChangeSocketOptions)
 {
+    // the congestion control strategy is pluggable: TCPVegasCC by default, or a
+    // BBR-style model-based controller via HIFI_CONGESTION_CONTROL=bbr
+    if (qgetenv("HIFI_CONGESTION_CONTROL").toLower() == "bbr") {
+        qCDebug(networking) << "Using BBR-style congestion control";
+        _ccFactory.reset(new CongestionControlFactory<BBRCC>());
+    }
+
     connect(&_udpSocket, &QUdpSocket::readyRead, this, &Socket::readPendingDatagrams);
 
     // make sure we hear about errors and state changes from the underlying socket
@@ -234,8 +243,79 @@ qint64 Socket::writeDatagram(const char* data, qint64 size, const HifiSockAddr&
     return writeDatagram(QByteArray::fromRawData(data, size), sockAddr);
 }
 
+void Socket::beginDatagramBatch() {
+    Q_ASSERT(QThread::currentThread() == thread());
+    _datagramBatching.store(true, std::memory_order_relaxed);
+}
+
+void Socket::endDatagramBatch() {
+    Q_ASSERT(QThread::currentThread() == thread());
+    _datagramBatching.store(false, std::memory_order_relaxed);
+
+    if (_pendingBatchDatagrams.empty()) {
+        return;
+    }
+
+#if defined(Q_OS_LINUX)
+    // one syscall for the whole burst
+    auto socketDescriptor = _udpSocket.socketDescriptor();
+    if (socketDescriptor != -1) {
+        const int MAX_BATCH = 64;
+        size_t offset = 0;
+        while (offset < _pendingBatchDatagrams.size()) {
+            int count = (int)std::min((size_t)MAX_BATCH, _pendingBatchDatagrams.size() - offset);
+            struct mmsghdr msgs[MAX_BATCH];
+            struct iovec iovecs[MAX_BATCH];
+            struct sockaddr_in addrs[MAX_BATCH];
+            memset(msgs, 0, sizeof(mmsghdr) * count);
+
+            for (int i = 0; i < count; i++) {
+                auto& datagram = _pendingBatchDatagrams[offset + i];
+                iovecs[i].iov_base = (void*)datagram.first.data();
+                iovecs[i].iov_len = datagram.first.size();
+
+                memset(&addrs[i], 0, sizeof(sockaddr_in));
+                addrs[i].sin_family = AF_INET;
+                addrs[i].sin_addr.s_addr = htonl(datagram.second.getAddress().toIPv4Address());
+                addrs[i].sin_port = htons(datagram.second.getPort());
+
+                msgs[i].msg_hdr.msg_iov = &iovecs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+                msgs[i].msg_hdr.msg_name = &addrs[i];
+                msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            }
+
+            int sent = sendmmsg(socketDescriptor, msgs, count, 0);
+            if (sent < 0) {
+                // fall back to the per-datagram path for whatever remains
+                for (size_t i = offset; i < _pendingBatchDatagrams.size(); i++) {
+                    writeDatagram(_pendingBatchDatagrams[i].first, _pendingBatchDatagrams[i].second);
+                }
+                break;
+            }
+            offset += sent;
+        }
+        _pendingBatchDatagrams.clear();
+        return;
+    }
+#endif
+
+    for (auto& datagram : _pendingBatchDatagrams) {
+        writeDatagram(datagram.first, datagram.second);
+    }
+    _pendingBatchDatagrams.clear();
+}
+
 qint64 Socket::writeDatagram(const QByteArray& datagram, const HifiSockAddr& sockAddr) {
 
+    // only divert sends made on the socket's own thread (the one that enabled batching);
+    // concurrent SendQueue sends go straight out and never touch the batch storage
+    if (_datagramBatching.load(std::memory_order_relaxed) && QThread::currentThread() == thread()) {
+        // deep copy: callers commonly pass fromRawData views of short-lived packet buffers
+        _pendingBatchDatagrams.emplace_back(QByteArray(datagram.constData(), datagram.size()), sockAddr);
+        return datagram.size();
+    }
+
     // don't attempt to write the datagram if we're unbound.  Just drop it.
     // _udpSocket.writeDatagram will return an error anyway, but there are
     // potential crashes in Qt when that happens.
@@ -365,10 +445,167 @@ void Socket::checkForReadyReadBackup() {
     }
 }
 
+void Socket::processReceivedDatagram(std::unique_ptr<char[]> buffer, qint64 packetSizeWithHeader,
+                                     const HifiSockAddr& senderSockAddr,
+                                     p_high_resolution_clock::time_point receiveTime, bool pooledBuffer) {
+    auto it = _unfilteredHandlers.find(senderSockAddr);
+
+    if (it != _unfilteredHandlers.end()) {
+        // we have a registered unfiltered handler for this HifiSockAddr - call that and return
+        if (it->second) {
+            auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+            if (pooledBuffer) {
+                basePacket->markReceiveBufferPooled();
+            }
+            basePacket->setReceiveTime(receiveTime);
+            it->second(std::move(basePacket));
+        }
+
+        return;
+    }
+
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+        if (pooledBuffer) {
+            controlPacket->markReceiveBufferPooled();
+        }
+        controlPacket->setReceiveTime(receiveTime);
+
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr, true);
+
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
+
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+        if (pooledBuffer) {
+            packet->markReceiveBufferPooled();
+        }
+        packet->setReceiveTime(receiveTime);
+
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
+
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            auto connection = findOrCreateConnection(senderSockAddr, true);
+
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
+
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
+#ifdef UDT_CONNECTION_DEBUG
+                    qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
+                        << ", type" << NLPacket::typeInHeader(*packet);
+#endif
+                    return;
+                }
+            } else if (connection) {
+                connection->recordReceivedUnreliablePackets(packet->getWireSize(),
+                                                            packet->getPayloadSize());
+            }
+
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr, true);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
+                }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
+            }
+        }
+    }
+}
+
 void Socket::readPendingDatagrams() {
     using namespace std::chrono;
     static const auto MAX_PROCESS_TIME { 100ms };
     const auto abortTime = system_clock::now() + MAX_PROCESS_TIME;
+
+#if defined(Q_OS_LINUX)
+    // batched receive: pull up to RECEIVE_BATCH_SIZE datagrams per recvmmsg
+    // syscall instead of one readDatagram (and one pendingDatagramSize ioctl)
+    // per packet
+    static const int RECEIVE_BATCH_SIZE = 16;
+    int socketDescriptor = (int)_udpSocket.socketDescriptor();
+    if (socketDescriptor != -1) {
+        while (true) {
+            if (system_clock::now() > abortTime) {
+                // We've been running for too long, stop processing packets for now
+                // Once we've processed the event queue, we'll come back to packet processing
+                break;
+            }
+
+            struct mmsghdr msgs[RECEIVE_BATCH_SIZE];
+            struct iovec iovecs[RECEIVE_BATCH_SIZE];
+            struct sockaddr_storage addrs[RECEIVE_BATCH_SIZE];
+            std::unique_ptr<char[]> buffers[RECEIVE_BATCH_SIZE];
+
+            memset(msgs, 0, sizeof(msgs));
+            for (int i = 0; i < RECEIVE_BATCH_SIZE; ++i) {
+                buffers[i] = BasePacket::obtainReceiveBuffer();
+                iovecs[i].iov_base = buffers[i].get();
+                iovecs[i].iov_len = udt::MAX_PACKET_SIZE_WITH_UDP_HEADER;
+                msgs[i].msg_hdr.msg_iov = &iovecs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+                msgs[i].msg_hdr.msg_name = &addrs[i];
+                msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+            }
+
+            int numReceived = recvmmsg(socketDescriptor, msgs, RECEIVE_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+            if (numReceived <= 0) {
+                for (int i = 0; i < RECEIVE_BATCH_SIZE; ++i) {
+                    BasePacket::releaseReceiveBuffer(std::move(buffers[i]));
+                }
+                break;
+            }
+
+            // we're reading packets so re-start the readyRead backup timer
+            _readyReadBackupTimer->start();
+
+            // grab a time point we can mark as the receive time of these packets
+            auto receiveTime = p_high_resolution_clock::now();
+
+            for (int i = 0; i < numReceived; ++i) {
+                qint64 sizeRead = msgs[i].msg_len;
+                HifiSockAddr senderSockAddr((sockaddr*)&addrs[i]);
+
+                // save information for this packet, in case it is the one that sticks readyRead
+                _lastPacketSizeRead = sizeRead;
+                _lastPacketSockAddr = senderSockAddr;
+
+                if (sizeRead > 0) {
+                    processReceivedDatagram(std::move(buffers[i]), sizeRead, senderSockAddr, receiveTime, true);
+                } else {
+                    BasePacket::releaseReceiveBuffer(std::move(buffers[i]));
+                }
+            }
+
+            // return unused batch buffers to the pool
+            for (int i = std::max(numReceived, 0); i < RECEIVE_BATCH_SIZE; ++i) {
+                BasePacket::releaseReceiveBuffer(std::move(buffers[i]));
+            }
+
+            if (numReceived < RECEIVE_BATCH_SIZE) {
+                // we drained the socket
+                break;
+            }
+        }
+        return;
+    }
+#endif
+
     int packetSizeWithHeader = -1;
 
     while (_udpSocket.hasPendingDatagrams() &&
@@ -393,8 +630,10 @@ void Socket::readPendingDatagrams() {
         // setup a HifiSockAddr to read into
         HifiSockAddr senderSockAddr;
 
-        // setup a buffer to read the packet into
-        auto buffer = std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
+        // setup a buffer to read the packet into, from the pool when it fits
+        bool pooledBuffer = packetSizeWithHeader <= udt::MAX_PACKET_SIZE_WITH_UDP_HEADER;
+        auto buffer = pooledBuffer ? BasePacket::obtainReceiveBuffer()
+                                   : std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
 
         // pull the datagram
         auto sizeRead = _udpSocket.readDatagram(buffer.get(), packetSizeWithHeader,
@@ -407,78 +646,13 @@ void Socket::readPendingDatagrams() {
         if (sizeRead <= 0) {
             // we either didn't pull anything for this packet or there was an error reading (this seems to trigger
             // on windows even if there's not a packet available)
-            continue;
-        }
-
-        auto it = _unfilteredHandlers.find(senderSockAddr);
-
-        if (it != _unfilteredHandlers.end()) {
-            // we have a registered unfiltered handler for this HifiSockAddr - call that and return
-            if (it->second) {
-                auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-                basePacket->setReceiveTime(receiveTime);
-                it->second(std::move(basePacket));
+            if (pooledBuffer) {
+                BasePacket::releaseReceiveBuffer(std::move(buffer));
             }
-
             continue;
         }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
-
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
-
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr, true);
-
-            if (connection) {
-                connection->processControl(move(controlPacket));
-            }
-
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
-
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
-
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                auto connection = findOrCreateConnection(senderSockAddr, true);
-
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
-
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
-#ifdef UDT_CONNECTION_DEBUG
-                        qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
-                            << ", type" << NLPacket::typeInHeader(*packet);
-#endif
-                        continue;
-                    }
-                } else if (connection) {
-                    connection->recordReceivedUnreliablePackets(packet->getWireSize(),
-                                                                packet->getPayloadSize());
-                }
-
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr, true);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
-                }
-            }
-        }
+        processReceivedDatagram(std::move(buffer), packetSizeWithHeader, senderSockAddr, receiveTime, pooledBuffer);
     }
 }
 
@@ -14,6 +14,7 @@
 #ifndef hifi_Socket_h
 #define hifi_Socket_h
 
+#include <atomic>
 #include <functional>
 #include <unordered_map>
 #include <mutex>
@@ -23,6 +24,8 @@
 #include <QtCore/QTimer>
 #include <QtNetwork/QUdpSocket>
 
+#include <PortableHighResolutionClock.h>
+
 #include "../HifiSockAddr.h"
 #include "TCPVegasCC.h"
 #include "Connection.h"
@@ -66,6 +69,14 @@ public:
     qint64 writePacketList(std::unique_ptr<PacketList> packetList, const HifiSockAddr& sockAddr);
     qint64 writeDatagram(const char* data, qint64 size, const HifiSockAddr& sockAddr);
     qint64 writeDatagram(const QByteArray& datagram, const HifiSockAddr& sockAddr);
+
+    // Batch mode for bursts of small unreliable sends (keepalive pings): between begin and end,
+    // writeDatagram calls made on the socket's own thread queue instead of hitting the socket,
+    // and the flush pushes everything in one sendmmsg on platforms that have it. Sends from
+    // other threads (SendQueue) are never diverted, so only the initiating thread ever touches
+    // the batch storage. All per-packet bookkeeping upstream is unaffected.
+    void beginDatagramBatch();
+    void endDatagramBatch();
     
     void bind(const QHostAddress& address, quint16 port = 0);
     void rebind(quint16 port);
@@ -109,6 +120,12 @@ private slots:
     void handleStateChanged(QAbstractSocket::SocketState socketState);
 
 private:
+    // only ever called directly from readPendingDatagrams; takes a move-only buffer, so it
+    // cannot be a slot (moc cannot marshal unique_ptr parameters)
+    void processReceivedDatagram(std::unique_ptr<char[]> buffer, qint64 packetSizeWithHeader,
+                                 const HifiSockAddr& senderSockAddr, p_high_resolution_clock::time_point receiveTime,
+                                 bool pooledBuffer = false);
+
     void setSystemBufferSizes();
     Connection* findOrCreateConnection(const HifiSockAddr& sockAddr, bool filterCreation = false);
    
@@ -122,6 +139,8 @@ private:
     Q_INVOKABLE void writeReliablePacketList(PacketList* packetList, const HifiSockAddr& sockAddr);
     
     QUdpSocket _udpSocket { this };
+    std::atomic<bool> _datagramBatching { false };
+    std::vector<std::pair<QByteArray, HifiSockAddr>> _pendingBatchDatagrams; // socket thread only
     PacketFilterOperator _packetFilterOperator;
     PacketHandler _packetHandler;
     MessageHandler _messageHandler;
@@ -11,6 +11,8 @@
 
 #include "Octree.h"
 
+#include "OctreeDataUtils.h"
+
 #include <cstring>
 #include <cstdio>
 #include <cmath>
@@ -959,6 +961,11 @@ bool Octree::writeToJSONFile(const char* fileName, const OctreeElementPointer& e
             success = persistFile.commit();
             if (!success) {
                 qCritical() << "Failed to commit to JSON save file:" << persistFile.errorString();
+            } else {
+                // refresh the info sidecar so id/version readers never have to parse the scene
+                PacketVersion expectedVersion = versionForPacketType(expectedDataPacketType());
+                OctreeUtils::writeOctreeDataInfoSidecar(fileName, _persistID, _persistDataVersion,
+                                                        (OctreeUtils::Version)expectedVersion, jsonDataForFile);
             }
         } else {
             qCritical("Failed to write to JSON file.");
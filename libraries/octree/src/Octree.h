@@ -214,6 +214,18 @@ public:
                             bool skipThoseWithBadParents) = 0;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) = 0;
 
+    // Binary scene format: a memory-mappable sidecar of full-entity records
+    // that loads much faster than parsing gzipped JSON (see EntityTree).
+    virtual bool writeBinaryScene(const QString& filename) { return false; }
+    virtual bool readBinaryScene(const QString& filename) { return false; }
+
+    // Append-only journal support: subclasses that can serialize incremental
+    // deltas (see EntityTree) override these, letting OctreePersistThread append
+    // changes to a journal instead of rewriting the whole tree every persist.
+    virtual bool supportsJournal() const { return false; }
+    virtual bool appendJournalDelta(QIODevice& device, quint64 sinceTime) { return false; }
+    virtual bool replayJournal(QIODevice& device) { return false; }
+
     // Octree importers
     bool readFromFile(const char* filename);
     bool readFromURL(const QString& url, const bool isObservable = true, const qint64 callerId = -1); // will support file urls as well...
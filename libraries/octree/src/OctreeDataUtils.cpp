@@ -14,10 +14,41 @@
 #include <Gzip.h>
 #include <udt/PacketHeaders.h>
 
+#include <QCryptographicHash>
 #include <QDebug>
-#include <QJsonObject>
-#include <QJsonDocument>
 #include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+
+QString OctreeUtils::octreeDataInfoSidecarPath(const QString& octreePath) {
+    return octreePath + ".info.json";
+}
+
+bool OctreeUtils::writeOctreeDataInfoSidecar(const QString& octreePath, const QUuid& id, Version dataVersion,
+                                             Version version, const QByteArray& sourceData) {
+    QFileInfo sourceInfo { octreePath };
+    if (!sourceInfo.exists()) {
+        return false;
+    }
+
+    QJsonObject info;
+    info["Id"] = id.toString();
+    info["DataVersion"] = (qint64)dataVersion;
+    info["Version"] = (qint64)version;
+    info["SourceSize"] = sourceInfo.size();
+    info["SourceModified"] = sourceInfo.lastModified().toMSecsSinceEpoch();
+    info["SourceHash"] = QString::fromLatin1(
+        QCryptographicHash::hash(sourceData, QCryptographicHash::Sha256).toHex());
+
+    QSaveFile sidecarFile { octreeDataInfoSidecarPath(octreePath) };
+    if (!sidecarFile.open(QIODevice::WriteOnly)
+            || sidecarFile.write(QJsonDocument(info).toJson()) == -1) {
+        return false;
+    }
+    return sidecarFile.commit();
+}
 
 bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromMap(const QVariantMap& map) {
     if (map.contains("Id") && map.contains("DataVersion") && map.contains("Version")) {
@@ -60,6 +91,27 @@ bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromFile(QString path) {
     return readOctreeDataInfoFromData(data);
 }
 
+bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromSidecarOrFile(const QString& path) {
+    QFile sidecarFile { octreeDataInfoSidecarPath(path) };
+    if (sidecarFile.open(QIODevice::ReadOnly)) {
+        auto info = QJsonDocument::fromJson(sidecarFile.readAll()).object();
+        QFileInfo sourceInfo { path };
+
+        // the sidecar only speaks for the exact bytes it was written next to
+        if (sourceInfo.exists()
+                && info["SourceSize"].toDouble() == (double)sourceInfo.size()
+                && (qint64)info["SourceModified"].toDouble() == sourceInfo.lastModified().toMSecsSinceEpoch()
+                && info.contains("Id") && info.contains("DataVersion") && info.contains("Version")) {
+            id = QUuid(info["Id"].toString());
+            dataVersion = (Version)info["DataVersion"].toDouble();
+            version = (Version)info["Version"].toDouble();
+            return true;
+        }
+    }
+
+    return readOctreeDataInfoFromFile(path);
+}
+
 QByteArray OctreeUtils::RawOctreeData::toByteArray() {
     QByteArray jsonString;
 
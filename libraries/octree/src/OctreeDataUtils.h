@@ -22,6 +22,12 @@ namespace OctreeUtils {
 using Version = int64_t;
 constexpr Version INITIAL_VERSION = 0;
 
+// Sidecar index written next to a persisted octree file carrying id/version/hash, so info-only
+// readers (the domain-server content handshake) never decompress and parse the scene itself.
+QString octreeDataInfoSidecarPath(const QString& octreePath);
+bool writeOctreeDataInfoSidecar(const QString& octreePath, const QUuid& id, Version dataVersion, Version version,
+                                const QByteArray& sourceData);
+
 //using PacketType = uint8_t;
 
 // RawOctreeData is an intermediate format between JSON and a fully deserialized Octree.
@@ -43,6 +49,11 @@ public:
     bool readOctreeDataInfoFromData(QByteArray data);
     bool readOctreeDataInfoFromFile(QString path);
     bool readOctreeDataInfoFromMap(const QVariantMap& map);
+
+    // Info-only fast path: consults the sidecar index first (validated against the scene file's
+    // size and modification time) and falls back to the full parse. Does NOT populate subclass
+    // payloads like the entity list - only id/version fields are guaranteed.
+    bool readOctreeDataInfoFromSidecarOrFile(const QString& path);
 };
 
 class RawEntityData : public RawOctreeData {
@@ -285,19 +285,13 @@ OctreeElementPointer OctreeElement::getChildAtIndex(int childIndex) const {
 }
 
 void OctreeElement::deleteAllChildren() {
-    // first delete all the OctreeElement objects...
-    for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
-        OctreeElementPointer childAt = getChildAtIndex(i);
-        if (childAt) {
-            childAt.reset();
-        }
-    }
+    // release the single-child slot and, when allocated, the external array
+    _childrenSingle.reset();
 
     if (_childrenExternal) {
-        // if the children_t union represents _children.external we need to delete it here
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
+        _externalChildren.reset();
+        _childrenExternal = false;
+        _externalChildrenMemoryUsage -= NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer);
     }
 }
 
@@ -345,10 +339,11 @@ void OctreeElement::setChildAtIndex(int childIndex, const OctreeElementPointer&
     } else if (previousChildCount == 0 && newChildCount == 1) {
         _childrenSingle = child;
     } else if (previousChildCount == 1 && newChildCount == 2) {
+        // graduate to the heap-allocated child array
         OctreeElementPointer previousChild = _childrenSingle;
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
+        _childrenSingle.reset();
+
+        _externalChildren.reset(new OctreeElementPointer[NUMBER_OF_CHILDREN]);
         _externalChildren[firstIndex] = previousChild;
         _externalChildren[childIndex] = child;
 
@@ -361,9 +356,8 @@ void OctreeElement::setChildAtIndex(int childIndex, const OctreeElementPointer&
         OctreeElementPointer previousFirstChild = _externalChildren[firstIndex];
         OctreeElementPointer previousSecondChild = _externalChildren[secondIndex];
 
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
+        // back to the inline single-child slot
+        _externalChildren.reset();
         _childrenExternal = false;
 
         _externalChildrenMemoryUsage -= NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer);
@@ -16,6 +16,7 @@
 #define SIMPLE_EXTERNAL_CHILDREN
 
 #include <atomic>
+#include <memory>
 
 #include <QReadWriteLock>
 
@@ -233,10 +234,12 @@ protected:
 #endif
 
 #ifdef SIMPLE_EXTERNAL_CHILDREN
-    // union children_t {
+    // Leaves and single-child elements (the overwhelming majority) carry just
+    // one inline pointer; the 8-slot array is heap-allocated only while an
+    // element has two or more children. This keeps the element itself small
+    // enough that far more of them fit per cache line during traversals.
     OctreeElementPointer _childrenSingle;
-    OctreeElementPointer _externalChildren[NUMBER_OF_CHILDREN];
-    // } _children;
+    std::unique_ptr<OctreeElementPointer[]> _externalChildren;  // allocated when more than one child
 #endif
 
     uint16_t _sourceUUIDKey; /// Client only, stores node id of voxel server that sent his voxel, 2 bytes
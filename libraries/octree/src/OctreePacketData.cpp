@@ -11,6 +11,9 @@
 
 #include "OctreePacketData.h"
 
+#include <mutex>
+#include <vector>
+
 #include <GLMHelpers.h>
 #include <PerfStat.h>
 
@@ -68,6 +71,41 @@ void OctreePacketData::reset() {
 OctreePacketData::~OctreePacketData() {
 }
 
+namespace {
+    std::mutex _poolLock;
+    std::vector<OctreePacketData*> _packetDataPool;
+}
+
+OctreePacketData* OctreePacketData::fromPool(bool enableCompression, unsigned int targetSize) {
+    OctreePacketData* packetData = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_poolLock);
+        if (!_packetDataPool.empty()) {
+            packetData = _packetDataPool.back();
+            _packetDataPool.pop_back();
+        }
+    }
+
+    if (packetData) {
+        // changeSettings() shrinks in place, so a reused instance keeps its allocation
+        packetData->changeSettings(enableCompression, targetSize);
+    } else {
+        packetData = new OctreePacketData(enableCompression, targetSize);
+    }
+    return packetData;
+}
+
+void OctreePacketData::returnToPool(OctreePacketData* packetData) {
+    const size_t MAX_POOLED_PACKET_DATA = 16;
+
+    std::lock_guard<std::mutex> lock(_poolLock);
+    if (_packetDataPool.size() < MAX_POOLED_PACKET_DATA) {
+        _packetDataPool.push_back(packetData);
+    } else {
+        delete packetData;
+    }
+}
+
 bool OctreePacketData::append(const unsigned char* data, int length) {
     bool success = false;
 
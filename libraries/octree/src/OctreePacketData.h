@@ -94,6 +94,12 @@ public:
     OctreePacketData(bool enableCompression = false, int maxFinalizedSize = MAX_OCTREE_PACKET_DATA_SIZE);
     ~OctreePacketData();
 
+    /// Pooled instances: fromPool() returns a reset instance with the requested settings,
+    /// reusing a released instance's buffers when one is available; returnToPool() hands
+    /// the instance (and its buffers) back. Thread-safe.
+    static OctreePacketData* fromPool(bool enableCompression = false, unsigned int targetSize = MAX_OCTREE_PACKET_DATA_SIZE);
+    static void returnToPool(OctreePacketData* packetData);
+
     /// change compression and target size settings
     void changeSettings(bool enableCompression = false, unsigned int targetSize = MAX_OCTREE_PACKET_DATA_SIZE);
 
@@ -337,4 +343,42 @@ private:
     static AtomicUIntStat _totalBytesOfRawData;
 };
 
+/// Move-only RAII handle to a pooled OctreePacketData: acquires from the pool on
+/// construction, releases on destruction, and can be moved to hand the buffers off
+/// without copying.
+class PooledOctreePacketData {
+public:
+    PooledOctreePacketData(bool enableCompression = false, unsigned int targetSize = MAX_OCTREE_PACKET_DATA_SIZE) :
+        _packetData(OctreePacketData::fromPool(enableCompression, targetSize)) { }
+    ~PooledOctreePacketData() {
+        if (_packetData) {
+            OctreePacketData::returnToPool(_packetData);
+        }
+    }
+
+    PooledOctreePacketData(PooledOctreePacketData&& other) noexcept : _packetData(other._packetData) {
+        other._packetData = nullptr;
+    }
+    PooledOctreePacketData& operator=(PooledOctreePacketData&& other) noexcept {
+        if (this != &other) {
+            if (_packetData) {
+                OctreePacketData::returnToPool(_packetData);
+            }
+            _packetData = other._packetData;
+            other._packetData = nullptr;
+        }
+        return *this;
+    }
+
+    PooledOctreePacketData(const PooledOctreePacketData&) = delete;
+    PooledOctreePacketData& operator=(const PooledOctreePacketData&) = delete;
+
+    OctreePacketData* get() { return _packetData; }
+    OctreePacketData* operator->() { return _packetData; }
+    OctreePacketData& operator*() { return *_packetData; }
+
+private:
+    OctreePacketData* _packetData;
+};
+
 #endif // hifi_OctreePacketData_h
@@ -11,6 +11,8 @@
 
 #include "OctreePersistThread.h"
 
+#include <QFileInfo>
+
 #include <chrono>
 #include <thread>
 
@@ -116,7 +118,7 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
         _cachedJSONData.clear();
         replacementData = message->readAll();
         replaceData(replacementData);
-        hasValidOctreeData = data.readOctreeDataInfoFromFile(_filename);
+        hasValidOctreeData = data.readOctreeDataInfoFromSidecarOrFile(_filename);
         qDebug() << "Got OctreeDataFileReply, new data sent";
     } else {
         qDebug() << "Got OctreeDataFileReply, current entity data is sufficient";
@@ -154,7 +156,19 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
         PerformanceWarning warn(true, "Loading Octree File", true);
 
         if (_cachedJSONData.isEmpty()) {
-            persistentFileRead = _tree->readFromFile(_filename.toLocal8Bit().constData());
+            // prefer the memory-mapped binary sidecar when it is at least as new
+            // as the JSON persist file
+            QString binaryFilename = _filename + ".bin";
+            QFileInfo binaryInfo(binaryFilename);
+            QFileInfo jsonInfo(_filename);
+            persistentFileRead = false;
+            if (_tree->supportsJournal() && binaryInfo.exists() &&
+                (!jsonInfo.exists() || binaryInfo.lastModified() >= jsonInfo.lastModified())) {
+                persistentFileRead = _tree->readBinaryScene(binaryFilename);
+            }
+            if (!persistentFileRead) {
+                persistentFileRead = _tree->readFromFile(_filename.toLocal8Bit().constData());
+            }
         } else {
             QDataStream jsonStream(_cachedJSONData);
             persistentFileRead = _tree->readFromStream(-1, jsonStream);
@@ -163,6 +177,20 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     });
 
     _cachedJSONData.clear();
+
+    // replay any journal appended since the last full snapshot; the next
+    // persist takes a full snapshot (_lastJournalTime stays 0), which then
+    // truncates the journal
+    if (persistentFileRead && _tree->supportsJournal()) {
+        QFile journal(journalFilename());
+        if (journal.exists() && journal.open(QIODevice::ReadOnly)) {
+            qCDebug(octree) << "Replaying octree journal" << journalFilename();
+            if (!_tree->replayJournal(journal)) {
+                qCWarning(octree) << "Octree journal replay failed or was truncated; continuing with replayed prefix";
+            }
+        }
+    }
+
     quint64 loadDone = usecTimestampNow();
     _loadTimeUSecs = loadDone - loadStarted;
 
@@ -304,18 +332,35 @@ void OctreePersistThread::cleanupOldReplacementBackups() {
 void OctreePersistThread::persist() {
     if (_tree->isDirty() && _initialLoadComplete) {
 
+        _tree->incrementPersistDataVersion();
+
+        // append the delta since the last persist to the journal instead of
+        // rewriting the whole tree; falls back to a full snapshot when the
+        // journal cannot cover the window or has grown too large
+        if (tryAppendJournal()) {
+            _tree->clearDirtyBit(); // tree is clean after saving
+            sendLatestEntityDataToDS();
+            return;
+        }
+
         _tree->withWriteLock([&] {
             qCDebug(octree) << "pruning Octree before saving...";
             _tree->pruneTree();
             qCDebug(octree) << "DONE pruning Octree before saving...";
         });
 
-        _tree->incrementPersistDataVersion();
-
         qCDebug(octree) << "Saving Octree data to:" << _filename;
+        quint64 snapshotTime = usecTimestampNow();
         if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
             _tree->clearDirtyBit(); // tree is clean after saving
             qCDebug(octree) << "DONE persisting Octree data to" << _filename;
+
+            // the snapshot covers everything; start a fresh journal relative to it
+            QFile::remove(journalFilename());
+            _lastJournalTime = snapshotTime;
+
+            // refresh the fast-startup binary sidecar alongside the snapshot
+            _tree->writeBinaryScene(_filename + ".bin");
         } else {
             qCWarning(octree) << "Failed to persist Octree data to" << _filename;
         }
@@ -324,6 +369,32 @@ void OctreePersistThread::persist() {
     }
 }
 
+bool OctreePersistThread::tryAppendJournal() {
+    const qint64 MAX_JOURNAL_SIZE = 10 * 1024 * 1024;
+
+    if (!_tree->supportsJournal() || _lastJournalTime == 0) {
+        return false;
+    }
+
+    QFile journal(journalFilename());
+    if (journal.size() > MAX_JOURNAL_SIZE) {
+        // bound journal replay time at load; take a full snapshot
+        return false;
+    }
+    if (!journal.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(octree) << "Failed to open octree journal" << journalFilename();
+        return false;
+    }
+
+    quint64 appendTime = usecTimestampNow();
+    if (!_tree->appendJournalDelta(journal, _lastJournalTime)) {
+        return false;
+    }
+
+    _lastJournalTime = appendTime;
+    return true;
+}
+
 void OctreePersistThread::sendLatestEntityDataToDS() {
     qDebug() << "Sending latest entity data to DS";
     auto nodeList = DependencyManager::get<NodeList>();
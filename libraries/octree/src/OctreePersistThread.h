@@ -59,6 +59,8 @@ protected slots:
 
 protected:
     void persist();
+    bool tryAppendJournal();
+    QString journalFilename() const { return _filename + ".journal"; }
     bool backupCurrentFile();
     void cleanupOldReplacementBackups();
 
@@ -78,6 +80,7 @@ private:
     quint64 _lastTimeDebug;
 
     QString _persistAsFileType;
+    quint64 _lastJournalTime { 0 };     // time of the snapshot/journal append the journal is relative to; 0 forces a snapshot
     QByteArray _cachedJSONData;
 };
 
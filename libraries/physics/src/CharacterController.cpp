@@ -327,6 +327,22 @@ void CharacterController::preStep(btCollisionWorld* collisionWorld) {
     // rayStart is at center of bottom sphere
     btVector3 rayStart = transform.getOrigin() - _halfHeight * _currentUp;
 
+    // Temporal coherence: a stationary character re-runs this query with the same
+    // inputs every step. Briefly reuse the last result while neither the start
+    // point nor our motion has changed meaningfully; the short reuse period keeps
+    // a platform moving out from under us from going unnoticed for long.
+    const btScalar FLOOR_QUERY_MOVE_EPSILON_SQUARED = 1.0e-6f;      // (1mm)^2
+    const btScalar FLOOR_QUERY_SPEED_EPSILON_SQUARED = 1.0e-6f;
+    const quint64 FLOOR_QUERY_REUSE_PERIOD = 100 * USECS_PER_MSEC;
+    quint64 now = usecTimestampNow();
+    if (_floorQueryCacheValid &&
+        (now - _floorQueryTime) < FLOOR_QUERY_REUSE_PERIOD &&
+        rayStart.distance2(_floorQueryStart) < FLOOR_QUERY_MOVE_EPSILON_SQUARED &&
+        _rigidBody->getLinearVelocity().length2() < FLOOR_QUERY_SPEED_EPSILON_SQUARED) {
+        // _floorDistance still holds the cached result
+        return;
+    }
+
     // rayEnd is some short distance outside bottom sphere
     const btScalar FLOOR_PROXIMITY_THRESHOLD = 0.3f * _radius;
     btScalar rayLength = _radius + FLOOR_PROXIMITY_THRESHOLD;
@@ -339,6 +355,10 @@ void CharacterController::preStep(btCollisionWorld* collisionWorld) {
     if (rayCallback.hasHit()) {
         _floorDistance = rayLength * rayCallback.m_closestHitFraction - _radius;
     }
+
+    _floorQueryCacheValid = true;
+    _floorQueryStart = rayStart;
+    _floorQueryTime = now;
 }
 
 const btScalar MIN_TARGET_SPEED = 0.001f;
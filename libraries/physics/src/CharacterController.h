@@ -205,6 +205,11 @@ protected:
     btScalar _radius { 0.0f };
 
     btScalar _floorDistance;
+
+    // temporal-coherence cache for the preStep floor-proximity ray
+    btVector3 _floorQueryStart;
+    quint64 _floorQueryTime { 0 };
+    bool _floorQueryCacheValid { false };
     bool _steppingUp { false };
     bool _stepUpEnabled { true };
     bool _hasSupport;
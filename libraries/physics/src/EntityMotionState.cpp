@@ -11,6 +11,9 @@
 
 #include "EntityMotionState.h"
 
+#include <mutex>
+#include <vector>
+
 #include <glm/gtx/norm.hpp>
 
 #include <EntityItem.h>
@@ -29,6 +32,37 @@ const uint8_t LOOPS_FOR_SIMULATION_ORPHAN = 50;
 const quint64 USECS_BETWEEN_OWNERSHIP_BIDS = USECS_PER_SECOND / 5;
 
 
+namespace {
+    // fixed-size block pool for EntityMotionState
+    std::mutex motionStatePoolMutex;
+    std::vector<void*> motionStatePool;
+    const size_t MAX_POOLED_MOTION_STATES = 1024;
+}
+
+void* EntityMotionState::operator new(size_t size) {
+    if (size == sizeof(EntityMotionState)) {
+        std::lock_guard<std::mutex> lock(motionStatePoolMutex);
+        if (!motionStatePool.empty()) {
+            void* memory = motionStatePool.back();
+            motionStatePool.pop_back();
+            return memory;
+        }
+    }
+    return ::operator new(size);
+}
+
+void EntityMotionState::operator delete(void* memory, size_t size) {
+    // only same-size blocks may be recycled
+    if (size == sizeof(EntityMotionState)) {
+        std::lock_guard<std::mutex> lock(motionStatePoolMutex);
+        if (motionStatePool.size() < MAX_POOLED_MOTION_STATES) {
+            motionStatePool.push_back(memory);
+            return;
+        }
+    }
+    ::operator delete(memory);
+}
+
 EntityMotionState::EntityMotionState(btCollisionShape* shape, EntityItemPointer entity) :
     ObjectMotionState(nullptr),
     _entity(entity),
@@ -782,7 +816,30 @@ bool EntityMotionState::isLocallyOwnedOrShouldBe() const {
 }
 
 void EntityMotionState::setRegion(uint8_t region) {
+    if (_region == region) {
+        return;
+    }
     _region = region;
+
+    // Workload-driven activation: bodies in the near region (R1) keep Bullet's
+    // default sleeping thresholds; further out (R2+) they fall asleep much more
+    // readily, since nobody is close enough to notice the settling detail.
+    // Crossing back into R1 restores the defaults and wakes the body so any
+    // prematurely-slept motion resumes.
+    btRigidBody* body = getRigidBody();
+    if (body && !body->isStaticOrKinematicObject()) {
+        const btScalar DEFAULT_LINEAR_SLEEPING_THRESHOLD = 0.8f;    // Bullet's defaults
+        const btScalar DEFAULT_ANGULAR_SLEEPING_THRESHOLD = 1.0f;
+        const btScalar DISTANT_THRESHOLD_SCALE = 4.0f;
+
+        if (region == workload::Region::R1) {
+            body->setSleepingThresholds(DEFAULT_LINEAR_SLEEPING_THRESHOLD, DEFAULT_ANGULAR_SLEEPING_THRESHOLD);
+            body->activate();
+        } else {
+            body->setSleepingThresholds(DISTANT_THRESHOLD_SCALE * DEFAULT_LINEAR_SLEEPING_THRESHOLD,
+                                        DISTANT_THRESHOLD_SCALE * DEFAULT_ANGULAR_SLEEPING_THRESHOLD);
+        }
+    }
 }
 
 void EntityMotionState::initForBid() {
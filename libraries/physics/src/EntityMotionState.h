@@ -26,6 +26,12 @@
 
 class EntityMotionState : public ObjectMotionState {
 public:
+    // EntityMotionStates churn constantly as entities move in and out of the
+    // physics simulation; class-level pooling recycles their fixed-size blocks
+    // instead of hitting the heap on every add/remove.
+    static void* operator new(size_t size);
+    static void operator delete(void* memory, size_t size);
+
     enum class OwnershipState {
         NotLocallyOwned = 0,
         PendingBid,
@@ -59,29 +59,30 @@ void computeTetrahedronInertia(btScalar mass, btVector3* points, btMatrix3x3& in
     const btVector3& p2 = points[2];
     const btVector3& p3 = points[3];
 
-    for (uint32_t i = 0; i < 3; ++i ) {
-        uint32_t j = (i + 1) % 3;
-        uint32_t k = (j + 1) % 3;
-
-        // compute diagonal
-        inertia[i][i] = mass * btScalar(0.1f) * 
-            ( p0[j] * (p0[j] + p1[j] + p2[j] + p3[j])
-            + p1[j] * (p1[j] + p2[j] + p3[j])
-            + p2[j] * (p2[j] + p3[j])
-            + p3[j] * p3[j]
-            + p0[k] * (p0[k] + p1[k] + p2[k] + p3[k])
-            + p1[k] * (p1[k] + p2[k] + p3[k])
-            + p2[k] * (p2[k] + p3[k])
-            + p3[k] * p3[k] );
-
-        // compute off-diagonals
-        inertia[j][k] = inertia[k][j] = - mass * btScalar(0.05f) *
-            ( btScalar(2.0f) * ( p0[j] * p0[k] +  p1[j] * p1[k] +  p2[j] * p2[k] +  p3[j] * p3[k] )
-            + p0[j] * (p1[k] + p2[k] + p3[k])
-            + p1[j] * (p0[k] + p2[k] + p3[k])
-            + p2[j] * (p0[k] + p1[k] + p3[k])
-            + p3[j] * (p0[k] + p1[k] + p2[k]) );
-    }
+    // Vectorized form of the same sums. With
+    //     S = p0 + p1 + p2 + p3       (componentwise)
+    //     A = p0*p0 + p1*p1 + ...     (componentwise squares)
+    // the diagonal sums SUM(n<=m){ pn[i]*pm[i] } collapse to (S[i]^2 + A[i])/2,
+    // and the off-diagonal sums collapse to D[jk] + S[j]*S[k] with
+    // D[jk] = SUM(n){ pn[j]*pn[k] }. The componentwise btVector3 ops run SIMD
+    // on SSE/NEON builds.
+    btVector3 pointSum = p0 + p1 + p2 + p3;
+    btVector3 squareSum = p0 * p0 + p1 * p1 + p2 * p2 + p3 * p3;
+    btVector3 pairSum = (pointSum * pointSum + squareSum) * btScalar(0.5f);
+
+    btScalar diagonalCoefficient = mass * btScalar(0.1f);
+    inertia[0][0] = diagonalCoefficient * (pairSum[1] + pairSum[2]);
+    inertia[1][1] = diagonalCoefficient * (pairSum[2] + pairSum[0]);
+    inertia[2][2] = diagonalCoefficient * (pairSum[0] + pairSum[1]);
+
+    btScalar crossXY = p0.x() * p0.y() + p1.x() * p1.y() + p2.x() * p2.y() + p3.x() * p3.y();
+    btScalar crossYZ = p0.y() * p0.z() + p1.y() * p1.z() + p2.y() * p2.z() + p3.y() * p3.z();
+    btScalar crossZX = p0.z() * p0.x() + p1.z() * p1.x() + p2.z() * p2.x() + p3.z() * p3.x();
+
+    btScalar offDiagonalCoefficient = -mass * btScalar(0.05f);
+    inertia[1][2] = inertia[2][1] = offDiagonalCoefficient * (crossYZ + pointSum[1] * pointSum[2]);
+    inertia[2][0] = inertia[0][2] = offDiagonalCoefficient * (crossZX + pointSum[2] * pointSum[0]);
+    inertia[0][1] = inertia[1][0] = offDiagonalCoefficient * (crossXY + pointSum[0] * pointSum[1]);
 }
 
 // helper function
@@ -10,6 +10,8 @@
 //
 
 #include "MultiSphereShape.h"
+
+#include <cfloat>
 #include "PhysicsLogging.h"
 
 void SphereRegion::translate(const glm::vec3& translation) {
@@ -635,14 +637,22 @@ void MultiSphereShape::setScale(float scale) {
 }
 
 AABox& MultiSphereShape::updateBoundingBox(const glm::vec3& position, const glm::quat& rotation) {
+    // This runs per joint per frame for every avatar in view. Rotate the sphere
+    // centers through one precomputed matrix and accumulate the extents with
+    // componentwise min/max (which vectorize), instead of copying the sphere
+    // list and folding a freshly-built AABox per sphere.
     _boundingBox = AABox();
-    auto spheres = getSpheresData();
-    for (size_t i = 0; i < spheres.size(); i++) {
-        auto sphere = spheres[i];
-        auto worldPosition = position + rotation * sphere._position;
-        glm::vec3 corner = worldPosition - glm::vec3(sphere._radius);
-        glm::vec3 dimensions = glm::vec3(2.0f * sphere._radius);
-        _boundingBox += AABox(corner, dimensions);
+    glm::mat3 rotationMatrix = glm::mat3_cast(rotation);
+    glm::vec3 minimum(FLT_MAX);
+    glm::vec3 maximum(-FLT_MAX);
+    const auto& spheres = getSpheresData();
+    for (const auto& sphere : spheres) {
+        glm::vec3 worldPosition = position + rotationMatrix * sphere._position;
+        minimum = glm::min(minimum, worldPosition - glm::vec3(sphere._radius));
+        maximum = glm::max(maximum, worldPosition + glm::vec3(sphere._radius));
+    }
+    if (!spheres.empty()) {
+        _boundingBox = AABox(minimum, maximum - minimum);
     }
     return _boundingBox;
 }
\ No newline at end of file
@@ -428,7 +428,7 @@ void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transactio
         bool needsNewShape = object->needsNewShape();
         if (needsNewShape) {
             ShapeType shapeType = object->getShapeType();
-            if (shapeType == SHAPE_TYPE_STATIC_MESH) {
+            if (ShapeManager::isAsyncShapeType(shapeType)) {
                 ShapeRequest shapeRequest(object->_entity);
                 ShapeRequests::iterator  requestItr = _shapeRequests.find(shapeRequest);
                 if (requestItr == _shapeRequests.end()) {
@@ -648,12 +648,10 @@ void PhysicalEntitySimulation::sendOwnedUpdates(uint32_t numSubsteps) {
 }
 
 void PhysicalEntitySimulation::handleCollisionEvents(const CollisionEvents& collisionEvents) {
-    for (auto collision : collisionEvents) {
-        // NOTE: The collision event is always aligned such that idA is never NULL.
-        // however idB may be NULL.
-        if (!collision.idB.isNull()) {
-            emit entityCollisionWithEntity(collision.idA, collision.idB, collision);
-        }
+    if (!collisionEvents.empty()) {
+        // deliver the whole step's contact pairs in one signal; the receiver
+        // fans out per pair without a queued invocation each
+        emit entityCollisionEvents(collisionEvents);
     }
 }
 
@@ -69,6 +69,9 @@ public:
     void queueEraseDomainEntity(const QUuid& id) const override;
 
 signals:
+    // one signal per step carrying every contact pair, so queued dispatch is
+    // paid per batch instead of per pair
+    void entityCollisionEvents(const CollisionEvents& events);
     void entityCollisionWithEntity(const EntityItemID& idA, const EntityItemID& idB, const Collision& collision);
 
 protected: // only called by EntitySimulation
@@ -11,6 +11,11 @@
 
 #include "PhysicsEngine.h"
 
+#include <LinearMath/btThreads.h>
+#if BT_THREADSAFE
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#endif
+
 #include <functional>
 
 #include <QFile>
@@ -45,7 +50,20 @@ PhysicsEngine::~PhysicsEngine() {
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
         _collisionConfig = new btDefaultCollisionConfiguration();
+#if BT_THREADSAFE
+        // Parallel narrowphase: when Bullet is built thread-safe, dispatch
+        // collision pairs across its task scheduler. Constraint solving stays on
+        // the stepping thread - ThreadSafeDynamicsWorld derives from the
+        // single-threaded world, so a solver pool would require rebasing it
+        // onto btDiscreteDynamicsWorldMt.
+        if (!btGetTaskScheduler()) {
+            btSetTaskScheduler(btCreateDefaultTaskScheduler());
+        }
+        const int DISPATCHER_GRAIN_SIZE = 40;   // pairs per parallel-for chunk
+        _collisionDispatcher = new btCollisionDispatcherMt(_collisionConfig, DISPATCHER_GRAIN_SIZE);
+#else
         _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+#endif
         _broadphaseFilter = new btDbvtBroadphase();
         _constraintSolver = new btSequentialImpulseConstraintSolver;
         _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
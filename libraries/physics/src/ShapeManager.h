@@ -55,6 +55,13 @@ public:
     ShapeManager();
     ~ShapeManager();
 
+    /// \return true for shape types expensive enough to be built off-thread;
+    /// getShape() returns nullptr for these until the worker delivers, bumping
+    /// the work-request count so callers know to wait
+    static bool isAsyncShapeType(ShapeType type) {
+        return type == SHAPE_TYPE_STATIC_MESH || type == SHAPE_TYPE_COMPOUND || type == SHAPE_TYPE_SIMPLE_COMPOUND;
+    }
+
     /// \return pointer to shape
     const btCollisionShape* getShape(const ShapeInfo& info);
     const btCollisionShape* getShapeByKey(uint64_t key);
@@ -140,12 +140,30 @@ void ThreadSafeDynamicsWorld::synchronizeMotionStates() {
         // that remembers a list of objects deactivated last step
         _activeStates.clear();
         _deactivatedStates.clear();
+
+        // Batched sync: first integrate every active body's interpolated
+        // transform into contiguous scratch arrays (pure math, no locks), then
+        // deliver them through the motion states, so the per-entity locking
+        // phase doesn't interleave with the transform integration.
+        _scratchBodies.resize(0);
+        _scratchTransforms.resize(0);
         for (int i=0;i<m_nonStaticRigidBodies.size();i++) {
             btRigidBody* body = m_nonStaticRigidBodies[i];
             ObjectMotionState* motionState = static_cast<ObjectMotionState*>(body->getMotionState());
             if (motionState) {
                 if (body->isActive()) {
-                    synchronizeMotionState(body);
+                    if (body->isKinematicObject()) {
+                        // special-cased, see synchronizeMotionState()
+                        synchronizeMotionState(body);
+                    } else {
+                        _scratchBodies.push_back(body);
+                        _scratchTransforms.expandNonInitializing();
+                        btTransformUtil::integrateTransform(body->getInterpolationWorldTransform(),
+                            body->getInterpolationLinearVelocity(), body->getInterpolationAngularVelocity(),
+                            (m_latencyMotionStateInterpolation && m_fixedTimeStep) ? m_localTime - m_fixedTimeStep
+                                                                                  : m_localTime * body->getHitFraction(),
+                            _scratchTransforms[_scratchTransforms.size() - 1]);
+                    }
                     _changedMotionStates.push_back(motionState);
                     _activeStates.insert(motionState);
                 } else if (_lastActiveStates.find(motionState) != _lastActiveStates.end()) {
@@ -154,6 +172,11 @@ void ThreadSafeDynamicsWorld::synchronizeMotionStates() {
                 }
             }
         }
+
+        // delivery phase
+        for (int i = 0; i < _scratchBodies.size(); ++i) {
+            _scratchBodies[i]->getMotionState()->setWorldTransform(_scratchTransforms[i]);
+        }
     }
     _activeStates.swap(_lastActiveStates);
 }
@@ -24,6 +24,7 @@
 #include "ObjectMotionState.h"
 
 #include <functional>
+#include <vector>
 
 using SubStepCallback = std::function<void()>;
 
@@ -58,6 +59,11 @@ public:
 private:
     // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
     void synchronizeMotionState(btRigidBody* body);
+
+    // scratch for the two-phase (integrate, then deliver) motion-state sync
+    // (btAlignedObjectArray preserves btTransform's SIMD alignment)
+    btAlignedObjectArray<btRigidBody*> _scratchBodies;
+    btAlignedObjectArray<btTransform> _scratchTransforms;
     void drawConnectedSpheres(btIDebugDraw* drawer, btScalar radius1, btScalar radius2, const btVector3& position1, 
                               const btVector3& position2, const btVector3& color);
 
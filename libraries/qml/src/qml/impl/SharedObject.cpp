@@ -35,6 +35,9 @@
 // achieve.
 // This has the effect of capping the framerate at 200
 static const int MIN_TIMER_MS = 5;
+// idle surfaces fall back to a slow poll; any render request snaps the timer back
+static const int IDLE_TIMER_MS = 100;
+static const int IDLE_TICKS_BEFORE_SLOWDOWN = 60;
 
 using namespace hifi::qml;
 using namespace hifi::qml::impl;
@@ -395,6 +398,7 @@ void SharedObject::requestRender() {
         return;
     }
     _renderRequested = true;
+    wakeTimer();
 }
 
 void SharedObject::requestRenderSync() {
@@ -403,6 +407,15 @@ void SharedObject::requestRenderSync() {
     }
     _renderRequested = true;
     _syncRequested = true;
+    wakeTimer();
+}
+
+void SharedObject::wakeTimer() {
+    // restore the fast cadence immediately so input and animation never wait out an idle poll
+    if (_renderTimer && _renderTimer->interval() != MIN_TIMER_MS) {
+        _renderTimer->setInterval(MIN_TIMER_MS);
+    }
+    _idleTimerTicks = 0;
 }
 
 bool SharedObject::fetchTexture(TextureAndFence& textureAndFence) {
@@ -479,8 +492,17 @@ void SharedObject::onRender() {
 void SharedObject::onTimer() {
     getTextureCache().report();
     if (!_renderRequested) {
+        // a static surface produces no render requests (the render control only signals on
+        // scene changes), so after a stretch of idle ticks the per-surface timer drops from
+        // its 5ms cadence to a slow poll - this is where idle tablet surfaces were costing
+        // constant wakeups
+        if (_renderTimer && _renderTimer->interval() == MIN_TIMER_MS
+                && ++_idleTimerTicks >= IDLE_TICKS_BEFORE_SLOWDOWN) {
+            _renderTimer->setInterval(IDLE_TIMER_MS);
+        }
         return;
     }
+    _idleTimerTicks = 0;
 
     {
         QMutexLocker locker(&_mutex);
@@ -81,6 +81,7 @@ private:
 
     void requestRender();
     void requestRenderSync();
+    void wakeTimer();
     void wait();
     void wake();
     void onInitialize();
@@ -113,6 +114,7 @@ private:
     uint8_t _maxFps { 60 };
 
     bool _renderRequested { false };
+    int _idleTimerTicks { 0 };
     bool _syncRequested { false };
     bool _quit { false };
     bool _paused { false };
@@ -18,6 +18,7 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QBuffer>
 #include <QtCore/QDebug>
+#include <QtConcurrent/QtConcurrentRun>
 
 using namespace recording;
 
@@ -30,7 +31,11 @@ Clip::Pointer Clip::fromFile(const QString& filePath) {
 }
 
 void Clip::toFile(const QString& filePath, const Clip::ConstPointer& clip) {
-    FileClip::write(filePath, clip->duplicate());
+    // duplicate() snapshots the clip, so serialization and file IO can run behind the caller
+    auto snapshot = clip->duplicate();
+    QtConcurrent::run([filePath, snapshot] {
+        FileClip::write(filePath, snapshot);
+    });
 }
 
 QByteArray Clip::toBuffer(const Clip::ConstPointer& clip) {
@@ -54,8 +59,16 @@ float Clip::position() const {
     return Frame::frameTimeToSeconds(positionFrameTime());
 }
 
+struct WrittenFrameEntry {
+    FrameType type;
+    Frame::Time timeOffset;
+    uint16_t size;
+    quint64 payloadOffset;
+};
+
 // FIXME move to frame?
-bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
+bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true,
+                std::vector<WrittenFrameEntry>* frameIndex = nullptr) {
     if (frame.type == Frame::TYPE_INVALID) {
         qWarning() << "Attempting to write invalid frame";
         return true;
@@ -81,6 +94,10 @@ bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
         return false;
     }
 
+    if (frameIndex) {
+        frameIndex->push_back({ frame.type, frame.timeOffset, dataSize, (quint64)output.pos() });
+    }
+
     if (dataSize != 0) {
         written = output.write(frameData);
         if (written != dataSize) {
@@ -105,17 +122,34 @@ bool Clip::write(QIODevice& output) {
     // Always mark new files as compressed
     rootObject.insert(FRAME_COMREPSSION_FLAG, true);
     QByteArray headerFrameData = QJsonDocument(rootObject).toBinaryData();
+    std::vector<WrittenFrameEntry> frameIndex;
+
     // Never compress the header frame
-    if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), false)) {
+    if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), false, &frameIndex)) {
         return false;
     }
 
     seek(0);
 
     for (auto frame = nextFrame(); frame; frame = nextFrame()) {
-        if (!writeFrame(output, *frame)) {
+        if (!writeFrame(output, *frame, true, &frameIndex)) {
             return false;
         }
     }
+
+    // Trailing frame index: count, entries, index offset, magic. Loaders seek here first and
+    // skip the whole-file header scan (which pages in every frame of a mapped clip).
+    quint64 indexStart = (quint64)output.pos();
+    uint32_t frameCount = (uint32_t)frameIndex.size();
+    output.write((char*)&frameCount, sizeof(frameCount));
+    for (const auto& entry : frameIndex) {
+        output.write((char*)&entry.type, sizeof(entry.type));
+        output.write((char*)&entry.timeOffset, sizeof(entry.timeOffset));
+        output.write((char*)&entry.size, sizeof(entry.size));
+        output.write((char*)&entry.payloadOffset, sizeof(entry.payloadOffset));
+    }
+    output.write((char*)&indexStart, sizeof(indexStart));
+    output.write((char*)&FRAME_INDEX_MAGIC, sizeof(FRAME_INDEX_MAGIC));
+
     return true;
 }
@@ -45,6 +45,59 @@ FrameTranslationMap parseTranslationMap(const QJsonDocument& doc) {
 }
 
 
+// parse the trailing frame index, touching only the footer and index pages of the mapping;
+// returns an empty list when no valid index footer is present
+PointerFrameHeaderList parseFrameIndex(uchar* const start, const size_t& size) {
+    PointerFrameHeaderList results;
+    const size_t FOOTER_SIZE = sizeof(quint64) + sizeof(uint32_t);
+    if (size < FOOTER_SIZE + sizeof(uint32_t)) {
+        return results;
+    }
+
+    uint32_t magic = 0;
+    memcpy(&magic, start + size - sizeof(uint32_t), sizeof(uint32_t));
+    if (magic != FRAME_INDEX_MAGIC) {
+        return results;
+    }
+
+    quint64 indexStart = 0;
+    memcpy(&indexStart, start + size - FOOTER_SIZE, sizeof(quint64));
+    if (indexStart + sizeof(uint32_t) > size - FOOTER_SIZE) {
+        return results;
+    }
+
+    auto current = start + indexStart;
+    uint32_t frameCount = 0;
+    memcpy(&frameCount, current, sizeof(frameCount));
+    current += sizeof(frameCount);
+
+    const size_t ENTRY_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(uint16_t) + sizeof(quint64);
+    if (indexStart + sizeof(uint32_t) + frameCount * ENTRY_SIZE > size - FOOTER_SIZE) {
+        return results;
+    }
+
+    for (uint32_t i = 0; i < frameCount; i++) {
+        PointerFrameHeader header;
+        memcpy(&header.type, current, sizeof(FrameType));
+        current += sizeof(FrameType);
+        memcpy(&header.timeOffset, current, sizeof(Frame::Time));
+        current += sizeof(Frame::Time);
+        memcpy(&header.size, current, sizeof(uint16_t));
+        current += sizeof(uint16_t);
+        memcpy(&header.fileOffset, current, sizeof(quint64));
+        current += sizeof(quint64);
+
+        if (header.fileOffset + header.size > indexStart) {
+            // entry points outside the frame region; distrust the whole index
+            return PointerFrameHeaderList();
+        }
+        results.push_back(header);
+    }
+
+    qDebug(recordingLog) << "Loaded frame index with " << results.size() << " frames";
+    return results;
+}
+
 PointerFrameHeaderList parseFrameHeaders(uchar* const start, const size_t& size) {
     PointerFrameHeaderList results;
     auto current = start;
@@ -87,7 +140,11 @@ void PointerClip::init(uchar* data, size_t size) {
     _data = data;
     _size = size;
 
-    auto parsedFrameHeaders = parseFrameHeaders(data, size);
+    // an indexed clip loads without scanning (and paging in) the whole mapping
+    auto parsedFrameHeaders = parseFrameIndex(data, size);
+    if (parsedFrameHeaders.empty()) {
+        parsedFrameHeaders = parseFrameHeaders(data, size);
+    }
     // Verify that at least one frame exists and that the first frame is a header
     if (0 == parsedFrameHeaders.size()) {
         qWarning() << "No frames found, invalid file";
@@ -20,6 +20,11 @@
 
 namespace recording {
 
+// trailing frame-index footer magic: clips written with an index end with
+// [index][quint64 indexStart][magic], letting loaders index the clip without paging in every
+// frame of the mapping; older readers fall off the end of the frame stream and ignore it
+const uint32_t FRAME_INDEX_MAGIC = 0x48465249; // 'HFRI'
+
 struct PointerFrameHeader : public FrameHeader {
     FrameType type;
     Frame::Time timeOffset;
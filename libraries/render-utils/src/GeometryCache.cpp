@@ -1329,6 +1329,18 @@ void GeometryCache::renderQuad(gpu::Batch& batch, const glm::vec2& minCorner, co
     const int NUM_POS_COORDS = 2;
     const int VERTEX_NORMAL_OFFSET = NUM_POS_COORDS * sizeof(float);
 
+    // identical quad content registered under another id already has buffers;
+    // share them instead of building a new set
+    if (!details.isCreated) {
+        auto contentItr = _quad2DContentCache.constFind(key);
+        if (contentItr != _quad2DContentCache.constEnd()) {
+            details = contentItr.value();
+            if (registered) {
+                _lastRegisteredQuad2D[id] = key;
+            }
+        }
+    }
+
     if (!details.isCreated) {
 
         details.isCreated = true;
@@ -1370,6 +1382,13 @@ void GeometryCache::renderQuad(gpu::Batch& batch, const glm::vec2& minCorner, co
 
         details.verticesBuffer->append(sizeof(vertexBuffer), (gpu::Byte*) vertexBuffer);
         details.colorBuffer->append(sizeof(colors), (gpu::Byte*) colors);
+
+        // publish for dedup across ids, bounded so stale content cycles out
+        const int MAX_QUAD_CONTENT_CACHE = 512;
+        if (_quad2DContentCache.size() >= MAX_QUAD_CONTENT_CACHE) {
+            _quad2DContentCache.clear();
+        }
+        _quad2DContentCache.insert(key, details);
     }
 
     batch.setInputFormat(details.streamFormat);
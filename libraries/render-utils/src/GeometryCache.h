@@ -428,6 +428,10 @@ private:
     QHash<int, Vec4Pair> _lastRegisteredQuad2D;
     QHash<int, BatchItemDetails> _registeredQuad2D;
 
+    // content-keyed dedup: identical quads registered under different ids share
+    // one set of GPU buffers (BatchItemDetails copies share their pointers)
+    QHash<Vec4Pair, BatchItemDetails> _quad2DContentCache;
+
     QHash<int, Vec3Pair> _lastRegisteredBevelRects;
     QHash<int, BatchItemDetails> _registeredBevelRects;
 
@@ -328,8 +328,17 @@ glm::ivec3 LightClusters::updateClusters() {
     // Clean up last info
     uint32_t numClusters = (uint32_t)_clusterGrid.size();
 
-    std::vector< std::vector< LightIndex > > clusterGridPoint(numClusters);
-    std::vector< std::vector< LightIndex > > clusterGridSpot(numClusters);
+    // reuse the per-cluster scratch lists; clear() keeps each vector's capacity
+    auto& clusterGridPoint = _clusterGridPointScratch;
+    auto& clusterGridSpot = _clusterGridSpotScratch;
+    clusterGridPoint.resize(numClusters);
+    clusterGridSpot.resize(numClusters);
+    for (auto& clusterLights : clusterGridPoint) {
+        clusterLights.clear();
+    }
+    for (auto& clusterLights : clusterGridSpot) {
+        clusterLights.clear();
+    }
 
     _clusterGrid.clear();
     _clusterGrid.resize(numClusters, EMPTY_CLUSTER);
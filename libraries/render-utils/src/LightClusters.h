@@ -105,6 +105,10 @@ public:
 
     std::vector<uint32_t> _clusterGrid;
     std::vector<LightIndex> _clusterContent;
+    // per-cluster scratch light lists, reused across updates so the thousands of
+    // per-cluster vectors keep their capacity instead of reallocating every frame
+    std::vector<std::vector<LightIndex>> _clusterGridPointScratch;
+    std::vector<std::vector<LightIndex>> _clusterGridSpotScratch;
     gpu::BufferView _clusterGridBuffer;
     gpu::BufferView _clusterContentBuffer;
     uint32_t _clusterContentBudget { 0 };
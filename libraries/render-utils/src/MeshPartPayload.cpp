@@ -382,10 +382,21 @@ void ModelMeshPartPayload::updateKey(const render::ItemKey& key) {
 void ModelMeshPartPayload::setShapeKey(bool invalidateShapeKey, PrimitiveMode primitiveMode, bool useDualQuaternionSkinning) {
     if (invalidateShapeKey) {
         _shapeKey = ShapeKey::Builder::invalid();
+        _shapeKeyCacheValid = false;
         return;
     }
 
-    if (_drawMaterials.shouldUpdate()) {
+    bool materialsNeedUpdate = _drawMaterials.shouldUpdate();
+
+    // the key is immutable between input changes; skip the rebuild when nothing
+    // feeding it moved (procedural materials are excluded, since their readiness
+    // can flip without a material update)
+    if (!materialsNeedUpdate && _shapeKeyCacheValid && !_cachedMaterialIsProcedural &&
+        primitiveMode == _cachedShapeKeyPrimitiveMode && useDualQuaternionSkinning == _cachedShapeKeyDualQuat) {
+        return;
+    }
+
+    if (materialsNeedUpdate) {
         RenderPipelines::updateMultiMaterial(_drawMaterials);
     }
 
@@ -436,6 +447,11 @@ void ModelMeshPartPayload::setShapeKey(bool invalidateShapeKey, PrimitiveMode pr
     }
 
     _shapeKey = builder.build();
+
+    _shapeKeyCacheValid = true;
+    _cachedShapeKeyPrimitiveMode = primitiveMode;
+    _cachedShapeKeyDualQuat = useDualQuaternionSkinning;
+    _cachedMaterialIsProcedural = material && material->isProcedural();
 }
 
 ShapeKey ModelMeshPartPayload::getShapeKey() const {
@@ -122,6 +122,15 @@ public:
     enum class ClusterBufferType { Matrices, DualQuaternions };
     ClusterBufferType _clusterBufferType { ClusterBufferType::Matrices };
 
+public:
+    // adopt a cluster buffer shared across the payloads of one skin deformer
+    void setClusterBuffer(const gpu::BufferPointer& clusterBuffer, bool useDualQuaternionSkinning) {
+        _clusterBufferType = useDualQuaternionSkinning ? ClusterBufferType::DualQuaternions : ClusterBufferType::Matrices;
+        _clusterBuffer = clusterBuffer;
+    }
+
+private:
+
     int _meshIndex;
     int _shapeID;
     uint32_t _deformerIndex;
@@ -138,6 +147,14 @@ private:
     gpu::BufferPointer _meshBlendshapeBuffer;
     int _meshNumVertices;
     render::ShapeKey _shapeKey { render::ShapeKey::Builder::invalid() };
+
+    // cached setShapeKey inputs: the key is immutable between input changes, so
+    // the per-frame render update skips rebuilding it from the material key
+    bool _shapeKeyCacheValid { false };
+    bool _cachedShapeKeyInvalidate { false };
+    PrimitiveMode _cachedShapeKeyPrimitiveMode { PrimitiveMode::SOLID };
+    bool _cachedShapeKeyDualQuat { false };
+    bool _cachedMaterialIsProcedural { false };
     bool _cauterized { false };
 
 };
@@ -222,6 +222,10 @@ void Model::updateRenderItems() {
         // We need to update them here so we can correctly update the bounding box.
         self->updateClusterMatrices();
 
+        // upload each skin deformer's cluster data once, into a buffer shared by
+        // all of its mesh-part payloads, instead of one upload per part
+        self->updateClusterBuffers();
+
         Transform modelTransform = self->getTransform();
         modelTransform.setScale(glm::vec3(1.0f));
 
@@ -245,11 +249,7 @@ void Model::updateRenderItems() {
 
                 transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, shapeState, meshState, useDualQuaternionSkinning,
                                                                       invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags, cauterized](ModelMeshPartPayload& data) {
-                    if (useDualQuaternionSkinning) {
-                        data.updateClusterBuffer(meshState.clusterDualQuaternions);
-                    } else {
-                        data.updateClusterBuffer(meshState.clusterMatrices);
-                    }
+                    data.setClusterBuffer(meshState.clusterBuffer, useDualQuaternionSkinning);
 
                     Transform renderTransform = modelTransform;
                     data.updateTransform(renderTransform);
@@ -1409,6 +1409,32 @@ void Model::updateRig(float deltaTime, glm::mat4 parentTransform) {
 }
 
 // virtual
+void Model::updateClusterBuffers() {
+    for (auto& state : _meshStates) {
+        if (_useDualQuaternionSkinning) {
+            if (state.clusterDualQuaternions.size() > 1) {
+                size_t numBytes = state.clusterDualQuaternions.size() * sizeof(TransformDualQuaternion);
+                if (!state.clusterBuffer) {
+                    state.clusterBuffer = std::make_shared<gpu::Buffer>(numBytes,
+                        (const gpu::Byte*) state.clusterDualQuaternions.data());
+                } else {
+                    state.clusterBuffer->setSubData(0, numBytes, (const gpu::Byte*) state.clusterDualQuaternions.data());
+                }
+            }
+        } else {
+            if (state.clusterMatrices.size() > 1) {
+                size_t numBytes = state.clusterMatrices.size() * sizeof(glm::mat4);
+                if (!state.clusterBuffer) {
+                    state.clusterBuffer = std::make_shared<gpu::Buffer>(numBytes,
+                        (const gpu::Byte*) state.clusterMatrices.data());
+                } else {
+                    state.clusterBuffer->setSubData(0, numBytes, (const gpu::Byte*) state.clusterMatrices.data());
+                }
+            }
+        }
+    }
+}
+
 void Model::updateClusterMatrices() {
     DETAILED_PERFORMANCE_TIMER("Model::updateClusterMatrices");
 
@@ -1822,15 +1848,27 @@ void Blender::run() {
 
             float normalCoefficient = vertexCoefficient * NORMAL_COEFFICIENT_SCALE;
             const HFMBlendshape& blendshape = meshIter->blendshapes.at(i);
-            for (int j = 0; j < blendshape.indices.size(); ++j) {
-                int index = blendshape.indices.at(j);
-
-                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[index];
-                currentBlendshapeOffset.positionOffset += blendshape.vertices.at(j) * vertexCoefficient;
-                currentBlendshapeOffset.normalOffset += blendshape.normals.at(j) * normalCoefficient;
-                if (j < blendshape.tangents.size()) {
-                    currentBlendshapeOffset.tangentOffset += blendshape.tangents.at(j) * normalCoefficient;
-                }
+
+            // raw pointers and a hoisted tangent split keep this gather loop
+            // branch-free per element, so the vec3 math vectorizes
+            const int* indices = blendshape.indices.constData();
+            const glm::vec3* vertices = blendshape.vertices.constData();
+            const glm::vec3* normals = blendshape.normals.constData();
+            const glm::vec3* tangents = blendshape.tangents.constData();
+            int numIndices = blendshape.indices.size();
+            int numWithTangents = qMin(numIndices, blendshape.tangents.size());
+
+            int j = 0;
+            for (; j < numWithTangents; ++j) {
+                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[indices[j]];
+                currentBlendshapeOffset.positionOffset += vertices[j] * vertexCoefficient;
+                currentBlendshapeOffset.normalOffset += normals[j] * normalCoefficient;
+                currentBlendshapeOffset.tangentOffset += tangents[j] * normalCoefficient;
+            }
+            for (; j < numIndices; ++j) {
+                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[indices[j]];
+                currentBlendshapeOffset.positionOffset += vertices[j] * vertexCoefficient;
+                currentBlendshapeOffset.normalOffset += normals[j] * normalCoefficient;
             }
         }
 
@@ -178,6 +178,7 @@ public:
 
     virtual void simulate(float deltaTime, bool fullUpdate = true);
     virtual void updateClusterMatrices();
+    void updateClusterBuffers();    // one ranged upload per skin deformer, shared across its parts
 
     /// Returns a reference to the shared geometry.
     const NetworkModel::Pointer& getNetworkModel() const { return _renderGeometry; }
@@ -352,6 +353,10 @@ public:
         std::vector<TransformDualQuaternion> clusterDualQuaternions;
         std::vector<glm::mat4> clusterMatrices;
 
+        // shared by every mesh-part payload of this skin deformer, uploaded once
+        // per frame by updateClusterBuffers()
+        gpu::BufferPointer clusterBuffer;
+
         uint32_t getNumClusters() const { return (uint32_t) std::max(clusterMatrices.size(), clusterMatrices.size()); }
     };
     const MeshState& getMeshState(int index) { return _meshStates.at(index); }
@@ -225,6 +225,29 @@ void RenderShadowMap::run(const render::RenderContextPointer& renderContext, con
     RenderArgs* args = renderContext->args;
     auto adjustedShadowFrustum = args->getViewFrustum();
 
+    // Static shadow caching: if this cascade's frustum, its content set and the
+    // scene are all unchanged since the map was last rendered, its depth
+    // contents are still valid - skip the whole pass. Any scene transaction
+    // invalidates (coarse, but never stale).
+    {
+        size_t shapeCount = 0;
+        for (const auto& items : inShapes) {
+            shapeCount += items.second.size();
+        }
+        uint32_t sceneChangeCount = renderContext->_scene->getChangeCount();
+        if (_haveCachedMap && sceneChangeCount == _cachedSceneChangeCount &&
+            shapeCount == _cachedShapeCount &&
+            _cachedShapeBounds == inShapeBounds &&
+            _cachedFrustum.isVerySimilar(adjustedShadowFrustum)) {
+            return;
+        }
+        _haveCachedMap = true;
+        _cachedSceneChangeCount = sceneChangeCount;
+        _cachedShapeCount = shapeCount;
+        _cachedShapeBounds = inShapeBounds;
+        _cachedFrustum = adjustedShadowFrustum;
+    }
+
     // Adjust the frustum near and far depths based on the rendered items bounding box to have
     // the minimal Z range.
     adjustNearFar(inShapeBounds, adjustedShadowFrustum);
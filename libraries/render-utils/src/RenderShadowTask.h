@@ -35,6 +35,14 @@ public:
 protected:
     render::ShapePlumberPointer _shapePlumber;
     unsigned int _cascadeIndex;
+
+    // static shadow cache: the cascade's map is left untouched while its
+    // frustum, its content set and the scene are all unchanged
+    ViewFrustum _cachedFrustum;
+    AABox _cachedShapeBounds;
+    size_t _cachedShapeCount { 0 };
+    uint32_t _cachedSceneChangeCount { 0 };
+    bool _haveCachedMap { false };
 };
 
 //class RenderShadowTaskConfig : public render::Task::Config::Persistent {
@@ -14,16 +14,25 @@
 #ifndef RENDER_UTILS_SSAO_SHARED_H
 #define RENDER_UTILS_SSAO_SHARED_H
 
+// Checkerboarded (quad-split) AO evaluation: each frame shades the full
+// resolution through SSAO_SPLIT_COUNT^2 interleaved sub-grids with per-frame
+// jittered sample angles (see _frameId in AmbientOcclusionEffect), which is
+// the temporal distribution half of a reprojection scheme. Both knobs are
+// overridable from the build for experimentation.
+#ifndef SSAO_USE_QUAD_SPLIT
 #define SSAO_USE_QUAD_SPLIT	1
+#endif
 #define SSAO_BILATERAL_BLUR_USE_NORMAL 0
 
 #define SSAO_DEPTH_KEY_SCALE 300.0
 
+#ifndef SSAO_SPLIT_LOG2_COUNT
 #if SSAO_USE_QUAD_SPLIT
 #define SSAO_SPLIT_LOG2_COUNT  2
 #else
 #define SSAO_SPLIT_LOG2_COUNT  0
 #endif
+#endif
 #define SSAO_SPLIT_COUNT  (1 << SSAO_SPLIT_LOG2_COUNT)
 
 // glsl / C++ compatible source as interface for ambient occlusion
@@ -302,11 +302,20 @@ void Font::setupGPU() {
 }
 
 void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows) {
-    drawInfo.verticesBuffer = std::make_shared<gpu::Buffer>();
-    drawInfo.indicesBuffer = std::make_shared<gpu::Buffer>();
+    // persistent geometry: rebuilds (e.g. editing text) reuse the existing
+    // buffers, and the glyph run accumulates on the CPU for one upload each
+    if (!drawInfo.verticesBuffer) {
+        drawInfo.verticesBuffer = std::make_shared<gpu::Buffer>();
+        drawInfo.indicesBuffer = std::make_shared<gpu::Buffer>();
+    }
     drawInfo.indexCount = 0;
     int numVertices = 0;
 
+    static thread_local std::vector<QuadBuilder> quadRun;
+    static thread_local std::vector<quint16> indexRun;
+    quadRun.clear();
+    indexRun.clear();
+
     drawInfo.string = str;
     drawInfo.bounds = bounds;
     drawInfo.origin = origin;
@@ -347,8 +356,7 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
                 auto glyph = _glyphs[c];
                 quint16 verticesOffset = numVertices;
 
-                QuadBuilder qd(glyph, advance - glm::vec2(0.0f, _ascent), scale, enlargeForShadows);
-                drawInfo.verticesBuffer->append(qd);
+                quadRun.emplace_back(glyph, advance - glm::vec2(0.0f, _ascent), scale, enlargeForShadows);
                 numVertices += VERTICES_PER_QUAD;
 
                 // Sam's recommended triangle slices
@@ -368,14 +376,12 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
                 //  0 -- 1
                 //
                 //  { 0, 1, 2 } -> { 2, 1, 3 }
-                quint16 indices[NUMBER_OF_INDICES_PER_QUAD];
-                indices[0] = verticesOffset + 0;
-                indices[1] = verticesOffset + 1;
-                indices[2] = verticesOffset + 2;
-                indices[3] = verticesOffset + 2;
-                indices[4] = verticesOffset + 1;
-                indices[5] = verticesOffset + 3;
-                drawInfo.indicesBuffer->append(sizeof(indices), (const gpu::Byte*)indices);
+                indexRun.push_back(verticesOffset + 0);
+                indexRun.push_back(verticesOffset + 1);
+                indexRun.push_back(verticesOffset + 2);
+                indexRun.push_back(verticesOffset + 2);
+                indexRun.push_back(verticesOffset + 1);
+                indexRun.push_back(verticesOffset + 3);
                 drawInfo.indexCount += NUMBER_OF_INDICES_PER_QUAD;
 
                 // Advance by glyph size
@@ -386,6 +392,10 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
             advance.x += _spaceWidth;
         }
     }
+
+    // one ranged upload per buffer for the whole glyph run
+    drawInfo.verticesBuffer->setData(quadRun.size() * sizeof(QuadBuilder), (const gpu::Byte*)quadRun.data());
+    drawInfo.indicesBuffer->setData(indexRun.size() * sizeof(quint16), (const gpu::Byte*)indexRun.data());
 }
 
 void Font::drawString(gpu::Batch& batch, Font::DrawInfo& drawInfo, const QString& str, const glm::vec4& color,
@@ -11,6 +11,8 @@
 
 #include "CullTask.h"
 
+#include <TBBHelpers.h>
+
 #include <algorithm>
 #include <assert.h>
 
@@ -74,8 +76,32 @@ void render::cullItems(const RenderContextPointer& renderContext, const CullFunc
 
     details._considered += (int)inItems.size();
 
+    // batch the frustum tests up front: one branch-free SIMD-friendly pass over
+    // all bounds instead of a plane-by-plane early-out per item; large batches
+    // are split across worker threads (the test is pure math over disjoint
+    // inputs and outputs)
+    static thread_local std::vector<uint8_t> frustumResults;
+    frustumResults.resize(inItems.size());
+    if (!inItems.empty()) {
+        PerformanceTimer perfTimer("boxIntersectsFrustum");
+        const int PARALLEL_CULL_THRESHOLD = 2048;
+        const int PARALLEL_CULL_GRAIN = 1024;
+        int count = (int)inItems.size();
+        if (count >= PARALLEL_CULL_THRESHOLD) {
+            tbb::parallel_for(tbb::blocked_range<int>(0, count, PARALLEL_CULL_GRAIN),
+                              [&](const tbb::blocked_range<int>& range) {
+                frustum.batchBoxIntersectsFrustum(&inItems[range.begin()].bound, sizeof(ItemBound),
+                                                  range.end() - range.begin(),
+                                                  frustumResults.data() + range.begin());
+            });
+        } else {
+            frustum.batchBoxIntersectsFrustum(&inItems[0].bound, sizeof(ItemBound), count, frustumResults.data());
+        }
+    }
+
     // Culling / LOD
-    for (auto item : inItems) {
+    for (size_t i = 0; i < inItems.size(); ++i) {
+        const auto& item = inItems[i];
         if (item.bound.isNull()) {
             outItems.emplace_back(item); // One more Item to render
             continue;
@@ -83,11 +109,7 @@ void render::cullItems(const RenderContextPointer& renderContext, const CullFunc
 
         // TODO: some entity types (like lights) might want to be rendered even
         // when they are outside of the view frustum...
-        bool inView;
-        {
-            PerformanceTimer perfTimer("boxIntersectsFrustum");
-            inView = frustum.boxIntersectsFrustum(item.bound);
-        }
+        bool inView = frustumResults[i] != 0;
         if (inView) {
             bool bigEnoughToRender;
             {
@@ -165,7 +187,25 @@ void FetchSpatialTree::run(const RenderContextPointer& renderContext, const Inpu
             const auto pixelResolution = frustumResolution.x > 0 ? frustumResolution : glm::ivec2(2048, 2048);
             threshold = glm::max(threshold, glm::min(frustumSize.x / pixelResolution.x, frustumSize.y / pixelResolution.y));
         }
-        scene->getSpatialTree().selectCellItems(outSelection, filter, queryFrustum, threshold);
+
+        // Reuse the previous selection while the scene, filter, threshold and
+        // query frustum are unchanged - a static camera over a static scene
+        // (spectator cams, mirrors) skips the octree traversal entirely.
+        uint32_t sceneChangeCount = scene->getChangeCount();
+        bool cacheValid = _cachedSceneChangeCount == sceneChangeCount &&
+                          _cachedThreshold == threshold &&
+                          _cachedFilter._value == filter._value && _cachedFilter._mask == filter._mask &&
+                          _cachedFrustum.isVerySimilar(queryFrustum);
+        if (cacheValid) {
+            outSelection = _cachedSelection;
+        } else {
+            scene->getSpatialTree().selectCellItems(outSelection, filter, queryFrustum, threshold);
+            _cachedSelection = outSelection;
+            _cachedFrustum = queryFrustum;
+            _cachedFilter = filter;
+            _cachedThreshold = threshold;
+            _cachedSceneChangeCount = sceneChangeCount;
+        }
     }
 }
 
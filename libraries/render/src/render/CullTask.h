@@ -70,6 +70,15 @@ namespace render {
         ViewFrustum _frozenFrustum;
         float _lodAngle;
 
+        // cached selection, shared across frames (and effectively across views
+        // with static cameras): valid while the scene, filter, threshold and
+        // query frustum are unchanged
+        ItemSpatialTree::ItemSelection _cachedSelection;
+        ViewFrustum _cachedFrustum;
+        ItemFilter _cachedFilter;
+        float _cachedThreshold { -1.0f };
+        uint32_t _cachedSceneChangeCount { 0 };
+
     public:
         using Config = FetchSpatialTreeConfig;
         using Inputs = render::VaryingSet2<ItemFilter, glm::ivec2>;
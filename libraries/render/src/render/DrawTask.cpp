@@ -74,10 +74,40 @@ void render::renderShapes(const RenderContextPointer& renderContext,
     if (maxDrawnItems != -1) {
         numItemsToDraw = glm::min(numItemsToDraw, maxDrawnItems);
     }
+
+    // Runs of consecutive items sharing a shape key keep the picked pipeline
+    // instead of re-picking (and re-binding) per item. With pipeline-sorted
+    // input this collapses to one pick per bucket, and identical draws recorded
+    // back to back let the gpu layer's named instance calls merge them.
+    ShapeKey lastPickedKey;
+    bool havePickedPipeline = false;
     for (auto i = 0; i < numItemsToDraw; ++i) {
         auto& item = scene->getItem(inItems[i].id);
-        renderShape(args, shapeContext, item, globalKey);
+        assert(item.getKey().isShape());
+        auto key = item.getShapeKey() | globalKey;
+        args->_itemShapeKey = key._flags.to_ulong();
+        if (key.isValid() && !key.hasOwnPipeline()) {
+            if (!havePickedPipeline || !render::ShapeKey::KeyEqual()(key, lastPickedKey)) {
+                args->_shapePipeline = shapeContext->pickPipeline(args, key);
+                lastPickedKey = key;
+                havePickedPipeline = true;
+            }
+            if (args->_shapePipeline) {
+                args->_shapePipeline->prepareShapeItem(args, key, item);
+                item.render(args);
+            }
+        } else if (key.hasOwnPipeline()) {
+            args->_shapePipeline = nullptr;
+            havePickedPipeline = false;
+            item.render(args);
+        } else {
+            std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
+                               &repeatedInvalidKeyMessageID);
+            HIFI_FCDEBUG_ID(renderlogging(), repeatedInvalidKeyMessageID, "Item could not be rendered with invalid key" << key);
+        }
     }
+    args->_shapePipeline = nullptr;
+    args->_itemShapeKey = 0;
 }
 
 void render::renderStateSortShapes(const RenderContextPointer& renderContext,
@@ -10,6 +10,8 @@
 //
 #include "EngineStats.h"
 
+#include <algorithm>
+
 #include <gpu/Texture.h>
 
 using namespace render;
@@ -64,5 +66,40 @@ void EngineStats::run(const RenderContextPointer& renderContext) {
     config->frameSetPipelineCount = _gpuStats._PSNumSetPipelines;
     config->frameSetInputFormatCount = _gpuStats._ISNumFormatChanges;
 
+    // Frame-time percentiles over a trailing window, and budget attribution:
+    // percentile spikes show up where averages hide them, and the over-budget
+    // tally attributes how often the frame blows its budget outright.
+    if (_frameTimes.size() < FRAME_TIME_WINDOW) {
+        _frameTimes.push_back(msecsElapsed);
+    } else {
+        _frameTimes[_frameTimeCursor] = msecsElapsed;
+        _frameTimeCursor = (_frameTimeCursor + 1) % FRAME_TIME_WINDOW;
+    }
+    if ((double)msecsElapsed > (double)config->frameBudgetMsecs) {
+        config->framesOverBudget++;
+    }
+    {
+        static std::vector<quint64> sortedTimes;
+        sortedTimes = _frameTimes;
+        std::sort(sortedTimes.begin(), sortedTimes.end());
+        auto percentile = [&](double p) {
+            return (float)sortedTimes[(size_t)(p * (sortedTimes.size() - 1))];
+        };
+        if (!sortedTimes.empty()) {
+            config->frameTimeP50 = percentile(0.50);
+            config->frameTimeP95 = percentile(0.95);
+            config->frameTimeP99 = percentile(0.99);
+        }
+    }
+
+    // surface every live GPU range timer's average by name
+    {
+        QVariantMap spans;
+        for (const auto& entry : gpu::RangeTimer::getAllGPUAverages()) {
+            spans[QString::fromStdString(entry.first)] = entry.second;
+        }
+        config->gpuTimerSpans = spans;
+    }
+
     // These new stat values are notified with the "newStats" signal triggered by the timer
 }
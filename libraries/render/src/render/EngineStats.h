@@ -61,6 +61,13 @@ namespace render {
         Q_PROPERTY(quint32 frameSetPipelineCount MEMBER frameSetPipelineCount NOTIFY newStats)
         Q_PROPERTY(quint32 frameSetInputFormatCount MEMBER frameSetInputFormatCount NOTIFY newStats)
 
+        Q_PROPERTY(float frameTimeP50 MEMBER frameTimeP50 NOTIFY newStats)
+        Q_PROPERTY(float frameTimeP95 MEMBER frameTimeP95 NOTIFY newStats)
+        Q_PROPERTY(float frameTimeP99 MEMBER frameTimeP99 NOTIFY newStats)
+        Q_PROPERTY(float frameBudgetMsecs MEMBER frameBudgetMsecs)
+        Q_PROPERTY(quint32 framesOverBudget MEMBER framesOverBudget NOTIFY newStats)
+        Q_PROPERTY(QVariantMap gpuTimerSpans MEMBER gpuTimerSpans NOTIFY newStats)
+
 
     public:
         EngineStatsConfig() : Job::Config(true) {}
@@ -101,11 +108,27 @@ namespace render {
         quint32 frameSetPipelineCount{ 0 };
 
         quint32 frameSetInputFormatCount{ 0 };
+
+        // frame-time distribution over the trailing window, and budget attribution
+        float frameTimeP50{ 0.0f };
+        float frameTimeP95{ 0.0f };
+        float frameTimeP99{ 0.0f };
+        float frameBudgetMsecs{ 16.7f };
+        quint32 framesOverBudget{ 0 };
+
+        // per-span GPU averages (msecs), from every live gpu::RangeTimer
+        QVariantMap gpuTimerSpans;
     };
 
     class EngineStats {
         gpu::ContextStats _gpuStats;
         QElapsedTimer _frameTimer;
+
+        // trailing window of frame times for percentile reporting
+        static const size_t FRAME_TIME_WINDOW = 512;
+        std::vector<quint64> _frameTimes;
+        size_t _frameTimeCursor { 0 };
+
     public:
         using Config = EngineStatsConfig;
         using JobModel = Job::Model<EngineStats, Config>;
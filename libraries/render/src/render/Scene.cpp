@@ -219,11 +219,21 @@ uint32_t Scene::enqueueFrame() {
         localTransactionQueue.swap(_transactionQueue);
     }
 
+    // consolidate into a recycled transaction arena - cleared vectors keep
+    // their capacity, so steady-state frames allocate nothing here - and move
+    // it into the frame list instead of copying every command
     Transaction consolidatedTransaction;
+    {
+        std::unique_lock<std::mutex> lock(_transactionFramesMutex);
+        if (!_recycledTransactions.empty()) {
+            consolidatedTransaction = std::move(_recycledTransactions.back());
+            _recycledTransactions.pop_back();
+        }
+    }
     consolidatedTransaction.merge(std::move(localTransactionQueue));
     {
         std::unique_lock<std::mutex> lock(_transactionFramesMutex);
-        _transactionFrames.push_back(consolidatedTransaction);
+        _transactionFrames.push_back(std::move(consolidatedTransaction));
     }
 
     return ++_transactionFrameNumber;
@@ -245,11 +255,27 @@ void Scene::processTransactionQueue() {
         processTransactionFrame(frame);
     }
 
+    // bounded tail compaction of the spatial tree's packed storage
+    _masterSpatialTree.tidyStorage();
+
+    // recycle the processed frames' command storage for future consolidation
+    {
+        std::unique_lock<std::mutex> lock(_transactionFramesMutex);
+        const size_t MAX_RECYCLED_TRANSACTIONS = 4;
+        for (auto& frame : queuedFrames) {
+            if (_recycledTransactions.size() >= MAX_RECYCLED_TRANSACTIONS) {
+                break;
+            }
+            frame.clear();  // keeps vector capacity
+            _recycledTransactions.push_back(std::move(frame));
+        }
+    }
     queuedFrames.clear();
 }
 
 void Scene::processTransactionFrame(const Transaction& transaction) {
     PROFILE_RANGE(render, __FUNCTION__);
+    _changeCount.fetch_add(1, std::memory_order_relaxed);
     {
         std::unique_lock<std::mutex> lock(_itemsMutex);
         // Here we should be able to check the value of last ItemID allocated 
@@ -178,6 +178,9 @@ public:
     // Access the spatialized items
     const ItemSpatialTree& getSpatialTree() const { return _masterSpatialTree; }
 
+    // bumped once per processed transaction frame; spatial query caches key on it
+    uint32_t getChangeCount() const { return _changeCount.load(); }
+
     // Access non-spatialized items (layered objects, backgrounds)
     const ItemIDSet& getNonspatialSet() const { return _masterNonspatialSet; }
 
@@ -206,6 +209,7 @@ protected:
     std::mutex _transactionFramesMutex;
     using TransactionFrames = std::vector<Transaction>;
     TransactionFrames _transactionFrames;
+    TransactionFrames _recycledTransactions;   // cleared transactions recycled as consolidation arenas
     uint32_t _transactionFrameNumber{ 0 };
 
     // Process one transaction frame 
@@ -216,6 +220,7 @@ protected:
     std::mutex _itemsMutex;
     Item::Vector _items;
     ItemSpatialTree _masterSpatialTree;
+    std::atomic<uint32_t> _changeCount { 1 };
     ItemIDSet _masterNonspatialSet;
 
     void resetItems(const Transaction::Resets& transactions);
@@ -10,6 +10,8 @@
 //
 
 #include "SortTask.h"
+
+#include <cstring>
 #include "ShapePipeline.h"
 
 #include <assert.h>
@@ -17,82 +19,101 @@
 
 using namespace render;
 
-struct ItemBoundSort {
-    float _centerDepth = 0.0f;
-    float _nearDepth = 0.0f;
-    float _farDepth = 0.0f;
-    ItemID _id = 0;
-    AABox _bounds;
+// LSD radix sort over 64-bit keys; byte passes that land in a single bucket
+// are skipped, so nearly-sorted or small-range key sets cost little
+static void radixSortKeys(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch) {
+    const int BITS_PER_PASS = 8;
+    const int NUM_BUCKETS = 1 << BITS_PER_PASS;
+    const int NUM_PASSES = (int)(sizeof(uint64_t) * 8) / BITS_PER_PASS;
+
+    size_t count = keys.size();
+    scratch.resize(count);
+    uint64_t* source = keys.data();
+    uint64_t* destination = scratch.data();
 
-    ItemBoundSort() {}
-    ItemBoundSort(float centerDepth, float nearDepth, float farDepth, ItemID id, const AABox& bounds) : _centerDepth(centerDepth), _nearDepth(nearDepth), _farDepth(farDepth), _id(id), _bounds(bounds) {}
-};
+    for (int pass = 0; pass < NUM_PASSES; ++pass) {
+        int shift = pass * BITS_PER_PASS;
 
-struct FrontToBackSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth < right._centerDepth);
+        size_t bucketCounts[NUM_BUCKETS] = {};
+        for (size_t i = 0; i < count; ++i) {
+            bucketCounts[(source[i] >> shift) & (NUM_BUCKETS - 1)]++;
+        }
+
+        if (count > 0 && bucketCounts[(source[0] >> shift) & (NUM_BUCKETS - 1)] == count) {
+            continue;   // every key shares this byte
+        }
+
+        size_t offsets[NUM_BUCKETS];
+        size_t sum = 0;
+        for (int bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+            offsets[bucket] = sum;
+            sum += bucketCounts[bucket];
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            destination[offsets[(source[i] >> shift) & (NUM_BUCKETS - 1)]++] = source[i];
+        }
+        std::swap(source, destination);
     }
-};
 
-struct BackToFrontSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth > right._centerDepth);
+    if (source != keys.data()) {
+        memcpy(keys.data(), source, count * sizeof(uint64_t));
     }
-};
+}
 
 void render::depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, 
                             const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
 
-    auto& scene = renderContext->_scene;
     RenderArgs* args = renderContext->args;
 
-
     // Allocate and simply copy
     outItems.clear();
     outItems.reserve(inItems.size());
 
-
-    // Make a local dataset of the center distance and closest point distance
-    std::vector<ItemBoundSort> itemBoundSorts;
-    itemBoundSorts.reserve(outItems.size());
-
-    for (auto itemDetails : inItems) {
-        auto item = scene->getItem(itemDetails.id);
-        auto bound = itemDetails.bound; // item.getBound();
-        float distanceSquared = args->getViewFrustum().distanceToCameraSquared(bound.calcCenter());
-
-        itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
+    // Precompute one 64-bit key per item - orderable depth bits in the high
+    // word, source index in the low word - and radix-sort the keys instead of
+    // moving the fat bound structs through a comparison sort.
+    static thread_local std::vector<uint64_t> sortKeys;
+    static thread_local std::vector<uint64_t> sortScratch;
+    sortKeys.clear();
+    sortKeys.reserve(inItems.size());
+
+    uint32_t index = 0;
+    for (const auto& itemDetails : inItems) {
+        float distanceSquared = args->getViewFrustum().distanceToCameraSquared(itemDetails.bound.calcCenter());
+        // non-negative floats compare like their bit patterns; invert for back-to-front
+        uint32_t depthBits;
+        memcpy(&depthBits, &distanceSquared, sizeof(depthBits));
+        if (!frontToBack) {
+            depthBits = ~depthBits;
+        }
+        sortKeys.push_back(((uint64_t)depthBits << 32) | index++);
     }
 
-    // sort against Z
-    if (frontToBack) {
-        FrontToBackSort frontToBackSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
-    } else {
-        BackToFrontSort  backToFrontSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
-    }
+    radixSortKeys(sortKeys, sortScratch);
 
     // Finally once sorted result to a list of itemID and keep uniques
     render::ItemID previousID = Item::INVALID_ITEM_ID;
     if (!bounds) {
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
+        for (uint64_t key : sortKeys) {
+            const auto& itemDetails = inItems[(uint32_t)key];
+            if (itemDetails.id != previousID) {
+                outItems.emplace_back(ItemBound(itemDetails.id, itemDetails.bound));
+                previousID = itemDetails.id;
             }
         }
-    } else if (!itemBoundSorts.empty()) {
+    } else if (!sortKeys.empty()) {
         if (bounds->isNull()) {
-            *bounds = itemBoundSorts.front()._bounds;
+            *bounds = inItems[(uint32_t)sortKeys.front()].bound;
         }
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
-                *bounds += item._bounds;
+        for (uint64_t key : sortKeys) {
+            const auto& itemDetails = inItems[(uint32_t)key];
+            if (itemDetails.id != previousID) {
+                outItems.emplace_back(ItemBound(itemDetails.id, itemDetails.bound));
+                previousID = itemDetails.id;
+                *bounds += itemDetails.bound;
             }
         }
     }
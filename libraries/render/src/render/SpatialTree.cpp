@@ -10,6 +10,8 @@
 //
 #include "SpatialTree.h"
 
+#include <algorithm>
+
 #include <ViewFrustum.h>
 
 using namespace render;
@@ -151,6 +153,40 @@ Octree::Index Octree::allocateCell(Index parent, const Location& location) {
 }
 
 
+void Octree::tidyStorage(int maxSteps) {
+    // pop fully-freed cells off the packed array's tail; a freed non-root cell
+    // is the only kind without a parent, and it must also be on the free list
+    int steps = maxSteps;
+    while (steps > 0 && (Index)_cells.size() - 1 > ROOT_CELL) {
+        Index tailIndex = (Index)_cells.size() - 1;
+        if (_cells[tailIndex].hasParent()) {
+            break;  // tail cell is live
+        }
+        auto freeItr = std::find(_freeCells.begin(), _freeCells.end(), tailIndex);
+        if (freeItr == _freeCells.end()) {
+            break;
+        }
+        *freeItr = _freeCells.back();
+        _freeCells.pop_back();
+        _cells.pop_back();
+        --steps;
+    }
+
+    // and the same for bricks
+    steps = maxSteps;
+    while (steps > 0 && !_bricks.empty()) {
+        Index tailIndex = (Index)_bricks.size() - 1;
+        auto freeItr = std::find(_freeBricks.begin(), _freeBricks.end(), tailIndex);
+        if (freeItr == _freeBricks.end()) {
+            break;  // tail brick is live
+        }
+        *freeItr = _freeBricks.back();
+        _freeBricks.pop_back();
+        _bricks.pop_back();
+        --steps;
+    }
+}
+
 void Octree::freeCell(Index index) {
     if (checkCellIndex(index)) {
         auto & cell = _cells[index];
@@ -348,6 +348,14 @@ namespace render {
         Index allocateCell(Index parent, const Location& location);
         void freeCell(Index index);
 
+    public:
+        // Incremental rebalance: bounded-work tail compaction of the packed
+        // cell and brick arrays, so churny sessions don't pin the storage at
+        // its high-water mark forever. Safe to call every frame.
+        void tidyStorage(int maxSteps = 32);
+
+    protected:
+
         Index allocateBrick();
         void freeBrick(Index index);
 
@@ -14,6 +14,13 @@ TransitionStage::Index TransitionStage::addTransition(ItemID itemId, Transition:
     transition.eventType = type;
     transition.itemId = itemId;
     transition.boundItemId = boundId;
+
+    // reuse a recycled params buffer; the fade job re-initializes its contents
+    if (!_recycledParamsBuffers.empty()) {
+        transition.paramsBuffer = _recycledParamsBuffers.back();
+        _recycledParamsBuffers.pop_back();
+    }
+
     id = _transitions.newElement(transition);
     _activeTransitionIds.push_back(id);
 
@@ -26,6 +33,13 @@ void TransitionStage::removeTransition(Index index) {
         _activeTransitionIds.erase(idIterator);
     }
     if (!_transitions.isElementFreed(index)) {
+        // pool the GPU params buffer before the slot is recycled
+        const size_t MAX_RECYCLED_PARAMS_BUFFERS = 64;
+        auto& transition = _transitions.edit(index);
+        if (transition.paramsBuffer._buffer && _recycledParamsBuffers.size() < MAX_RECYCLED_PARAMS_BUFFERS) {
+            _recycledParamsBuffers.push_back(transition.paramsBuffer);
+        }
+        transition.paramsBuffer = gpu::BufferView();
         _transitions.freeElement(index);
     }
 }
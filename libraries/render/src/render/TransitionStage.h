@@ -50,6 +50,10 @@ namespace render {
 
         Transitions _transitions;
         TransitionIdList _activeTransitionIds;
+
+        // params buffers recycled between transitions, so avatar/domain churn
+        // doesn't allocate a fresh GPU buffer per fade
+        std::vector<gpu::BufferView> _recycledParamsBuffers;
     };
     using TransitionStagePointer = std::shared_ptr<TransitionStage>;
 
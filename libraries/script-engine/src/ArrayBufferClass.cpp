@@ -91,6 +91,19 @@ QScriptValue ArrayBufferClass::newInstance(const QByteArray& ba) {
     return engine()->newObject(this, data);
 }
 
+QScriptValue ArrayBufferClass::newExternalInstance(const char* data, qint32 size, const QVariant& lifetimePin) {
+    // fromRawData wraps the caller's memory in place - no O(size) copy. The pin rides on the
+    // instance as an undeletable hidden property, keeping the native owner alive for as long as
+    // the buffer is referenced from script. A script *write* still detaches the copy-on-write
+    // QByteArray, trading a one-time copy for memory safety instead of scribbling on the native
+    // buffer.
+    QScriptValue arrayData = engine()->newVariant(QVariant::fromValue(QByteArray::fromRawData(data, size)));
+    QScriptValue instance = engine()->newObject(this, arrayData);
+    instance.setProperty("__nativePin__", engine()->newVariant(lifetimePin),
+                         QScriptValue::ReadOnly | QScriptValue::Undeletable | QScriptValue::SkipInEnumeration);
+    return instance;
+}
+
 QScriptValue ArrayBufferClass::construct(QScriptContext* context, QScriptEngine* engine) {
     ArrayBufferClass* cls = qscriptvalue_cast<ArrayBufferClass*>(context->callee().data());
     if (!cls) {
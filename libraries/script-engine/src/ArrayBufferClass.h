@@ -29,6 +29,9 @@ public:
     ArrayBufferClass(ScriptEngine* scriptEngine);
     QScriptValue newInstance(qint32 size);
     QScriptValue newInstance(const QByteArray& ba);
+    // Wraps natively owned memory without copying; lifetimePin is stashed on the instance so the
+    // native owner outlives every script reference to the buffer
+    QScriptValue newExternalInstance(const char* data, qint32 size, const QVariant& lifetimePin);
 
     QueryFlags queryProperty(const QScriptValue& object,
                              const QScriptString& name,
@@ -15,7 +15,9 @@
 
 #include <shared/QtHelpers.h>
 
+#include "ArrayBufferClass.h"
 #include "ScriptAudioInjector.h"
+#include "ScriptEngine.h"
 #include "ScriptEngineLogging.h"
 
 void registerAudioMetaTypes(QScriptEngine* engine) {
@@ -65,6 +67,24 @@ ScriptAudioInjector* AudioScriptingInterface::playSound(SharedSoundPointer sound
     }
 }
 
+QScriptValue AudioScriptingInterface::getSamples(SharedSoundPointer sound) {
+    if (!sound || !sound->isReady()) {
+        qCDebug(scriptengine) << "AudioScriptingInterface::getSamples called with a sound that is not ready.";
+        return QScriptValue::NullValue;
+    }
+
+    auto scriptEngine = qobject_cast<ScriptEngine*>(engine());
+    if (!scriptEngine) {
+        return QScriptValue::NullValue;
+    }
+
+    // AudioData is immutable and shared, so the ArrayBuffer can view the decoded PCM in place;
+    // the pinned pointer keeps the allocation alive while script holds the buffer
+    auto audioData = sound->getAudioData();
+    return scriptEngine->getArrayBufferClass()->newExternalInstance(
+        audioData->rawData(), (qint32)audioData->getNumBytes(), QVariant::fromValue(audioData));
+}
+
 void AudioScriptingInterface::setStereoInput(bool stereo) {
     if (_localAudioInterface) {
         QMetaObject::invokeMethod(_localAudioInterface, "setIsStereoInput", Q_ARG(bool, stereo));
@@ -12,6 +12,8 @@
 #ifndef hifi_AudioScriptingInterface_h
 #define hifi_AudioScriptingInterface_h
 
+#include <QtScript/QScriptable>
+
 #include <AbstractAudioInterface.h>
 #include <AudioInjector.h>
 #include <DependencyManager.h>
@@ -19,7 +21,7 @@
 
 class ScriptAudioInjector;
 
-class AudioScriptingInterface : public QObject, public Dependency {
+class AudioScriptingInterface : public QObject, protected QScriptable, public Dependency {
     Q_OBJECT
     SINGLETON_DEPENDENCY
 
@@ -191,6 +193,15 @@ protected:
      */
     Q_INVOKABLE ScriptAudioInjector* playSound(SharedSoundPointer sound, const AudioInjectorOptions& injectorOptions = AudioInjectorOptions());
 
+    /**jsdoc
+     * Gets a sound's raw PCM data (16-bit signed integer samples, interleaved by channel) as an
+     * <code>ArrayBuffer</code> view over the decoded audio already in memory, without copying it.
+     * @function Audio.getSamples
+     * @param {SoundObject} sound - The sound to read samples from. The sound must be downloaded.
+     * @returns {ArrayBuffer} The sound's sample data, or <code>null</code> if the sound is not ready.
+     */
+    Q_INVOKABLE QScriptValue getSamples(SharedSoundPointer sound);
+
     /**jsdoc
      * Starts playing the content of an audio file locally (isn't sent to the audio mixer). This is the same as calling 
      * {@link Audio.playSound} with {@link AudioInjector.AudioInjectorOptions} <code>localOnly</code> set <code>true</code> and 
@@ -15,6 +15,7 @@
 #include <thread>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QEventLoop>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTimer>
@@ -73,8 +74,12 @@
 #include "TypedArrays.h"
 #include "XMLHttpRequestClass.h"
 #include "WebSocketClass.h"
+#include "ScriptWorkerClass.h"
 #include "RecordingScriptingInterface.h"
 #include "ScriptEngines.h"
+#include <RingTracer.h>
+
+#include "ScriptProfiler.h"
 #include "StackTestScriptingInterface.h"
 #include "ModelScriptingInterface.h"
 
@@ -731,6 +736,9 @@ void ScriptEngine::init() {
     QScriptValue webSocketConstructorValue = newFunction(WebSocketClass::constructor);
     globalObject().setProperty("WebSocket", webSocketConstructorValue);
 
+    QScriptValue workerConstructorValue = newFunction(ScriptWorkerClass::constructor);
+    globalObject().setProperty("Worker", workerConstructorValue);
+
     /**jsdoc
      * Prints a message to the program log and emits {@link Script.printedMessage}.
      * The message logged is the message values separated by spaces.
@@ -771,6 +779,8 @@ void ScriptEngine::init() {
 
     registerGlobalObject("Entities", entityScriptingInterface.data());
     registerFunction("Entities", "getMultipleEntityProperties", EntityScriptingInterface::getMultipleEntityProperties);
+    registerFunction("Entities", "queryEntities", EntityScriptingInterface::queryEntities);
+    registerFunction("Entities", "getEntityProperties", EntityScriptingInterface::getEntityProperties);
     registerGlobalObject("Quat", &_quatLibrary);
     registerGlobalObject("Vec3", &_vec3Library);
     registerGlobalObject("Mat4", &_mat4Library);
@@ -1084,6 +1094,12 @@ void ScriptEngine::addEventHandler(const EntityItemID& entityID, const QString&
 }
 
 // this is not redundant -- the version in BaseScriptEngine is specifically not Q_INVOKABLE
+static QString programCacheKey(const QString& sourceCode, const QString& fileName, int lineNumber) {
+    QCryptographicHash hasher(QCryptographicHash::Sha1);
+    hasher.addData(reinterpret_cast<const char*>(sourceCode.constData()), sourceCode.size() * (int)sizeof(QChar));
+    return QString::fromLatin1(hasher.result().toHex()) + ":" + fileName + ":" + QString::number(lineNumber);
+}
+
 QScriptValue ScriptEngine::evaluateInClosure(const QScriptValue& closure, const QScriptProgram& program) {
     return BaseScriptEngine::evaluateInClosure(closure, program);
 }
@@ -1108,28 +1124,40 @@ QScriptValue ScriptEngine::evaluate(const QString& sourceCode, const QString& fi
         return result;
     }
 
-    // Check syntax
-    auto syntaxError = lintScript(sourceCode, fileName);
-    if (syntaxError.isError()) {
-        if (!isEvaluating()) {
-            syntaxError.setProperty("detail", "evaluate");
+    // Source this engine has evaluated before reuses its cached program - QScriptProgram keeps
+    // the compiled code per engine, so the parse/compile is skipped entirely
+    auto key = programCacheKey(sourceCode, fileName, lineNumber);
+    auto cachedProgram = _programCache.find(key);
+    if (cachedProgram == _programCache.end()) {
+        // Check syntax
+        auto syntaxError = lintScript(sourceCode, fileName);
+        if (syntaxError.isError()) {
+            if (!isEvaluating()) {
+                syntaxError.setProperty("detail", "evaluate");
+            }
+            raiseException(syntaxError);
+            maybeEmitUncaughtException("lint");
+            return syntaxError;
         }
-        raiseException(syntaxError);
-        maybeEmitUncaughtException("lint");
-        return syntaxError;
-    }
-    QScriptProgram program { sourceCode, fileName, lineNumber };
-    if (program.isNull()) {
-        // can this happen?
-        auto err = makeError("could not create QScriptProgram for " + fileName);
-        raiseException(err);
-        maybeEmitUncaughtException("compile");
-        return err;
+        QScriptProgram program { sourceCode, fileName, lineNumber };
+        if (program.isNull()) {
+            // can this happen?
+            auto err = makeError("could not create QScriptProgram for " + fileName);
+            raiseException(err);
+            maybeEmitUncaughtException("compile");
+            return err;
+        }
+
+        const int MAX_CACHED_PROGRAMS = 256;
+        if (_programCache.size() >= MAX_CACHED_PROGRAMS) {
+            _programCache.clear();
+        }
+        cachedProgram = _programCache.insert(key, program);
     }
 
     QScriptValue result;
     {
-        result = BaseScriptEngine::evaluate(program);
+        result = BaseScriptEngine::evaluate(cachedProgram.value());
         maybeEmitUncaughtException("evaluate");
     }
     return result;
@@ -1183,6 +1211,14 @@ void ScriptEngine::run() {
 
     std::chrono::microseconds totalUpdates(0);
 
+    // Garbage collection scheduling: rather than letting the engine decide to collect in the
+    // middle of an update or timer callback, collect explicitly inside the frame's idle window
+    // whenever enough slack remains before the next frame. Collecting this often keeps the heap
+    // small, which in turn keeps each pause well under the idle window.
+    const std::chrono::milliseconds GC_MIN_IDLE_SLACK { 5 };
+    const std::chrono::seconds GC_INTERVAL { 1 };
+    clock::time_point lastGarbageCollection = clock::now();
+
     // TODO: Integrate this with signals/slots instead of reimplementing throttling for ScriptEngine
     while (!_isFinished) {
         auto beforeSleep = clock::now();
@@ -1214,6 +1250,23 @@ void ScriptEngine::run() {
             PROFILE_RANGE(script, "processEvents-sleep");
             std::chrono::milliseconds sleepFor =
                 std::chrono::duration_cast<std::chrono::milliseconds>(sleepUntil - clock::now());
+
+            if (sleepFor >= GC_MIN_IDLE_SLACK && (beforeSleep - lastGarbageCollection) >= GC_INTERVAL) {
+                PROFILE_RANGE(script, "collectGarbage");
+                auto preGC = clock::now();
+                collectGarbage();
+                auto postGC = clock::now();
+                lastGarbageCollection = postGC;
+
+                auto gcDuration = std::chrono::duration_cast<std::chrono::microseconds>(postGC - preGC);
+                _totalGCExecution += gcDuration;
+                _maxGCDuration = std::max(_maxGCDuration, gcDuration);
+                _gcCount++;
+
+                // whatever the collection cost comes out of this frame's sleep
+                sleepFor = std::chrono::duration_cast<std::chrono::milliseconds>(sleepUntil - clock::now());
+            }
+
             if (sleepFor > std::chrono::milliseconds(0)) {
                 QEventLoop loop;
                 QTimer timer;
@@ -1296,6 +1349,14 @@ void ScriptEngine::run() {
             clearExceptions();
         }
     }
+    if (_gcCount > 0) {
+        scriptInfoMessage(QString("Script %1 garbage collection: %2 collections, %3 us total, %4 us max pause")
+            .arg(getFilename())
+            .arg(_gcCount)
+            .arg(_totalGCExecution.count())
+            .arg(_maxGCDuration.count()));
+    }
+
     scriptInfoMessage("Script Engine stopping:" + getFilename());
 
     stopAllTimers(); // make sure all our timers are stopped if the script is ending
@@ -1399,6 +1460,37 @@ void ScriptEngine::callAnimationStateHandler(QScriptValue callback, AnimVariantM
     }
 }
 
+void ScriptEngine::startProfiling() {
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, "startProfiling");
+        return;
+    }
+    if (!_profiler) {
+        _profiler.reset(new ScriptProfiler(this));
+        setAgent(_profiler.get());
+    }
+}
+
+QVariantMap ScriptEngine::stopProfiling() {
+    if (QThread::currentThread() != thread()) {
+        QVariantMap report;
+        BLOCKING_INVOKE_METHOD(this, "stopProfiling", Q_RETURN_ARG(QVariantMap, report));
+        return report;
+    }
+    QVariantMap report;
+    if (_profiler) {
+        report = _profiler->takeReport();
+        // detaching the agent restores JIT execution
+        setAgent(nullptr);
+        _profiler.reset();
+    }
+    return report;
+}
+
+bool ScriptEngine::dumpHitchTrace(const QString& path, float seconds) {
+    return tracing::RingTracer::dump(path, seconds);
+}
+
 void ScriptEngine::updateMemoryCost(const qint64& deltaSize) {
     if (deltaSize > 0) {
         // We've patched qt to fix https://highfidelity.atlassian.net/browse/BUGZ-46 on mac and windows only.
@@ -2308,85 +2400,93 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
         return;
     }
 
-    // SYNTAX ERRORS
-    auto syntaxError = lintScript(contents, fileName);
-    if (syntaxError.isError()) {
-        auto message = syntaxError.property("formatted").toString();
-        if (message.isEmpty()) {
-            message = syntaxError.toString();
-        }
-        setError(QString("Bad syntax (%1)").arg(message), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        syntaxError.setProperty("detail", entityID.toString());
-        emit unhandledException(syntaxError);
-        return;
-    }
-    QScriptProgram program { contents, fileName };
-    if (program.isNull()) {
-        setError("Bad program (isNull)", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(makeError("program.isNull"));
-        return; // done processing script
-    }
-
     if (isURL) {
         setParentURL(scriptOrURL);
     }
 
-    // SANITY/PERFORMANCE CHECK USING SANDBOX
-    const int SANDBOX_TIMEOUT = 0.25 * MSECS_PER_SECOND;
-    BaseScriptEngine sandbox;
-    sandbox.setProcessEventsInterval(SANDBOX_TIMEOUT);
-    QScriptValue testConstructor, exception;
-    {
-        QTimer timeout;
-        timeout.setSingleShot(true);
-        timeout.start(SANDBOX_TIMEOUT);
-        connect(&timeout, &QTimer::timeout, [=, &sandbox]{
-                qCDebug(scriptengine) << "ScriptEngine::entityScriptContentAvailable timeout";
-
-                // Guard against infinite loops and non-performant code
-                sandbox.raiseException(
-                    sandbox.makeError(QString("Timed out (entity constructors are limited to %1ms)").arg(SANDBOX_TIMEOUT))
-                );
-        });
-
-        testConstructor = sandbox.evaluate(program);
-
-        if (sandbox.hasUncaughtException()) {
-            exception = sandbox.cloneUncaughtException(QString("(preflight %1)").arg(entityID.toString()));
-            sandbox.clearExceptions();
-        } else if (testConstructor.isError()) {
-            exception = testConstructor;
+    // Identical source already linted and preflighted this session (the same script attached to
+    // many entities) skips straight to construction; the later evaluate() reuses its cached
+    // compiled program as well
+    auto preflightKey = programCacheKey(contents, fileName, 1);
+    if (!_preflightedPrograms.contains(preflightKey)) {
+        // SYNTAX ERRORS
+        auto syntaxError = lintScript(contents, fileName);
+        if (syntaxError.isError()) {
+            auto message = syntaxError.property("formatted").toString();
+            if (message.isEmpty()) {
+                message = syntaxError.toString();
+            }
+            setError(QString("Bad syntax (%1)").arg(message), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            syntaxError.setProperty("detail", entityID.toString());
+            emit unhandledException(syntaxError);
+            return;
+        }
+        QScriptProgram program { contents, fileName };
+        if (program.isNull()) {
+            setError("Bad program (isNull)", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(makeError("program.isNull"));
+            return; // done processing script
         }
-    }
 
-    if (exception.isError()) {
-        // create a local copy using makeError to decouple from the sandbox engine
-        exception = makeError(exception);
-        setError(formatException(exception, _enableExtendedJSExceptions.get()), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(exception);
-        return;
-    }
+        // SANITY/PERFORMANCE CHECK USING SANDBOX
+        const int SANDBOX_TIMEOUT = 0.25 * MSECS_PER_SECOND;
+        BaseScriptEngine sandbox;
+        sandbox.setProcessEventsInterval(SANDBOX_TIMEOUT);
+        QScriptValue testConstructor, exception;
+        {
+            QTimer timeout;
+            timeout.setSingleShot(true);
+            timeout.start(SANDBOX_TIMEOUT);
+            connect(&timeout, &QTimer::timeout, [=, &sandbox]{
+                    qCDebug(scriptengine) << "ScriptEngine::entityScriptContentAvailable timeout";
+
+                    // Guard against infinite loops and non-performant code
+                    sandbox.raiseException(
+                        sandbox.makeError(QString("Timed out (entity constructors are limited to %1ms)").arg(SANDBOX_TIMEOUT))
+                    );
+            });
 
-    // CONSTRUCTOR VIABILITY
-    if (!testConstructor.isFunction()) {
-        QString testConstructorType = QString(testConstructor.toVariant().typeName());
-        if (testConstructorType == "") {
-            testConstructorType = "empty";
+            testConstructor = sandbox.evaluate(program);
+
+            if (sandbox.hasUncaughtException()) {
+                exception = sandbox.cloneUncaughtException(QString("(preflight %1)").arg(entityID.toString()));
+                sandbox.clearExceptions();
+            } else if (testConstructor.isError()) {
+                exception = testConstructor;
+            }
         }
-        QString testConstructorValue = testConstructor.toString();
-        if (testConstructorValue.size() > MAX_DEBUG_VALUE_LENGTH) {
-            testConstructorValue = testConstructorValue.mid(0, MAX_DEBUG_VALUE_LENGTH) + "...";
+
+        if (exception.isError()) {
+            // create a local copy using makeError to decouple from the sandbox engine
+            exception = makeError(exception);
+            setError(formatException(exception, _enableExtendedJSExceptions.get()), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(exception);
+            return;
         }
-        auto message = QString("failed to load entity script -- expected a function, got %1, %2")
-            .arg(testConstructorType).arg(testConstructorValue);
 
-        auto err = makeError(message);
-        err.setProperty("fileName", scriptOrURL);
-        err.setProperty("detail", "(constructor " + entityID.toString() + ")");
+        // CONSTRUCTOR VIABILITY
+        if (!testConstructor.isFunction()) {
+            QString testConstructorType = QString(testConstructor.toVariant().typeName());
+            if (testConstructorType == "") {
+                testConstructorType = "empty";
+            }
+            QString testConstructorValue = testConstructor.toString();
+            if (testConstructorValue.size() > MAX_DEBUG_VALUE_LENGTH) {
+                testConstructorValue = testConstructorValue.mid(0, MAX_DEBUG_VALUE_LENGTH) + "...";
+            }
+            auto message = QString("failed to load entity script -- expected a function, got %1, %2")
+                .arg(testConstructorType).arg(testConstructorValue);
+
+            auto err = makeError(message);
+            err.setProperty("fileName", scriptOrURL);
+            err.setProperty("detail", "(constructor " + entityID.toString() + ")");
+
+            setError("Could not find constructor (" + testConstructorType + ")", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(err);
+            return; // done processing script
+        }
 
-        setError("Could not find constructor (" + testConstructorType + ")", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(err);
-        return; // done processing script
+        _preflightedPrograms.insert(preflightKey);
     }
 
     // (this feeds into refreshFileScript)
@@ -22,6 +22,7 @@
 #include <QtCore/QStringList>
 
 #include <QtScript/QScriptEngine>
+#include <QtScript/QScriptProgram>
 
 #include <AnimationCache.h>
 #include <AnimVariant.h>
@@ -284,6 +285,8 @@ public:
      * @returns {boolean} <code>true</code> if the script is running as an Interface or avatar script, <code>false</code> if it 
      *     isn't.
      */
+    Context getContextEnum() const { return _context; }
+
     Q_INVOKABLE bool isClientScript() const { return _context == CLIENT_SCRIPT; }
 
     /**jsdoc
@@ -670,6 +673,37 @@ public:
 
     void setScriptEngines(QSharedPointer<ScriptEngines>& scriptEngines) { _scriptEngines = scriptEngines; }
 
+    /**jsdoc
+     * Starts the sampling profiler for this script engine. While profiling, the engine runs
+     * interpreted (no JIT), so only enable it while investigating.
+     * @function Script.startProfiling
+     */
+    Q_INVOKABLE void startProfiling();
+
+    /**jsdoc
+     * Stops the sampling profiler and returns the aggregated samples collected since
+     * {@link Script.startProfiling} as collapsed stacks suitable for flame-graph tooling.
+     * @function Script.stopProfiling
+     * @returns {object} <code>{ durationMsecs, sampleIntervalUsecs, sampleCount, stacks }</code>
+     *     where <code>stacks</code> maps <code>"outer;inner"</code> stack strings to sample counts.
+     */
+    Q_INVOKABLE QVariantMap stopProfiling();
+
+    /**jsdoc
+     * Dumps the last few seconds of the always-on lightweight span recorder - every thread's
+     * ring buffer - to a chrome-trace JSON file. Intended for "it just stuttered" reports.
+     * @function Script.dumpHitchTrace
+     * @param {string} path - The file to write the trace to.
+     * @param {number} [seconds=10] - How many seconds of history to include.
+     * @returns {boolean} <code>true</code> if the trace was written.
+     */
+    Q_INVOKABLE bool dumpHitchTrace(const QString& path, float seconds = 10.0f);
+
+    // GC accounting for this script's engine thread
+    std::chrono::microseconds getTotalGCExecution() const { return _totalGCExecution; }
+    std::chrono::microseconds getMaxGCDuration() const { return _maxGCDuration; }
+    int getGCCount() const { return _gcCount; }
+
 public slots:
 
     /**jsdoc
@@ -904,6 +938,15 @@ protected:
     QObject* setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot);
     void stopTimer(QTimer* timer);
 
+    // Compiled programs this engine has already evaluated, keyed on source/fileName/line, so
+    // re-evaluating identical source (one entity script attached to many entities) skips the
+    // parse and compile; _preflightedPrograms remembers sources that already passed the entity
+    // sandbox check this session
+    QHash<QString, QScriptProgram> _programCache;
+    QSet<QString> _preflightedPrograms;
+
+    std::unique_ptr<class ScriptProfiler> _profiler;
+
     QHash<EntityItemID, RegisteredEventHandlers> _registeredHandlers;
     void forwardHandlerCall(const EntityItemID& entityID, const QString& eventName, QScriptValueList eventHanderArgs);
 
@@ -964,6 +1007,11 @@ protected:
 
     std::chrono::microseconds _totalTimerExecution { 0 };
 
+    // Garbage collection scheduling and accounting (see the idle-window collection in run())
+    std::chrono::microseconds _totalGCExecution { 0 };
+    std::chrono::microseconds _maxGCDuration { 0 };
+    int _gcCount { 0 };
+
     static const QString _SETTINGS_ENABLE_EXTENDED_MODULE_COMPAT;
     static const QString _SETTINGS_ENABLE_EXTENDED_EXCEPTIONS;
 
@@ -0,0 +1,105 @@
+//
+//  ScriptProfiler.cpp
+//  libraries/script-engine/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ScriptProfiler.h"
+
+#include <chrono>
+
+#include <SharedUtil.h>
+
+ScriptProfiler::ScriptProfiler(QScriptEngine* engine, int sampleIntervalUsecs) :
+    QScriptEngineAgent(engine),
+    _sampleIntervalUsecs(sampleIntervalUsecs),
+    _startTime(usecTimestampNow()),
+    _samplerThread([this] { sampleLoop(); })
+{
+}
+
+ScriptProfiler::~ScriptProfiler() {
+    _running.store(false);
+    _samplerThread.join();
+}
+
+void ScriptProfiler::scriptLoad(qint64 id, const QString& program, const QString& fileName, int baseLineNumber) {
+    std::lock_guard<std::mutex> lock(_stackMutex);
+    _scriptNames[id] = fileName.isEmpty() ? QString("(anonymous)") : fileName;
+}
+
+void ScriptProfiler::functionEntry(qint64 scriptId) {
+    std::lock_guard<std::mutex> lock(_stackMutex);
+    _shadowStack.push_back(scriptId);
+}
+
+void ScriptProfiler::functionExit(qint64 scriptId, const QScriptValue& returnValue) {
+    std::lock_guard<std::mutex> lock(_stackMutex);
+    if (!_shadowStack.empty()) {
+        _shadowStack.pop_back();
+    }
+}
+
+void ScriptProfiler::sampleLoop() {
+    while (_running.load()) {
+        std::this_thread::sleep_for(std::chrono::microseconds(_sampleIntervalUsecs));
+
+        QByteArray signature;
+        {
+            std::lock_guard<std::mutex> lock(_stackMutex);
+            signature = QByteArray(reinterpret_cast<const char*>(_shadowStack.data()),
+                                   (int)(_shadowStack.size() * sizeof(qint64)));
+        }
+
+        std::lock_guard<std::mutex> lock(_samplesMutex);
+        _sampleCount++;
+        if (!signature.isEmpty()) {
+            _samples[signature]++;
+        }
+    }
+}
+
+QVariantMap ScriptProfiler::takeReport() {
+    QHash<QByteArray, int> samples;
+    int sampleCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(_samplesMutex);
+        samples.swap(_samples);
+        sampleCount = _sampleCount;
+        _sampleCount = 0;
+    }
+
+    QHash<qint64, QString> scriptNames;
+    {
+        std::lock_guard<std::mutex> lock(_stackMutex);
+        scriptNames = _scriptNames;
+    }
+
+    // collapse each raw id stack into "outer;inner" form, merging stacks whose ids resolve to
+    // the same names (the flamegraph collapsed-stack format)
+    QVariantMap stacks;
+    for (auto it = samples.constBegin(); it != samples.constEnd(); ++it) {
+        const qint64* ids = reinterpret_cast<const qint64*>(it.key().constData());
+        int depth = it.key().size() / (int)sizeof(qint64);
+        QStringList frames;
+        for (int i = 0; i < depth; i++) {
+            auto nameIt = scriptNames.constFind(ids[i]);
+            frames.append(nameIt != scriptNames.constEnd() ? nameIt.value() : QString("(native)"));
+        }
+        auto collapsed = frames.join(";");
+        stacks[collapsed] = stacks.value(collapsed, 0).toInt() + it.value();
+    }
+
+    QVariantMap report;
+    report["durationMsecs"] = (double)(usecTimestampNow() - _startTime) / 1000.0;
+    report["sampleIntervalUsecs"] = _sampleIntervalUsecs;
+    report["sampleCount"] = sampleCount;
+    report["stacks"] = stacks;
+    _startTime = usecTimestampNow();
+    return report;
+}
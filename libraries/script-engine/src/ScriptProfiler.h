@@ -0,0 +1,63 @@
+//
+//  ScriptProfiler.h
+//  libraries/script-engine/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ScriptProfiler_h
+#define hifi_ScriptProfiler_h
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QVariantMap>
+#include <QtScript/QScriptEngineAgent>
+
+// Sampling profiler for one script engine. The agent callbacks maintain a shadow stack of
+// script ids (cheap push/pop under a mutex); a dedicated sampler thread snapshots that stack on
+// a fixed interval and aggregates identical stacks, so the report cost is proportional to the
+// number of distinct stacks, not to execution. Only attach while profiling: installing any
+// QScriptEngineAgent drops the engine to interpreted execution for the duration.
+class ScriptProfiler : public QScriptEngineAgent {
+public:
+    static const int DEFAULT_SAMPLE_INTERVAL_USECS = 5000;
+
+    ScriptProfiler(QScriptEngine* engine, int sampleIntervalUsecs = DEFAULT_SAMPLE_INTERVAL_USECS);
+    ~ScriptProfiler();
+
+    void scriptLoad(qint64 id, const QString& program, const QString& fileName, int baseLineNumber) override;
+    void functionEntry(qint64 scriptId) override;
+    void functionExit(qint64 scriptId, const QScriptValue& returnValue) override;
+
+    // Aggregated results since start, as collapsed stacks ("outer;inner" -> sample count) plus
+    // sampling metadata; call from the engine thread
+    QVariantMap takeReport();
+
+private:
+    void sampleLoop();
+
+    const int _sampleIntervalUsecs;
+    quint64 _startTime { 0 };
+
+    std::mutex _stackMutex;
+    std::vector<qint64> _shadowStack;
+    QHash<qint64, QString> _scriptNames;
+
+    std::mutex _samplesMutex;
+    QHash<QByteArray, int> _samples; // raw script-id stack signature -> count
+    int _sampleCount { 0 };
+
+    std::atomic<bool> _running { true };
+    std::thread _samplerThread;
+};
+
+#endif // hifi_ScriptProfiler_h
@@ -0,0 +1,155 @@
+//
+//  ScriptWorkerClass.cpp
+//  libraries/script-engine/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ScriptWorkerClass.h"
+
+#include <QtCore/QPointer>
+#include <QtCore/QThread>
+
+#include "ScriptCache.h"
+#include "ScriptEngineLogging.h"
+
+ScriptWorkerClass::ScriptWorkerClass(QScriptEngine* ownerEngine, const QString& sourceURL) :
+    _ownerEngine(ownerEngine)
+{
+    QPointer<ScriptWorkerClass> self(this);
+    DependencyManager::get<ScriptCache>()->getScriptContents(sourceURL,
+        [self](const QString& url, const QString& contents, bool isURL, bool success, const QString& status) {
+        if (!self) {
+            return;
+        }
+        // the content callback may fire on the cache's thread; hop back to the owning script's
+        if (success) {
+            QMetaObject::invokeMethod(self.data(), [self, contents, url] {
+                if (self) {
+                    self->startWorker(contents, url);
+                }
+            });
+        } else {
+            QMetaObject::invokeMethod(self.data(), "deliverErrorToOwner",
+                Q_ARG(QString, QString("Worker: failed to load script %1 (%2)").arg(url).arg(status)));
+        }
+    });
+}
+
+ScriptWorkerClass::~ScriptWorkerClass() {
+    terminate();
+}
+
+QScriptValue ScriptWorkerClass::constructor(QScriptContext* context, QScriptEngine* engine) {
+    QString url;
+    if (context->argumentCount() > 0) {
+        url = context->argument(0).toString();
+    }
+    return engine->newQObject(new ScriptWorkerClass(engine, url), QScriptEngine::ScriptOwnership);
+}
+
+void ScriptWorkerClass::startWorker(const QString& source, const QString& name) {
+    if (_terminated) {
+        return;
+    }
+
+    // the worker gets a full engine of the same context on its own thread, but none of the
+    // owner's interfaces or state - isolation is the point
+    auto ownerContext = qobject_cast<ScriptEngine*>(_ownerEngine);
+    auto context = ownerContext ? ownerContext->getContextEnum() : ScriptEngine::CLIENT_SCRIPT;
+    _workerEngine = scriptEngineFactory(context, NO_SCRIPT, QString("about:Worker %1").arg(name));
+
+    auto workerEngine = _workerEngine.data();
+    QPointer<ScriptWorkerClass> self(this);
+
+    // unhandled worker exceptions surface through onerror; stringified on the worker's own
+    // thread, since script values cannot cross engines
+    connect(workerEngine, &ScriptEngine::unhandledException, workerEngine,
+            [self](const QScriptValue& exception) {
+        if (self) {
+            QMetaObject::invokeMethod(self.data(), "deliverErrorToOwner",
+                Q_ARG(QString, exception.toString()));
+        }
+    });
+
+    _workerEngine->runInThread();
+
+    // wire the messaging globals and evaluate the source once the engine's thread is up
+    QMetaObject::invokeMethod(workerEngine, [workerEngine, self, source, name] {
+        auto postMessageFn = workerEngine->newFunction(ScriptWorkerClass::workerPostMessage);
+        postMessageFn.setData(workerEngine->newQObject(self.data()));
+        workerEngine->globalObject().setProperty("postMessage", postMessageFn);
+        workerEngine->evaluate(source, name);
+    });
+
+    // release anything posted while the source was still loading, in order
+    for (const auto& payload : _pendingMessages) {
+        postVariant(payload);
+    }
+    _pendingMessages.clear();
+}
+
+void ScriptWorkerClass::postMessage(const QScriptValue& message) {
+    // plain-value conversion; ArrayBuffers ride along as copy-on-write byte arrays, so large
+    // binary payloads transfer without a deep copy
+    QVariant payload = message.toVariant();
+    if (!_workerEngine) {
+        if (!_terminated) {
+            _pendingMessages.push_back(payload);
+        }
+        return;
+    }
+    postVariant(payload);
+}
+
+void ScriptWorkerClass::postVariant(const QVariant& payload) {
+    auto workerEngine = _workerEngine.data();
+    QMetaObject::invokeMethod(workerEngine, [workerEngine, payload] {
+        auto handler = workerEngine->globalObject().property("onmessage");
+        if (handler.isFunction()) {
+            handler.call(QScriptValue::NullValue, QScriptValueList { workerEngine->toScriptValue(payload) });
+        }
+    });
+}
+
+void ScriptWorkerClass::terminate() {
+    _terminated = true;
+    _pendingMessages.clear();
+    if (_workerEngine) {
+        _workerEngine->stop();
+        _workerEngine.clear();
+    }
+}
+
+void ScriptWorkerClass::deliverMessageToOwner(const QVariant& message) {
+    if (_terminated) {
+        return;
+    }
+    if (_onMessage.isFunction()) {
+        _onMessage.call(QScriptValue::NullValue, QScriptValueList { _ownerEngine->toScriptValue(message) });
+    }
+}
+
+void ScriptWorkerClass::deliverErrorToOwner(const QString& error) {
+    if (_terminated) {
+        return;
+    }
+    qCWarning(scriptengine) << "Worker error:" << error;
+    if (_onError.isFunction()) {
+        _onError.call(QScriptValue::NullValue, QScriptValueList { QScriptValue(error) });
+    }
+}
+
+QScriptValue ScriptWorkerClass::workerPostMessage(QScriptContext* context, QScriptEngine* engine) {
+    auto worker = qobject_cast<ScriptWorkerClass*>(context->callee().data().toQObject());
+    if (worker && context->argumentCount() > 0) {
+        // queued across threads back to the owner
+        QMetaObject::invokeMethod(worker, "deliverMessageToOwner",
+            Q_ARG(QVariant, context->argument(0).toVariant()));
+    }
+    return QScriptValue::UndefinedValue;
+}
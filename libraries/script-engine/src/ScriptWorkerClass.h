@@ -0,0 +1,92 @@
+//
+//  ScriptWorkerClass.h
+//  libraries/script-engine/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ScriptWorkerClass_h
+#define hifi_ScriptWorkerClass_h
+
+#include <vector>
+
+#include <QObject>
+#include <QScriptEngine>
+
+#include "ScriptEngine.h"
+
+/**jsdoc
+ * Runs a script on its own engine and thread, communicating with the owning script only through
+ * messages. The worker script has no access to the owning script's state; it sees a bare engine
+ * with the core language facilities (including typed arrays) plus global
+ * <code>postMessage(message)</code> and <code>onmessage</code>. Messages are converted to plain
+ * values when they cross the boundary; <code>ArrayBuffer</code> payloads travel by reference
+ * (copy-on-write), so large binary messages do not pay a copy in either direction.
+ *
+ * <p>Constructed by <code>new Worker(url)</code>.</p>
+ *
+ * @class Worker
+ * @param {string} url - The URL of the script to run in the worker.
+ *
+ * @hifi-interface
+ * @hifi-client-entity
+ * @hifi-avatar
+ * @hifi-server-entity
+ * @hifi-assignment-client
+ *
+ * @property {Worker~onMessageCallback} onmessage - Function called when the worker posts a message.
+ * @property {Worker~onErrorCallback} onerror - Function called when the worker script fails to load
+ *     or raises an unhandled exception.
+ */
+class ScriptWorkerClass : public QObject {
+    Q_OBJECT
+
+    Q_PROPERTY(QScriptValue onmessage READ getOnMessage WRITE setOnMessage)
+    Q_PROPERTY(QScriptValue onerror READ getOnError WRITE setOnError)
+
+public:
+    ScriptWorkerClass(QScriptEngine* ownerEngine, const QString& sourceURL);
+    ~ScriptWorkerClass();
+
+    static QScriptValue constructor(QScriptContext* context, QScriptEngine* engine);
+
+    QScriptValue getOnMessage() const { return _onMessage; }
+    void setOnMessage(QScriptValue function) { _onMessage = function; }
+    QScriptValue getOnError() const { return _onError; }
+    void setOnError(QScriptValue function) { _onError = function; }
+
+    /**jsdoc
+     * Sends a message to the worker; delivered to the worker's global <code>onmessage</code>.
+     * @function Worker.postMessage
+     * @param {*} message - The message value.
+     */
+    Q_INVOKABLE void postMessage(const QScriptValue& message);
+
+    /**jsdoc
+     * Stops the worker's engine and thread.
+     * @function Worker.terminate
+     */
+    Q_INVOKABLE void terminate();
+
+    // message/error delivery back onto the owning script's thread (via queued invocation)
+    Q_INVOKABLE void deliverMessageToOwner(const QVariant& message);
+    Q_INVOKABLE void deliverErrorToOwner(const QString& error);
+
+private:
+    static QScriptValue workerPostMessage(QScriptContext* context, QScriptEngine* engine);
+    void startWorker(const QString& source, const QString& name);
+    void postVariant(const QVariant& payload);
+
+    QScriptEngine* _ownerEngine;
+    ScriptEnginePointer _workerEngine;
+    QScriptValue _onMessage { QScriptValue::NullValue };
+    QScriptValue _onError { QScriptValue::NullValue };
+    std::vector<QVariant> _pendingMessages; // posted before the worker source finished loading
+    bool _terminated { false };
+};
+
+#endif // hifi_ScriptWorkerClass_h
@@ -14,7 +14,10 @@
 
 #include "XMLHttpRequestClass.h"
 
+#include <cctype>
+
 #include <QEventLoop>
+#include <QtCore/QJsonDocument>
 #include <qurlquery.h>
 
 #include <AccountManager.h>
@@ -86,6 +89,113 @@ void XMLHttpRequestClass::requestDownloadProgress(qint64 bytesReceived, qint64 b
         setReadyState(HEADERS_RECEIVED);
         setReadyState(LOADING);
     }
+
+    if (_responseType == "chunked-arraybuffer" || _responseType == "chunked-json") {
+        // streaming modes consume bytes as they arrive instead of accumulating the response;
+        // draining here (on the script thread) against the bounded read buffer set in
+        // connectToReply is what applies backpressure to the network layer
+        QByteArray chunk = _reply->readAll();
+        if (!chunk.isEmpty()) {
+            deliverChunk(chunk, bytesReceived, bytesTotal);
+        }
+    } else if (_onProgress.isFunction()) {
+        _onProgress.call(QScriptValue::NullValue,
+                         QScriptValueList { QScriptValue((double)bytesReceived), QScriptValue((double)bytesTotal) });
+    }
+}
+
+QScriptValue XMLHttpRequestClass::makeArrayBuffer(const QByteArray& bytes) const {
+    QScriptValue data = _engine->newVariant(QVariant::fromValue(bytes));
+    return _engine->newObject(reinterpret_cast<ScriptEngine*>(_engine)->getArrayBufferClass(), data);
+}
+
+void XMLHttpRequestClass::deliverChunk(const QByteArray& chunk, qint64 bytesReceived, qint64 bytesTotal) {
+    if (_responseType == "chunked-json") {
+        processJsonChunk(chunk);
+    } else if (_onProgress.isFunction()) {
+        _onProgress.call(QScriptValue::NullValue,
+                         QScriptValueList { makeArrayBuffer(chunk),
+                                            QScriptValue((double)bytesReceived),
+                                            QScriptValue((double)bytesTotal) });
+    }
+}
+
+void XMLHttpRequestClass::emitJsonElement(int start, int end) {
+    if (!_onProgress.isFunction()) {
+        return;
+    }
+    QJsonParseError parseError;
+    auto doc = QJsonDocument::fromJson(_jsonBuffer.mid(start, end - start), &parseError);
+    if (parseError.error != QJsonParseError::NoError) {
+        _jsonBroken = true;
+        return;
+    }
+    _onProgress.call(QScriptValue::NullValue, QScriptValueList { _engine->toScriptValue(doc.toVariant()) });
+}
+
+void XMLHttpRequestClass::processJsonChunk(const QByteArray& chunk) {
+    if (_jsonBroken) {
+        return;
+    }
+    _jsonBuffer.append(chunk);
+
+    const char* data = _jsonBuffer.constData();
+    int size = _jsonBuffer.size();
+    int i = _jsonScanPos;
+    for (; i < size && !_jsonBroken; i++) {
+        char c = data[i];
+        if (_jsonInString) {
+            if (_jsonEscaped) {
+                _jsonEscaped = false;
+            } else if (c == '\\') {
+                _jsonEscaped = true;
+            } else if (c == '"') {
+                _jsonInString = false;
+            }
+            continue;
+        }
+
+        if (!_jsonRootSeen) {
+            if (c == '[' || c == '{') {
+                _jsonRootSeen = true;
+                _jsonRootIsArray = (c == '[');
+                _jsonDepth = 1;
+            }
+            continue;
+        }
+
+        // complete top-level array elements end at a depth-1 comma or the root's closing bracket
+        if (_jsonRootIsArray && _jsonDepth == 1) {
+            if (c == ',' || c == ']') {
+                if (_jsonElementStart >= 0) {
+                    emitJsonElement(_jsonElementStart, i);
+                    _jsonElementStart = -1;
+                }
+            } else if (_jsonElementStart < 0 && !isspace((unsigned char)c)) {
+                _jsonElementStart = i;
+            }
+        }
+
+        if (c == '"') {
+            _jsonInString = true;
+        } else if (c == '[' || c == '{') {
+            _jsonDepth++;
+        } else if (c == ']' || c == '}') {
+            _jsonDepth--;
+        }
+    }
+
+    // keep only the current partial element (or nothing) buffered
+    if (!_jsonRootIsArray) {
+        _jsonScanPos = size;
+    } else if (_jsonElementStart >= 0) {
+        _jsonBuffer = _jsonBuffer.mid(_jsonElementStart);
+        _jsonScanPos = _jsonBuffer.size();
+        _jsonElementStart = 0;
+    } else {
+        _jsonBuffer.clear();
+        _jsonScanPos = 0;
+    }
 }
 
 QScriptValue XMLHttpRequestClass::getAllResponseHeaders() const {
@@ -210,19 +320,42 @@ void XMLHttpRequestClass::requestFinished() {
     _errorCode = _reply->error();
 
     if (_errorCode == QNetworkReply::NoError) {
-        _rawResponseData.append(_reply->readAll());
-
-        if (_responseType == "json") {
-            _responseData = _engine->evaluate("(" + QString(_rawResponseData.data()) + ")");
-            if (_responseData.isError()) {
-                _engine->clearExceptions();
-                _responseData = QScriptValue::NullValue;
+        if (_responseType == "chunked-arraybuffer" || _responseType == "chunked-json") {
+            // flush whatever the last downloadProgress signal did not cover
+            QByteArray chunk = _reply->readAll();
+            if (!chunk.isEmpty()) {
+                deliverChunk(chunk, 0, 0);
             }
-        } else if (_responseType == "arraybuffer") {
-            QScriptValue data = _engine->newVariant(QVariant::fromValue(_rawResponseData));
-            _responseData = _engine->newObject(reinterpret_cast<ScriptEngine*>(_engine)->getArrayBufferClass(), data);
+            if (_responseType == "chunked-json" && _jsonRootSeen && !_jsonRootIsArray && !_jsonBroken
+                    && _onProgress.isFunction()) {
+                // a non-array root cannot be split into elements; deliver it whole at the end
+                emitJsonElement(0, _jsonBuffer.size());
+            }
+            _jsonBuffer.clear();
+            _responseData = QScriptValue::NullValue;
         } else {
-            _responseData = QScriptValue(QString(_rawResponseData.data()));
+            _rawResponseData.append(_reply->readAll());
+
+            if (_responseType == "json") {
+                // parse outside the script engine first - far cheaper than evaluate() on large
+                // payloads and no whole-payload QString copy; fall back to the old evaluation
+                // for payloads that are not strict JSON
+                QJsonParseError parseError;
+                auto doc = QJsonDocument::fromJson(_rawResponseData, &parseError);
+                if (parseError.error == QJsonParseError::NoError) {
+                    _responseData = _engine->toScriptValue(doc.toVariant());
+                } else {
+                    _responseData = _engine->evaluate("(" + QString(_rawResponseData.data()) + ")");
+                    if (_responseData.isError()) {
+                        _engine->clearExceptions();
+                        _responseData = QScriptValue::NullValue;
+                    }
+                }
+            } else if (_responseType == "arraybuffer") {
+                _responseData = makeArrayBuffer(_rawResponseData);
+            } else {
+                _responseData = QScriptValue(QString(_rawResponseData.data()));
+            }
         }
     }
 
@@ -246,6 +379,11 @@ void XMLHttpRequestClass::abortRequest() {
 }
 
 void XMLHttpRequestClass::connectToReply(QNetworkReply* reply) {
+    if (_responseType == "chunked-arraybuffer" || _responseType == "chunked-json") {
+        // bound how far the network layer may read ahead of the script consumer
+        const qint64 STREAMING_READ_BUFFER_SIZE = 256 * 1024;
+        reply->setReadBufferSize(STREAMING_READ_BUFFER_SIZE);
+    }
     connect(reply, SIGNAL(finished()), this, SLOT(requestFinished()));
     connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), this, SLOT(requestError(QNetworkReply::NetworkError)));
     connect(reply, SIGNAL(downloadProgress(qint64, qint64)), this, SLOT(requestDownloadProgress(qint64, qint64)));
@@ -167,6 +167,7 @@ class XMLHttpRequestClass : public QObject {
     // Callbacks
     Q_PROPERTY(QScriptValue ontimeout READ getOnTimeout WRITE setOnTimeout)
     Q_PROPERTY(QScriptValue onreadystatechange READ getOnReadyStateChange WRITE setOnReadyStateChange)
+    Q_PROPERTY(QScriptValue onprogress READ getOnProgress WRITE setOnProgress)
 public:
     XMLHttpRequestClass(QScriptEngine* engine);
     ~XMLHttpRequestClass();
@@ -223,6 +224,8 @@ public:
     void setOnTimeout(QScriptValue function) { _onTimeout = function; }
     QScriptValue getOnReadyStateChange() const { return _onReadyStateChange; }
     void setOnReadyStateChange(QScriptValue function) { _onReadyStateChange = function; }
+    QScriptValue getOnProgress() const { return _onProgress; }
+    void setOnProgress(QScriptValue function) { _onProgress = function; }
 
 public slots:
 
@@ -290,6 +293,10 @@ signals:
 private:
     void setReadyState(ReadyState readyState);
     void doSend();
+    QScriptValue makeArrayBuffer(const QByteArray& bytes) const;
+    void deliverChunk(const QByteArray& chunk, qint64 bytesReceived, qint64 bytesTotal);
+    void processJsonChunk(const QByteArray& chunk);
+    void emitJsonElement(int start, int end);
     void connectToReply(QNetworkReply* reply);
     void disconnectFromReply(QNetworkReply* reply);
     void abortRequest();
@@ -306,8 +313,22 @@ private:
     QScriptValue _responseData;
     QScriptValue _onTimeout { QScriptValue::NullValue };
     QScriptValue _onReadyStateChange { QScriptValue::NullValue };
+    QScriptValue _onProgress { QScriptValue::NullValue };
     ReadyState _readyState { XMLHttpRequestClass::UNSENT };
 
+    // Incremental scanner state for the "chunked-json" response type: tracks string/nesting
+    // context across chunk boundaries so complete top-level array elements can be parsed and
+    // delivered as they arrive, keeping only the current partial element buffered
+    QByteArray _jsonBuffer;
+    int _jsonScanPos { 0 };
+    int _jsonElementStart { -1 };
+    int _jsonDepth { 0 };
+    bool _jsonInString { false };
+    bool _jsonEscaped { false };
+    bool _jsonRootSeen { false };
+    bool _jsonRootIsArray { false };
+    bool _jsonBroken { false };
+
     /**jsdoc
      * <p>The type of network error.</p>
      * <table>
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cassert>
 #include <climits>
+#include <cstring>
 #include <limits>
 
 #include <QDebug>
@@ -41,6 +42,14 @@ public:
     ByteCountCoded(const QByteArray& fromEncoded) : data(0) { decode(fromEncoded); }
 
     QByteArray encode() const;
+
+    // encodes into a caller-supplied buffer (no allocation); returns the number
+    // of bytes written, or 0 if maxSize is too small
+    int encodeToBuffer(char* output, int maxSize) const;
+
+    // worst-case encoded size: 7 payload bits per byte plus the header bit
+    static const int MAX_ENCODED_BYTES = (int)(sizeof(T) * BITS_IN_BYTE) / (BITS_IN_BYTE - 1) + 1;
+
     size_t decode(const QByteArray& fromEncoded);
     size_t decode(const char* encodedBuffer, int encodedSize);
 
@@ -61,58 +70,47 @@ template<typename T> inline QByteArray& operator>>(QByteArray& in, ByteCountCode
     return in;
 }
 
-template<typename T> inline QByteArray ByteCountCoded<T>::encode() const {
-    QByteArray output;
-
-    int totalBits = sizeof(data) * BITS_IN_BYTE;
-    int valueBits = totalBits;
-    bool firstValueFound = false;
+template<typename T> inline int ByteCountCoded<T>::encodeToBuffer(char* output, int maxSize) const {
+    // determine the number of significant bits in the value
+    int valueBits = 0;
     T temp = data;
-    T lastBitMask = (T)(1) << (totalBits - 1);
-
-    // determine the number of bits that the value takes
-    for (int bitAt = 0; bitAt < totalBits; bitAt++) {
-        T bitValue = (temp & lastBitMask) == lastBitMask;
-        if (!firstValueFound) {
-            if (bitValue == 0) {
-                valueBits--;
-            } else {
-                firstValueFound = true;
-            }
-        }
-        temp = temp << 1;
+    while (temp != 0) {
+        ++valueBits;
+        temp = temp >> 1;
     }
-    
+
     // calculate the number of total bytes, including our header
     // BITS_IN_BYTE-1 because we need to code the number of bytes in the header
     // + 1 because we always take at least 1 byte, even if number of bits is less than a bytes worth
-    int numberOfBytes = (valueBits / (BITS_IN_BYTE - 1)) + 1; 
-
-    output.fill(0, numberOfBytes);
-
-    // next pack the number of header bits in, the first N-1 to be set to 1, the last to be set to 0
-    for(int i = 0; i < numberOfBytes; i++) {
-        int outputIndex = i;
-        T bitValue = (i < (numberOfBytes - 1)  ? 1 : 0);
-        char original = output.at(outputIndex / BITS_IN_BYTE);
-        int shiftBy = BITS_IN_BYTE - ((outputIndex % BITS_IN_BYTE) + 1);
-        char thisBit = ( bitValue << shiftBy);
-        output[i / BITS_IN_BYTE] = (original | thisBit);
+    int numberOfBytes = (valueBits / (BITS_IN_BYTE - 1)) + 1;
+
+    if (numberOfBytes > maxSize) {
+        return 0;
     }
 
-    // finally pack the the actual bits from the bit array
-    temp = data;
-    for(int i = numberOfBytes; i < (numberOfBytes + valueBits); i++) {
-        int outputIndex = i;
-        T bitValue = (temp & 1);
-        char original = output.at(outputIndex / BITS_IN_BYTE);
-        int shiftBy = BITS_IN_BYTE - ((outputIndex % BITS_IN_BYTE) + 1);
-        char thisBit = ( bitValue << shiftBy);
-        output[i / BITS_IN_BYTE] = (original | thisBit);
+    memset(output, 0, numberOfBytes);
+
+    // pack the header bits: the first N-1 set to 1, the Nth left as 0
+    for (int i = 0; i < numberOfBytes - 1; i++) {
+        output[i / BITS_IN_BYTE] |= (char)(1 << (BITS_IN_BYTE - ((i % BITS_IN_BYTE) + 1)));
+    }
 
+    // pack the value bits, least significant first, into the bit stream
+    temp = data;
+    for (int i = numberOfBytes; i < (numberOfBytes + valueBits); i++) {
+        if (temp & 1) {
+            output[i / BITS_IN_BYTE] |= (char)(1 << (BITS_IN_BYTE - ((i % BITS_IN_BYTE) + 1)));
+        }
         temp = temp >> 1;
     }
-    return output;
+    return numberOfBytes;
+}
+
+template<typename T> inline QByteArray ByteCountCoded<T>::encode() const {
+    // encode into a stack buffer first, so the QByteArray is built in one step
+    char buffer[MAX_ENCODED_BYTES];
+    int numberOfBytes = encodeToBuffer(buffer, MAX_ENCODED_BYTES);
+    return QByteArray(buffer, numberOfBytes);
 }
 
 template<typename T> inline size_t ByteCountCoded<T>::decode(const QByteArray& fromEncodedBytes) {
@@ -26,3 +26,15 @@ QSharedPointer<Dependency> DependencyManager::safeGet(size_t hashCode) const {
     return _instanceHash.value(hashCode);
 }
 
+
+void DependencyManager::recordInitTiming(const char* typeName, std::chrono::microseconds duration) {
+    auto& mgr = manager();
+    QMutexLocker lock(&mgr._instanceHashMutex);
+    mgr._initTimings.push_back({ typeName, duration });
+}
+
+std::vector<DependencyManager::InitTiming> DependencyManager::getInitTimings() {
+    auto& mgr = manager();
+    QMutexLocker lock(&mgr._instanceHashMutex);
+    return mgr._initTimings;
+}
@@ -19,8 +19,10 @@
 #include <QWeakPointer>
 #include <QMutex>
 
+#include <chrono>
 #include <functional>
 #include <typeinfo>
+#include <vector>
 
 #define SINGLETON_DEPENDENCY \
     friend class ::DependencyManager;
@@ -78,6 +80,14 @@ public:
 
     static void prepareToExit() { manager()._exiting = true; }
 
+    // Construction-time accounting: every set<T>() records how long the singleton's constructor
+    // took, so startup can report a timeline of where initialization time actually went.
+    struct InitTiming {
+        const char* typeName;
+        std::chrono::microseconds duration;
+    };
+    static std::vector<InitTiming> getInitTimings();
+
 private:
     static DependencyManager& manager();
 
@@ -86,8 +96,11 @@ private:
 
     QSharedPointer<Dependency> safeGet(size_t hashCode) const;
 
+    static void recordInitTiming(const char* typeName, std::chrono::microseconds duration);
+
     QHash<size_t, QSharedPointer<Dependency>> _instanceHash;
     QHash<size_t, size_t> _inheritanceHash;
+    std::vector<InitTiming> _initTimings;
 
     mutable QMutex _instanceHashMutex { QMutex::Recursive };
     mutable QMutex _inheritanceHashMutex;
@@ -140,7 +153,10 @@ QSharedPointer<T> DependencyManager::set(Args&&... args) {
         iter.value().clear();
     }
 
+    auto constructionStart = std::chrono::steady_clock::now();
     QSharedPointer<T> newInstance(new T(args...), &T::customDeleter);
+    recordInitTiming(typeid(T).name(), std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - constructionStart));
     manager()._instanceHash.insert(hashCode, newInstance);
 
     return newInstance;
@@ -157,7 +173,10 @@ QSharedPointer<T> DependencyManager::set(Args&&... args) {
         iter.value().clear();
     }
 
+    auto constructionStart = std::chrono::steady_clock::now();
     QSharedPointer<T> newInstance(new I(args...), &I::customDeleter);
+    recordInitTiming(typeid(I).name(), std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - constructionStart));
     manager()._instanceHash.insert(hashCode, newInstance);
 
     return newInstance;
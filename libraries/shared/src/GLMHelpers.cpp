@@ -198,6 +198,139 @@ int packOrientationQuatToSixBytes(unsigned char* buffer, const glm::quat& quatIn
     return 6;
 }
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>
+
+// SSE2 select: (mask & b) | (~mask & a)
+static inline __m128 select_ps(__m128 mask, __m128 b, __m128 a) {
+    return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a));
+}
+
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quats, int numQuats) {
+    static_assert(sizeof(glm::quat) == 4 * sizeof(float), "glm::quat must be 4 packed floats");
+
+    unsigned char* cursor = buffer;
+
+    const float MAGNITUDE = 1.0f / sqrtf(2.0f);
+    const uint32_t NUM_BITS_PER_COMPONENT = 15;
+    const uint32_t RANGE = (1 << NUM_BITS_PER_COMPONENT) - 1;
+
+    int n = 0;
+    for (; n + 4 <= numQuats; n += 4) {
+
+        // transpose 4 quaternions into component lanes
+        __m128 q0 = _mm_loadu_ps((const float*)&quats[n+0]);
+        __m128 q1 = _mm_loadu_ps((const float*)&quats[n+1]);
+        __m128 q2 = _mm_loadu_ps((const float*)&quats[n+2]);
+        __m128 q3 = _mm_loadu_ps((const float*)&quats[n+3]);
+
+        __m128 t0 = _mm_unpacklo_ps(q0, q1);
+        __m128 t2 = _mm_unpacklo_ps(q2, q3);
+        __m128 t1 = _mm_unpackhi_ps(q0, q1);
+        __m128 t3 = _mm_unpackhi_ps(q2, q3);
+
+        __m128 x = _mm_movelh_ps(t0, t2);
+        __m128 y = _mm_movehl_ps(t2, t0);
+        __m128 z = _mm_movelh_ps(t1, t3);
+        __m128 w = _mm_movehl_ps(t3, t1);
+
+        // find the largest component per lane, preferring the earliest on ties
+        // (matches the scalar packer's strict comparisons)
+        __m128 signBit = _mm_set1_ps(-0.0f);
+        __m128 ax = _mm_andnot_ps(signBit, x);
+        __m128 ay = _mm_andnot_ps(signBit, y);
+        __m128 az = _mm_andnot_ps(signBit, z);
+        __m128 aw = _mm_andnot_ps(signBit, w);
+
+        __m128 bestAbs = ax;
+        __m128 bestVal = x;
+        __m128 bestIdx = _mm_setzero_ps();
+
+        __m128 gt = _mm_cmpgt_ps(ay, bestAbs);
+        bestAbs = select_ps(gt, ay, bestAbs);
+        bestVal = select_ps(gt, y, bestVal);
+        bestIdx = select_ps(gt, _mm_set1_ps(1.0f), bestIdx);
+
+        gt = _mm_cmpgt_ps(az, bestAbs);
+        bestAbs = select_ps(gt, az, bestAbs);
+        bestVal = select_ps(gt, z, bestVal);
+        bestIdx = select_ps(gt, _mm_set1_ps(2.0f), bestIdx);
+
+        gt = _mm_cmpgt_ps(aw, bestAbs);
+        bestAbs = select_ps(gt, aw, bestAbs);
+        bestVal = select_ps(gt, w, bestVal);
+        bestIdx = select_ps(gt, _mm_set1_ps(3.0f), bestIdx);
+
+        // ensure that the sign of the dropped component is always negative
+        __m128 negate = _mm_and_ps(_mm_cmpgt_ps(bestVal, _mm_setzero_ps()), signBit);
+        x = _mm_xor_ps(x, negate);
+        y = _mm_xor_ps(y, negate);
+        z = _mm_xor_ps(z, negate);
+        w = _mm_xor_ps(w, negate);
+
+        // quantize all four components into 0..RANGE
+        __m128 offset = _mm_set1_ps(MAGNITUDE);
+        __m128 scale = _mm_set1_ps((float)RANGE / (2.0f * MAGNITUDE));
+        __m128i ix = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(x, offset), scale));
+        __m128i iy = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(y, offset), scale));
+        __m128i iz = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(z, offset), scale));
+        __m128i iw = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(w, offset), scale));
+
+        alignas(16) int32_t quantized[4][4];
+        _mm_store_si128((__m128i*)quantized[0], ix);
+        _mm_store_si128((__m128i*)quantized[1], iy);
+        _mm_store_si128((__m128i*)quantized[2], iz);
+        _mm_store_si128((__m128i*)quantized[3], iw);
+
+        alignas(16) float indices[4];
+        _mm_store_ps(indices, bestIdx);
+
+        // gather the three kept components per quaternion and emit the bytes
+        for (int lane = 0; lane < 4; lane++) {
+            uint8_t largestComponent = (uint8_t)indices[lane];
+
+            uint16_t components[3];
+            for (int i = 0, j = 0; i < 4; i++) {
+                if (i != largestComponent) {
+                    components[j] = (uint16_t)quantized[i][lane];
+                    j++;
+                }
+            }
+
+            components[0] = (0x7fff & components[0]) | ((0x01 & largestComponent) << 15);
+            components[1] = (0x7fff & components[1]) | ((0x02 & largestComponent) << 14);
+
+            cursor[0] = HI_BYTE(components[0]);
+            cursor[1] = LO_BYTE(components[0]);
+            cursor[2] = HI_BYTE(components[1]);
+            cursor[3] = LO_BYTE(components[1]);
+            cursor[4] = HI_BYTE(components[2]);
+            cursor[5] = LO_BYTE(components[2]);
+            cursor += 6;
+        }
+    }
+
+    // scalar tail
+    for (; n < numQuats; n++) {
+        cursor += packOrientationQuatToSixBytes(cursor, quats[n]);
+    }
+
+    return (int)(cursor - buffer);
+}
+
+#else
+
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quats, int numQuats) {
+    unsigned char* cursor = buffer;
+    for (int n = 0; n < numQuats; n++) {
+        cursor += packOrientationQuatToSixBytes(cursor, quats[n]);
+    }
+    return (int)(cursor - buffer);
+}
+
+#endif
+
 int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& quatOutput) {
 
     uint16_t components[3];
@@ -118,6 +118,11 @@ int unpackOrientationQuatFromBytes(const unsigned char* buffer, glm::quat& quatO
 int packOrientationQuatToSixBytes(unsigned char* buffer, const glm::quat& quatInput);
 int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& quatOutput);
 
+// Batch variant of packOrientationQuatToSixBytes: packs numQuats rotations into
+// buffer (six bytes each, contiguous). On x86 the component selection,
+// conditional negation and quantization run four quaternions at a time.
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quats, int numQuats);
+
 // Ratios need the be highly accurate when less than 10, but not very accurate above 10, and they
 // are never greater than 1000 to 1, this allows us to encode each component in 16bits
 int packFloatRatioToTwoByte(unsigned char* buffer, float ratio);
@@ -11,6 +11,11 @@
 
 #include "GeometryUtil.h"
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#endif
+
 #include <assert.h>
 #include <cstring>
 #include <cmath>
@@ -406,6 +411,101 @@ bool findRayTriangleIntersection(const glm::vec3& origin, const glm::vec3& direc
     return false;
 }
 
+int findRayTriangleBatchIntersection(const glm::vec3& origin, const glm::vec3& direction,
+                                     const Triangle* triangles, const size_t* indices, int count,
+                                     float& distance, bool allowBackface) {
+    int bestIndex = -1;
+    float bestDistance = FLT_MAX;
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    const int SIMD_WIDTH = 4;
+    __m128 dirX = _mm_set1_ps(direction.x);
+    __m128 dirY = _mm_set1_ps(direction.y);
+    __m128 dirZ = _mm_set1_ps(direction.z);
+    __m128 origX = _mm_set1_ps(origin.x);
+    __m128 origY = _mm_set1_ps(origin.y);
+    __m128 origZ = _mm_set1_ps(origin.z);
+    __m128 epsilon = _mm_set1_ps(EPSILON);
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+
+    int blockEnd = count - (count % SIMD_WIDTH);
+    for (int base = 0; base < blockEnd; base += SIMD_WIDTH) {
+        // gather the four triangles' vertices into SoA lanes
+        const Triangle& t0 = triangles[indices[base + 0]];
+        const Triangle& t1 = triangles[indices[base + 1]];
+        const Triangle& t2 = triangles[indices[base + 2]];
+        const Triangle& t3 = triangles[indices[base + 3]];
+
+        #define GATHER(member, axis) _mm_set_ps(t3.member.axis, t2.member.axis, t1.member.axis, t0.member.axis)
+        __m128 v0x = GATHER(v0, x), v0y = GATHER(v0, y), v0z = GATHER(v0, z);
+        __m128 e1x = _mm_sub_ps(GATHER(v1, x), v0x);
+        __m128 e1y = _mm_sub_ps(GATHER(v1, y), v0y);
+        __m128 e1z = _mm_sub_ps(GATHER(v1, z), v0z);
+        __m128 e2x = _mm_sub_ps(GATHER(v2, x), v0x);
+        __m128 e2y = _mm_sub_ps(GATHER(v2, y), v0y);
+        __m128 e2z = _mm_sub_ps(GATHER(v2, z), v0z);
+        #undef GATHER
+
+        // P = direction x e2
+        __m128 px = _mm_sub_ps(_mm_mul_ps(dirY, e2z), _mm_mul_ps(dirZ, e2y));
+        __m128 py = _mm_sub_ps(_mm_mul_ps(dirZ, e2x), _mm_mul_ps(dirX, e2z));
+        __m128 pz = _mm_sub_ps(_mm_mul_ps(dirX, e2y), _mm_mul_ps(dirY, e2x));
+
+        __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+        __m128 absDet = _mm_andnot_ps(_mm_set1_ps(-0.0f), det);
+        __m128 valid = allowBackface ? _mm_cmpge_ps(absDet, epsilon) : _mm_cmpge_ps(det, epsilon);
+
+        __m128 invDet = _mm_div_ps(one, det);
+
+        __m128 tx = _mm_sub_ps(origX, v0x);
+        __m128 ty = _mm_sub_ps(origY, v0y);
+        __m128 tz = _mm_sub_ps(origZ, v0z);
+
+        __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)), _mm_mul_ps(tz, pz)), invDet);
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+
+        // Q = T x e1
+        __m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e1z), _mm_mul_ps(tz, e1y));
+        __m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e1x), _mm_mul_ps(tx, e1z));
+        __m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e1y), _mm_mul_ps(ty, e1x));
+
+        __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dirX, qx), _mm_mul_ps(dirY, qy)), _mm_mul_ps(dirZ, qz)), invDet);
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+
+        __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+        valid = _mm_and_ps(valid, _mm_cmpgt_ps(t, epsilon));
+
+        __m128 tMasked = _mm_or_ps(_mm_and_ps(valid, t), _mm_andnot_ps(valid, _mm_set1_ps(FLT_MAX)));
+        float lanes[4];
+        _mm_storeu_ps(lanes, tMasked);
+        for (int lane = 0; lane < SIMD_WIDTH; lane++) {
+            if (lanes[lane] < bestDistance) {
+                bestDistance = lanes[lane];
+                bestIndex = base + lane;
+            }
+        }
+    }
+    int scalarStart = blockEnd;
+#else
+    int scalarStart = 0;
+#endif
+
+    for (int i = scalarStart; i < count; i++) {
+        float thisDistance;
+        if (findRayTriangleIntersection(origin, direction, triangles[indices[i]], thisDistance, allowBackface)
+                && thisDistance < bestDistance) {
+            bestDistance = thisDistance;
+            bestIndex = i;
+        }
+    }
+
+    if (bestIndex >= 0) {
+        distance = bestDistance;
+    }
+    return bestIndex;
+}
+
 static void getTrianglePlaneIntersectionPoints(const glm::vec3 trianglePoints[3], const float pointPlaneDistances[3],
                                                const int clippedPointIndex, const int keptPointIndices[2],
                                                glm::vec3 points[2]) {
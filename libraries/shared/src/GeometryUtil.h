@@ -94,6 +94,14 @@ bool findRayRectangleIntersection(const glm::vec3& origin, const glm::vec3& dire
 bool findRayTriangleIntersection(const glm::vec3& origin, const glm::vec3& direction,
                                     const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2, float& distance, bool allowBackface = false);
 
+// Batched Moller-Trumbore: tests count triangles (selected by indices into the triangle array)
+// against one ray, four at a time with SSE where available, and returns the position within
+// `indices` of the closest hit (or -1); distance receives the closest hit distance.
+class Triangle;
+int findRayTriangleBatchIntersection(const glm::vec3& origin, const glm::vec3& direction,
+                                     const Triangle* triangles, const size_t* indices, int count,
+                                     float& distance, bool allowBackface = false);
+
 bool findParabolaRectangleIntersection(const glm::vec3& origin, const glm::vec3& velocity, const glm::vec3& acceleration,
     const glm::vec2& dimensions, float& parabolicDistance);
 
@@ -0,0 +1,59 @@
+//
+//  Metrics.cpp
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "Metrics.h"
+
+#include <mutex>
+#include <set>
+
+namespace metrics {
+
+const char* PROMETHEUS_MIME_TYPE = "text/plain; version=0.0.4";
+
+static std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::set<Metric*>& registry() {
+    static std::set<Metric*> metricSet;
+    return metricSet;
+}
+
+Metric::Metric(const QString& name, const QString& help, Type type) :
+    _name(name),
+    _help(help),
+    _type(type)
+{
+    std::lock_guard<std::mutex> lock(registryMutex());
+    registry().insert(this);
+}
+
+Metric::~Metric() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    registry().erase(this);
+}
+
+QByteArray renderPrometheusText() {
+    QByteArray output;
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (const auto* metric : registry()) {
+        auto name = metric->getName().toUtf8();
+        if (!metric->getHelp().isEmpty()) {
+            output += "# HELP " + name + " " + metric->getHelp().toUtf8() + "\n";
+        }
+        output += "# TYPE " + name + (metric->getType() == Metric::COUNTER ? " counter\n" : " gauge\n");
+        output += name + " " + QByteArray::number(metric->currentValue(), 'g', 15) + "\n";
+    }
+    return output;
+}
+
+}
@@ -0,0 +1,76 @@
+//
+//  Metrics.h
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_Metrics_h
+#define hifi_Metrics_h
+
+#include <atomic>
+#include <functional>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+// A process-wide registry of Prometheus-format metrics. Counters are single atomic adds on the
+// hot path; gauges sample through a caller-provided function that must itself be O(1) (reading
+// an atomic or a plain member). The registry lock is only taken at construction, destruction
+// and render time, so collection cost is a walk over the registered metrics and nothing else.
+namespace metrics {
+
+class Metric {
+public:
+    enum Type { COUNTER, GAUGE };
+
+    Metric(const QString& name, const QString& help, Type type);
+    virtual ~Metric();
+
+    const QString& getName() const { return _name; }
+    const QString& getHelp() const { return _help; }
+    Type getType() const { return _type; }
+
+    virtual double currentValue() const = 0;
+
+private:
+    QString _name;
+    QString _help;
+    Type _type;
+};
+
+class Counter : public Metric {
+public:
+    Counter(const QString& name, const QString& help) : Metric(name, help, COUNTER) {}
+
+    void increment(int64_t by = 1) { _value.fetch_add(by, std::memory_order_relaxed); }
+    double currentValue() const override { return (double)_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> _value { 0 };
+};
+
+class Gauge : public Metric {
+public:
+    Gauge(const QString& name, const QString& help, std::function<double()> sampler) :
+        Metric(name, help, GAUGE), _sampler(sampler) {}
+
+    double currentValue() const override { return _sampler(); }
+
+private:
+    std::function<double()> _sampler;
+};
+
+// Renders every registered metric in the Prometheus text exposition format (version 0.0.4)
+QByteArray renderPrometheusText();
+
+// Prometheus's media type for the text format
+extern const char* PROMETHEUS_MIME_TYPE;
+
+}
+
+#endif // hifi_Metrics_h
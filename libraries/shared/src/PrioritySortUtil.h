@@ -68,6 +68,10 @@ namespace PrioritySortUtil {
         void reserve(size_t num) {
             _vector.reserve(num);
         }
+        // empties the queue but keeps its storage, for reuse across frames
+        void clear() {
+            _vector.clear();
+        }
         const std::vector<T>& getSortedVector(int numToSort = 0) {
             if (numToSort == 0 || numToSort >= (int)_vector.size()) {
                 std::sort(_vector.begin(), _vector.end(),
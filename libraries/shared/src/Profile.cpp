@@ -7,6 +7,8 @@
 //
 
 #include "Profile.h"
+
+#include "RingTracer.h"
 #include <chrono>
 
 Q_LOGGING_CATEGORY(trace_app, "trace.app")
@@ -57,6 +59,10 @@ Duration::Duration(const QLoggingCategory& category,
                    uint64_t payload,
                    const QVariantMap& baseArgs) :
     DurationBase(category, name) {
+    // the lightweight ring records every span regardless of whether full tracing is on
+    _ringNameId = tracing::RingTracer::internName(name);
+    tracing::RingTracer::record(_ringNameId, 'B');
+
     if (tracingEnabled() && category.isDebugEnabled()) {
         QVariantMap args = baseArgs;
         args["nv_payload"] = QVariant::fromValue(payload);
@@ -79,6 +85,8 @@ Duration::Duration(const QLoggingCategory& category,
 }
 
 Duration::~Duration() {
+    tracing::RingTracer::record(_ringNameId, 'E');
+
     if (tracingEnabled() && _category.isDebugEnabled()) {
         tracing::traceEvent(_category, _name, tracing::DurationEnd);
 #ifdef NSIGHT_TRACING
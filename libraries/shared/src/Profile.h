@@ -10,6 +10,7 @@
 #ifndef HIFI_PROFILE_
 #define HIFI_PROFILE_
 
+#include "RingTracer.h"
 #include "Trace.h"
 #include "SharedUtil.h"
 
@@ -50,6 +51,11 @@ public:
     Duration(const QLoggingCategory& category, const QString& name, uint32_t argbColor = 0xff0000ff, uint64_t payload = 0, const QVariantMap& args = QVariantMap());
     ~Duration();
 
+private:
+    uint32_t _ringNameId { 0 };
+
+public:
+
     static uint64_t beginRange(const QLoggingCategory& category, const char* name, uint32_t argbColor);
     static void endRange(const QLoggingCategory& category, uint64_t rangeId);
 };
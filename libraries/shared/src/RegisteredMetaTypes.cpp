@@ -22,6 +22,9 @@
 #include <QtGui/QVector3D>
 #include <QtGui/QQuaternion>
 #include <QtNetwork/QAbstractSocket>
+#include <QtCore/QHash>
+#include <QtCore/QPointer>
+#include <QtScript/QScriptString>
 #include <QtScript/QScriptValue>
 #include <QtScript/QScriptValueIterator>
 #include <QJsonDocument>
@@ -74,10 +77,90 @@ void registerMetaTypes(QScriptEngine* engine) {
     qScriptRegisterSequenceMetaType<QVector<unsigned int>>(engine);
 }
 
+// Per-engine flyweight state for the hot value converters: interned property-name handles and
+// the lazily-built prototype objects. Looking the prototype up on the global object and
+// re-interning "x"/"y"/"z" strings on every conversion dominated the marshaling cost for
+// vector-math-heavy scripts.
+namespace {
+
+struct ScriptValueCache {
+    QScriptString xStr, yStr, zStr, wStr;
+    QScriptString redStr, greenStr, blueStr;
+    QScriptValue vec2Prototype;
+    QScriptValue vec3Prototype;
+    QScriptValue vec3ColorPrototype;
+};
+
+ScriptValueCache& getScriptValueCache(QScriptEngine* engine) {
+    struct CacheEntry {
+        // QPointer goes null when the engine dies, so an engine re-allocated at the same
+        // address can never pick up the old engine's handles
+        QPointer<QScriptEngine> alive;
+        std::shared_ptr<ScriptValueCache> cache;
+    };
+    // converters are only ever called on the engine's own thread
+    static thread_local QHash<QScriptEngine*, CacheEntry> caches;
+
+    auto& entry = caches[engine];
+    if (entry.alive.data() != engine) {
+        entry.alive = engine;
+        entry.cache = std::make_shared<ScriptValueCache>();
+        auto& cache = *entry.cache;
+        cache.xStr = engine->toStringHandle("x");
+        cache.yStr = engine->toStringHandle("y");
+        cache.zStr = engine->toStringHandle("z");
+        cache.wStr = engine->toStringHandle("w");
+        cache.redStr = engine->toStringHandle("red");
+        cache.greenStr = engine->toStringHandle("green");
+        cache.blueStr = engine->toStringHandle("blue");
+    }
+    return *entry.cache;
+}
+
+QScriptValue makeVec3(QScriptEngine* engine, ScriptValueCache& cache, const glm::vec3& vec3) {
+    if (!cache.vec3Prototype.isValid()) {
+        cache.vec3Prototype = engine->evaluate(
+            "__hifi_vec3__ = Object.defineProperties({}, { "
+            "defined: { value: true },"
+            "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "1: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "2: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
+            "r: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "g: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "b: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
+            "red: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
+            "})"
+        );
+    }
+    QScriptValue value = engine->newObject();
+    value.setProperty(cache.xStr, vec3.x);
+    value.setProperty(cache.yStr, vec3.y);
+    value.setProperty(cache.zStr, vec3.z);
+    value.setPrototype(cache.vec3Prototype);
+    return value;
+}
+
+QScriptValue makeQuat(QScriptEngine* engine, ScriptValueCache& cache, const glm::quat& quat) {
+    QScriptValue obj = engine->newObject();
+    if (quat.x != quat.x || quat.y != quat.y || quat.z != quat.z || quat.w != quat.w) {
+        // if quat contains a NaN don't try to convert it
+        return obj;
+    }
+    obj.setProperty(cache.xStr, quat.x);
+    obj.setProperty(cache.yStr, quat.y);
+    obj.setProperty(cache.zStr, quat.z);
+    obj.setProperty(cache.wStr, quat.w);
+    return obj;
+}
+
+} // namespace
+
 QScriptValue vec2ToScriptValue(QScriptEngine* engine, const glm::vec2& vec2) {
-    auto prototype = engine->globalObject().property("__hifi_vec2__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& cache = getScriptValueCache(engine);
+    if (!cache.vec2Prototype.isValid()) {
+        cache.vec2Prototype = engine->evaluate(
             "__hifi_vec2__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
@@ -88,9 +171,9 @@ QScriptValue vec2ToScriptValue(QScriptEngine* engine, const glm::vec2& vec2) {
         );
     }
     QScriptValue value = engine->newObject();
-    value.setProperty("x", vec2.x);
-    value.setProperty("y", vec2.y);
-    value.setPrototype(prototype);
+    value.setProperty(cache.xStr, vec2.x);
+    value.setProperty(cache.yStr, vec2.y);
+    value.setPrototype(cache.vec2Prototype);
     return value;
 }
 
@@ -169,35 +252,13 @@ glm::vec2 vec2FromVariant(const QVariant &object) {
 }
 
 QScriptValue vec3ToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_vec3__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
-            "__hifi_vec3__ = Object.defineProperties({}, { "
-            "defined: { value: true },"
-            "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
-            "1: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
-            "2: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
-            "r: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
-            "g: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
-            "b: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
-            "red: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
-            "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
-            "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
-            "})"
-        );
-    }
-    QScriptValue value = engine->newObject();
-    value.setProperty("x", vec3.x);
-    value.setProperty("y", vec3.y);
-    value.setProperty("z", vec3.z);
-    value.setPrototype(prototype);
-    return value;
+    return makeVec3(engine, getScriptValueCache(engine), vec3);
 }
 
 QScriptValue vec3ColorToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_vec3_color__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& cache = getScriptValueCache(engine);
+    if (!cache.vec3ColorPrototype.isValid()) {
+        cache.vec3ColorPrototype = engine->evaluate(
             "__hifi_vec3_color__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
@@ -213,10 +274,10 @@ QScriptValue vec3ColorToScriptValue(QScriptEngine* engine, const glm::vec3& vec3
         );
     }
     QScriptValue value = engine->newObject();
-    value.setProperty("red", vec3.x);
-    value.setProperty("green", vec3.y);
-    value.setProperty("blue", vec3.z);
-    value.setPrototype(prototype);
+    value.setProperty(cache.redStr, vec3.x);
+    value.setProperty(cache.greenStr, vec3.y);
+    value.setProperty(cache.blueStr, vec3.z);
+    value.setPrototype(cache.vec3ColorPrototype);
     return value;
 }
 
@@ -313,10 +374,10 @@ QScriptValue u8vec3ColorToScriptValue(QScriptEngine* engine, const glm::u8vec3&
         );
     }
     QScriptValue value = engine->newObject();
-    value.setProperty("red", vec3.x);
-    value.setProperty("green", vec3.y);
-    value.setProperty("blue", vec3.z);
-    value.setPrototype(prototype);
+    value.setProperty(cache.redStr, vec3.x);
+    value.setProperty(cache.greenStr, vec3.y);
+    value.setProperty(cache.blueStr, vec3.z);
+    value.setPrototype(cache.vec3ColorPrototype);
     return value;
 }
 
@@ -728,9 +789,10 @@ QScriptValue qVectorVec3ColorToScriptValue(QScriptEngine* engine, const QVector<
 }
 
 QScriptValue qVectorVec3ToScriptValue(QScriptEngine* engine, const QVector<glm::vec3>& vector) {
-    QScriptValue array = engine->newArray();
+    auto& cache = getScriptValueCache(engine);
+    QScriptValue array = engine->newArray(vector.size());
     for (int i = 0; i < vector.size(); i++) {
-        array.setProperty(i, vec3ToScriptValue(engine, vector.at(i)));
+        array.setProperty(i, makeVec3(engine, cache, vector.at(i)));
     }
     return array;
 }
@@ -758,16 +820,7 @@ void qVectorVec3FromScriptValue(const QScriptValue& array, QVector<glm::vec3>& v
 }
 
 QScriptValue quatToScriptValue(QScriptEngine* engine, const glm::quat& quat) {
-    QScriptValue obj = engine->newObject();
-    if (quat.x != quat.x || quat.y != quat.y || quat.z != quat.z || quat.w != quat.w) {
-        // if quat contains a NaN don't try to convert it
-        return obj;
-    }
-    obj.setProperty("x", quat.x);
-    obj.setProperty("y", quat.y);
-    obj.setProperty("z", quat.z);
-    obj.setProperty("w", quat.w);
-    return obj;
+    return makeQuat(engine, getScriptValueCache(engine), quat);
 }
 
 void quatFromScriptValue(const QScriptValue& object, glm::quat &quat) {
@@ -843,9 +896,10 @@ QVariant quatToVariant(const glm::quat& quat) {
 }
 
 QScriptValue qVectorQuatToScriptValue(QScriptEngine* engine, const QVector<glm::quat>& vector) {
-    QScriptValue array = engine->newArray();
+    auto& cache = getScriptValueCache(engine);
+    QScriptValue array = engine->newArray(vector.size());
     for (int i = 0; i < vector.size(); i++) {
-        array.setProperty(i, quatToScriptValue(engine, vector.at(i)));
+        array.setProperty(i, makeQuat(engine, cache, vector.at(i)));
     }
     return array;
 }
@@ -1182,11 +1236,44 @@ void Collision::invert() {
     penetration *= -1.0f;
 }
 
+//
+// Interned UUID strings. Entity event dispatch (enter/leave, collisions,
+// pointer events) converts the same few UUIDs to strings and back thousands of
+// times per second; both directions go through a small thread-local cache so
+// the hot path is a hash lookup instead of a format or parse plus allocation.
+// Thread-local keeps the script and main threads lock-free.
+//
+static const int MAX_INTERNED_UUIDS = 512;
+
+static const QString& internedUuidString(const QUuid& uuid) {
+    static thread_local QHash<QUuid, QString> cache;
+    auto it = cache.find(uuid);
+    if (it == cache.end()) {
+        if (cache.size() >= MAX_INTERNED_UUIDS) {
+            cache.clear();
+        }
+        it = cache.insert(uuid, uuid.toString());
+    }
+    return it.value();
+}
+
+static const QUuid& internedUuidFromString(const QString& uuidAsString) {
+    static thread_local QHash<QString, QUuid> cache;
+    auto it = cache.find(uuidAsString);
+    if (it == cache.end()) {
+        if (cache.size() >= MAX_INTERNED_UUIDS) {
+            cache.clear();
+        }
+        it = cache.insert(uuidAsString, QUuid(uuidAsString));
+    }
+    return it.value();
+}
+
 QScriptValue quuidToScriptValue(QScriptEngine* engine, const QUuid& uuid) {
     if (uuid.isNull()) {
         return QScriptValue::NullValue;
     }
-    QScriptValue obj(uuid.toString());
+    QScriptValue obj(internedUuidString(uuid));
     return obj;
 }
 
@@ -1196,8 +1283,7 @@ void quuidFromScriptValue(const QScriptValue& object, QUuid& uuid) {
         return;
     }
     QString uuidAsString = object.toVariant().toString();
-    QUuid fromString(uuidAsString);
-    uuid = fromString;
+    uuid = internedUuidFromString(uuidAsString);
 }
 
 /**jsdoc
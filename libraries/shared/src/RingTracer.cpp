@@ -0,0 +1,159 @@
+//
+//  RingTracer.cpp
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "RingTracer.h"
+
+#include <array>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QThread>
+
+#include "SharedUtil.h"
+
+using namespace tracing;
+
+namespace {
+
+struct ThreadRing {
+    std::array<RingTracer::Entry, RingTracer::RING_SIZE> entries;
+    std::atomic<uint32_t> head { 0 };
+    qint64 threadId { 0 };
+
+    ThreadRing();
+    ~ThreadRing();
+};
+
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::set<ThreadRing*>& ringRegistry() {
+    static std::set<ThreadRing*> registry;
+    return registry;
+}
+
+ThreadRing::ThreadRing() {
+    threadId = (qint64)(intptr_t)QThread::currentThreadId();
+    std::lock_guard<std::mutex> lock(registryMutex());
+    ringRegistry().insert(this);
+}
+
+ThreadRing::~ThreadRing() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    ringRegistry().erase(this);
+}
+
+thread_local ThreadRing tlsRing;
+
+std::mutex& nameMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<QString>& nameTable() {
+    static std::vector<QString> names { QString() }; // id 0 reserved as invalid
+    return names;
+}
+
+QHash<QString, uint32_t>& nameIds() {
+    static QHash<QString, uint32_t> ids;
+    return ids;
+}
+
+}
+
+uint32_t RingTracer::internName(const QString& name) {
+    // per-thread cache keeps the steady-state cost to one hash lookup, no lock
+    static thread_local QHash<QString, uint32_t> localCache;
+    auto cached = localCache.constFind(name);
+    if (cached != localCache.constEnd()) {
+        return cached.value();
+    }
+
+    uint32_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(nameMutex());
+        auto it = nameIds().constFind(name);
+        if (it != nameIds().constEnd()) {
+            id = it.value();
+        } else {
+            id = (uint32_t)nameTable().size();
+            nameTable().push_back(name);
+            nameIds().insert(name, id);
+        }
+    }
+    localCache.insert(name, id);
+    return id;
+}
+
+void RingTracer::record(uint32_t nameId, char phase) {
+    auto& ring = tlsRing;
+    auto slot = ring.head.fetch_add(1, std::memory_order_relaxed) & (RING_SIZE - 1);
+    auto& entry = ring.entries[slot];
+    entry.nameId = nameId;
+    entry.phase = phase;
+    entry.timestampUsecs = usecTimestampNow();
+}
+
+bool RingTracer::dump(const QString& filePath, float windowSecs) {
+    uint64_t cutoff = usecTimestampNow() - (uint64_t)(windowSecs * (float)USECS_PER_SECOND);
+
+    QJsonArray events;
+    std::vector<QString> names;
+    {
+        std::lock_guard<std::mutex> lock(nameMutex());
+        names = nameTable();
+    }
+
+    {
+        // entry reads race with writers by design - a torn diagnostic entry is filtered by the
+        // cutoff/name checks and costs nothing, while the recording path stays lock-free
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (auto* ring : ringRegistry()) {
+            uint32_t head = ring->head.load(std::memory_order_acquire);
+            uint32_t count = std::min(head, RING_SIZE);
+            for (uint32_t i = 0; i < count; i++) {
+                // oldest-first within the retained window
+                const auto& entry = ring->entries[(head - count + i) & (RING_SIZE - 1)];
+                if (entry.nameId == INVALID_NAME_ID || entry.nameId >= names.size()
+                        || entry.timestampUsecs < cutoff || (entry.phase != 'B' && entry.phase != 'E')) {
+                    continue;
+                }
+                QJsonObject event;
+                event["name"] = names[entry.nameId];
+                event["ph"] = QString(QChar(entry.phase));
+                event["ts"] = (qint64)entry.timestampUsecs;
+                event["pid"] = 1;
+                event["tid"] = ring->threadId;
+                event["cat"] = QStringLiteral("ring");
+                events.append(event);
+            }
+        }
+    }
+
+    QJsonObject root;
+    root["traceEvents"] = events;
+
+    QFile file { filePath };
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    return true;
+}
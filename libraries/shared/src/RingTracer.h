@@ -0,0 +1,49 @@
+//
+//  RingTracer.h
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_RingTracer_h
+#define hifi_RingTracer_h
+
+#include <atomic>
+#include <cstdint>
+
+#include <QtCore/QString>
+
+namespace tracing {
+
+// Always-on lightweight span recorder. Every PROFILE_RANGE writes begin/end entries - an
+// interned name id, a phase byte and a timestamp - into a fixed per-thread ring through a
+// relaxed counter: no locks, no allocation, cheap enough to leave enabled in production. When a
+// user reports a hitch, dump() snapshots every live thread's ring and writes the last N seconds
+// as a chrome-trace JSON file, so "it stuttered" arrives as an actionable trace.
+class RingTracer {
+public:
+    static const uint32_t RING_SIZE = 16384; // entries per thread, power of two
+    static const uint32_t INVALID_NAME_ID = 0;
+
+    struct Entry {
+        uint32_t nameId { INVALID_NAME_ID };
+        char phase { 0 }; // 'B' or 'E'
+        uint64_t timestampUsecs { 0 };
+    };
+
+    // interns the name once; the returned id is what the hot path records
+    static uint32_t internName(const QString& name);
+
+    static void record(uint32_t nameId, char phase);
+
+    // writes the last windowSecs seconds of every thread's ring as chrome-trace JSON
+    static bool dump(const QString& filePath, float windowSecs);
+};
+
+}
+
+#endif // hifi_RingTracer_h
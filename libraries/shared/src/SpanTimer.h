@@ -0,0 +1,120 @@
+//
+//  SpanTimer.h
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SpanTimer_h
+#define hifi_SpanTimer_h
+
+#include <stdint.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+
+#include "SharedUtil.h"
+
+//
+// Always-on, low-overhead span instrumentation.
+//
+// A SpanTimer accumulates call count, total time and a coarse log2 duration
+// histogram into relaxed atomics; SpanTimer::Scope records one span on scope
+// exit. The cost per span is two clock reads and a few relaxed atomic adds,
+// cheap enough to leave enabled in production - unlike the trace-event
+// profiler, which must be switched on and records individual events.
+//
+// Timers register themselves in a global list, so servers can report every
+// span in their stats without knowing about individual call sites:
+//
+//      static SpanTimer entityEncodeSpan("entityEncode");
+//      ...
+//      SpanTimer::Scope scope(entityEncodeSpan);
+//
+class SpanTimer {
+public:
+    static const int NUM_DURATION_BUCKETS = 20;     // log2 buckets: 1us .. ~0.5s
+
+    SpanTimer(const char* name) : _name(name) {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(this);
+    }
+
+    const char* getName() const { return _name; }
+
+    void record(quint64 usecs) {
+        _count.fetch_add(1, std::memory_order_relaxed);
+        _totalUsecs.fetch_add(usecs, std::memory_order_relaxed);
+
+        int bucket = 0;
+        while (usecs > 1 && bucket < NUM_DURATION_BUCKETS - 1) {
+            usecs >>= 1;
+            ++bucket;
+        }
+        _buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // stats snapshot of this span: count, total, average and slow-call tallies
+    QJsonObject getStats() const {
+        quint64 count = _count.load(std::memory_order_relaxed);
+        quint64 total = _totalUsecs.load(std::memory_order_relaxed);
+
+        // calls of 2^14 usecs (~16ms) and up count as slow
+        const int SLOW_BUCKET = 14;
+        quint64 slow = 0;
+        for (int i = SLOW_BUCKET; i < NUM_DURATION_BUCKETS; ++i) {
+            slow += _buckets[i].load(std::memory_order_relaxed);
+        }
+
+        QJsonObject stats;
+        stats["calls"] = (double)count;
+        stats["totalUsecs"] = (double)total;
+        stats["averageUsecs"] = count ? (double)total / (double)count : 0.0;
+        stats["slowCalls"] = (double)slow;
+        return stats;
+    }
+
+    // stats for every registered span, keyed by span name
+    static QJsonObject getAllSpanStats() {
+        QJsonObject allStats;
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (const SpanTimer* timer : registry()) {
+            allStats[timer->getName()] = timer->getStats();
+        }
+        return allStats;
+    }
+
+    class Scope {
+    public:
+        Scope(SpanTimer& timer) : _timer(timer), _start(usecTimestampNow()) {}
+        ~Scope() { _timer.record(usecTimestampNow() - _start); }
+
+    private:
+        SpanTimer& _timer;
+        quint64 _start;
+    };
+
+private:
+    static std::vector<SpanTimer*>& registry() {
+        static std::vector<SpanTimer*> timers;
+        return timers;
+    }
+    static std::mutex& registryMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    const char* _name;
+    std::atomic<quint64> _count { 0 };
+    std::atomic<quint64> _totalUsecs { 0 };
+    std::atomic<quint64> _buckets[NUM_DURATION_BUCKETS] {};
+};
+
+#endif // hifi_SpanTimer_h
@@ -18,6 +18,8 @@
 #include "StreamUtils.h"
 #include "SharedLogging.h"
 
+std::atomic<uint64_t> SpatiallyNestable::_worldTransformEpoch { 1 };
+
 const float defaultAACubeSize = 1.0f;
 const int MAX_PARENTING_CHAIN_SIZE = 30;
 
@@ -67,6 +69,7 @@ const QUuid SpatiallyNestable::getParentID() const {
 }
 
 void SpatiallyNestable::setParentID(const QUuid& parentID) {
+    bumpWorldTransformEpoch();
     bumpAncestorChainRenderableVersion();
     bool success = false;
     auto parent = getParentPointer(success);
@@ -183,6 +186,7 @@ void SpatiallyNestable::forgetChild(SpatiallyNestablePointer newChild) const {
 }
 
 void SpatiallyNestable::setParentJointIndex(quint16 parentJointIndex) {
+    bumpWorldTransformEpoch();
     _parentJointIndex = parentJointIndex;
     bool success = false;
     auto parent = getParentPointer(success);
@@ -745,12 +749,37 @@ glm::vec3 SpatiallyNestable::getParentAngularVelocity(bool& success) const {
 }
 
 const Transform SpatiallyNestable::getTransform(bool& success, int depth) const {
+    // world transforms are stable between any two epoch bumps (every transform mutation and
+    // joint-pose commit bumps), so repeated queries within a frame collapse to a cache read and
+    // chain walks terminate at the first cached ancestor
+    uint64_t epoch = _worldTransformEpoch.load(std::memory_order_acquire);
+    {
+        bool cacheHit = false;
+        Transform cached;
+        _worldTransformCacheLock.withReadLock([&] {
+            if (_cachedWorldTransformEpoch == epoch) {
+                cacheHit = true;
+                cached = _cachedWorldTransform;
+                success = _cachedWorldTransformSuccess;
+            }
+        });
+        if (cacheHit) {
+            return cached;
+        }
+    }
+
     Transform result;
     // return a world-space transform for this object's location
     Transform parentTransform = getParentTransform(success, depth);
     _transformLock.withReadLock([&] {
         Transform::mult(result, parentTransform, _transform);
     });
+
+    _worldTransformCacheLock.withWriteLock([&] {
+        _cachedWorldTransform = result;
+        _cachedWorldTransformSuccess = success;
+        _cachedWorldTransformEpoch = epoch;
+    });
     return result;
 }
 
@@ -875,6 +904,7 @@ void SpatiallyNestable::setSNScale(const glm::vec3& scale, bool& success) {
         }
     });
     if (success && changed) {
+        bumpWorldTransformEpoch();
         dimensionsChanged();
     }
 }
@@ -1016,6 +1046,7 @@ void SpatiallyNestable::setLocalSNScale(const glm::vec3& scale) {
         }
     });
     if (changed) {
+        bumpWorldTransformEpoch();
         dimensionsChanged();
     }
 }
@@ -1115,6 +1146,7 @@ void SpatiallyNestable::forEachDescendantTest(const ChildLambdaTest& actor) cons
 }
 
 void SpatiallyNestable::locationChanged(bool tellPhysics, bool tellChildren) {
+    bumpWorldTransformEpoch();
     if (tellChildren) {
         forEachChild([&](SpatiallyNestablePointer object) {
             object->locationChanged(tellPhysics, tellChildren);
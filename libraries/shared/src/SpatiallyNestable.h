@@ -12,6 +12,7 @@
 #ifndef hifi_SpatiallyNestable_h
 #define hifi_SpatiallyNestable_h
 
+#include <atomic>
 #include <QUuid>
 
 #include "Transform.h"
@@ -35,6 +36,9 @@ enum class NestableType {
 
 class SpatiallyNestable : public std::enable_shared_from_this<SpatiallyNestable> {
 public:
+    // invalidates every cached world transform; called by transform setters and joint-pose commits
+    static void bumpWorldTransformEpoch() { _worldTransformEpoch.fetch_add(1, std::memory_order_release); }
+
     SpatiallyNestable(NestableType nestableType, QUuid id);
     virtual ~SpatiallyNestable();
 
@@ -254,6 +258,17 @@ private:
     quint16 _parentJointIndex { INVALID_JOINT_INDEX }; // which joint of the parent is this relative to?
 
     mutable ReadWriteLockable _transformLock;
+
+    // Epoch-tagged world-transform cache: every transform mutation anywhere (and every avatar
+    // joint-pose commit, since objects can be parented to joints) bumps the global epoch, so a
+    // cached world transform is valid exactly until anything in the app moves. Repeated queries
+    // within a frame collapse to a cache read, and parent-chain walks stop at the first cached
+    // ancestor.
+    static std::atomic<uint64_t> _worldTransformEpoch;
+    mutable ReadWriteLockable _worldTransformCacheLock;
+    mutable Transform _cachedWorldTransform;
+    mutable uint64_t _cachedWorldTransformEpoch { 0 };
+    mutable bool _cachedWorldTransformSuccess { false };
     mutable ReadWriteLockable _idLock;
     mutable ReadWriteLockable _velocityLock;
     mutable ReadWriteLockable _angularVelocityLock;
@@ -207,17 +207,16 @@ bool TriangleSet::TriangleTreeCell::findRayIntersectionInternal(const glm::vec3&
     Triangle bestTriangle;
 
     if (precision) {
-        for (const auto& triangleIndex : _triangleIndices) {
-            const auto& thisTriangle = _allTriangles[triangleIndex];
-            float thisTriangleDistance;
-            trianglesTouched++;
-            if (findRayTriangleIntersection(origin, direction, thisTriangle, thisTriangleDistance, allowBackface)) {
-                if (thisTriangleDistance < bestDistance) {
-                    bestDistance = thisTriangleDistance;
-                    bestTriangle = thisTriangle;
-                    intersectedSomething = true;
-                }
-            }
+        // all of this cell's triangles go through the batched SIMD kernel in one call
+        trianglesTouched += (int)_triangleIndices.size();
+        float batchDistance;
+        int batchBest = findRayTriangleBatchIntersection(origin, direction, _allTriangles.data(),
+                                                         _triangleIndices.data(), (int)_triangleIndices.size(),
+                                                         batchDistance, allowBackface);
+        if (batchBest >= 0 && batchDistance < bestDistance) {
+            bestDistance = batchDistance;
+            bestTriangle = _allTriangles[_triangleIndices[batchBest]];
+            intersectedSomething = true;
         }
     } else {
         intersectedSomething = true;
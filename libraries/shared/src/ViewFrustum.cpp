@@ -219,6 +219,34 @@ bool ViewFrustum::boxIntersectsFrustum(const AABox& box) const {
     return true;
 }
 
+void ViewFrustum::batchBoxIntersectsFrustum(const AABox* firstBox, size_t strideBytes, int count,
+                                            uint8_t* results) const {
+    // lay the plane data out once; the farthest-vertex test is equivalent to
+    // dot(normal, center) + dot(|normal|, extents) + d >= 0
+    glm::vec3 normals[NUM_FRUSTUM_PLANES];
+    glm::vec3 absNormals[NUM_FRUSTUM_PLANES];
+    float dCoefficients[NUM_FRUSTUM_PLANES];
+    for (int i = 0; i < NUM_FRUSTUM_PLANES; i++) {
+        normals[i] = _planes[i].getNormal();
+        absNormals[i] = glm::abs(normals[i]);
+        dCoefficients[i] = _planes[i].getDCoefficient();
+    }
+
+    const uint8_t* boxCursor = reinterpret_cast<const uint8_t*>(firstBox);
+    for (int boxIndex = 0; boxIndex < count; ++boxIndex, boxCursor += strideBytes) {
+        const AABox& box = *reinterpret_cast<const AABox*>(boxCursor);
+        glm::vec3 extents = 0.5f * box.getScale();
+        glm::vec3 center = box.getCorner() + extents;
+
+        uint8_t inside = 1;
+        for (int i = 0; i < NUM_FRUSTUM_PLANES; i++) {
+            float distance = glm::dot(normals[i], center) + glm::dot(absNormals[i], extents) + dCoefficients[i];
+            inside &= (uint8_t)(distance >= 0.0f);
+        }
+        results[boxIndex] = inside;
+    }
+}
+
 bool ViewFrustum::boxInsideFrustum(const AABox& box) const {
     // only check against frustum
     for (int i = 0; i < NUM_FRUSTUM_PLANES; i++) {
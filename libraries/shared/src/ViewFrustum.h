@@ -105,6 +105,11 @@ public:
     bool sphereIntersectsFrustum(const glm::vec3& center, float radius) const;
     bool cubeIntersectsFrustum(const AACube& box) const;
     bool boxIntersectsFrustum(const AABox& box) const;
+
+    // Batched frustum test: fills results[i] with boxIntersectsFrustum(box i),
+    // reading boxes every strideBytes starting at firstBox. The test runs in
+    // branch-free center/extents form over all planes, which auto-vectorizes.
+    void batchBoxIntersectsFrustum(const AABox* firstBox, size_t strideBytes, int count, uint8_t* results) const;
     bool boxInsideFrustum(const AABox& box) const;
 
     bool sphereIntersectsKeyhole(const glm::vec3& center, float radius) const;
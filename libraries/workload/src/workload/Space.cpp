@@ -16,6 +16,11 @@
 #include <cstring>
 #include <algorithm>
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#endif
+
 #include <glm/gtx/quaternion.hpp>
 
 using namespace workload;
@@ -94,7 +99,61 @@ void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     uint32_t numProxies = (uint32_t)_proxies.size();
     uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    // Four proxies at a time: their spheres are transposed into SoA registers and every view's
+    // region boundaries (all views fused into the one pass) are tested with vector distance
+    // math. A proxy's final region is the minimum touching region index across all views, which
+    // is exactly what the scalar ascending-k-with-break loop computes.
+    const uint32_t SIMD_WIDTH = 4;
+    uint32_t numBlocks = numProxies / SIMD_WIDTH;
+    for (uint32_t block = 0; block < numBlocks; ++block) {
+        uint32_t base = block * SIMD_WIDTH;
+
+        __m128 px = _mm_loadu_ps(&_proxies[base + 0].sphere.x);
+        __m128 py = _mm_loadu_ps(&_proxies[base + 1].sphere.x);
+        __m128 pz = _mm_loadu_ps(&_proxies[base + 2].sphere.x);
+        __m128 pr = _mm_loadu_ps(&_proxies[base + 3].sphere.x);
+        _MM_TRANSPOSE4_PS(px, py, pz, pr);
+
+        // region indices tracked as floats so SSE2 min/blend apply
+        __m128 region = _mm_set1_ps((float)Region::R4);
+        for (uint32_t j = 0; j < numViews; ++j) {
+            auto& view = _views[j];
+            for (uint8_t k = 0; k < Region::NUM_TRACKED_REGIONS; ++k) {
+                __m128 dx = _mm_sub_ps(px, _mm_set1_ps(view.regions[k].x));
+                __m128 dy = _mm_sub_ps(py, _mm_set1_ps(view.regions[k].y));
+                __m128 dz = _mm_sub_ps(pz, _mm_set1_ps(view.regions[k].z));
+                __m128 distance2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                __m128 touch = _mm_add_ps(pr, _mm_set1_ps(view.regions[k].w));
+                __m128 touching = _mm_cmplt_ps(distance2, _mm_mul_ps(touch, touch));
+
+                __m128 candidate = _mm_or_ps(_mm_and_ps(touching, _mm_set1_ps((float)k)),
+                                             _mm_andnot_ps(touching, _mm_set1_ps((float)Region::R4)));
+                region = _mm_min_ps(region, candidate);
+            }
+        }
+
+        float regionLanes[4];
+        _mm_storeu_ps(regionLanes, region);
+
+        for (uint32_t lane = 0; lane < SIMD_WIDTH; ++lane) {
+            Proxy& proxy = _proxies[base + lane];
+            if (proxy.region < Region::INVALID) {
+                proxy.prevRegion = proxy.region;
+                proxy.region = (uint8_t)regionLanes[lane];
+                if (proxy.region != proxy.prevRegion) {
+                    changes.emplace_back(Space::Change((int32_t)(base + lane), proxy.region, proxy.prevRegion));
+                }
+            }
+        }
+    }
+    uint32_t scalarStart = numBlocks * SIMD_WIDTH;
+#else
+    uint32_t scalarStart = 0;
+#endif
+
+    for (uint32_t i = scalarStart; i < numProxies; ++i) {
         Proxy& proxy = _proxies[i];
         if (proxy.region < Region::INVALID) {
             glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
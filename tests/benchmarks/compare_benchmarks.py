@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+#  compare_benchmarks.py
+#  tests/benchmarks
+#
+#  Created by High Fidelity on 9/2/26.
+#  Copyright 2026 High Fidelity, Inc.
+#
+#  Distributed under the Apache License, Version 2.0.
+#  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+#
+# Compares two KernelBenchmarks CSV result files (produced with `benchmarks-KernelBenchmarks
+# -csv results.csv`) and fails when any benchmark regressed beyond the threshold. Intended
+# usage on a performance-labeled PR:
+#
+#   ./benchmarks-KernelBenchmarks -csv before.csv   # on the base commit
+#   ./benchmarks-KernelBenchmarks -csv after.csv    # on the PR
+#   python3 tests/benchmarks/compare_benchmarks.py before.csv after.csv --threshold 5
+
+import argparse
+import csv
+import sys
+
+
+def load_results(path):
+    # QtTest benchmark CSV rows: function, tag, metric-name, value-per-iteration, iterations
+    results = {}
+    with open(path, newline='') as f:
+        for row in csv.reader(f):
+            if len(row) < 4:
+                continue
+            name = row[0].strip('"')
+            try:
+                value = float(row[3])
+            except ValueError:
+                continue
+            results[name] = value
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two benchmark CSV result files.')
+    parser.add_argument('before')
+    parser.add_argument('after')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='allowed regression in percent before failing (default 5)')
+    args = parser.parse_args()
+
+    before = load_results(args.before)
+    after = load_results(args.after)
+
+    regressions = []
+    print('{:<40} {:>12} {:>12} {:>9}'.format('benchmark', 'before', 'after', 'delta'))
+    for name in sorted(set(before) | set(after)):
+        if name not in before or name not in after:
+            print('{:<40} {:>12} {:>12} {:>9}'.format(
+                name, before.get(name, '-'), after.get(name, '-'), 'n/a'))
+            continue
+        delta = (after[name] - before[name]) / before[name] * 100.0 if before[name] else 0.0
+        print('{:<40} {:>12.4f} {:>12.4f} {:>+8.1f}%'.format(name, before[name], after[name], delta))
+        if delta > args.threshold:
+            regressions.append((name, delta))
+
+    if regressions:
+        print('\nFAIL: {} benchmark(s) regressed beyond {}%:'.format(len(regressions), args.threshold))
+        for name, delta in regressions:
+            print('  {} (+{:.1f}%)'.format(name, delta))
+        return 1
+
+    print('\nOK: no benchmark regressed beyond {}%'.format(args.threshold))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,155 @@
+//
+//  KernelBenchmarks.cpp
+//  tests/benchmarks/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "KernelBenchmarks.h"
+
+#include <cmath>
+#include <vector>
+
+#include <AudioConstants.h>
+#include <AudioHRTF.h>
+#include <AudioSRC.h>
+#include <AnimPose.h>
+#include <GLMHelpers.h>
+#include <ByteCountCoding.h>
+#include <udt/LossList.h>
+
+using namespace udt;
+
+QTEST_MAIN(KernelBenchmarks)
+
+static const int FRAME = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+
+// deterministic pseudo-noise input so every run measures identical work
+static void fillNoise(float* buffer, int count) {
+    uint32_t state = 0x12345678;
+    for (int i = 0; i < count; i++) {
+        state = state * 1664525 + 1013904223;
+        buffer[i] = (int32_t)state * (1.0f / (float)INT32_MAX) * 0.25f;
+    }
+}
+
+void KernelBenchmarks::benchmarkHrtfRender() {
+    AudioHRTF hrtf;
+    std::vector<int16_t> input(FRAME);
+    std::vector<float> output(2 * FRAME, 0.0f);
+    for (int i = 0; i < FRAME; i++) {
+        input[i] = (int16_t)(8192.0f * sinf(i * 0.1f));
+    }
+
+    float azimuth = 0.0f;
+    QBENCHMARK {
+        hrtf.render(input.data(), output.data(), 0, azimuth, 1.0f, 1.0f, FRAME);
+        azimuth += 0.01f;
+    }
+}
+
+void KernelBenchmarks::benchmarkHrtfBatchRender() {
+    const int NUM_SOURCES = 16;
+    std::vector<AudioHRTF> hrtfs(NUM_SOURCES);
+    std::vector<std::vector<int16_t>> inputs(NUM_SOURCES, std::vector<int16_t>(FRAME));
+    std::vector<float> output(2 * FRAME, 0.0f);
+    for (int s = 0; s < NUM_SOURCES; s++) {
+        for (int i = 0; i < FRAME; i++) {
+            inputs[s][i] = (int16_t)(4096.0f * sinf(i * 0.05f * (s + 1)));
+        }
+    }
+
+    QBENCHMARK {
+        std::vector<AudioHRTF::BatchedSource> batch;
+        batch.reserve(NUM_SOURCES);
+        for (int s = 0; s < NUM_SOURCES; s++) {
+            batch.push_back({ &hrtfs[s], inputs[s].data(), 0.1f * s, 1.0f, 1.0f });
+        }
+        AudioHRTF::renderBatch(batch.data(), (int)batch.size(), output.data(), 0, FRAME);
+    }
+}
+
+void KernelBenchmarks::benchmarkAudioSrcRender() {
+    AudioSRC src(44100, 48000, 1);
+    const int INPUT_FRAMES = 512;
+    std::vector<float> input(INPUT_FRAMES);
+    std::vector<float> output(2 * INPUT_FRAMES);
+    fillNoise(input.data(), INPUT_FRAMES);
+
+    float* inputs[1] = { input.data() };
+    float* outputs[1] = { output.data() };
+    QBENCHMARK {
+        src.render(inputs, outputs, INPUT_FRAMES);
+    }
+}
+
+void KernelBenchmarks::benchmarkLossListInsertRemove() {
+    QBENCHMARK {
+        LossList lossList;
+        // sparse appends with merges, as produced by bursty loss
+        for (int i = 0; i < 2000; i += 2) {
+            lossList.append(SequenceNumber(i));
+        }
+        for (int i = 1; i < 2000; i += 4) {
+            lossList.insert(SequenceNumber(i), SequenceNumber(i));
+        }
+        for (int i = 0; i < 2000; i += 3) {
+            lossList.remove(SequenceNumber(i));
+        }
+    }
+}
+
+void KernelBenchmarks::benchmarkAnimPoseMultiply() {
+    const int NUM_JOINTS = 128;
+    std::vector<AnimPose> parents(NUM_JOINTS);
+    std::vector<AnimPose> locals(NUM_JOINTS);
+    std::vector<AnimPose> results(NUM_JOINTS);
+    for (int i = 0; i < NUM_JOINTS; i++) {
+        parents[i] = AnimPose(glm::vec3(1.0f), glm::angleAxis(0.01f * i, Vectors::UNIT_Y), glm::vec3(0.1f * i, 1.0f, 0.0f));
+        locals[i] = AnimPose(glm::vec3(1.0f), glm::angleAxis(0.02f * i, Vectors::UNIT_X), glm::vec3(0.0f, 0.1f * i, 0.0f));
+    }
+
+    QBENCHMARK {
+        for (int i = 0; i < NUM_JOINTS; i++) {
+            results[i] = parents[i] * locals[i];
+        }
+    }
+}
+
+void KernelBenchmarks::benchmarkQuatPackSixBytes() {
+    const int NUM_QUATS = 256;
+    std::vector<glm::quat> rotations(NUM_QUATS);
+    std::vector<unsigned char> packed(NUM_QUATS * 6);
+    for (int i = 0; i < NUM_QUATS; i++) {
+        rotations[i] = glm::normalize(glm::quat(1.0f, 0.01f * i, 0.02f * i, 0.03f * i));
+    }
+
+    QBENCHMARK {
+        unsigned char* cursor = packed.data();
+        for (int i = 0; i < NUM_QUATS; i++) {
+            cursor += packOrientationQuatToSixBytes(cursor, rotations[i]);
+        }
+    }
+}
+
+void KernelBenchmarks::benchmarkByteCountCoding() {
+    const int NUM_VALUES = 1024;
+    std::vector<quint64> values(NUM_VALUES);
+    for (int i = 0; i < NUM_VALUES; i++) {
+        values[i] = (quint64)i * 2654435761u;
+    }
+
+    QBENCHMARK {
+        char buffer[ByteCountCoded<quint64>::MAX_ENCODED_BYTES];
+        size_t total = 0;
+        for (int i = 0; i < NUM_VALUES; i++) {
+            ByteCountCoded<quint64> coder(values[i]);
+            total += coder.encodeToBuffer(buffer, (int)sizeof(buffer));
+        }
+        Q_UNUSED(total);
+    }
+}
@@ -0,0 +1,33 @@
+//
+//  KernelBenchmarks.h
+//  tests/benchmarks/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_KernelBenchmarks_h
+#define hifi_KernelBenchmarks_h
+
+#include <QtTest/QtTest>
+
+// Microbenchmarks over the proven hot kernels, one QBENCHMARK per slot so Qt's iteration
+// harness stabilizes each measurement independently. Run with `-csv <file>` to get
+// machine-readable results for compare_benchmarks.py.
+class KernelBenchmarks : public QObject {
+    Q_OBJECT
+
+private slots:
+    void benchmarkHrtfRender();
+    void benchmarkHrtfBatchRender();
+    void benchmarkAudioSrcRender();
+    void benchmarkLossListInsertRemove();
+    void benchmarkAnimPoseMultiply();
+    void benchmarkQuatPackSixBytes();
+    void benchmarkByteCountCoding();
+};
+
+#endif // hifi_KernelBenchmarks_h
@@ -0,0 +1,179 @@
+//
+//  PhysicsBenchmarkTests.cpp
+//  tests/physics/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsBenchmarkTests.h"
+
+#include <functional>
+#include <memory>
+
+#include <btBulletDynamicsCommon.h>
+
+QTEST_MAIN(PhysicsBenchmarkTests)
+
+const btScalar FIXED_SUBSTEP = 1.0f / 90.0f;
+
+// A self-contained deterministic Bullet world: fixed substeps, fixed insertion
+// order, no real-time clocks anywhere in the scene setup.
+class BenchmarkWorld {
+public:
+    BenchmarkWorld() {
+        _collisionConfig = new btDefaultCollisionConfiguration();
+        _dispatcher = new btCollisionDispatcher(_collisionConfig);
+        _broadphase = new btDbvtBroadphase();
+        _solver = new btSequentialImpulseConstraintSolver();
+        _world = new btDiscreteDynamicsWorld(_dispatcher, _broadphase, _solver, _collisionConfig);
+        _world->setGravity(btVector3(0.0f, -9.8f, 0.0f));
+
+        // static ground plane
+        addBody(0.0f, new btStaticPlaneShape(btVector3(0.0f, 1.0f, 0.0f), 0.0f), btVector3(0.0f, 0.0f, 0.0f));
+    }
+
+    ~BenchmarkWorld() {
+        for (int i = _world->getNumCollisionObjects() - 1; i >= 0; --i) {
+            btCollisionObject* object = _world->getCollisionObjectArray()[i];
+            _world->removeCollisionObject(object);
+            delete btRigidBody::upcast(object)->getMotionState();
+            delete object;
+        }
+        for (auto* shape : _shapes) {
+            delete shape;
+        }
+        delete _world;
+        delete _solver;
+        delete _broadphase;
+        delete _dispatcher;
+        delete _collisionConfig;
+    }
+
+    void addBody(btScalar mass, btCollisionShape* shape, const btVector3& position) {
+        _shapes.push_back(shape);
+        btVector3 inertia(0.0f, 0.0f, 0.0f);
+        if (mass > 0.0f) {
+            shape->calculateLocalInertia(mass, inertia);
+        }
+        btTransform transform;
+        transform.setIdentity();
+        transform.setOrigin(position);
+        btMotionState* motionState = new btDefaultMotionState(transform);
+        btRigidBody* body = new btRigidBody(btRigidBody::btRigidBodyConstructionInfo(mass, motionState, shape, inertia));
+        _world->addRigidBody(body);
+    }
+
+    void step(int numSteps) {
+        for (int i = 0; i < numSteps; ++i) {
+            _world->stepSimulation(FIXED_SUBSTEP, 0, FIXED_SUBSTEP);
+        }
+    }
+
+    // order-sensitive hash over every body's final transform, quantized to
+    // tolerate last-bit float formatting but nothing physical
+    uint64_t stateHash() const {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](int64_t value) {
+            hash ^= (uint64_t)value;
+            hash *= 1099511628211ull;
+        };
+        const btScalar QUANTUM = 1.0e-5f;
+        for (int i = 0; i < _world->getNumCollisionObjects(); ++i) {
+            const btTransform& transform = _world->getCollisionObjectArray()[i]->getWorldTransform();
+            for (int axis = 0; axis < 3; ++axis) {
+                mix((int64_t)(transform.getOrigin()[axis] / QUANTUM));
+            }
+            btQuaternion rotation = transform.getRotation();
+            for (int component = 0; component < 4; ++component) {
+                mix((int64_t)(rotation[component] / QUANTUM));
+            }
+        }
+        return hash;
+    }
+
+private:
+    btDefaultCollisionConfiguration* _collisionConfig;
+    btCollisionDispatcher* _dispatcher;
+    btDbvtBroadphase* _broadphase;
+    btSequentialImpulseConstraintSolver* _solver;
+    btDiscreteDynamicsWorld* _world;
+    std::vector<btCollisionShape*> _shapes;
+};
+
+// deterministic xorshift for scene jitter
+static uint32_t randState = 0;
+static float seededUnitFloat() {
+    randState ^= randState << 13;
+    randState ^= randState >> 17;
+    randState ^= randState << 5;
+    return (randState >> 8) * (1.0f / (1 << 24));
+}
+
+static void buildBoxStackScene(BenchmarkWorld& world) {
+    randState = 0x5EED0001;
+    const int STACK_HEIGHT = 10;
+    const int NUM_STACKS = 9;
+    for (int s = 0; s < NUM_STACKS; ++s) {
+        float x = (s % 3 - 1) * 3.0f;
+        float z = (s / 3 - 1) * 3.0f;
+        for (int h = 0; h < STACK_HEIGHT; ++h) {
+            btVector3 position(x + 0.01f * seededUnitFloat(), 0.5f + (float)h, z + 0.01f * seededUnitFloat());
+            world.addBody(1.0f, new btBoxShape(btVector3(0.45f, 0.45f, 0.45f)), position);
+        }
+    }
+}
+
+static void buildSpherePileScene(BenchmarkWorld& world) {
+    randState = 0x5EED0002;
+    const int NUM_SPHERES = 200;
+    for (int i = 0; i < NUM_SPHERES; ++i) {
+        btVector3 position(4.0f * (seededUnitFloat() - 0.5f),
+                           1.0f + 4.0f * seededUnitFloat(),
+                           4.0f * (seededUnitFloat() - 0.5f));
+        world.addBody(0.5f, new btSphereShape(0.3f), position);
+    }
+}
+
+static uint64_t runScene(std::function<void(BenchmarkWorld&)> buildScene, int numSteps) {
+    BenchmarkWorld world;
+    buildScene(world);
+    world.step(numSteps);
+    return world.stateHash();
+}
+
+void PhysicsBenchmarkTests::boxStackSceneIsDeterministic() {
+    // two independent runs of the same seeded scene must agree bit-for-bit;
+    // a divergence means a simulation change is not deterministic (or altered
+    // behavior and the benchmark baselines need re-reading)
+    const int NUM_STEPS = 300;
+    uint64_t firstRun = runScene(buildBoxStackScene, NUM_STEPS);
+    uint64_t secondRun = runScene(buildBoxStackScene, NUM_STEPS);
+    QCOMPARE(firstRun, secondRun);
+}
+
+void PhysicsBenchmarkTests::spherePileSceneIsDeterministic() {
+    const int NUM_STEPS = 300;
+    uint64_t firstRun = runScene(buildSpherePileScene, NUM_STEPS);
+    uint64_t secondRun = runScene(buildSpherePileScene, NUM_STEPS);
+    QCOMPARE(firstRun, secondRun);
+}
+
+void PhysicsBenchmarkTests::benchmarkBoxStackScene() {
+    BenchmarkWorld world;
+    buildBoxStackScene(world);
+    QBENCHMARK_ONCE {
+        world.step(300);
+    }
+}
+
+void PhysicsBenchmarkTests::benchmarkSpherePileScene() {
+    BenchmarkWorld world;
+    buildSpherePileScene(world);
+    QBENCHMARK_ONCE {
+        world.step(300);
+    }
+}
@@ -0,0 +1,30 @@
+//
+//  PhysicsBenchmarkTests.h
+//  tests/physics/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsBenchmarkTests_h
+#define hifi_PhysicsBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+// Deterministic benchmark scenes stepped on a raw Bullet world: each scene is
+// seeded and fixed-stepped, so the final state hash gates against simulation
+// regressions and the per-step timings are comparable run to run.
+class PhysicsBenchmarkTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void boxStackSceneIsDeterministic();
+    void spherePileSceneIsDeterministic();
+    void benchmarkBoxStackScene();
+    void benchmarkSpherePileScene();
+};
+
+#endif // hifi_PhysicsBenchmarkTests_h
@@ -0,0 +1,238 @@
+//
+//  main.cpp
+//  tools/audio-mixer-bench/src
+//
+//  Created by High Fidelity on 9/1/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+//  Offline benchmark of the audio mixer's hot loop: spatializing N sources for
+//  M listeners through AudioHRTF, per network frame, without sockets or codecs.
+//
+//  Source audio and positions come either from a captured trace (--trace) or
+//  from a synthetic generator, so mixer changes can be profiled and compared
+//  on the same input, offline.
+//
+//  Trace format (little-endian):
+//      char[4]  magic "HFAT"
+//      uint32   version (1)
+//      uint32   numSources
+//      then, per network frame, per source:
+//          float[3] position
+//          int16[240] mono samples
+//
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QtDebug>
+
+#include <AudioConstants.h>
+#include <AudioHRTF.h>
+
+static const int HRTF_DATASET_INDEX = 1;
+static const char TRACE_MAGIC[4] = { 'H', 'F', 'A', 'T' };
+static const uint32_t TRACE_VERSION = 1;
+
+struct SourceFrame {
+    float position[3];
+    int16_t samples[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+};
+
+// deterministic xorshift, so synthetic runs are reproducible
+static uint32_t rand32() {
+    static uint32_t state = 0x12345678;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static float randFloat() {
+    return (rand32() >> 8) * (1.0f / (1 << 24));
+}
+
+// synthesize one frame of a wandering sine source
+static void synthesizeFrame(SourceFrame& frame, int source, unsigned int frameIndex) {
+    const float ROOM_RADIUS = 32.0f;
+    const float WANDER = 0.01f;
+
+    if (frameIndex == 0) {
+        frame.position[0] = (2.0f * randFloat() - 1.0f) * ROOM_RADIUS;
+        frame.position[1] = 0.0f;
+        frame.position[2] = (2.0f * randFloat() - 1.0f) * ROOM_RADIUS;
+    } else {
+        frame.position[0] += (2.0f * randFloat() - 1.0f) * WANDER;
+        frame.position[2] += (2.0f * randFloat() - 1.0f) * WANDER;
+    }
+
+    float frequency = 110.0f * (1 + (source % 16));
+    float phaseStep = 2.0f * (float)M_PI * frequency / AudioConstants::SAMPLE_RATE;
+    float phase = phaseStep * frameIndex * AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+
+    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+        frame.samples[i] = (int16_t)(8192.0f * sinf(phase + phaseStep * i));
+    }
+}
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Offline audio-mixer benchmark: replays captured or synthetic source traces\n"
+                                     "through the HRTF mixing loop and reports per-frame timings.");
+    parser.addHelpOption();
+
+    QCommandLineOption listenersOption("listeners", "number of listeners to mix for (default 50)", "N", "50");
+    QCommandLineOption sourcesOption("sources", "number of sources (ignored when --trace is given, default 50)", "N", "50");
+    QCommandLineOption framesOption("frames", "number of network frames to mix (default 1000)", "N", "1000");
+    QCommandLineOption traceOption("trace", "captured packet trace to replay", "file");
+    QCommandLineOption unbatchedOption("unbatched", "render each source individually instead of using renderBatch");
+    parser.addOption(listenersOption);
+    parser.addOption(sourcesOption);
+    parser.addOption(framesOption);
+    parser.addOption(traceOption);
+    parser.addOption(unbatchedOption);
+    parser.process(app);
+
+    int numListeners = parser.value(listenersOption).toInt();
+    int numSources = parser.value(sourcesOption).toInt();
+    unsigned int numFrames = parser.value(framesOption).toUInt();
+    bool batched = !parser.isSet(unbatchedOption);
+
+    QFile traceFile(parser.value(traceOption));
+    bool replaying = !parser.value(traceOption).isEmpty();
+    if (replaying) {
+        if (!traceFile.open(QIODevice::ReadOnly)) {
+            qCritical() << "cannot open trace" << traceFile.fileName();
+            return 1;
+        }
+
+        char magic[4];
+        uint32_t version = 0, traceSources = 0;
+        if (traceFile.read(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, TRACE_MAGIC, sizeof(magic)) != 0 ||
+            traceFile.read((char*)&version, sizeof(version)) != sizeof(version) || version != TRACE_VERSION ||
+            traceFile.read((char*)&traceSources, sizeof(traceSources)) != sizeof(traceSources)) {
+            qCritical() << "not an audio trace:" << traceFile.fileName();
+            return 1;
+        }
+        numSources = (int)traceSources;
+    }
+
+    qInfo() << "mixing" << numSources << "sources for" << numListeners << "listeners over" << numFrames << "frames"
+            << (replaying ? "(replayed)" : "(synthetic)") << (batched ? "(batched)" : "(unbatched)");
+
+    // per listener/source pair HRTF state, as in AudioMixerClientData
+    std::vector<std::unique_ptr<AudioHRTF>> hrtfs;
+    hrtfs.reserve(numListeners * numSources);
+    for (int i = 0; i < numListeners * numSources; i++) {
+        hrtfs.emplace_back(new AudioHRTF);
+    }
+
+    // fixed listener positions on a circle
+    std::vector<float> listenerX(numListeners), listenerZ(numListeners);
+    for (int i = 0; i < numListeners; i++) {
+        float angle = 2.0f * (float)M_PI * i / numListeners;
+        listenerX[i] = 8.0f * cosf(angle);
+        listenerZ[i] = 8.0f * sinf(angle);
+    }
+
+    std::vector<SourceFrame> sources(numSources);
+    std::vector<AudioHRTF::BatchedSource> batch;
+    batch.reserve(numSources);
+    float mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+
+    std::vector<double> frameTimes;
+    frameTimes.reserve(numFrames);
+
+    for (unsigned int frame = 0; frame < numFrames; frame++) {
+
+        // pull the next frame of every source
+        for (int s = 0; s < numSources; s++) {
+            if (replaying) {
+                if (traceFile.read((char*)&sources[s], sizeof(SourceFrame)) != sizeof(SourceFrame)) {
+                    qInfo() << "trace exhausted after" << frame << "frames";
+                    numFrames = frame;
+                    break;
+                }
+            } else {
+                synthesizeFrame(sources[s], s, frame);
+            }
+        }
+        if (frame == numFrames) {
+            break;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (int l = 0; l < numListeners; l++) {
+            memset(mixSamples, 0, sizeof(mixSamples));
+            batch.clear();
+
+            for (int s = 0; s < numSources; s++) {
+                float dx = sources[s].position[0] - listenerX[l];
+                float dz = sources[s].position[2] - listenerZ[l];
+                float distance = std::max(sqrtf(dx * dx + dz * dz), 0.001f);
+                float azimuth = atan2f(dx, -dz);
+                float gain = std::min(ATTN_DISTANCE_REF / distance, 1.0f);
+
+                AudioHRTF* hrtf = hrtfs[l * numSources + s].get();
+                if (batched) {
+                    batch.push_back({ hrtf, sources[s].samples, azimuth, distance, gain });
+                } else {
+                    hrtf->render(sources[s].samples, mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
+                                 AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+                }
+            }
+
+            if (batched) {
+                AudioHRTF::renderBatch(batch.data(), (int)batch.size(), mixSamples, HRTF_DATASET_INDEX,
+                                       AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            }
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        frameTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    if (frameTimes.empty()) {
+        qCritical() << "nothing mixed";
+        return 1;
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    double total = 0.0;
+    for (double t : frameTimes) {
+        total += t;
+    }
+    auto percentile = [&](double p) { return frameTimes[(size_t)(p * (frameTimes.size() - 1))]; };
+
+    double budget = 1e6 * AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL / AudioConstants::SAMPLE_RATE;
+
+    qInfo() << "frames:" << (int)frameTimes.size()
+            << "renders/frame:" << numListeners * numSources;
+    qInfo() << QString("mix time (us): avg %1  p50 %2  p95 %3  p99 %4  max %5")
+                   .arg(total / frameTimes.size(), 0, 'f', 1)
+                   .arg(percentile(0.50), 0, 'f', 1)
+                   .arg(percentile(0.95), 0, 'f', 1)
+                   .arg(percentile(0.99), 0, 'f', 1)
+                   .arg(frameTimes.back(), 0, 'f', 1)
+                   .toUtf8().constData();
+    qInfo() << QString("frame budget: %1 us, avg usage %2%")
+                   .arg(budget, 0, 'f', 1)
+                   .arg(100.0 * (total / frameTimes.size()) / budget, 0, 'f', 1)
+                   .toUtf8().constData();
+
+    return 0;
+}
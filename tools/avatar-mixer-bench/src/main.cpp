@@ -0,0 +1,165 @@
+//
+//  main.cpp
+//  tools/avatar-mixer-bench/src
+//
+//  Created by High Fidelity on 9/1/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+//  Offline benchmark of the avatar mixer's broadcast hot path: a synthetic
+//  crowd of animated source avatars is serialized for every receiver each
+//  frame through AvatarData::toByteArray, with per-receiver last-sent joint
+//  state, exactly as AvatarMixerSlave does - and optionally parsed back,
+//  exercising the receive path too.
+//
+
+#include <math.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QtDebug>
+
+#include <AvatarData.h>
+
+static const int SYNTHETIC_JOINT_COUNT = 72;
+
+// deterministic xorshift, so runs are reproducible
+static uint32_t rand32() {
+    static uint32_t state = 0x2545F491;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static float randFloat() {
+    return (rand32() >> 8) * (1.0f / (1 << 24));
+}
+
+// animate one source avatar: wander the position, wiggle a subset of joints
+static void animateAvatar(AvatarData& avatar, unsigned int frame) {
+    glm::vec3 position = avatar.getWorldPosition();
+    position.x += 0.01f * (2.0f * randFloat() - 1.0f);
+    position.z += 0.01f * (2.0f * randFloat() - 1.0f);
+    avatar.setWorldPosition(position);
+
+    // a typical animated frame changes a fraction of the joints beyond the cull threshold
+    for (int j = 0; j < SYNTHETIC_JOINT_COUNT; j += 3) {
+        float angle = 0.3f * sinf(0.1f * frame + j);
+        avatar.setJointData(j, glm::angleAxis(angle, glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(0.0f));
+    }
+}
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Avatar mixer benchmark: serializes a synthetic animated crowd for every\n"
+                                     "receiver each frame, mirroring the AvatarMixerSlave broadcast loop.");
+    parser.addHelpOption();
+
+    QCommandLineOption avatarsOption("avatars", "number of source avatars (default 100)", "N", "100");
+    QCommandLineOption receiversOption("receivers", "number of receivers (default 100)", "N", "100");
+    QCommandLineOption framesOption("frames", "number of broadcast frames (default 200)", "N", "200");
+    QCommandLineOption parseOption("parse", "also parse the serialized data (receive path)");
+    parser.addOption(avatarsOption);
+    parser.addOption(receiversOption);
+    parser.addOption(framesOption);
+    parser.addOption(parseOption);
+    parser.process(app);
+
+    int numAvatars = parser.value(avatarsOption).toInt();
+    int numReceivers = parser.value(receiversOption).toInt();
+    unsigned int numFrames = parser.value(framesOption).toUInt();
+    bool alsoParse = parser.isSet(parseOption);
+
+    qInfo() << "serializing" << numAvatars << "avatars for" << numReceivers << "receivers over" << numFrames
+            << "frames" << (alsoParse ? "(with parse)" : "");
+
+    // synthetic crowd
+    std::vector<std::unique_ptr<AvatarData>> sourceAvatars;
+    for (int i = 0; i < numAvatars; i++) {
+        auto avatar = std::unique_ptr<AvatarData>(new AvatarData());
+        avatar->setSessionUUID(QUuid::createUuid());
+        avatar->setWorldPosition(glm::vec3(32.0f * (2.0f * randFloat() - 1.0f), 0.0f,
+                                           32.0f * (2.0f * randFloat() - 1.0f)));
+        for (int j = 0; j < SYNTHETIC_JOINT_COUNT; j++) {
+            avatar->setJointData(j, glm::quat(), glm::vec3(0.0f));
+        }
+        sourceAvatars.push_back(std::move(avatar));
+    }
+
+    // per receiver/source last-sent joint state, as the mixer keeps per pair
+    std::vector<std::vector<QVector<JointData>>> lastSentJoints(numReceivers);
+    for (auto& perReceiver : lastSentJoints) {
+        perReceiver.resize(numAvatars);
+    }
+
+    // receive-side avatars, when parsing
+    std::vector<std::unique_ptr<AvatarData>> parsedAvatars;
+    if (alsoParse) {
+        for (int i = 0; i < numAvatars; i++) {
+            parsedAvatars.emplace_back(new AvatarData());
+        }
+    }
+
+    std::vector<double> frameTimes;
+    frameTimes.reserve(numFrames);
+    uint64_t totalBytes = 0;
+
+    for (unsigned int frame = 0; frame < numFrames; frame++) {
+
+        for (auto& avatar : sourceAvatars) {
+            animateAvatar(*avatar, frame);
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (int r = 0; r < numReceivers; r++) {
+            glm::vec3 receiverPosition(8.0f * cosf(r), 0.0f, 8.0f * sinf(r));
+
+            for (int a = 0; a < numAvatars; a++) {
+                AvatarDataPacket::SendStatus sendStatus;
+                sendStatus.sendUUID = true;
+
+                QByteArray bytes = sourceAvatars[a]->toByteArray(AvatarData::CullSmallData, 0,
+                    lastSentJoints[r][a], sendStatus, false, true, receiverPosition, &lastSentJoints[r][a]);
+                totalBytes += bytes.size();
+
+                if (alsoParse && r == 0) {
+                    // strip the UUID, as the mixer's bulk packet reader does
+                    parsedAvatars[a]->parseDataFromBuffer(bytes.mid(NUM_BYTES_RFC4122_UUID));
+                }
+            }
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        frameTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    double total = 0.0;
+    for (double t : frameTimes) {
+        total += t;
+    }
+    auto percentile = [&](double p) { return frameTimes[(size_t)(p * (frameTimes.size() - 1))]; };
+
+    qInfo() << "serializations/frame:" << numAvatars * numReceivers
+            << "avg bytes/avatar:" << (double)totalBytes / ((double)numFrames * numAvatars * numReceivers);
+    qInfo() << QString("frame time (ms): avg %1  p50 %2  p95 %3  p99 %4  max %5")
+                   .arg(total / frameTimes.size(), 0, 'f', 2)
+                   .arg(percentile(0.50), 0, 'f', 2)
+                   .arg(percentile(0.95), 0, 'f', 2)
+                   .arg(percentile(0.99), 0, 'f', 2)
+                   .arg(frameTimes.back(), 0, 'f', 2)
+                   .toUtf8().constData();
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+#
+#  compare_frame_benchmarks.py
+#  tools/gpu-frame-player
+#
+#  Created by High Fidelity on 9/2/26.
+#  Copyright 2026 High Fidelity, Inc.
+#
+#  Distributed under the Apache License, Version 2.0.
+#  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+#
+# Diffs two JSON results from `gpu-frame-player --benchmark frame.hfb -o results.json` run on
+# different builds, reporting per-pass mean GPU time deltas and failing when the whole-frame
+# mean regressed beyond the threshold.
+
+import argparse
+import json
+import sys
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two gpu-frame-player benchmark results.')
+    parser.add_argument('before')
+    parser.add_argument('after')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='allowed whole-frame regression in percent (default 5)')
+    args = parser.parse_args()
+
+    with open(args.before) as f:
+        before = json.load(f)
+    with open(args.after) as f:
+        after = json.load(f)
+
+    print('{:<48} {:>10} {:>10} {:>9}'.format('pass', 'before ms', 'after ms', 'delta'))
+    passes = sorted(set(before.get('passes', {})) | set(after.get('passes', {})))
+    for name in passes:
+        b = before.get('passes', {}).get(name, {}).get('meanMsecs')
+        a = after.get('passes', {}).get(name, {}).get('meanMsecs')
+        if b is None or a is None:
+            print('{:<48} {:>10} {:>10} {:>9}'.format(name, b if b is not None else '-',
+                                                      a if a is not None else '-', 'n/a'))
+            continue
+        delta = (a - b) / b * 100.0 if b else 0.0
+        print('{:<48} {:>10.3f} {:>10.3f} {:>+8.1f}%'.format(name, b, a, delta))
+
+    frameBefore = before['frame']['meanMsecs']
+    frameAfter = after['frame']['meanMsecs']
+    frameDelta = (frameAfter - frameBefore) / frameBefore * 100.0 if frameBefore else 0.0
+    print('\n{:<48} {:>10.3f} {:>10.3f} {:>+8.1f}%'.format('whole frame', frameBefore, frameAfter, frameDelta))
+
+    if frameDelta > args.threshold:
+        print('\nFAIL: whole-frame GPU time regressed {:.1f}% (> {}%)'.format(frameDelta, args.threshold))
+        return 1
+    print('\nOK')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -38,6 +38,11 @@ PlayerWindow::PlayerWindow() {
 PlayerWindow::~PlayerWindow() {
 }
 
+void PlayerWindow::runBenchmark(const QString& framePath, int iterations, const QString& outputPath) {
+    _renderThread.startBenchmark(iterations, outputPath);
+    loadFrame(framePath);
+}
+
 bool PlayerWindow::eventFilter(QObject* obj, QEvent* event)  {
     if (event->type() == QEvent::Close) {
         _renderThread.terminate();
@@ -20,6 +20,9 @@ public:
     PlayerWindow();
     virtual ~PlayerWindow();
 
+    // loads the given frame and runs the headless benchmark instead of interactive playback
+    void runBenchmark(const QString& framePath, int iterations, const QString& outputPath);
+
 protected:
     bool eventFilter(QObject* obj, QEvent* event) override;
     void keyPressEvent(QKeyEvent* event) override;
@@ -7,6 +7,12 @@
 //
 
 #include "RenderThread.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
 #include <QtGui/QWindow>
 #include <gl/QOpenGLContextWrapper.h>
 
@@ -171,7 +177,11 @@ void RenderThread::renderFrame(gpu::FramePointer& frame) {
 
     //_gpuContext->enableStereo(true);
     if (frame && !frame->batches.empty()) {
-        _gpuContext->executeFrame(frame);
+        if (_benchmark) {
+            runBenchmarkIteration(frame);
+        } else {
+            _gpuContext->executeFrame(frame);
+        }
     }
 
 #ifdef USE_GL
@@ -314,3 +324,76 @@ void RenderThread::setupRenderPass() {
     _renderPass = _device.createRenderPass(renderPassInfo);
 }
 #endif
+
+void RenderThread::startBenchmark(int iterations, const QString& outputPath) {
+    _benchmark.reset(new BenchmarkState());
+    _benchmark->iterationsRemaining = iterations;
+    _benchmark->totalIterations = iterations;
+    _benchmark->outputPath = outputPath;
+}
+
+void RenderThread::runBenchmarkIteration(gpu::FramePointer& frame) {
+#ifdef USE_GL
+    GLuint timerQuery { 0 };
+    glGenQueries(1, &timerQuery);
+
+    double frameTotal = 0.0;
+    for (const auto& batch : frame->batches) {
+        glBeginQuery(GL_TIME_ELAPSED, timerQuery);
+        _gpuContext->executeBatch(*batch);
+        glEndQuery(GL_TIME_ELAPSED);
+
+        // synchronous result fetch; a benchmark wants exact per-pass numbers, not pipelining
+        GLuint64 elapsedNsecs = 0;
+        glGetQueryObjectui64v(timerQuery, GL_QUERY_RESULT, &elapsedNsecs);
+        double elapsedMsecs = (double)elapsedNsecs / 1.0e6;
+        _benchmark->passTimings[batch->getName()].push_back(elapsedMsecs);
+        frameTotal += elapsedMsecs;
+    }
+    glDeleteQueries(1, &timerQuery);
+
+    _benchmark->frameTimings.push_back(frameTotal);
+    if (--_benchmark->iterationsRemaining <= 0) {
+        finishBenchmark();
+    }
+#endif
+}
+
+static QJsonObject benchmarkStats(const std::vector<double>& samples) {
+    double total = 0.0, minimum = samples.empty() ? 0.0 : samples.front(), maximum = 0.0;
+    for (double sample : samples) {
+        total += sample;
+        minimum = std::min(minimum, sample);
+        maximum = std::max(maximum, sample);
+    }
+    QJsonObject stats;
+    stats["meanMsecs"] = samples.empty() ? 0.0 : total / (double)samples.size();
+    stats["minMsecs"] = minimum;
+    stats["maxMsecs"] = maximum;
+    return stats;
+}
+
+void RenderThread::finishBenchmark() {
+    QJsonObject result;
+    result["iterations"] = _benchmark->totalIterations;
+    result["frame"] = benchmarkStats(_benchmark->frameTimings);
+
+    QJsonObject passes;
+    for (const auto& entry : _benchmark->passTimings) {
+        auto name = entry.first.empty() ? std::string("(unnamed)") : entry.first;
+        passes[QString::fromStdString(name)] = benchmarkStats(entry.second);
+    }
+    result["passes"] = passes;
+
+    auto json = QJsonDocument(result).toJson();
+    if (!_benchmark->outputPath.isEmpty()) {
+        QFile outputFile { _benchmark->outputPath };
+        if (outputFile.open(QIODevice::WriteOnly)) {
+            outputFile.write(json);
+        }
+    }
+    printf("%s\n", json.constData());
+
+    _benchmark.reset();
+    QMetaObject::invokeMethod(qApp, "quit", Qt::QueuedConnection);
+}
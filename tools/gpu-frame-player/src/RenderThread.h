@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <vector>
 #include <QtCore/QElapsedTimer>
 
 #include <GenericThread.h>
@@ -67,4 +70,18 @@ public:
     void submitFrame(const gpu::FramePointer& frame);
     void initialize(QWindow* window);
     void renderFrame(gpu::FramePointer& frame);
+
+    // Headless benchmark mode: replays the loaded frame for a fixed number of iterations with a
+    // GPU timer query around every batch, then writes per-pass statistics as JSON and exits.
+    struct BenchmarkState {
+        int iterationsRemaining { 0 };
+        int totalIterations { 0 };
+        QString outputPath;
+        std::map<std::string, std::vector<double>> passTimings; // batch name -> per-iteration msecs
+        std::vector<double> frameTimings;
+    };
+    std::unique_ptr<BenchmarkState> _benchmark;
+    void startBenchmark(int iterations, const QString& outputPath);
+    void runBenchmarkIteration(gpu::FramePointer& frame);
+    void finishBenchmark();
 };
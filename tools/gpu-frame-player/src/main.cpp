@@ -6,6 +6,7 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <QtCore/QCommandLineParser>
 #include <QtWidgets/QApplication>
 
 #include <shared/FileLogger.h>
@@ -28,7 +29,24 @@ int main(int argc, char** argv) {
     QApplication app(argc, argv);
     logger.reset(new FileLogger());
     setup();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("GPU frame player / headless replay benchmark");
+    parser.addHelpOption();
+    QCommandLineOption benchmarkOption({ "b", "benchmark" },
+        "Replay the given captured frame headless and report per-pass GPU timings as JSON.", "frame.hfb");
+    QCommandLineOption iterationsOption({ "n", "iterations" }, "Benchmark iterations (default 100).", "count", "100");
+    QCommandLineOption outputOption({ "o", "output" }, "Write benchmark JSON to this file.", "results.json");
+    parser.addOption(benchmarkOption);
+    parser.addOption(iterationsOption);
+    parser.addOption(outputOption);
+    parser.process(app);
+
     PlayerWindow window;
+    if (parser.isSet(benchmarkOption)) {
+        window.runBenchmark(parser.value(benchmarkOption), parser.value(iterationsOption).toInt(),
+                            parser.value(outputOption));
+    }
     app.exec();
     return 0;
 }
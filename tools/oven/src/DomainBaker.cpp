@@ -17,6 +17,10 @@
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonObject>
 
+#include <QtCore/QStandardPaths>
+
+#include <BakeCache.h>
+
 #include "Gzip.h"
 #include "Oven.h"
 #include "baking/BakerLibrary.h"
@@ -38,6 +42,16 @@ DomainBaker::DomainBaker(const QUrl& localModelFileURL, const QString& domainNam
 }
 
 void DomainBaker::bake() {
+    // domain bakes re-run over mostly unchanged content, so turn on the persistent bake cache;
+    // HIFI_BAKE_CACHE_DIR overrides the location, HIFI_DISABLE_BAKE_CACHE=1 turns it off
+    if (qEnvironmentVariableIntValue("HIFI_DISABLE_BAKE_CACHE") == 0) {
+        auto cacheDirectory = qEnvironmentVariable("HIFI_BAKE_CACHE_DIR");
+        if (cacheDirectory.isEmpty()) {
+            cacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/bake-cache";
+        }
+        BakeCache::instance().setCacheDirectory(cacheDirectory);
+    }
+
     setupOutputFolder();
 
     if (hasErrors()) {
@@ -0,0 +1,219 @@
+//
+//  main.cpp
+//  tools/udt-sim/src
+//
+//  Created by High Fidelity on 9/2/26.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+//  Deterministic congestion-control simulation harness.
+//
+//  Drives a congestion controller (TCPVegasCC or BBRCC) against a simulated
+//  bottleneck link - fixed rate, propagation delay, bounded queue, seeded
+//  random loss - on a virtual clock, so controller changes can be evaluated
+//  and compared reproducibly, with no sockets and no wall-clock jitter.
+//
+
+#include <inttypes.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QtDebug>
+
+#include <udt/BBRCC.h>
+#include <udt/TCPVegasCC.h>
+
+using namespace udt;
+
+// expose the pacing outputs of a congestion controller to the harness
+template <class CC>
+class SimulatedCC : public CC {
+public:
+    double getSendPeriod() const { return this->_packetSendPeriod; }
+    int getWindow() const { return this->_congestionWindowSize; }
+    void setup(int mss, SequenceNumber initial) {
+        this->setMSS(mss);
+        this->setInitialSendSequenceNumber(initial);
+    }
+    void packetSent(int size, SequenceNumber seq, p_high_resolution_clock::time_point when) {
+        this->setSendCurrentSequenceNumber(seq);
+        this->onPacketSent(size, seq, when);
+    }
+};
+
+// deterministic xorshift
+static uint32_t randState = 1;
+static uint32_t rand32() {
+    randState ^= randState << 13;
+    randState ^= randState >> 17;
+    randState ^= randState << 5;
+    return randState;
+}
+static double randUnit() {
+    return (rand32() >> 8) * (1.0 / (1 << 24));
+}
+
+static p_high_resolution_clock::time_point simTimePoint(int64_t usecs) {
+    return p_high_resolution_clock::time_point(std::chrono::microseconds(usecs));
+}
+
+struct InFlightPacket {
+    SequenceNumber sequenceNumber;
+    int64_t arrivalTime;    // at the receiver, in sim usecs
+    bool lost;
+};
+
+template <class CC>
+static void runSimulation(const QString& name, int64_t durationUsecs, double bottleneckMbps,
+                          int64_t propagationDelayUsecs, int queuePackets, double lossRate) {
+    const int MSS = 1400;
+    const double BYTES_PER_USEC = bottleneckMbps * 1e6 / 8.0 / 1e6;
+    const int64_t SERIALIZATION_USECS = (int64_t)(MSS / BYTES_PER_USEC);
+
+    SimulatedCC<CC> cc;
+    cc.setup(MSS, SequenceNumber(0));
+
+    int64_t now = 0;
+    int64_t nextSendTime = 0;
+    int64_t queueFreeTime = 0;              // when the bottleneck queue drains
+    SequenceNumber nextSequenceNumber(1);
+    SequenceNumber lastAcked(0);
+
+    std::deque<InFlightPacket> inFlight;    // ordered by arrival time
+
+    int64_t packetsSent = 0;
+    int64_t packetsLost = 0;
+    int64_t packetsAcked = 0;
+    double queueDelaySum = 0.0;
+
+    while (now < durationUsecs) {
+        // deliver (or drop) everything that has arrived by now, acking in order
+        while (!inFlight.empty() && inFlight.front().arrivalTime <= now) {
+            InFlightPacket packet = inFlight.front();
+            inFlight.pop_front();
+
+            if (packet.lost) {
+                ++packetsLost;
+                continue;
+            }
+
+            // the receiver acks cumulatively on arrival
+            if (packet.sequenceNumber > lastAcked) {
+                lastAcked = packet.sequenceNumber;
+            }
+            ++packetsAcked;
+
+            // the ACK takes one propagation delay to come back
+            cc.onACK(lastAcked, simTimePoint(packet.arrivalTime + propagationDelayUsecs));
+        }
+
+        // send when pacing and the congestion window allow
+        int inFlightCount = (int)(nextSequenceNumber - lastAcked) - 1;
+        if (now >= nextSendTime && inFlightCount < cc.getWindow()) {
+            SequenceNumber sequenceNumber = nextSequenceNumber++;
+            cc.packetSent(MSS, sequenceNumber, simTimePoint(now));
+            ++packetsSent;
+
+            // the packet serializes onto the bottleneck once the queue ahead drains
+            int64_t startService = std::max(now, queueFreeTime);
+            int64_t queuedPackets = (startService - now) / std::max(SERIALIZATION_USECS, (int64_t)1);
+            bool dropped = queuedPackets >= queuePackets || randUnit() < lossRate;
+
+            if (!dropped) {
+                queueFreeTime = startService + SERIALIZATION_USECS;
+                queueDelaySum += (double)(startService - now);
+
+                InFlightPacket packet;
+                packet.sequenceNumber = sequenceNumber;
+                packet.arrivalTime = queueFreeTime + propagationDelayUsecs;
+                packet.lost = false;
+                inFlight.push_back(packet);
+            } else {
+                // drops are modeled at the sender-side queue; account them at delivery
+                InFlightPacket packet;
+                packet.sequenceNumber = sequenceNumber;
+                packet.arrivalTime = now + propagationDelayUsecs;
+                packet.lost = true;
+                inFlight.push_back(packet);
+            }
+
+            nextSendTime = now + std::max((int64_t)cc.getSendPeriod(), (int64_t)1);
+        }
+
+        // advance the virtual clock to the next interesting event
+        int64_t next = std::min(nextSendTime, durationUsecs);
+        if (!inFlight.empty()) {
+            next = std::min(next, inFlight.front().arrivalTime);
+        }
+        now = std::max(next, now + 1);
+    }
+
+    double seconds = durationUsecs / 1e6;
+    double achievedMbps = packetsAcked * MSS * 8.0 / durationUsecs;     // bits per usec == Mbps
+    qInfo() << "---" << name << "---";
+    qInfo() << QString("sent %1  acked %2  lost %3 (%4%)")
+                   .arg(packetsSent).arg(packetsAcked).arg(packetsLost)
+                   .arg(packetsSent ? 100.0 * packetsLost / packetsSent : 0.0, 0, 'f', 2)
+                   .toUtf8().constData();
+    qInfo() << QString("goodput %1 Mbps of %2 Mbps bottleneck (%3%), avg queue delay %4 us, %5 pps")
+                   .arg(achievedMbps, 0, 'f', 2)
+                   .arg(bottleneckMbps, 0, 'f', 2)
+                   .arg(100.0 * achievedMbps / bottleneckMbps, 0, 'f', 1)
+                   .arg(packetsSent ? queueDelaySum / packetsSent : 0.0, 0, 'f', 1)
+                   .arg((double)packetsSent / seconds, 0, 'f', 0)
+                   .toUtf8().constData();
+}
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Deterministic congestion-control simulation: runs a controller against a\n"
+                                     "simulated bottleneck (rate, delay, queue, seeded loss) on a virtual clock.");
+    parser.addHelpOption();
+
+    QCommandLineOption ccOption("cc", "congestion controller: vegas, bbr or both (default both)", "name", "both");
+    QCommandLineOption rateOption("rate", "bottleneck rate in Mbps (default 10)", "Mbps", "10");
+    QCommandLineOption delayOption("delay", "one-way propagation delay in ms (default 20)", "ms", "20");
+    QCommandLineOption queueOption("queue", "bottleneck queue depth in packets (default 64)", "packets", "64");
+    QCommandLineOption lossOption("loss", "random loss rate, 0..1 (default 0)", "rate", "0");
+    QCommandLineOption durationOption("duration", "simulated seconds (default 30)", "seconds", "30");
+    QCommandLineOption seedOption("seed", "RNG seed (default 1)", "seed", "1");
+    parser.addOption(ccOption);
+    parser.addOption(rateOption);
+    parser.addOption(delayOption);
+    parser.addOption(queueOption);
+    parser.addOption(lossOption);
+    parser.addOption(durationOption);
+    parser.addOption(seedOption);
+    parser.process(app);
+
+    QString cc = parser.value(ccOption).toLower();
+    double rate = parser.value(rateOption).toDouble();
+    int64_t delay = (int64_t)(parser.value(delayOption).toDouble() * 1000);
+    int queue = parser.value(queueOption).toInt();
+    double loss = parser.value(lossOption).toDouble();
+    int64_t duration = (int64_t)(parser.value(durationOption).toDouble() * 1e6);
+
+    qInfo() << QString("link: %1 Mbps, %2 ms one-way, queue %3 pkts, loss %4, %5 s simulated, seed %6")
+                   .arg(rate).arg(delay / 1000.0).arg(queue).arg(loss)
+                   .arg(duration / 1e6).arg(parser.value(seedOption))
+                   .toUtf8().constData();
+
+    if (cc == "vegas" || cc == "both") {
+        randState = parser.value(seedOption).toUInt();
+        runSimulation<TCPVegasCC>("TCPVegasCC", duration, rate, delay, queue, loss);
+    }
+    if (cc == "bbr" || cc == "both") {
+        randState = parser.value(seedOption).toUInt();
+        runSimulation<BBRCC>("BBRCC", duration, rate, delay, queue, loss);
+    }
+
+    return 0;
+}